@@ -7,13 +7,43 @@
 
 #include <immintrin.h>
 
-// To work with 8 chunk integers (256 bits) we internally need 17 chunk integers.
-// The reason is that intermediate products can be 16 chunks and division performs
-// a scaling that may require an additional chunk.
+/*
+ * Limb width
+ *
+ * By default, chunks hold 32 bits and are stored in 64-bit words, which leaves
+ * room for lazy carries (cf. big_int_add_optimal_bound) and lets the AVX2
+ * kernels multiply chunks with _mm256_mul_epu32. Curve1174 and Elligator rely
+ * on this layout.
+ *
+ * Compiling with -DBIGINT_LIMB_64 switches to full 64-bit chunks with
+ * unsigned __int128 intermediates. This halves the number of chunks and thus
+ * the loop trip counts of the generic operations. The API stays the same, but
+ * the 32-bit specialized kernels (e.g., big_int_mul_256) fall back to the
+ * generic code. Only the BigInt library itself supports this mode.
+ */
+#ifdef BIGINT_LIMB_64
+typedef uint64_t chunk_size_t;
+typedef unsigned __int128 dbl_chunk_size_t;
+#else
+typedef uint32_t chunk_size_t;
+typedef uint64_t dbl_chunk_size_t;
+#endif
+
+// Type of the chunks array, always 64-bit words
+typedef uint64_t chunk_storage_t;
+
+// To work with 256-bit integers, we internally need 2 * BIGINT_FIXED_SIZE + 1
+// chunks. The reason is that intermediate products can be twice as large and
+// division performs a scaling that may require an additional chunk.
+#ifdef BIGINT_LIMB_64
+#define BIGINT_FIXED_SIZE ((uint32_t) 4)
+#define BIGINT_FIXED_SIZE_INTERNAL ((uint32_t) 9)
+#else
 #define BIGINT_FIXED_SIZE ((uint32_t) 8)
 #define BIGINT_FIXED_SIZE_INTERNAL ((uint32_t) 17)
+#endif
 #define BIGINT_METADATA_SIZE ((uint32_t) 2 * sizeof(uint32_t))
-#define BIGINT_INTERNAL_CHUNK_BYTE ((uint32_t) sizeof(dbl_chunk_size_t))
+#define BIGINT_INTERNAL_CHUNK_BYTE ((uint32_t) sizeof(chunk_storage_t))
 #define BIGINT_CHUNK_BYTE_SIZE ((uint32_t) sizeof(chunk_size_t))
 #define BIGINT_CHUNK_HEX_SIZE ((uint32_t) sizeof(chunk_size_t) * 2)
 #define BIGINT_CHUNK_BIT_SIZE ((uint32_t) sizeof(chunk_size_t) * 8)
@@ -22,10 +52,8 @@
 #define BIGINT_CHUNK_MASK (BIGINT_RADIX - 1)
 
 // Change if larger chunks are used
-#define STR_TO_CHUNK strtol
-#define CHUNK_ABS llabs
+#define STR_TO_CHUNK strtoull
 #define BIGINT_RADIX (((dbl_chunk_size_t) 1) << BIGINT_CHUNK_BIT_SIZE)
-#define BIGINT_RADIX_SIGNED ((int64_t) BIGINT_RADIX)
 #define BIGINT_RADIX_FOR_MOD (BIGINT_RADIX - 1)
 #define BIGINT_RADIX_FOR_MOD_128 ((unsigned __int128) (BIGINT_RADIX - 1))
 
@@ -36,9 +64,6 @@
 #define ADD_STAT_COLLECTION(type)
 #endif
 
-typedef uint32_t chunk_size_t;
-typedef uint64_t dbl_chunk_size_t;
-
 /**
  * \brief Internal data structure for BigInts.
  *        Stores integer a_n * (2^64)^n + a_(n-1) * (2^64)^(n-1) + a_0
@@ -58,9 +83,20 @@ typedef struct __attribute__((packed, aligned(8))) BigInt
     uint32_t overflow : 1;      // 1 if operation overflowed (only supported for add/sub)
     uint32_t size : 30;         // Number of chunks used in the BigInt
     uint32_t pad;               // XXX: remove when switching to chunks of 32 bits
-    dbl_chunk_size_t chunks[BIGINT_FIXED_SIZE_INTERNAL];// Chunks of size chunk_size_t in reverse order
+    chunk_storage_t chunks[BIGINT_FIXED_SIZE_INTERNAL];// Chunks of size chunk_size_t in reverse order
 } BigInt;
 
+/**
+ * Compact storage for a non-negative BigInt below 2^256, e.g., for large arrays
+ * of field elements. Only the chunks are stored, without metadata or the
+ * internal headroom, i.e., 32 instead of 144 bytes. Convert with big_int_pack
+ * and big_int_unpack before doing arithmetic.
+ */
+typedef struct BigInt256Packed
+{
+    chunk_size_t chunks[BIGINT_FIXED_SIZE];
+} BigInt256Packed;
+
 /**
  * Struct for the results of g := gcd(a, b) = xa + yb
  */
@@ -70,10 +106,78 @@ typedef struct EgcdResult {
     BigInt x;
 } EgcdResult;
 
+// Largest window of the sliding-window exponentiation, the table holds the odd
+// powers b, b^3, ..., b^(2^w - 1)
+#define BIGINT_POW_MAX_WINDOW 6
+#define BIGINT_POW_TABLE_SIZE (1 << (BIGINT_POW_MAX_WINDOW - 1))
+
+// Maximum number of 64-bit limbs of a Montgomery modulus
+#define BIGINT_MONT_LIMBS 4
+
+/**
+ * Precomputed constants for Montgomery arithmetic modulo an odd q < 2^256.
+ * With n = nr_limbs, we use R = 2^(64 * n). Independent of the chunk size,
+ * the Montgomery kernels work on 64-bit limbs with 128-bit intermediates.
+ * Initialize with big_int_mont_ctx_init.
+ */
+typedef struct BigIntMontCtx
+{
+    uint64_t q[BIGINT_MONT_LIMBS];      // q in 64-bit limbs
+    uint64_t r2[BIGINT_MONT_LIMBS];     // R^2 mod q
+    uint64_t one[BIGINT_MONT_LIMBS];    // R mod q, i.e., 1 in Montgomery form
+    uint64_t q_inv;                     // -q^-1 mod 2^64
+    uint64_t nr_limbs;                  // Number of 64-bit limbs of q
+    BigInt q_big;                       // q as BigInt, for reductions
+} BigIntMontCtx;
+
+/**
+ * Precomputed constants for Barrett reduction modulo q < 2^256. With n =
+ * nr_limbs, mu = floor(2^(128 n) / q) has n + 1 64-bit limbs. Reduces numbers
+ * below 2^(128 n), e.g., 512-bit hash outputs, without any conversion.
+ * Initialize with big_int_barrett_ctx_init.
+ */
+typedef struct BigIntBarrettCtx
+{
+    uint64_t q[BIGINT_MONT_LIMBS];      // q in 64-bit limbs
+    uint64_t mu[BIGINT_MONT_LIMBS + 1]; // floor(2^(128 n) / q)
+    uint64_t nr_limbs;                  // Number of 64-bit limbs of q
+    BigInt q_big;                       // q as BigInt, for larger inputs
+} BigIntBarrettCtx;
+
+// Number of ChaCha20 blocks computed per refill of the CSPRNG
+#define BIGINT_RNG_CHACHA_BLOCKS 4
+#define BIGINT_RNG_CHACHA_WORDS (BIGINT_RNG_CHACHA_BLOCKS * 8)
+
+/**
+ * Random number generator used by big_int_create_random and
+ * big_int_fill_random. Every thread draws from its own generator, which is a
+ * xoshiro256** seeded from the OS by default (fast, but not for secrets).
+ * big_int_rng_secure returns the thread's ChaCha20 CSPRNG for key material.
+ * Both are reseeded in child processes after fork. Generators initialized
+ * with big_int_rng_*_init are deterministic and are not. Other generators
+ * can be plugged in by setting fill and switching to them with
+ * big_int_rng_use.
+ */
+typedef struct BigIntRng
+{
+    // Write n random 64-bit words to out
+    void (*fill)(struct BigIntRng *rng, uint64_t *out, uint64_t n);
+    union
+    {
+        uint64_t xoshiro[4];
+        struct
+        {
+            uint32_t key[8];
+            uint64_t pos;                           // Next unused word of buf
+            uint64_t buf[BIGINT_RNG_CHACHA_WORDS];  // Key stream
+        } chacha;
+    } state;
+} BigIntRng;
+
 /*
 * Struct that tracks usage of BigInt functions
 */
-uint64_t big_int_stats[BIGINT_TYPE_LAST];
+extern uint64_t big_int_stats[BIGINT_TYPE_LAST];
 
 #define MULT_CHUNKS(...) __VA_ARGS__
 
@@ -138,7 +242,12 @@ BigInt *big_int_prune_leading_zeros(BigInt *r, BigInt *a);
 BigInt *big_int_create_from_dbl_chunk(BigInt *r, dbl_chunk_size_t chunk, uint8_t sign);
 BigInt *big_int_create_from_chunk(BigInt *r, chunk_size_t chunk, uint8_t sign);
 BigInt *big_int_create_from_hex(BigInt *r, char* s);
+BigInt *big_int_create_from_bytes(BigInt *r, const uint8_t *buf, uint64_t len);
+uint8_t *big_int_to_bytes(uint8_t *buf, BigInt *a, uint64_t len);
+BigInt256Packed *big_int_pack(BigInt256Packed *r, BigInt *a, uint64_t n);
+BigInt *big_int_unpack(BigInt *r, BigInt256Packed *a, uint64_t n);
 BigInt *big_int_create_random(BigInt *r, int64_t nr_of_chunks);
+BigInt *big_int_fill_random(BigInt *arr, uint64_t n, uint64_t bits);
 BigInt *big_int_copy(BigInt *a, BigInt *b);
 void big_int_print(BigInt *a);
 
@@ -180,6 +289,23 @@ int8_t big_int_is_odd(BigInt *a);
 BigInt *big_int_pow(BigInt *r, BigInt *b, BigInt *e, BigInt *q);
 EgcdResult *big_int_egcd(EgcdResult *r, BigInt *a, BigInt *b);
 BigInt *big_int_chi(BigInt *r, BigInt *t, BigInt *q);
+uint64_t big_int_bit_length(BigInt *a);
+uint64_t big_int_pow_window_size(uint64_t bits);
+uint64_t big_int_pow_window(BigInt *e, int64_t i, uint64_t w, uint64_t *len);
+
+// Montgomery arithmetic
+BigIntMontCtx *big_int_mont_ctx_init(BigIntMontCtx *ctx, BigInt *q);
+BigInt *big_int_to_mont(BigInt *r, BigInt *a, BigIntMontCtx *ctx);
+BigInt *big_int_from_mont(BigInt *r, BigInt *a, BigIntMontCtx *ctx);
+BigInt *big_int_mont_mul(BigInt *r, BigInt *a, BigInt *b, BigIntMontCtx *ctx);
+BigInt *big_int_mont_square(BigInt *r, BigInt *a, BigIntMontCtx *ctx);
+BigInt *big_int_pow_mont(BigInt *r, BigInt *b, BigInt *e, BigIntMontCtx *ctx);
+
+// Barrett reduction
+BigIntBarrettCtx *big_int_barrett_ctx_init(BigIntBarrettCtx *ctx, BigInt *q);
+BigInt *big_int_mod_barrett(BigInt *r, BigInt *a, BigIntBarrettCtx *ctx);
+BigInt *big_int_mul_mod_barrett(BigInt *r, BigInt *a, BigInt *b,
+    BigIntBarrettCtx *ctx);
 
 //New operations
 BigInt *big_int_square(BigInt *r, BigInt *a);
@@ -209,6 +335,13 @@ void big_int_mul_4_fast(BigInt *r0, BigInt *r1, BigInt *r2, BigInt *r3,
                         BigInt *a0, BigInt *a1, BigInt *a2, BigInt *a3,
                         BigInt *b0, BigInt *b1, BigInt *b2, BigInt *b3);
 
+// Random number generators
+BigIntRng *big_int_rng_xoshiro_init(BigIntRng *rng, uint64_t seed);
+BigIntRng *big_int_rng_chacha_init(BigIntRng *rng, const uint8_t *key);
+BigIntRng *big_int_rng_secure(void);
+BigIntRng *big_int_rng_use(BigIntRng *rng);
+void big_int_rng_fill(BigIntRng *rng, uint64_t *out, uint64_t n);
+
 // Reset stats (use in combination with setting the env variable COLLECT_STATS)
 void reset_stats(void);
 
@@ -16,6 +16,7 @@ void big_int_curve1174_mul_mod_4(BigInt *r0, BigInt *r1, BigInt *r2, BigInt *r3,
 BigInt *big_int_curve1174_square_mod(BigInt *r, BigInt *a);
 BigInt *big_int_curve1174_div_mod(BigInt *r, BigInt *a, BigInt *b);
 BigInt *big_int_curve1174_inv_fermat(BigInt *r, BigInt *a);
+BigInt *big_int_curve1174_inv_batch(BigInt *r, BigInt *a, uint64_t n);
 
 // Special comparison
 int8_t big_int_curve1174_compare_to_q(BigInt *a);
@@ -0,0 +1,86 @@
+#ifndef BIGINT_N_H_    /* Include guard */
+#define BIGINT_N_H_
+
+#include <stdint.h>
+#include "bigint.h"
+
+/*
+ * Fixed-width BigInts
+ *
+ * BigInt reserves BIGINT_FIXED_SIZE_INTERNAL chunks for every number, which is
+ * sized for 256-bit operands and cannot hold more than 544 bits. The types
+ * below instead have exactly bits / 64 limbs of 64 bits each, without sign or
+ * size metadata, i.e., they are non-negative and always have full width.
+ * Products go to a separate type of twice the width.
+ *
+ * Each width is a family of types and functions generated by
+ * BIGINT_N_DECLARE(bits) and BIGINT_N_DEFINE(bits) (in bigint_n.c). The
+ * kernels are shared, but inlined with the limb count as compile-time
+ * constant, such that every width gets its own fully unrolled code. To add a
+ * width, add a pair of these macro calls.
+ *
+ * The Montgomery functions work on numbers in [0, q) for an odd modulus q of
+ * at most the width of the family.
+ */
+
+// Number of 64-bit limbs of a fixed-width BigInt
+#define BIGINT_N_LIMBS(bits) ((bits) / 64)
+
+// Number of limbs of the largest generated width
+#define BIGINT_N_MAX_LIMBS BIGINT_N_LIMBS(1024)
+
+#define BIGINT_N_DECLARE(bits)                                                 \
+                                                                               \
+typedef struct BigInt##bits                                                    \
+{                                                                              \
+    uint64_t limbs[BIGINT_N_LIMBS(bits)];                                      \
+} BigInt##bits;                                                                \
+                                                                               \
+typedef struct BigInt##bits##Wide                                              \
+{                                                                              \
+    uint64_t limbs[2 * BIGINT_N_LIMBS(bits)];                                  \
+} BigInt##bits##Wide;                                                          \
+                                                                               \
+typedef struct BigInt##bits##MontCtx                                           \
+{                                                                              \
+    BigInt##bits q;             /* Odd modulus */                              \
+    BigInt##bits r2;            /* R^2 mod q, with R = 2^bits */               \
+    BigInt##bits one;           /* R mod q, i.e., 1 in Montgomery form */      \
+    uint64_t q_inv;             /* -q^-1 mod 2^64 */                           \
+} BigInt##bits##MontCtx;                                                       \
+                                                                               \
+BigInt##bits *big_int_##bits##_from_big_int(BigInt##bits *r, BigInt *a);       \
+BigInt *big_int_##bits##_to_big_int(BigInt *r, BigInt##bits *a);               \
+BigInt##bits *big_int_##bits##_from_hex(BigInt##bits *r, const char *s);       \
+int8_t big_int_##bits##_compare(BigInt##bits *a, BigInt##bits *b);             \
+int8_t big_int_##bits##_is_zero(BigInt##bits *a);                              \
+uint64_t big_int_##bits##_add(BigInt##bits *r, BigInt##bits *a,                \
+    BigInt##bits *b);                                                          \
+uint64_t big_int_##bits##_sub(BigInt##bits *r, BigInt##bits *a,                \
+    BigInt##bits *b);                                                          \
+BigInt##bits##Wide *big_int_##bits##_mul(BigInt##bits##Wide *r,                \
+    BigInt##bits *a, BigInt##bits *b);                                         \
+                                                                               \
+BigInt##bits##MontCtx *big_int_##bits##_mont_ctx_init(                         \
+    BigInt##bits##MontCtx *ctx, BigInt##bits *q);                              \
+BigInt##bits *big_int_##bits##_to_mont(BigInt##bits *r, BigInt##bits *a,       \
+    BigInt##bits##MontCtx *ctx);                                               \
+BigInt##bits *big_int_##bits##_from_mont(BigInt##bits *r, BigInt##bits *a,     \
+    BigInt##bits##MontCtx *ctx);                                               \
+BigInt##bits *big_int_##bits##_add_mod(BigInt##bits *r, BigInt##bits *a,       \
+    BigInt##bits *b, BigInt##bits##MontCtx *ctx);                              \
+BigInt##bits *big_int_##bits##_sub_mod(BigInt##bits *r, BigInt##bits *a,       \
+    BigInt##bits *b, BigInt##bits##MontCtx *ctx);                              \
+BigInt##bits *big_int_##bits##_mont_mul(BigInt##bits *r, BigInt##bits *a,      \
+    BigInt##bits *b, BigInt##bits##MontCtx *ctx);                              \
+BigInt##bits *big_int_##bits##_mont_square(BigInt##bits *r, BigInt##bits *a,   \
+    BigInt##bits##MontCtx *ctx);                                               \
+BigInt##bits *big_int_##bits##_pow_mont(BigInt##bits *r, BigInt##bits *b,      \
+    BigInt##bits *e, BigInt##bits##MontCtx *ctx);
+
+BIGINT_N_DECLARE(256)
+BIGINT_N_DECLARE(384)
+BIGINT_N_DECLARE(512)
+BIGINT_N_DECLARE(1024)
+
+#endif // BIGINT_N_H_
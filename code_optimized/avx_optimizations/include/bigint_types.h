@@ -21,61 +21,100 @@
 #define BIGINT_TYPE_BIG_INT_ABS                    12
 #define BIGINT_TYPE_BIG_INT_ADD                    13
 #define BIGINT_TYPE_BIG_INT_ADD_MOD                14
-#define BIGINT_TYPE_BIG_INT_CHI                    15
-#define BIGINT_TYPE_BIG_INT_COMPARE                16
-#define BIGINT_TYPE_BIG_INT_COPY                   17
-#define BIGINT_TYPE_BIG_INT_CREATE_FROM_CHUNK      18
-#define BIGINT_TYPE_BIG_INT_CREATE_FROM_DBL_CHUNK  19
-#define BIGINT_TYPE_BIG_INT_CREATE_FROM_HEX        20
-#define BIGINT_TYPE_BIG_INT_CREATE_RANDOM          21
-#define BIGINT_TYPE_BIG_INT_CURVE1174_ADD_MOD      22
-#define BIGINT_TYPE_BIG_INT_CURVE1174_CHI          23
-#define BIGINT_TYPE_BIG_INT_CURVE1174_COMPARE_TO_Q 24
-#define BIGINT_TYPE_BIG_INT_CURVE1174_DIV_MOD      25
-#define BIGINT_TYPE_BIG_INT_CURVE1174_INV          26
-#define BIGINT_TYPE_BIG_INT_CURVE1174_MOD          27
-#define BIGINT_TYPE_BIG_INT_CURVE1174_MUL_MOD      28
-#define BIGINT_TYPE_BIG_INT_CURVE1174_MUL_MOD_4    29
-#define BIGINT_TYPE_BIG_INT_CURVE1174_POW          30
-#define BIGINT_TYPE_BIG_INT_CURVE1174_POW_Q_M1_D2  31
-#define BIGINT_TYPE_BIG_INT_CURVE1174_POW_Q_M2     32
-#define BIGINT_TYPE_BIG_INT_CURVE1174_POW_Q_P1_D4  33
-#define BIGINT_TYPE_BIG_INT_CURVE1174_POW_SMALL    34
-#define BIGINT_TYPE_BIG_INT_CURVE1174_SQUARED_MOD  35
-#define BIGINT_TYPE_BIG_INT_CURVE1174_SUB_MOD      36
-#define BIGINT_TYPE_BIG_INT_DIV                    37
-#define BIGINT_TYPE_BIG_INT_DIV_MOD                38
-#define BIGINT_TYPE_BIG_INT_DIV_REM                39
-#define BIGINT_TYPE_BIG_INT_EGCD                   40
-#define BIGINT_TYPE_BIG_INT_GET_RES                41
-#define BIGINT_TYPE_BIG_INT_INV                    42
-#define BIGINT_TYPE_BIG_INT_IS_ODD                 43
-#define BIGINT_TYPE_BIG_INT_IS_ZERO                44
-#define BIGINT_TYPE_BIG_INT_MOD                    45
-#define BIGINT_TYPE_BIG_INT_MUL                    46
-#define BIGINT_TYPE_BIG_INT_MUL_256                47
-#define BIGINT_TYPE_BIG_INT_MUL_4                  48
-#define BIGINT_TYPE_BIG_INT_MUL_4_FAST             49
-#define BIGINT_TYPE_BIG_INT_MUL_MOD                50
-#define BIGINT_TYPE_BIG_INT_MUL_SINGLE_CHUNK       51
-#define BIGINT_TYPE_BIG_INT_NEG                    52
-#define BIGINT_TYPE_BIG_INT_POW                    53
-#define BIGINT_TYPE_BIG_INT_PRUNE_LEADING_ZEROS    54
-#define BIGINT_TYPE_BIG_INT_SLL_SMALL              55
-#define BIGINT_TYPE_BIG_INT_SQUARE                 56
-#define BIGINT_TYPE_BIG_INT_SQUARE_128             57
-#define BIGINT_TYPE_BIG_INT_SQUARE_160             58
-#define BIGINT_TYPE_BIG_INT_SQUARE_192             59
-#define BIGINT_TYPE_BIG_INT_SQUARE_224             60
-#define BIGINT_TYPE_BIG_INT_SQUARE_256             61
-#define BIGINT_TYPE_BIG_INT_SQUARE_32              62
-#define BIGINT_TYPE_BIG_INT_SQUARE_64              63
-#define BIGINT_TYPE_BIG_INT_SQUARE_96              64
-#define BIGINT_TYPE_BIG_INT_SQUARE_MOD             65
-#define BIGINT_TYPE_BIG_INT_SRL_SMALL              66
-#define BIGINT_TYPE_BIG_INT_SUB                    67
-#define BIGINT_TYPE_BIG_INT_SUB_MOD                68
-#define BIGINT_TYPE_LAST                           69
+#define BIGINT_TYPE_BIG_INT_BARRETT_CTX_INIT       15
+#define BIGINT_TYPE_BIG_INT_BIT_LENGTH             16
+#define BIGINT_TYPE_BIG_INT_CHI                    17
+#define BIGINT_TYPE_BIG_INT_COMPARE                18
+#define BIGINT_TYPE_BIG_INT_COPY                   19
+#define BIGINT_TYPE_BIG_INT_CREATE_FROM_BYTES      20
+#define BIGINT_TYPE_BIG_INT_CREATE_FROM_CHUNK      21
+#define BIGINT_TYPE_BIG_INT_CREATE_FROM_DBL_CHUNK  22
+#define BIGINT_TYPE_BIG_INT_CREATE_FROM_HEX        23
+#define BIGINT_TYPE_BIG_INT_CREATE_RANDOM          24
+#define BIGINT_TYPE_BIG_INT_CURVE1174_ADD_MOD      25
+#define BIGINT_TYPE_BIG_INT_CURVE1174_CHI          26
+#define BIGINT_TYPE_BIG_INT_CURVE1174_COMPARE_TO_Q 27
+#define BIGINT_TYPE_BIG_INT_CURVE1174_DIV_MOD      28
+#define BIGINT_TYPE_BIG_INT_CURVE1174_INV          29
+#define BIGINT_TYPE_BIG_INT_CURVE1174_INV_BATCH    30
+#define BIGINT_TYPE_BIG_INT_CURVE1174_MOD          31
+#define BIGINT_TYPE_BIG_INT_CURVE1174_MUL_MOD      32
+#define BIGINT_TYPE_BIG_INT_CURVE1174_MUL_MOD_4    33
+#define BIGINT_TYPE_BIG_INT_CURVE1174_POW          34
+#define BIGINT_TYPE_BIG_INT_CURVE1174_POW_Q_M1_D2  35
+#define BIGINT_TYPE_BIG_INT_CURVE1174_POW_Q_M2     36
+#define BIGINT_TYPE_BIG_INT_CURVE1174_POW_Q_P1_D4  37
+#define BIGINT_TYPE_BIG_INT_CURVE1174_POW_SMALL    38
+#define BIGINT_TYPE_BIG_INT_CURVE1174_SQUARED_MOD  39
+#define BIGINT_TYPE_BIG_INT_CURVE1174_SUB_MOD      40
+#define BIGINT_TYPE_BIG_INT_DIV                    41
+#define BIGINT_TYPE_BIG_INT_DIV_MOD                42
+#define BIGINT_TYPE_BIG_INT_DIV_REM                43
+#define BIGINT_TYPE_BIG_INT_EGCD                   44
+#define BIGINT_TYPE_BIG_INT_FILL_RANDOM            45
+#define BIGINT_TYPE_BIG_INT_FROM_MONT              46
+#define BIGINT_TYPE_BIG_INT_GET_RES                47
+#define BIGINT_TYPE_BIG_INT_INV                    48
+#define BIGINT_TYPE_BIG_INT_IS_ODD                 49
+#define BIGINT_TYPE_BIG_INT_IS_ZERO                50
+#define BIGINT_TYPE_BIG_INT_MOD                    51
+#define BIGINT_TYPE_BIG_INT_MOD_BARRETT            52
+#define BIGINT_TYPE_BIG_INT_MONT_CTX_INIT          53
+#define BIGINT_TYPE_BIG_INT_MONT_MUL               54
+#define BIGINT_TYPE_BIG_INT_MONT_SQUARE            55
+#define BIGINT_TYPE_BIG_INT_MUL                    56
+#define BIGINT_TYPE_BIG_INT_MUL_256                57
+#define BIGINT_TYPE_BIG_INT_MUL_4                  58
+#define BIGINT_TYPE_BIG_INT_MUL_4_FAST             59
+#define BIGINT_TYPE_BIG_INT_MUL_MOD                60
+#define BIGINT_TYPE_BIG_INT_MUL_MOD_BARRETT        61
+#define BIGINT_TYPE_BIG_INT_MUL_SINGLE_CHUNK       62
+#define BIGINT_TYPE_BIG_INT_NEG                    63
+#define BIGINT_TYPE_BIG_INT_N_ADD                  64
+#define BIGINT_TYPE_BIG_INT_N_ADD_MOD              65
+#define BIGINT_TYPE_BIG_INT_N_COMPARE              66
+#define BIGINT_TYPE_BIG_INT_N_FROM_BIG_INT         67
+#define BIGINT_TYPE_BIG_INT_N_FROM_HEX             68
+#define BIGINT_TYPE_BIG_INT_N_FROM_MONT            69
+#define BIGINT_TYPE_BIG_INT_N_IS_ZERO              70
+#define BIGINT_TYPE_BIG_INT_N_MONT_CTX_INIT        71
+#define BIGINT_TYPE_BIG_INT_N_MONT_MUL             72
+#define BIGINT_TYPE_BIG_INT_N_MONT_SQUARE          73
+#define BIGINT_TYPE_BIG_INT_N_MUL                  74
+#define BIGINT_TYPE_BIG_INT_N_POW_MONT             75
+#define BIGINT_TYPE_BIG_INT_N_SUB                  76
+#define BIGINT_TYPE_BIG_INT_N_SUB_MOD              77
+#define BIGINT_TYPE_BIG_INT_N_TO_BIG_INT           78
+#define BIGINT_TYPE_BIG_INT_N_TO_MONT              79
+#define BIGINT_TYPE_BIG_INT_PACK                   80
+#define BIGINT_TYPE_BIG_INT_POW                    81
+#define BIGINT_TYPE_BIG_INT_POW_MONT               82
+#define BIGINT_TYPE_BIG_INT_POW_WINDOW             83
+#define BIGINT_TYPE_BIG_INT_POW_WINDOW_SIZE        84
+#define BIGINT_TYPE_BIG_INT_PRUNE_LEADING_ZEROS    85
+#define BIGINT_TYPE_BIG_INT_RNG_CHACHA_INIT        86
+#define BIGINT_TYPE_BIG_INT_RNG_FILL               87
+#define BIGINT_TYPE_BIG_INT_RNG_SECURE             88
+#define BIGINT_TYPE_BIG_INT_RNG_USE                89
+#define BIGINT_TYPE_BIG_INT_RNG_XOSHIRO_INIT       90
+#define BIGINT_TYPE_BIG_INT_SLL_SMALL              91
+#define BIGINT_TYPE_BIG_INT_SQUARE                 92
+#define BIGINT_TYPE_BIG_INT_SQUARE_128             93
+#define BIGINT_TYPE_BIG_INT_SQUARE_160             94
+#define BIGINT_TYPE_BIG_INT_SQUARE_192             95
+#define BIGINT_TYPE_BIG_INT_SQUARE_224             96
+#define BIGINT_TYPE_BIG_INT_SQUARE_256             97
+#define BIGINT_TYPE_BIG_INT_SQUARE_32              98
+#define BIGINT_TYPE_BIG_INT_SQUARE_64              99
+#define BIGINT_TYPE_BIG_INT_SQUARE_96              100
+#define BIGINT_TYPE_BIG_INT_SQUARE_MOD             101
+#define BIGINT_TYPE_BIG_INT_SRL_SMALL              102
+#define BIGINT_TYPE_BIG_INT_SUB                    103
+#define BIGINT_TYPE_BIG_INT_SUB_MOD                104
+#define BIGINT_TYPE_BIG_INT_TO_BYTES               105
+#define BIGINT_TYPE_BIG_INT_TO_MONT                106
+#define BIGINT_TYPE_BIG_INT_UNPACK                 107
+#define BIGINT_TYPE_LAST                           108
 
 __attribute__((unused))
 static char *big_int_type_names[] = {
@@ -94,9 +133,12 @@ static char *big_int_type_names[] = {
     "big_int_abs",
     "big_int_add",
     "big_int_add_mod",
+    "big_int_barrett_ctx_init",
+    "big_int_bit_length",
     "big_int_chi",
     "big_int_compare",
     "big_int_copy",
+    "big_int_create_from_bytes",
     "big_int_create_from_chunk",
     "big_int_create_from_dbl_chunk",
     "big_int_create_from_hex",
@@ -106,6 +148,7 @@ static char *big_int_type_names[] = {
     "big_int_curve1174_compare_to_q",
     "big_int_curve1174_div_mod",
     "big_int_curve1174_inv",
+    "big_int_curve1174_inv_batch",
     "big_int_curve1174_mod",
     "big_int_curve1174_mul_mod",
     "big_int_curve1174_mul_mod_4",
@@ -120,20 +163,52 @@ static char *big_int_type_names[] = {
     "big_int_div_mod",
     "big_int_div_rem",
     "big_int_egcd",
+    "big_int_fill_random",
+    "big_int_from_mont",
     "big_int_get_res",
     "big_int_inv",
     "big_int_is_odd",
     "big_int_is_zero",
     "big_int_mod",
+    "big_int_mod_barrett",
+    "big_int_mont_ctx_init",
+    "big_int_mont_mul",
+    "big_int_mont_square",
     "big_int_mul",
     "big_int_mul_256",
     "big_int_mul_4",
     "big_int_mul_4_fast",
     "big_int_mul_mod",
+    "big_int_mul_mod_barrett",
     "big_int_mul_single_chunk",
+    "big_int_n_add",
+    "big_int_n_add_mod",
+    "big_int_n_compare",
+    "big_int_n_from_big_int",
+    "big_int_n_from_hex",
+    "big_int_n_from_mont",
+    "big_int_n_is_zero",
+    "big_int_n_mont_ctx_init",
+    "big_int_n_mont_mul",
+    "big_int_n_mont_square",
+    "big_int_n_mul",
+    "big_int_n_pow_mont",
+    "big_int_n_sub",
+    "big_int_n_sub_mod",
+    "big_int_n_to_big_int",
+    "big_int_n_to_mont",
     "big_int_neg",
+    "big_int_pack",
     "big_int_pow",
+    "big_int_pow_mont",
+    "big_int_pow_window",
+    "big_int_pow_window_size",
     "big_int_prune_leading_zeros",
+    "big_int_rng_chacha_init",
+    "big_int_rng_fill",
+    "big_int_rng_secure",
+    "big_int_rng_use",
+    "big_int_rng_xoshiro_init",
     "big_int_sll_small",
     "big_int_square",
     "big_int_square_128",
@@ -148,8 +223,11 @@ static char *big_int_type_names[] = {
     "big_int_srl_small",
     "big_int_sub",
     "big_int_sub_mod",
+    "big_int_to_bytes",
+    "big_int_to_mont",
+    "big_int_unpack",
     "BIGINT_TYPE_LAST",
-    "big_int_chi"
+    "big_int_n_pow_mont"
 };
 
 #endif // BIGINT_TYPES_H_
@@ -0,0 +1,1371 @@
+/**
+ * This file is **autogenerated** by Python. Any manual changes to it will be
+ * OVERWRITTEN!
+ */
+
+#ifndef CURVE1174_BASE_TABLE_H_
+#define CURVE1174_BASE_TABLE_H_
+
+#include <stdint.h>
+
+#define CURVE1174_BASE_TABLE_ROWS 32
+#define CURVE1174_BASE_TABLE_COLS 8
+
+typedef struct Curve1174BaseTableEntry
+{
+    uint32_t y_plus_x[8];
+    uint32_t y_minus_x[8];
+    uint32_t t2d[8];
+} Curve1174BaseTableEntry;
+
+// curve1174_base_table[i][j] = (j + 1) * 256^i * G as (y + x, y - x, 2dxy),
+// chunks are stored least significant first.
+__attribute__((unused, aligned(64)))
+static const Curve1174BaseTableEntry curve1174_base_table[CURVE1174_BASE_TABLE_ROWS][CURVE1174_BASE_TABLE_COLS] = {
+    {
+        { // 1 * 256^0 * G
+            {0x5828d4f1, 0xbadef0e7, 0xf86e64d0, 0x1004b84c, 0x29adaf9d, 0xf99a32f9, 0xbeb04413, 0x0236ea8f},
+            {0xde639734, 0x8eba7297, 0x6610ca06, 0x8fc10578, 0xa95a6c7b, 0xd312d529, 0xea4f2b84, 0x03377475},
+            {0xd749fb7a, 0xc1f7af65, 0x3bd6011c, 0x4d81fbcb, 0xf25c0745, 0x8cfe5b90, 0x8557dad1, 0x04f36548},
+        },
+        { // 2 * 256^0 * G
+            {0x5e3aabf6, 0x4284ae61, 0x21115ce3, 0x6d4c279b, 0xdf128327, 0xc308cf7d, 0x450517ab, 0x02ac65ba},
+            {0x5442e858, 0xfaa53f96, 0x7031bf61, 0x737c2a9c, 0x96c7fb6d, 0x11512d0d, 0xe0f94254, 0x03776527},
+            {0xb5018f26, 0x7c691d66, 0xeba248a4, 0xcffab2c3, 0xa34e178b, 0x49aae938, 0x4758ac59, 0x0704c95a},
+        },
+        { // 3 * 256^0 * G
+            {0x84555e42, 0x5e32cc0a, 0x29da885d, 0x44ef7130, 0x5bf453fb, 0x27d4fd1c, 0xc5d51d6a, 0x023996ad},
+            {0x0277d245, 0xdf5b92af, 0x4a746e0b, 0xddf6689a, 0x97229d2b, 0x5ba68268, 0x6d1e7672, 0x0291665a},
+            {0x88d73d5a, 0x1505070b, 0x06296296, 0x30f9cee4, 0xfc26a6c0, 0xe214af43, 0x4583061c, 0x00c42f99},
+        },
+        { // 4 * 256^0 * G
+            {0x67bead60, 0x64749981, 0xfc75576d, 0x7f17f5e0, 0x18e48aa7, 0xa6b1a866, 0x98d1a6d1, 0x010f0248},
+            {0xdf57085f, 0x10d9d040, 0x47ced4aa, 0x8b08c0f2, 0x8afed5df, 0x7c09e280, 0x30d55515, 0x0763d020},
+            {0x71c083ce, 0xa540542a, 0xced9a4b0, 0x99efe806, 0xe8a1245e, 0xee1ab240, 0xd5463913, 0x00bb2ebb},
+        },
+        { // 5 * 256^0 * G
+            {0x638fea07, 0x25ea8d14, 0x667a0506, 0x5ebd2b0c, 0x52a25d19, 0x59d3e251, 0xd09fc1de, 0x0619d1da},
+            {0x8d07f638, 0xc6b3bcf0, 0x5677c2f0, 0x08a96a67, 0x2d34893b, 0xb09ea0d2, 0x27494b8f, 0x02d39ac8},
+            {0xc5d0ad29, 0x2dc2640e, 0xe3f99ff1, 0x72fbc640, 0xcade3681, 0x47d804a2, 0x951bee2a, 0x0029d42f},
+        },
+        { // 6 * 256^0 * G
+            {0xdebc5be0, 0x1c2d682c, 0x384de055, 0x756657ec, 0xa031db55, 0x63091b75, 0xa4962859, 0x04e15789},
+            {0x9335becb, 0xdba7931f, 0x73b625c5, 0xd2b15bfd, 0x9ead0df3, 0xf093ea8f, 0xecd1c594, 0x03334fb2},
+            {0xbed8a653, 0xd38ec9de, 0x4a4e1619, 0x8e771e95, 0xb60c18ad, 0x3d53ea9a, 0xade586d1, 0x0623f627},
+        },
+        { // 7 * 256^0 * G
+            {0x2b5937dd, 0xaf626284, 0x43e734d1, 0xc205608c, 0x67008a81, 0x1f2faedc, 0x825655be, 0x03f9df15},
+            {0x3dc917ac, 0x6d8b3327, 0x78c3ddb8, 0x6b11b333, 0xfc654879, 0xe92687a6, 0x44996487, 0x01a38f3f},
+            {0xf182ed1b, 0xd359a492, 0xda088781, 0xe7725b69, 0xa80a168b, 0xece04100, 0xcabdfd64, 0x0794340d},
+        },
+        { // 8 * 256^0 * G
+            {0x321f27e8, 0x8ebb3a82, 0x4c4b1a00, 0x7f3a7201, 0x7b563858, 0x3986da19, 0xc8bf9be7, 0x05bc1d54},
+            {0xc74314f7, 0x8a3bda29, 0xaa8f7518, 0x0db6eed8, 0x824ff645, 0xd1ad7c0c, 0x2da31159, 0x00e884fd},
+            {0x8bb49f4f, 0xf61fcc57, 0x13a02e93, 0xd7ff5368, 0x67a20138, 0x0ddbe8ea, 0x0dde4891, 0x03a48f12},
+        },
+    },
+    {
+        { // 1 * 256^1 * G
+            {0x154b9e07, 0x876f97b8, 0xc962239b, 0xb2d72cdd, 0x26491b2a, 0x14eef67a, 0xd3b78c51, 0x07137c78},
+            {0x45546ad7, 0xcabd93aa, 0xc39fa4f8, 0x68e75fe4, 0xa043cb8b, 0xd7fd7630, 0x09eeb840, 0x04ba1b1e},
+            {0x3a448323, 0x8b2d0e9a, 0xdc99b0c8, 0x61ae3601, 0x7f8bf410, 0x08e3ea3c, 0x9f1552d1, 0x029e21e2},
+        },
+        { // 2 * 256^1 * G
+            {0xc9ac914e, 0x5862dc51, 0x2211deb7, 0x4765b138, 0x7f452b90, 0x8ce7b38a, 0xf4d5880c, 0x06af3026},
+            {0xeb2d37b8, 0x48f10747, 0x61cf5f05, 0x452ba21d, 0xd1e053a5, 0x65d7a995, 0xa15aa03a, 0x014bd441},
+            {0x53390742, 0x5337cac1, 0x11c5333a, 0x583d2952, 0x5a16daf1, 0x4adb62bf, 0x103f4212, 0x038defac},
+        },
+        { // 3 * 256^1 * G
+            {0x984290f5, 0x8c288785, 0x0631ece1, 0x652ae8cc, 0x4abd5497, 0x07799060, 0xf36771ac, 0x01b2ac68},
+            {0x1d4b4f21, 0x7b65d1db, 0x68ec3ee2, 0xb04b3957, 0x54cd9330, 0x0640d7ad, 0x080b2238, 0x01a7de12},
+            {0xe5894842, 0xd27aa5d8, 0x5683767f, 0x96986610, 0x60f3297c, 0x9c52c577, 0x82169cb6, 0x00f408d3},
+        },
+        { // 4 * 256^1 * G
+            {0xaf3dccdc, 0x07ba65bb, 0x7de02a72, 0x599ddcea, 0x89f33092, 0xd7930d9a, 0x3cd33518, 0x06b40799},
+            {0x585b92a3, 0x29109ae6, 0x291e7c39, 0x6da44d7c, 0xf081f8e9, 0xec1dc428, 0x937a5718, 0x0731259f},
+            {0xb7ebedaa, 0xaa561a1c, 0x7c54eeb3, 0x463990cf, 0x2632f9da, 0xc3ff6a36, 0x4e340b8b, 0x078a03b7},
+        },
+        { // 5 * 256^1 * G
+            {0x65096fd7, 0xcf13dc81, 0x70007c32, 0x65814986, 0x683e6e94, 0xcbac105c, 0x11721823, 0x024f3f53},
+            {0x38765750, 0xedc5d68d, 0xa42ec3ef, 0x69a7290b, 0x8af687ca, 0xd609c106, 0xe5553e43, 0x0363d5b4},
+            {0xe962eb8e, 0xb861671a, 0xce3b16f8, 0x72d45d73, 0xaf840341, 0xd14e78a5, 0x20a582bb, 0x03da630d},
+        },
+        { // 6 * 256^1 * G
+            {0x2b43648c, 0x27d24c71, 0x49c1964f, 0x05b6592c, 0x51dfc0af, 0xdedbf226, 0x4ce34cd5, 0x030ccce2},
+            {0xd1781534, 0x970466ed, 0xa59db6ac, 0x80495f60, 0x57ae58dc, 0xcecae376, 0xbc429773, 0x037e1c92},
+            {0xbacd5103, 0xb47a9dd4, 0xea1163a3, 0x8a529b8e, 0x0e54eefc, 0xd50fea3f, 0x16a126fe, 0x07d2a513},
+        },
+        { // 7 * 256^1 * G
+            {0xb97f5524, 0x2d882b80, 0xa762b97e, 0x6583cda2, 0x76e161a3, 0xa89a11d2, 0x3749b0b1, 0x078226bb},
+            {0xd027c681, 0xb2867b85, 0x67568b07, 0x77b79c2d, 0x50a0c5fa, 0x53092e45, 0x9cd46234, 0x04180c59},
+            {0x63981db1, 0xc916eac5, 0xd61de9ef, 0xcf014912, 0xfa2c9c8b, 0x5dd6d866, 0xc28c23c7, 0x06c402f7},
+        },
+        { // 8 * 256^1 * G
+            {0x5de9d73e, 0x5c2c47ce, 0x9eefb7bb, 0xc31a30eb, 0x95dffd71, 0x93563b34, 0xb0fb2c3e, 0x038b9eb4},
+            {0xbcc84f0e, 0xf75268a5, 0x7d44d44c, 0x22985089, 0x2cb7e7bf, 0xd801bc52, 0x36f734a8, 0x071e5fea},
+            {0x8f65b639, 0x4b8813bf, 0x09d3c28c, 0x61094e74, 0xd6345ce8, 0x695be82e, 0x883da8cd, 0x05bb8c0d},
+        },
+    },
+    {
+        { // 1 * 256^2 * G
+            {0x998702f2, 0xdb9b314d, 0x7a3478be, 0x8427d728, 0x3f99881f, 0xd3bbe007, 0x90bd3230, 0x00e5ea5d},
+            {0x1aad6485, 0xa1207a09, 0xde1538ca, 0x70bcf865, 0x3541702f, 0x9cd71dee, 0xba00f4ca, 0x02563127},
+            {0x50e355eb, 0x86d526ac, 0xfa5dbf7a, 0x0b4614b7, 0x410f5f9f, 0x0d0d26c2, 0x84c153a1, 0x04dcace7},
+        },
+        { // 2 * 256^2 * G
+            {0x61dd0c84, 0xf4c64be0, 0x7e6e58f2, 0x63830365, 0x618686bf, 0x2ff578af, 0x12835e74, 0x04c1b44c},
+            {0x509a0138, 0xd4f64d64, 0x7df9e756, 0x6506c1f7, 0xb54ceda7, 0x687e092e, 0x92d12256, 0x01c72680},
+            {0x8dc48757, 0xdbf4e281, 0x19e506b1, 0xdfb790c9, 0x61f58f42, 0x2a4e76fc, 0x0e252e04, 0x030990e9},
+        },
+        { // 3 * 256^2 * G
+            {0xa6f990fd, 0xb9c2820d, 0x54c71ac7, 0x7f7221e6, 0xc1d0434f, 0x2f1b8584, 0xbe340739, 0x00627272},
+            {0xbdab5d7e, 0x18fe95c0, 0x134a9847, 0xc19641c2, 0x981d68f4, 0x47d35f81, 0x530ead0f, 0x071280d6},
+            {0x7ef20473, 0xc8e03d4f, 0x94865eeb, 0x2ced538b, 0x862ab44b, 0x64ff17ad, 0x1afe7e3f, 0x03779117},
+        },
+        { // 4 * 256^2 * G
+            {0x0c41115c, 0xd644a542, 0xd09e091c, 0xd01b414c, 0x8ec6a219, 0xf95d2f8c, 0x0e495b70, 0x06ea85c9},
+            {0x022f87ef, 0xfd6f28a1, 0x2fb69c2f, 0x15a286b3, 0x850faf57, 0x11a1b7f9, 0x22344e5c, 0x05d30cd7},
+            {0xb4cb7a97, 0x3f2a4b72, 0xe4f7e388, 0xfa00e7f0, 0x37af76ae, 0xa931e6c8, 0xf2e82bef, 0x07154e79},
+        },
+        { // 5 * 256^2 * G
+            {0x8d7bebe5, 0x01d9ef38, 0x226e382d, 0xccfc2ef1, 0xceb90f2b, 0x944bbbfe, 0x1d154523, 0x01d82049},
+            {0xc02cb5ba, 0xc1d5c40c, 0xbbc8380c, 0x982bc1c2, 0xf5a745a2, 0xb8413f93, 0x4323f14a, 0x04fb7c8f},
+            {0x08bb2a05, 0x9c88a7e5, 0xdae74780, 0xe589adb5, 0x192237f3, 0x416f9079, 0x0636890a, 0x044a6185},
+        },
+        { // 6 * 256^2 * G
+            {0x20342c65, 0x9e7d6089, 0xa9842f26, 0xe0aaf491, 0x49e5a5bc, 0x08b6a6e0, 0x5093bc9a, 0x0018a6dd},
+            {0x63be4c70, 0x29894382, 0x4c83376d, 0x41a7b9c2, 0xef731164, 0x6d7c3b42, 0x166a1610, 0x02786409},
+            {0xd19955db, 0xf7eac771, 0xeea419a3, 0x614a673a, 0x0a48052e, 0xd8780860, 0xf63e6d20, 0x02cb117d},
+        },
+        { // 7 * 256^2 * G
+            {0xbdccc348, 0xd0902492, 0x63312662, 0xf72a57fe, 0x7f40adae, 0xd06a477c, 0x60f0774c, 0x036cd59f},
+            {0x124027cc, 0xdbb2ccc9, 0x94b76fcc, 0xb7db1d80, 0xf1894411, 0xb0720c98, 0x94082dc9, 0x0542af26},
+            {0x8a2aed03, 0x7f29ed1b, 0x3f8430b7, 0xc4fca187, 0x58cfb4b7, 0x9c47ef15, 0xa13aa507, 0x00aedc50},
+        },
+        { // 8 * 256^2 * G
+            {0x635c2490, 0x58fa3553, 0xc33e3f3d, 0x554c3006, 0xb7664b71, 0xbdad17dd, 0x6b07411f, 0x025a3ca6},
+            {0xeda06b09, 0x2476e631, 0x0bef612f, 0x0b95db75, 0x37e56481, 0x9b7a23ff, 0xa0b27b2d, 0x07c4335e},
+            {0x1b206877, 0x087d949b, 0x415d4e62, 0x31a012a7, 0xcf15a1a1, 0xa14e07ce, 0xe6746cc8, 0x045406a9},
+        },
+    },
+    {
+        { // 1 * 256^3 * G
+            {0x7d8e6f80, 0x9949c597, 0x3b7df318, 0x3a77da8c, 0x30eaa918, 0xee4ce8ad, 0xac14b1ee, 0x02820f9f},
+            {0xa7297f92, 0x97e2c817, 0x2589771f, 0x540c5c41, 0xe7b8f16b, 0x4e37e1b4, 0x3d719c20, 0x06d06e58},
+            {0x2b79f799, 0x76943d88, 0x840a3ce2, 0x5f1d31fb, 0x74ffb9e2, 0x01bd45d4, 0xd79fcdd3, 0x04fd1a11},
+        },
+        { // 2 * 256^3 * G
+            {0xe1f27bed, 0x8cff2658, 0xeda94d46, 0x812f378b, 0x8794b0c7, 0xc2cd6be8, 0xa5e8e60c, 0x061585b6},
+            {0x06178a11, 0xe1a44ab8, 0xee0d6156, 0x832fdab6, 0x51b2645f, 0x6235fd3a, 0x88eaa581, 0x0052c085},
+            {0xa6d6276d, 0x14472413, 0xa349d630, 0x28c23cb1, 0xd023a6a2, 0x030f6e6e, 0xcfd9f8e8, 0x022037af},
+        },
+        { // 3 * 256^3 * G
+            {0x4d0ea74d, 0x38be0ac7, 0x9374f18b, 0xd7078e64, 0x1c99cd21, 0x79bb9d64, 0x215eb04c, 0x03188905},
+            {0x7162909d, 0xa1ac391a, 0x54d8cd85, 0x7c16f6c7, 0x947575f6, 0x530b0b3b, 0x27afaaa6, 0x05b87785},
+            {0x41352ab6, 0x1ce82964, 0x69715bbc, 0x55a97804, 0x5fc5a081, 0xf075efe9, 0xd421f98c, 0x0594a398},
+        },
+        { // 4 * 256^3 * G
+            {0x2e1c514f, 0xda664334, 0x8344442c, 0x1c561654, 0xe529a896, 0x11f042cc, 0x00e07891, 0x067bee87},
+            {0x4256a271, 0x6c14116f, 0xb0b9a473, 0xfac8bbbd, 0x792182fc, 0xa265dccb, 0x3da0147e, 0x04fc31ab},
+            {0xc8c9ccf5, 0x1e5d460e, 0xd942b63c, 0xa67c38c3, 0xdd83424f, 0xb7203572, 0x296fe1d1, 0x06367248},
+        },
+        { // 5 * 256^3 * G
+            {0xef156db1, 0xe33c5c71, 0x994fdc8d, 0xfd7f6bec, 0xcce1324c, 0x49e52499, 0xfade1071, 0x004da22b},
+            {0x7eab6d9d, 0x5895b82c, 0x28e0adc9, 0x1c06b6a6, 0x4d9651c9, 0x148c96e0, 0x586618f4, 0x016f299f},
+            {0x325280a7, 0x50afcd03, 0x4ec5c6d5, 0x978d86e9, 0x066b82dc, 0x210a68d1, 0x6e8423ee, 0x01ce5237},
+        },
+        { // 6 * 256^3 * G
+            {0x1f222521, 0xd025b89d, 0xab93adde, 0xb6c124a6, 0xeb4b3b3a, 0xed5e320e, 0xe0c2ddd6, 0x038a77bc},
+            {0xf54f36bd, 0x2e24a048, 0x19d8b6c1, 0x2d08ea08, 0x2e0b5b10, 0x6787eced, 0x84b0b400, 0x06dab394},
+            {0x8b19efa7, 0x883a35a7, 0x056baba6, 0xaf5fcd5f, 0xb621dfff, 0x7b9cbc98, 0x0bd8940a, 0x040ea934},
+        },
+        { // 7 * 256^3 * G
+            {0x2decf63b, 0x0e578235, 0x29885de7, 0xfd9bdbd9, 0x299dcb37, 0x07c8b978, 0x9a3540c5, 0x0263b4c7},
+            {0x07fe974c, 0x2c2bb6e1, 0x3c839abc, 0x7439246a, 0xfe4cff55, 0x3abc7ad4, 0x6f5d89a5, 0x0187f878},
+            {0x18fe0e52, 0x84e92bab, 0x0988e00b, 0xbc13f74f, 0x3c718bc5, 0x63bd3bfe, 0xea387079, 0x01d013d0},
+        },
+        { // 8 * 256^3 * G
+            {0x8f66d275, 0x8c4f77f9, 0xf037abfe, 0x9e7d5920, 0x3a4ab32a, 0x8b84334a, 0xc2dfe5ad, 0x0452dbd0},
+            {0x6d805d54, 0x3fa16a57, 0x13e59d0a, 0x0590d3da, 0x7b734d21, 0x510ed534, 0x64f3fb89, 0x01910b25},
+            {0x5df757a5, 0xd2a69d83, 0x8510c641, 0xf97de681, 0xd73d6927, 0x743b3cb2, 0x765f617a, 0x01aded7b},
+        },
+    },
+    {
+        { // 1 * 256^4 * G
+            {0xef0f0c48, 0x759ed1fb, 0x8417a7ac, 0x8693a2a0, 0xd69e9288, 0x8e742241, 0xf856ae6a, 0x03530fe3},
+            {0x1111c1a3, 0xcd730c2a, 0xf1d7318c, 0x70068c55, 0xd31b5fbd, 0xa71a3b52, 0x334273bf, 0x07a23805},
+            {0x3de9cdf9, 0xcfc25847, 0x5f98cfa1, 0x189416f6, 0x41886701, 0xea8b9fd7, 0xa7be6176, 0x06701cf7},
+        },
+        { // 2 * 256^4 * G
+            {0x931829e4, 0xfa267bf9, 0x82d9f90f, 0x1cca726b, 0x7b96dd61, 0xef6fef1a, 0xdb233916, 0x05ca3bc8},
+            {0x6b97a60d, 0xe0f192b4, 0x777182f1, 0x261b3aed, 0xda8f572e, 0xfe418858, 0xcce70437, 0x04d619a6},
+            {0xca2d1457, 0xc66c7408, 0x56aba645, 0x6064d5bf, 0x9dce6ec7, 0x0ea0f27f, 0x84b40a2f, 0x0483a411},
+        },
+        { // 3 * 256^4 * G
+            {0xed73c27c, 0x6b8e4c0c, 0x1c76abcf, 0x77c28e4c, 0xdbacecc8, 0x282230ff, 0xfc94f7bf, 0x04e256a9},
+            {0xc29958f7, 0xbae8c33e, 0x525fbfa3, 0xd9e5a742, 0xaaefe972, 0xe0f5eadf, 0x40be43ab, 0x0731400c},
+            {0x5008f9c9, 0xce5934b6, 0xad0f19ad, 0x27cef613, 0xe02b2627, 0x99a6c13e, 0x7972b5dc, 0x07c8183b},
+        },
+        { // 4 * 256^4 * G
+            {0x2b8c7136, 0xe2ce5ad9, 0xc81ca5e8, 0x96285b02, 0xecd9c3f8, 0x9785ac83, 0x1902872a, 0x07b0a0a9},
+            {0x502ec6a7, 0xd2b49676, 0x755762af, 0x4eaa80d6, 0x8e97ede1, 0x6bc94d3c, 0x1affe7d9, 0x00355871},
+            {0x4c9832ad, 0x5c231fe8, 0xaa0c3c9c, 0x1403e646, 0x9412b697, 0xeeb813a2, 0xc15e8ca4, 0x07478427},
+        },
+        { // 5 * 256^4 * G
+            {0x4713d90e, 0x7c1bb3c5, 0x49c0bbad, 0x3076c30f, 0x2f9d8a23, 0x40dfaad7, 0x8bbdd74a, 0x035d6204},
+            {0xd4b6d1d7, 0xa4fc0c27, 0x0298328c, 0x570bef38, 0x3bfd9dde, 0x6509f157, 0xf6a228d8, 0x024d3e7d},
+            {0xc157b42e, 0xee77e8df, 0x0a72e853, 0x0d1b0298, 0xb87c314e, 0xd09d9057, 0xc91e2589, 0x04b22d46},
+        },
+        { // 6 * 256^4 * G
+            {0xb4d3feb0, 0x66cb7cf1, 0x0e575f5f, 0xcbfba9c0, 0x2c8ae4fe, 0x92fb6013, 0x0a1e888f, 0x04e4f45c},
+            {0x4518700c, 0x642091c6, 0x84c0fcf8, 0x1574e31e, 0x35e003a5, 0xb134e16e, 0x3fab0991, 0x01599acf},
+            {0xdf85eb00, 0x52fd9115, 0xd0fd2d46, 0x3bbcf945, 0x43f864e4, 0x44256750, 0xdd556d5b, 0x02b116f8},
+        },
+        { // 7 * 256^4 * G
+            {0xb80b8274, 0x5b4db5e4, 0x1bcfcdcd, 0x63ca6dab, 0x8930dc4d, 0xbb589353, 0x185276fe, 0x05c021f9},
+            {0x9cb3e85a, 0xc550f59c, 0x6f8f7ae2, 0x977dc728, 0x2d612e42, 0x79f0be15, 0xd5960a73, 0x0274a6ab},
+            {0xb782f07f, 0xf9628669, 0x0e5a70d9, 0xe555c0e1, 0x1b0b4be6, 0xfdd76f1a, 0x7d0bfa6e, 0x05d9e927},
+        },
+        { // 8 * 256^4 * G
+            {0xb591b789, 0x08267c4d, 0x16ef193f, 0xcf318769, 0xa3631c36, 0x5da4a629, 0xf0ee0633, 0x06b2c77e},
+            {0x2a7b58de, 0x61700810, 0xc32d796e, 0xc153dd92, 0xcbfee42f, 0x7477b27c, 0x77829af5, 0x07f76b50},
+            {0xc7682cb8, 0x5e47849d, 0x221f933c, 0x26f46f31, 0x2924fe54, 0xa506c3ce, 0xe702aa05, 0x03a48f54},
+        },
+    },
+    {
+        { // 1 * 256^5 * G
+            {0xcc227829, 0x89cd82e3, 0xfdaac833, 0x46f200bf, 0xf9afa2db, 0xa724af22, 0xd1c9503e, 0x0751b2de},
+            {0x6e038952, 0xbd6a25ac, 0x6a5ff87c, 0xad72f3c2, 0xeaa44ca7, 0xafeaa07c, 0x69cb0611, 0x0112b659},
+            {0x128fe43a, 0xd3472422, 0x96a47b5b, 0x80ef76a4, 0x958e513e, 0x18f2d714, 0x2fc82013, 0x07c62491},
+        },
+        { // 2 * 256^5 * G
+            {0xfe6d81c8, 0x9be5db30, 0xef11c1ec, 0x2fe9dd36, 0x1f092e0f, 0x77c162b2, 0x57d589cb, 0x051ab23b},
+            {0x76470ed1, 0xafd29e9c, 0x119ecac1, 0x0b3bfddc, 0xb08c5870, 0x68fd5fd5, 0x06766412, 0x0782c1ad},
+            {0xf01d6b72, 0x086e14ff, 0x1c50d307, 0xfebcd98f, 0x1ae0f74c, 0x6f03a538, 0xb668fa02, 0x016394c7},
+        },
+        { // 3 * 256^5 * G
+            {0xcd330127, 0xb3819aee, 0xec73991a, 0x82594667, 0x5a05d204, 0x61946716, 0x575c3fe4, 0x00f01d31},
+            {0xd1c3230d, 0x1544eb36, 0x6eb2505a, 0x85922903, 0xea2c6139, 0x81d3dc7c, 0xc139586c, 0x0008d190},
+            {0xc1737473, 0xf956f8b2, 0x69c57fe0, 0xeb88a056, 0x39e7d1cb, 0x2d90785e, 0x746a6e0e, 0x006bc2a8},
+        },
+        { // 4 * 256^5 * G
+            {0xe101dfc2, 0x493c73a6, 0x8cf7002c, 0x4f7a3a07, 0x5e8a7760, 0x916bf060, 0x119cacdf, 0x00690e5e},
+            {0xf73ef5cd, 0xd4b6ff7d, 0x4fc726cd, 0x81a89fad, 0x86d8f4e3, 0x8291b8e6, 0x5cdb1a95, 0x07794d51},
+            {0x4e787a11, 0x71aae4fd, 0x3a75c312, 0x4c6497f5, 0xa6bdf35d, 0xf19ec1d9, 0x3e2af2a8, 0x0483058b},
+        },
+        { // 5 * 256^5 * G
+            {0x48bd35ae, 0xd538d629, 0x55280d6a, 0x3597f4d3, 0x6d85d762, 0x9852e719, 0xca30ef89, 0x00044bd3},
+            {0x4a73a12f, 0x07e2c358, 0x59c42b14, 0x9f9d68a3, 0x7992586d, 0x03d5fd28, 0x9ee0ecc4, 0x01da5a86},
+            {0x534f802f, 0x39b0b7be, 0x8ea9bbd7, 0x530c46f2, 0x3b964bbc, 0x09039981, 0xfb5bae26, 0x07295f40},
+        },
+        { // 6 * 256^5 * G
+            {0x21790667, 0x6cd6aaaf, 0xb8e6d50c, 0x2a912774, 0xedcf2024, 0x6b0ee5f2, 0x257cbada, 0x03614290},
+            {0x80f9c83b, 0x526d74e7, 0x00801699, 0x6feca942, 0x73bf13c5, 0x68cf295f, 0x952701ce, 0x055d7b5d},
+            {0x3d486c8f, 0xd68d83d1, 0xbac4f370, 0x085ebe76, 0xfa261653, 0x8f6838b5, 0x6bb8f68e, 0x067058ec},
+        },
+        { // 7 * 256^5 * G
+            {0x04dee273, 0x231528f7, 0x21f6792d, 0x62fdee52, 0x02ab418f, 0x1fd16e77, 0xb50543f4, 0x02ab7edc},
+            {0xf1b2897d, 0x73a70bc3, 0xceea0ee1, 0x8e3dffa5, 0x14005650, 0xaed487e0, 0xfebed091, 0x0749784d},
+            {0xf68534dd, 0x94ff0f96, 0xb35af252, 0xeb0113d4, 0x2edc4df2, 0x38eadbe2, 0x2aa8b201, 0x0265b97c},
+        },
+        { // 8 * 256^5 * G
+            {0x023d9065, 0x1b83ad6d, 0xc09859cd, 0xf78ad3c6, 0x5967f721, 0x0ff7adbf, 0x44714f04, 0x01316a0a},
+            {0x8294573e, 0xf3303af8, 0x8a367d01, 0x40fe05f9, 0x6a9b9ad1, 0x192b8620, 0x4ed81215, 0x07748fd8},
+            {0x463171bf, 0x0c25d9cc, 0xbabfecef, 0x70a5c6f5, 0xdda87d47, 0x9a1fd536, 0x1fda60ff, 0x01ac51aa},
+        },
+    },
+    {
+        { // 1 * 256^6 * G
+            {0x34a9ae0b, 0x6c171ec9, 0x8e2b2abb, 0x854810a1, 0x9cc37bca, 0xe005e060, 0xd6709dcc, 0x00e746ab},
+            {0x24914d02, 0x56bab1a7, 0xfabce2bf, 0x922329fc, 0xd8dc5eee, 0xb9481c93, 0x18ef9a78, 0x06088ac2},
+            {0x72306084, 0xc79f13ff, 0xf7cfbabb, 0xbdea8340, 0x9fb720ca, 0xd040d0c6, 0xdd1ae4c6, 0x04475073},
+        },
+        { // 2 * 256^6 * G
+            {0xf4eb9a09, 0x7bd0b4bb, 0x88fb53a9, 0x0f420134, 0xf5ea7c56, 0xeb4ca68b, 0x358ad9f9, 0x071728b2},
+            {0x2aebf9bd, 0x3be23480, 0x949b1368, 0x5d7ab4e5, 0xcbab2df3, 0x48ce1a06, 0x33364815, 0x05226499},
+            {0x04f3fa08, 0x7436ca5a, 0x767b95ee, 0x799f66fa, 0x6e2af8b0, 0x3012868a, 0x78f4115d, 0x072b5fac},
+        },
+        { // 3 * 256^6 * G
+            {0x6cd5e123, 0x66b2a1f5, 0x16f606ea, 0x83600deb, 0x5f010812, 0x7c05b3ec, 0x1b94e48f, 0x05f02c91},
+            {0x690867da, 0x7304a612, 0x3c90ae12, 0x173da59a, 0xfdae3874, 0xe5cc140f, 0x98555bcd, 0x01dbad67},
+            {0x1f2a7e37, 0xa79fea02, 0xbca09bc8, 0x4f7bc62a, 0x6788a07a, 0x9c28108b, 0x1d001121, 0x0301e01e},
+        },
+        { // 4 * 256^6 * G
+            {0x67dcc51d, 0x8e217ad4, 0x50f2db47, 0xb7a557e7, 0x06d76462, 0xee546f8b, 0x35bb8dbd, 0x00982f75},
+            {0x7c2854a1, 0x7dddfb50, 0xed01e6bf, 0x3eba4131, 0x1ef0a91e, 0xf6bf6b24, 0xb052b067, 0x0712f5d5},
+            {0x7ac7f802, 0xffbfb524, 0x8f3f97ce, 0xd8fd48fe, 0x1ad0462d, 0xc00d59e3, 0xd6ab2822, 0x03422623},
+        },
+        { // 5 * 256^6 * G
+            {0xb5053a5d, 0x74a5ab37, 0x9be10dc2, 0x81c64cc4, 0xcfbfce33, 0x8111cd85, 0xe8614f33, 0x0696334d},
+            {0xc5663241, 0x69ec34d6, 0x9048e1de, 0x84d59abc, 0x963ca957, 0x0a7b9da4, 0x72ee2167, 0x03ee3438},
+            {0x7f05ae28, 0x23d8dfde, 0x8c588cfa, 0xaff583a2, 0x9bdd6d2b, 0x2dec997e, 0xeff8a38f, 0x0159279d},
+        },
+        { // 6 * 256^6 * G
+            {0x2768c3e1, 0x2de4874e, 0x3e794766, 0x3fac40ea, 0x8c7fc2dc, 0x91aba6d6, 0xac50ca7a, 0x04635e70},
+            {0x15c403ba, 0x0d6aedd2, 0xe0a8338a, 0xd167617e, 0xcb9aded1, 0xea3779d0, 0x68965e86, 0x022ef6d0},
+            {0xec04920d, 0x50f06579, 0xf7da801b, 0x0ea8cdcd, 0x283fb5ac, 0x8de6eae2, 0xbb67a03b, 0x03d41b7c},
+        },
+        { // 7 * 256^6 * G
+            {0xe9bd0c7a, 0xf90bb2bd, 0x7888b84a, 0xd72021c2, 0x1e094f8e, 0x8c3737dd, 0xfc9a5593, 0x01bcd247},
+            {0xe8124016, 0x743730b2, 0xa73e2d39, 0xb8a3e28d, 0xb59bc7ca, 0x436c9990, 0x8fabeda5, 0x05d8852a},
+            {0x459b42b0, 0x65690d54, 0x423afe2e, 0xa40563bf, 0x6ff17288, 0x9efd0c47, 0x574695b9, 0x0212821b},
+        },
+        { // 8 * 256^6 * G
+            {0xe2ad7797, 0xcd930f8e, 0x69096ab8, 0x9532d5eb, 0x7b185677, 0x93357106, 0xe0b9822e, 0x04502597},
+            {0x4e4d525e, 0xcb30467b, 0x399e75e0, 0xe023665b, 0x3f7ca574, 0x2f528181, 0x2090010e, 0x07684665},
+            {0xe93506fb, 0x92267016, 0x11061280, 0xdb69841a, 0xadd3777f, 0x1abbeb27, 0x7ec47266, 0x07062dff},
+        },
+    },
+    {
+        { // 1 * 256^7 * G
+            {0x546c7648, 0xaafa74d4, 0x5e9b54ec, 0x834343e3, 0x3f06c76e, 0x489a5f23, 0x55fd4b7a, 0x03843b53},
+            {0x04b7172a, 0x0d66c3ce, 0x08b732fe, 0xb47e7236, 0x1670039a, 0x5b46746a, 0x06b4d589, 0x07f664d7},
+            {0xab7e03e6, 0xd8aab362, 0x897b2550, 0x76a06136, 0x5d7435cc, 0xf0f1ebf5, 0x133860d9, 0x01a4c353},
+        },
+        { // 2 * 256^7 * G
+            {0x02f557f3, 0x3ee379d6, 0xfd585a9e, 0x5d3ff305, 0x0468c975, 0x972d4de9, 0x19d64b70, 0x05978180},
+            {0xf9686347, 0x8df5fb4d, 0xe0a69b4f, 0x520a90c2, 0x842cd4db, 0xf5d8e3ec, 0xcb954b83, 0x05a79273},
+            {0x1d46c660, 0x0f969389, 0x10ee77ab, 0xa085bb74, 0x7694bda3, 0x089d869b, 0xf5cd1739, 0x07393f3a},
+        },
+        { // 3 * 256^7 * G
+            {0x09a6c110, 0x2b1b68f3, 0xe7ce7c91, 0xcea4f06f, 0x7933302d, 0x58aedeaf, 0x40256e30, 0x0057f7df},
+            {0xbda578a4, 0xa12c7108, 0x7b2fa3f2, 0x84e3ff7c, 0x2079ad10, 0x44ef56a5, 0x7cce7ded, 0x00a47e17},
+            {0x2fa9369d, 0xadd9a476, 0x05ce4ee0, 0x376c455b, 0x3a507e20, 0xbac1e7ff, 0x384d2e0e, 0x041ead1b},
+        },
+        { // 4 * 256^7 * G
+            {0x48447346, 0x3cd06fb9, 0xa9bd4c9a, 0xcef64397, 0x4b6246b8, 0x541c6f24, 0x4b38a725, 0x050ec2a8},
+            {0x5b48ae49, 0xcc3a328d, 0x6a898418, 0x75d5e9e3, 0x1e9d78cb, 0x42867e7b, 0x92a7d41a, 0x048f50b6},
+            {0x8410aa62, 0x6919e80b, 0xc9218a5a, 0x1b7023dc, 0x21ef583a, 0x59421507, 0xe88080d3, 0x034a6c12},
+        },
+        { // 5 * 256^7 * G
+            {0x5d18f771, 0x0676f4c1, 0x28f49d39, 0x283b8d3a, 0x568d1e3d, 0x65b0907a, 0x41d9bfec, 0x06ed9ab2},
+            {0x1c52c747, 0xa46629d2, 0xa6ce5f0e, 0x97880a28, 0x6d32530c, 0xb8d59802, 0xdb2e6fc0, 0x008ca776},
+            {0x87a0d118, 0x7a043540, 0x71dbd03b, 0xb9af814c, 0x634d4b86, 0x730dffd2, 0x3b9a9d93, 0x02bd1aef},
+        },
+        { // 6 * 256^7 * G
+            {0xb8db6586, 0xf8517f5d, 0x2de5238c, 0x9896ff55, 0x0a8e4516, 0xf18230e4, 0xc6747904, 0x05469086},
+            {0x812a7ab1, 0x4fd873a4, 0xa658a54d, 0x906269e5, 0x9442859b, 0x03ed0d6b, 0xae359a69, 0x03487cda},
+            {0xb9f1cecb, 0x1b7adfcc, 0xa42cfb77, 0x7d3af9d3, 0x245b7aad, 0xcb26bd4e, 0xb6f4fc83, 0x030563d4},
+        },
+        { // 7 * 256^7 * G
+            {0x810d69a3, 0x965aad1c, 0x1a6d1538, 0x1db5c5c6, 0xa85b9067, 0xe8fa5418, 0x70559b0a, 0x03365ff4},
+            {0x3725091c, 0xd5b06a28, 0xe0b2b08b, 0xf14cd2fa, 0x80a45fca, 0xc63e0caa, 0x587299c1, 0x069a8370},
+            {0x119d6d49, 0x4d858e21, 0xf4d55979, 0x31d91c74, 0x4050f3bf, 0x475d10c2, 0x8095560e, 0x068d3e77},
+        },
+        { // 8 * 256^7 * G
+            {0x79eebe44, 0xc08f993d, 0xc780ff4c, 0xdb3ab6ec, 0xc7eb12d8, 0x65733097, 0xa4176bc6, 0x05485e33},
+            {0xe670472c, 0x9c24d736, 0xad4b7a3e, 0x2862a386, 0xb62f1ce6, 0x7356ce6a, 0x91ab8f2d, 0x045361ee},
+            {0x3dfb818d, 0xca69ea7a, 0xc07da5fd, 0x1d82cb72, 0x229faccc, 0xdb4e3fb4, 0x4d0bb35b, 0x05b6bf3e},
+        },
+    },
+    {
+        { // 1 * 256^8 * G
+            {0xe59a69bd, 0xb41c48cb, 0xf2382f97, 0x5a6104d3, 0x5b599152, 0x1fdecb94, 0xcb6b7fcc, 0x0193358c},
+            {0x09112abd, 0x1dd540d4, 0x6f5c2cb3, 0x81303b14, 0x8ffa6845, 0xb33b6cb1, 0x4ad50437, 0x0296eba7},
+            {0x8171e83f, 0xa7559a69, 0xdde72b77, 0x63b41a1b, 0x058bceb6, 0xedb5f937, 0x46b3b22a, 0x07bda031},
+        },
+        { // 2 * 256^8 * G
+            {0x54a865ff, 0xcef2b808, 0x326155dd, 0xf0cba2ab, 0x89ac14ba, 0xf0e41fa8, 0x2f75b219, 0x02f69eb7},
+            {0x102dda03, 0xb635799e, 0x0dce9c44, 0xb747682a, 0x3fbfd201, 0xd4aeec11, 0x2cf782e6, 0x00cac341},
+            {0x64b92515, 0x9af44724, 0x52e860d9, 0xc7d16b40, 0x01c0b361, 0x2b56450e, 0x048d8432, 0x00020176},
+        },
+        { // 3 * 256^8 * G
+            {0x6690ca7d, 0xa70fa068, 0x8afed558, 0x1550e011, 0xe995e636, 0xba0fe6c4, 0xa53b707c, 0x0033d10e},
+            {0xa809ea1a, 0x7d479252, 0xf9b6331b, 0x2061746f, 0xa1feac9a, 0x1c9f0575, 0x6db68196, 0x02204b9a},
+            {0x3fd2075f, 0x24b9b8cc, 0xbdb25b29, 0x758869ee, 0x0a9c9b33, 0x14702413, 0xec188bfe, 0x06c319b6},
+        },
+        { // 4 * 256^8 * G
+            {0xcd6e54dd, 0x60101648, 0x577898a8, 0xe0dcedbd, 0x993b0686, 0xe5e8bdba, 0x7d4ad51b, 0x01ce2761},
+            {0x6d8acaeb, 0x85a01377, 0x4ac22382, 0x75581cfb, 0x05b8394a, 0x41943a54, 0xda564c4e, 0x06ad9c90},
+            {0xb34d1ab0, 0xce658e75, 0x12d37f5a, 0x4bc73773, 0x4591283f, 0xed4a6de2, 0x580ad2cf, 0x049185e2},
+        },
+        { // 5 * 256^8 * G
+            {0xb90e96ab, 0x6dca3b31, 0x59c42a75, 0x0b1e50ac, 0xc279f82c, 0x72d6cefd, 0x743f2ece, 0x04962ae5},
+            {0x1d7d58af, 0x68500cad, 0xb55308b8, 0xa3385c6a, 0x30297cf3, 0x7c7c3dc5, 0x8bad1ba2, 0x010e4ab6},
+            {0x7956f45e, 0x6827fbdb, 0xe47d7633, 0xb77ee6dd, 0x402fc286, 0x8ca5785d, 0x5d64e842, 0x0061392b},
+        },
+        { // 6 * 256^8 * G
+            {0x50311000, 0x9041857d, 0x5f3fcac5, 0x84ff18cc, 0xdf5adc6d, 0x93d1ab82, 0x747a4305, 0x016bef41},
+            {0x1ee27705, 0x4b6f5b50, 0x2de92b4d, 0x69542bee, 0x3fe112ff, 0x7500a2d0, 0xad5796d3, 0x01705294},
+            {0x3478d957, 0x14b6192c, 0x3bf4f165, 0xa7a53559, 0xab2f4a33, 0x503537b4, 0xfca7946a, 0x02c2bd1d},
+        },
+        { // 7 * 256^8 * G
+            {0x29c6a540, 0x335036a2, 0x23538eea, 0xf511a8ac, 0x298b419d, 0x9c57b7d8, 0x8205b1de, 0x0669ce09},
+            {0xa6b982fb, 0xb1474dd2, 0x3652b839, 0x9c8f171b, 0xb7172915, 0x79de9996, 0xda149da2, 0x074161a1},
+            {0x155fec60, 0x6530d093, 0x043ae4b1, 0xbaa70bec, 0xd98a9351, 0x9884344d, 0x89d1f483, 0x0583fcf0},
+        },
+        { // 8 * 256^8 * G
+            {0x7fe03864, 0xeb2ef279, 0x488602ef, 0x0444c45e, 0x67708dc5, 0x4868a91c, 0x9355c5b1, 0x0742ef2e},
+            {0x7abff0e5, 0x043cb343, 0x7bf431bf, 0x9ad619b9, 0xbf40a2ff, 0x6e870523, 0x185ea4e9, 0x0039d32c},
+            {0x2ebd535f, 0x2c77f9df, 0x2b96aa06, 0xdde566cd, 0x63994218, 0x9a095808, 0x106abcdc, 0x015391d9},
+        },
+    },
+    {
+        { // 1 * 256^9 * G
+            {0xafb8734c, 0xd11c4cfc, 0x3e530f98, 0x683e2c98, 0xd7efabcf, 0xe5443c98, 0x8a09dd2d, 0x038904d2},
+            {0x3e0868be, 0x4142dce2, 0x366261d2, 0x882ffb91, 0xf84ff06f, 0x6a3d3970, 0xf9fb9342, 0x0659de90},
+            {0xf7f7b0b2, 0xe74f5f80, 0x15903eb4, 0x28c20a1c, 0xa8bbf10d, 0x310db8a5, 0x4df344d0, 0x0427dbaf},
+        },
+        { // 2 * 256^9 * G
+            {0x9bc3bfb9, 0x28c2be07, 0x0893209c, 0x39d0fe41, 0xa58feb33, 0xd0e5acb7, 0x4cd861d4, 0x056e6dcc},
+            {0x3566372c, 0x42454706, 0xe7267d46, 0x601d6ae9, 0x12f90009, 0xdcc4cb2c, 0xf128d2bf, 0x04d69f1e},
+            {0x031d2b85, 0x0fb5f520, 0x1ee4cf33, 0x91a31baa, 0x61b3af44, 0x8b42dbf1, 0x1f976cfd, 0x02c5e41f},
+        },
+        { // 3 * 256^9 * G
+            {0x4e12b38c, 0xcedd840f, 0xa68d01c0, 0x8b5e44c6, 0xbea60344, 0x4c5722c5, 0xfdf5092b, 0x07ae80ad},
+            {0xc11663b1, 0x890befe9, 0xe9ddee96, 0xfdb7a90c, 0xd597343e, 0x9d573830, 0x795f44b8, 0x04521c7c},
+            {0x6c113fd6, 0x79bac5c1, 0x479e5d28, 0x7f1f7e80, 0xa46dda4a, 0x1114f15b, 0x07302356, 0x00b5279b},
+        },
+        { // 4 * 256^9 * G
+            {0xc7651ad8, 0xfae461fa, 0xb98ad210, 0xb88ca9ed, 0xb559ad5a, 0x160294bd, 0x529cde5c, 0x04ccc4ea},
+            {0xcfb12ff8, 0xe4c59144, 0xb88b7928, 0x1021d02b, 0xa92e0907, 0x19729b9d, 0xc28b0963, 0x072bfa33},
+            {0xfc92104c, 0xc01fe38e, 0x79be048e, 0x3867db63, 0x3256f146, 0xfec8bd46, 0x5bc026d2, 0x005f3ef8},
+        },
+        { // 5 * 256^9 * G
+            {0xa6f0f5f1, 0xfbb7b3af, 0x84b7f78f, 0x5638c79f, 0xb56ae324, 0x6dcd3f0c, 0xac9ac5cc, 0x01437372},
+            {0x48416aa2, 0x55a7cb0a, 0x14432c91, 0x48952e48, 0x8b1744c0, 0x7a1f8a2a, 0x87317ce8, 0x005ba350},
+            {0x98c3dd77, 0x70ac1b57, 0x8d2b4c5a, 0x27dd59c2, 0x73190aab, 0x75460fcd, 0x1b9d8d04, 0x056cdf44},
+        },
+        { // 6 * 256^9 * G
+            {0xf3b327e7, 0x266a6551, 0x3064e1ec, 0xdf1bec96, 0xa4b996ae, 0x99d4cee3, 0xe94c926d, 0x072e5655},
+            {0x0f244873, 0xb08ff995, 0x7327be5d, 0x9afc7f7b, 0x83181c15, 0x1fdc8002, 0xfd67f881, 0x0638fdc4},
+            {0x55622f13, 0x9893892a, 0xdc323b39, 0xca54c570, 0x44fa2599, 0xf5437d3c, 0xa02d6683, 0x0212fb31},
+        },
+        { // 7 * 256^9 * G
+            {0x1056fcf9, 0xcac06071, 0x3290647f, 0x851a090e, 0xe05941df, 0x3e32f218, 0x14f699e2, 0x0150e0ca},
+            {0x6e9d916b, 0xf9caf768, 0x6a56f11b, 0x207ab892, 0xa2316ad6, 0xcc279396, 0x2a5f6917, 0x01cee0e3},
+            {0x5984e919, 0x349ac323, 0xff618242, 0xf300bac2, 0xd317b8c4, 0x8642493d, 0x00392d96, 0x0057ce86},
+        },
+        { // 8 * 256^9 * G
+            {0xd599df26, 0x4b58c2d0, 0x367b58ae, 0x4ad22f4a, 0x9c91b751, 0xad0c038e, 0x113d5926, 0x005ebd37},
+            {0xf4ba9964, 0x9e6878bb, 0x05ac0b06, 0xbee465ee, 0xf6d55964, 0x0b072d5f, 0xd7b30f76, 0x0515d583},
+            {0x67a2b562, 0x3cc788d3, 0xb6cba329, 0x2534503a, 0x8c68570a, 0xe75ffc35, 0x51156192, 0x03cce051},
+        },
+    },
+    {
+        { // 1 * 256^10 * G
+            {0x3a35832a, 0xc5b90bbf, 0x50956fae, 0x3e96c59b, 0x36dcf45a, 0xcc4afaca, 0xd42795d4, 0x04199830},
+            {0xe1604c6d, 0x6189782c, 0x00e84abd, 0xfce5417e, 0x25318142, 0x4848fd99, 0x52983532, 0x034e2209},
+            {0xf8349c20, 0x56fc3b03, 0xb81aa29c, 0x0c57ca41, 0xfd4cf011, 0x4fc74b5d, 0xabc53329, 0x01e327dc},
+        },
+        { // 2 * 256^10 * G
+            {0xa4ba14f6, 0x33179e86, 0x52822a6b, 0x79b23c7b, 0xc306db28, 0xd8f4eaf0, 0x6fb31c26, 0x07bd5f4c},
+            {0x7a6f4702, 0x3a41ea3c, 0x1660e7c2, 0x0af929fd, 0x6d47296b, 0x7ec5b994, 0x0e2865e4, 0x04f961ec},
+            {0x41f351a2, 0x2861e445, 0xadf536e6, 0x6a3c32ac, 0x144400c7, 0x374abf19, 0x1332496a, 0x06edc718},
+        },
+        { // 3 * 256^10 * G
+            {0xab247996, 0xb0539810, 0x4f426a4b, 0xc68045df, 0x304fba27, 0xc1a7b131, 0xf1820c08, 0x03fd64da},
+            {0x702bf319, 0xeb2ed6a2, 0x3d347437, 0xc1ef5af4, 0x3d1def20, 0xb0dac4f6, 0x2ea598d2, 0x027b01d0},
+            {0x46f73d77, 0x8a3f5d67, 0x6a278d94, 0x8cf18a5a, 0x8dd2ea0e, 0xa1d08169, 0xb8558c7c, 0x0205857a},
+        },
+        { // 4 * 256^10 * G
+            {0x84f09fee, 0xd8ca58f6, 0x2873a4bf, 0xfa30d752, 0x05eb658c, 0x8ddcc9ad, 0x182f9dad, 0x055fb263},
+            {0xf85de244, 0xf5961f4d, 0xaa9e43da, 0xabf99793, 0xc7fe7503, 0xd4728c86, 0x08f63fd3, 0x04c99994},
+            {0x0fb80447, 0xa9f10376, 0x5c176f95, 0xabc8cf93, 0x0868e14b, 0x16648b96, 0x9db4e35c, 0x04a604aa},
+        },
+        { // 5 * 256^10 * G
+            {0x0a4d139e, 0x38ec3b00, 0x6c552356, 0xdc36ea07, 0xf49bc219, 0xd1b46d33, 0x0990a32e, 0x00b18d94},
+            {0xbabae2c9, 0xd3faf2b0, 0x02b7e07f, 0x8a138ef7, 0xeae08e25, 0x8f27119c, 0x4c0b6942, 0x0482f6cd},
+            {0x5a7c3a73, 0x79b692a6, 0x286fa9d5, 0x8e95a86c, 0x9a4ba2ac, 0x06deb5c3, 0x1ed3b094, 0x07429d7c},
+        },
+        { // 6 * 256^10 * G
+            {0x81942a0c, 0x9a0b9889, 0x25da9835, 0x05bddec2, 0xcb1e02f4, 0x05f702e9, 0x3cb24c9a, 0x07763950},
+            {0x3950ebee, 0x11118f3e, 0x133d45bc, 0xe7696c1d, 0x7ee89ab8, 0x6c5cdb04, 0x52ebe6ba, 0x05676e6b},
+            {0x45040977, 0x41a21539, 0x547c32c2, 0x9eb95ea3, 0xe2a79ec4, 0x7ca19eb8, 0x47b880d6, 0x00daea17},
+        },
+        { // 7 * 256^10 * G
+            {0x601fa32f, 0x06a1be90, 0xcc290a1a, 0x8ed6388d, 0x7cb1a243, 0xc95b4d28, 0x094d3208, 0x05a5c407},
+            {0xf5590d68, 0x763cd9f1, 0x5025db6f, 0x1322e606, 0x2309c1c7, 0xff589e87, 0x0da59fe3, 0x03bd6142},
+            {0x19bdfc05, 0xd51f9bd7, 0x346bfaba, 0x92c45445, 0x5f948135, 0xa762555f, 0x76117317, 0x0374ab6a},
+        },
+        { // 8 * 256^10 * G
+            {0xadf9d6c2, 0x1ea68ffa, 0x3f0cecbd, 0xdc902e31, 0x72a3a48c, 0x95ba19d3, 0x151a0600, 0x04be3a1f},
+            {0x43ee91a7, 0xac06b56e, 0x6f31f128, 0x4a939b30, 0xf2dcb16c, 0x11184f06, 0x35b0571a, 0x04365192},
+            {0xa69b29da, 0x3df6a90d, 0x5f09b034, 0x1455b616, 0xbadb7765, 0x844df812, 0x65a24254, 0x079bf005},
+        },
+    },
+    {
+        { // 1 * 256^11 * G
+            {0xfe8a9b11, 0x16b32ad3, 0xd4045dc8, 0xc5d877a2, 0xb62723a7, 0xeb537e61, 0x20153baa, 0x0707ea06},
+            {0x9d7fde4b, 0xfb1d26fc, 0xf20dcc7e, 0x6646c517, 0xe34af873, 0xd52c7552, 0x0c7543a9, 0x042d3b82},
+            {0x0f40a542, 0x2eedb0be, 0x62767669, 0x130b3aa6, 0x51028856, 0xc724b433, 0x2148c04a, 0x06838f04},
+        },
+        { // 2 * 256^11 * G
+            {0x0bb9af9b, 0x06528c8d, 0x59d3b84f, 0xa8a65d47, 0x594a8d77, 0x7d588abb, 0x3115d2e4, 0x0612de39},
+            {0x330c31f8, 0xc799df08, 0x5060d183, 0xc64a3b7e, 0xde85c068, 0x3091c435, 0xd209e1a4, 0x062fc56e},
+            {0x38343c9f, 0x040e474a, 0x1ceb19e6, 0x3fae0fa9, 0x2f254ca9, 0x59c1e7f5, 0x6ac05337, 0x07d27089},
+        },
+        { // 3 * 256^11 * G
+            {0x0b5b9677, 0x20258668, 0xf448e310, 0x11da3b9c, 0x50aaffd8, 0xdfa6ea9f, 0x1c11b5f4, 0x0250b974},
+            {0xedcc7548, 0x2edd50c9, 0x4d4127b0, 0x05d15e50, 0x80ccb6b5, 0xe8c30196, 0xb2cfdb15, 0x02790967},
+            {0x1b16c81d, 0x1d2b4b86, 0x8c681834, 0x2fdaf709, 0x14e1b315, 0xb7faaac6, 0x3128427a, 0x0161f898},
+        },
+        { // 4 * 256^11 * G
+            {0xf73d4991, 0x402ac488, 0x66e22825, 0xa37158d7, 0x943962f1, 0x5f1a48c5, 0x993c0f4a, 0x00ffc4c4},
+            {0x04db2504, 0xa40214f5, 0x024d3ae8, 0x0216d843, 0xde46dd45, 0x7e19b03a, 0xc3d1455f, 0x02672db7},
+            {0xf14134c2, 0x24e0100a, 0xd76c1adf, 0x9e9ad214, 0x9ec16b6f, 0x2487beeb, 0x87407593, 0x04bd2308},
+        },
+        { // 5 * 256^11 * G
+            {0xc9c7b78e, 0xa5ccdbcd, 0xa2937151, 0x08a9ef84, 0xc267089e, 0x0ade5fc1, 0x2c39fd92, 0x011b80e8},
+            {0xd8cfa468, 0x8bf772fd, 0x8796e920, 0x32add095, 0x3b08f11c, 0x3ca7be3d, 0xa7d7acb2, 0x01594bb0},
+            {0xb55b4a02, 0x3b29e08d, 0xea1ab34c, 0xa885c02d, 0x0e6b203c, 0xe3eb216b, 0x0042e962, 0x01180ea1},
+        },
+        { // 6 * 256^11 * G
+            {0x676fe42c, 0x5c51fcf4, 0xceecd0b5, 0x4a90e00c, 0x20083283, 0x4f1d176d, 0xe0ef94f9, 0x07fda558},
+            {0xfe9a4c55, 0x1d832272, 0xecaac6a6, 0x2f723b16, 0xcb2a21cb, 0x62eeb0d9, 0x3340ea2a, 0x04b0ad7a},
+            {0x804c3b89, 0x837938d2, 0x2ab492e7, 0x0691b37a, 0x0f64a348, 0xa7e67367, 0x190f403f, 0x040e6ef3},
+        },
+        { // 7 * 256^11 * G
+            {0x9fa4f63f, 0xc102511e, 0xce21c0fd, 0x07d15dd5, 0xed46fcae, 0xcd96ece0, 0xbe60299a, 0x05f5aeaa},
+            {0x51b0947c, 0xcfc9e283, 0x672d394a, 0xc479eb5a, 0xf5a4661f, 0xd76f36e1, 0xf32f1279, 0x04a50c6b},
+            {0x6638ac97, 0xe9289430, 0xfc2e8282, 0x3c73bda1, 0xbab70882, 0x53741cc9, 0x677b1793, 0x00800184},
+        },
+        { // 8 * 256^11 * G
+            {0x732f869f, 0x7c7091d5, 0xec2b311b, 0xc446627c, 0x0d77c51d, 0x7f1926cc, 0x17d115d2, 0x06748403},
+            {0x45d03955, 0xe50ab065, 0x0fa38ca3, 0x5052973e, 0x664a74b8, 0x76556519, 0xdf898fea, 0x055737e4},
+            {0xc52be511, 0xc51f61d8, 0xab0957d9, 0x983a6fdb, 0xe1dc4d32, 0x2c9cf85d, 0x6b89418f, 0x015f9b70},
+        },
+    },
+    {
+        { // 1 * 256^12 * G
+            {0xc097be6f, 0x1768aa05, 0xcd1ea7eb, 0xebb993e3, 0x4a05b34d, 0x02443bec, 0x7eab108e, 0x06ef6a19},
+            {0x9faa9558, 0xdc2c31cd, 0x0b41db18, 0x49421537, 0x6efbd481, 0xb1797b2a, 0xe67bd837, 0x0516a997},
+            {0x6b7891cc, 0x805edce1, 0xcef67b26, 0x082a63e6, 0x3cffd92b, 0xf47d9f0a, 0x8144b65e, 0x013c7a1d},
+        },
+        { // 2 * 256^12 * G
+            {0x63d90cd1, 0x51814385, 0xdb5ff515, 0xe8181f31, 0x98c90089, 0xf2c3c165, 0x5f5da375, 0x06b837c6},
+            {0xe95cdd15, 0x3eb0738d, 0xca5dc973, 0xfbe645a7, 0xfb5ac1a0, 0x45656425, 0xc2c5347c, 0x07a7359e},
+            {0x9db07a22, 0x3cd999bd, 0xdef85c35, 0xcd747bc3, 0x13b02998, 0x8a234ccc, 0x5047bce9, 0x053a4ca9},
+        },
+        { // 3 * 256^12 * G
+            {0xf5a4061d, 0x8bce52a8, 0x8e0378c5, 0x5da8526e, 0x9b194806, 0x28c6175d, 0x839d1c7a, 0x0193acfb},
+            {0x461b2877, 0x3e32fd6c, 0x2bb7fb88, 0xe644ec64, 0xc57f09dd, 0xf670cc66, 0x188f3613, 0x025627f6},
+            {0xc8a171e1, 0xb9a3558a, 0x275376fb, 0xb7f06a7f, 0x8cc0c1d9, 0x85c193ef, 0x17193a71, 0x016c2154},
+        },
+        { // 4 * 256^12 * G
+            {0x1fbe87b1, 0x8397d555, 0xaee4189d, 0x5e1811f4, 0x618208f6, 0x43bda305, 0x6a6978f2, 0x04dc5867},
+            {0x05326132, 0x5e12f4c9, 0x4fd34656, 0xeee3cfa8, 0x3c248365, 0xe6173cd4, 0x74b9bd1f, 0x04448524},
+            {0x4cdaaf0b, 0xe51c01fb, 0x9ec651c9, 0xfbfd4b2e, 0x0b922d25, 0xbf1093f9, 0xc656e41f, 0x0491fbc8},
+        },
+        { // 5 * 256^12 * G
+            {0x7a2058a5, 0x73c1d465, 0x676ff8b3, 0x1f2a81ad, 0x3ff76f3d, 0x598e3788, 0x2f7fef3c, 0x03175954},
+            {0x0d435f97, 0xcf3df660, 0x74a62025, 0x0f53740b, 0x3a83ca63, 0x94eb695f, 0xe978eee3, 0x051eb4be},
+            {0x64dd1f09, 0x3dff791a, 0x616e87a9, 0xff9257f5, 0x38d5673a, 0x2f723506, 0x5a1acdd9, 0x04c23be9},
+        },
+        { // 6 * 256^12 * G
+            {0xce600b26, 0x699415f6, 0x2ba34ad6, 0xf23b2b24, 0xc942c627, 0x9de22410, 0xb9aeafaa, 0x04cbf852},
+            {0x63d774a5, 0x821681de, 0xe41ad2e8, 0x1c762ad3, 0x0edaae36, 0xcde93de0, 0xd949ca77, 0x005f3ad0},
+            {0x9a8b1ad8, 0x574243c2, 0x6f757651, 0x68c5b944, 0x1535fcdb, 0x09542c43, 0xee631216, 0x0036b886},
+        },
+        { // 7 * 256^12 * G
+            {0xf4b0c86c, 0xffd47841, 0x96f6a2e8, 0x45769472, 0x9d5a0a0c, 0x9d04400f, 0x903d8d09, 0x0443a6d2},
+            {0x00c52518, 0xb417c045, 0xa1f00148, 0xdb50d0cb, 0xa1559b22, 0x03a50542, 0x0ac945cd, 0x013d207c},
+            {0x8e2fbfcd, 0xa77d410c, 0xbe8f20f1, 0x68a2301a, 0x5b73c363, 0xd68573f2, 0xfb08eb00, 0x01e2b815},
+        },
+        { // 8 * 256^12 * G
+            {0xff67bde1, 0xca707f4c, 0x5b6c7ac4, 0xbcc45dbb, 0x6aee5a4f, 0x9c46c5a6, 0xbcfdee60, 0x020df3d2},
+            {0xd4c7d2a4, 0xc0a8b058, 0xb44264f5, 0x68c0cbdb, 0x513282bd, 0x447117a4, 0x51935b19, 0x0362fd75},
+            {0x8b1974c9, 0x477c029f, 0x483322fd, 0x0f8f0472, 0xd7e04d3e, 0x717d2c65, 0x9d1af9d5, 0x03ad488d},
+        },
+    },
+    {
+        { // 1 * 256^13 * G
+            {0x4124ebc0, 0x0c5475ec, 0xe5a2f67e, 0x5be3daf7, 0x5a13a133, 0x6a58940b, 0xce004534, 0x07fd2b98},
+            {0x68c1741a, 0x7e25a434, 0x3c26f344, 0x8af58026, 0xef60aff3, 0x38ee7bb2, 0x12d707d5, 0x04352b77},
+            {0x7557251f, 0x8218395e, 0x7172eda9, 0xd8e87424, 0xc804f61a, 0xa27a89aa, 0x2527f0e5, 0x006eab61},
+        },
+        { // 2 * 256^13 * G
+            {0x3ddea6d2, 0x8a025b70, 0x05624e31, 0x6e7d4d7d, 0x18b0b93d, 0x7b4b3f24, 0xc0edd238, 0x07b50416},
+            {0x8034baf1, 0x83b364f6, 0x00c41aff, 0x3ebdf585, 0x1ed50f5c, 0x9a36134d, 0xb0d832e0, 0x03c3d14d},
+            {0x952d69cb, 0x8cac70d5, 0x213d0fbf, 0x260a0e6f, 0x4a34e9cc, 0xcd81cd92, 0x90c8d373, 0x00226054},
+        },
+        { // 3 * 256^13 * G
+            {0xcfecc246, 0xa4265c5f, 0x46467497, 0x82acb603, 0x8ce35833, 0xc3edca7f, 0x3be7423b, 0x007f55b2},
+            {0xa1d472e7, 0x52473e99, 0xcf4d842c, 0x2aae418a, 0x68ad59d4, 0xbe8536ad, 0xffbd6970, 0x048ae7a9},
+            {0x7708e1b5, 0xfe1b6e12, 0xe5612546, 0xe0cc3c08, 0x9b655028, 0x1e34d211, 0xbfd05e12, 0x04c95411},
+        },
+        { // 4 * 256^13 * G
+            {0xe199dbbf, 0x6ce571e7, 0x33ac1db1, 0x5a7d39cd, 0xb0da5bd6, 0xaf7b2459, 0xfa9839f6, 0x0378043c},
+            {0xfe8afba1, 0x8aa09cfe, 0x75a39c04, 0x817e8959, 0xd009746a, 0x038710b5, 0x67892b25, 0x066bdfd9},
+            {0x8d572b59, 0xa5e88e03, 0xac61784a, 0x55dbb0a4, 0x8843cf28, 0x4d17c4e5, 0x5a2b303a, 0x03c33b32},
+        },
+        { // 5 * 256^13 * G
+            {0x2318ea4d, 0x56cce217, 0x913e5819, 0xc0777848, 0x612b15d3, 0x57cdead4, 0xf719228e, 0x0613da47},
+            {0x76003634, 0x9cfbf680, 0xba76a4b4, 0x4e139be0, 0xba6f7e3c, 0x44585fde, 0xa1640c78, 0x050523c1},
+            {0x6e297dda, 0x7580b380, 0x8d64a57c, 0xe5dfcf9f, 0xd35f6791, 0x3cd5feba, 0x66229882, 0x04b8f960},
+        },
+        { // 6 * 256^13 * G
+            {0x3ad08588, 0x67715e9f, 0xf03cdd49, 0x22a735ef, 0x19b30fcb, 0x568a5978, 0xb9757b5b, 0x0182a6de},
+            {0x182f9d82, 0x47c13774, 0xdc1dc552, 0x74db45f8, 0xb610399b, 0x36592658, 0x1eeec6aa, 0x078450b3},
+            {0x4c4d0024, 0xdf88d735, 0xc722f4be, 0xaab625aa, 0xafb096c1, 0x14157fa5, 0x9d67b71f, 0x064075b3},
+        },
+        { // 7 * 256^13 * G
+            {0x7f11694b, 0x383a035d, 0x10de4f80, 0x22bb8b57, 0xa76b56f3, 0xb491baf0, 0x4d8dd2af, 0x04648bf7},
+            {0x2a191014, 0xd3729381, 0x35a7bbf4, 0x72ad1256, 0x15ce306f, 0xa671f7cb, 0x3c378603, 0x036bcf24},
+            {0x8e74ebb0, 0x94a42b45, 0x86c03523, 0x33f07ab6, 0x46ea39c7, 0xcf9202da, 0x59d872a5, 0x04bd95e6},
+        },
+        { // 8 * 256^13 * G
+            {0x824a69e9, 0x09b286da, 0x6cb47a9a, 0xa095ff05, 0x66f416cb, 0xa0aa7251, 0x3e087641, 0x0239a2da},
+            {0x1bc641f6, 0xff268c90, 0xe964a517, 0x32188dd2, 0x09c0d714, 0xb346bc16, 0x70351f6f, 0x010ff621},
+            {0x698a87c7, 0x576b6dfa, 0xbc92e992, 0xa1d65567, 0xd92d77b1, 0xe7509053, 0xeef5c9e5, 0x037d0b45},
+        },
+    },
+    {
+        { // 1 * 256^14 * G
+            {0x838bc1c6, 0x88939247, 0x64cba360, 0x4274a2c9, 0x14d4ad2d, 0x2b7be869, 0x93fd5eaf, 0x04c8ce69},
+            {0x3eef8e7a, 0x2e627095, 0xc76efebf, 0xae3dc24e, 0xa7190807, 0x0c27def5, 0x8b32a99b, 0x045f5ed1},
+            {0x5479646d, 0xa27d8345, 0x7dd6b58e, 0xe9ffcffc, 0xdb2748d6, 0x4482854d, 0x71d78c2b, 0x01968895},
+        },
+        { // 2 * 256^14 * G
+            {0x5b62dbad, 0x74890d64, 0x7bd8e314, 0x2d71c16a, 0xdbe57fd2, 0xe494597a, 0xa6bf8c59, 0x01f6beaa},
+            {0x968b74d6, 0x39b2b44d, 0x453d55b8, 0x380c9750, 0xdad86870, 0x71d5996b, 0xafce0a63, 0x0009c92b},
+            {0xafa0086f, 0xd1a19017, 0xc553ba62, 0x4df5a176, 0x06284821, 0x80a7c315, 0x4105a551, 0x04237b83},
+        },
+        { // 3 * 256^14 * G
+            {0x9c726a32, 0x87d18d8e, 0xf5fb684c, 0x3b1adfc8, 0x6b35bb22, 0x3363e69d, 0xdae28f15, 0x04380cd9},
+            {0xcda297d0, 0x17a1bc7a, 0xc7a907d6, 0x30894d34, 0x6ce87560, 0x23332d42, 0xd248d1e2, 0x07dacf0d},
+            {0x7d928912, 0x7040dd19, 0xaf56b22a, 0xfd677e46, 0x36e2be3a, 0x1127f56b, 0x23fbd874, 0x00f10252},
+        },
+        { // 4 * 256^14 * G
+            {0x3dcaee2a, 0xd883c0b7, 0xc130dec3, 0x714c549b, 0x755be2b4, 0xc0677ab8, 0x075c6219, 0x070063bb},
+            {0x493d2408, 0xedb5e95b, 0x6138627f, 0x5aff749a, 0xa6e86b15, 0xa262a8c0, 0x8ceef484, 0x073cf48f},
+            {0x806b2a4f, 0xd06b500a, 0x17bf9af8, 0x8a7b56c8, 0xaeda8ad1, 0x9cb2fcee, 0x2c5b6b50, 0x076aea02},
+        },
+        { // 5 * 256^14 * G
+            {0x9c9dd2c0, 0x6dae80c3, 0x9fac48c6, 0x77250b4c, 0xcbc1d8ec, 0xe23e1605, 0x625319f0, 0x015f0260},
+            {0xe16e7740, 0x6e7bda8d, 0x332b6ad3, 0xb70d796b, 0x9a5fecd8, 0xdd0b6af1, 0x3728454e, 0x02f1dd9e},
+            {0xd2eebe32, 0x4e8cf039, 0x85b9ccd6, 0xddb0a3c7, 0xf970b58e, 0x2f31be26, 0x04782ec4, 0x038ecf5f},
+        },
+        { // 6 * 256^14 * G
+            {0xd18ba76d, 0x7a21df3f, 0x34f5331d, 0xc1a4a1ed, 0x8d1efb93, 0x2cb02828, 0x5f300ee0, 0x01f3ee7f},
+            {0xf233cfba, 0xbbbbf9c5, 0x9fe9e18f, 0xab5084e1, 0x06338f70, 0xc34cab42, 0xafd444cf, 0x04142c65},
+            {0xe5f5e05b, 0x21d7208c, 0xf246933b, 0x8ed7029f, 0x86e9d8fe, 0x777bf4cd, 0x799ecea5, 0x01f5fffe},
+        },
+        { // 7 * 256^14 * G
+            {0x93cb7223, 0x1f14a408, 0x9d8dbe8d, 0xd87ab1ec, 0xd3129b03, 0xd7dc3be0, 0xbc19db5b, 0x01bcef57},
+            {0xecc00d77, 0xaa897ee5, 0x776e770b, 0x01e035a9, 0x3d0ef029, 0x91665ef7, 0x90d39921, 0x050463d9},
+            {0x20008189, 0xa827dde6, 0x19897c92, 0xc4d5798e, 0x916db8bb, 0x3da4b5ce, 0xe1feac6f, 0x015dec24},
+        },
+        { // 8 * 256^14 * G
+            {0xaa618d3c, 0x324b01ce, 0x010412ac, 0xcac3d217, 0xc24285f0, 0x2957dc7d, 0xe2378273, 0x03b85f04},
+            {0x3bae3537, 0xabbb2eb6, 0x330e7e5b, 0x996a57b1, 0xf38dcc6a, 0xd471a86c, 0x0cae6b73, 0x06dea5ca},
+            {0xf7836df1, 0xfe13af82, 0xb04d6aae, 0x24adbc27, 0x7030c8d8, 0xa2ff5616, 0x78d84f50, 0x005e349a},
+        },
+    },
+    {
+        { // 1 * 256^15 * G
+            {0xc61d723e, 0xc5097590, 0x19460f8a, 0xf7f61b18, 0x93e481c8, 0x9befd874, 0x0d78deea, 0x02892db6},
+            {0x9ec4c9e1, 0x5caff642, 0x10a13286, 0xa2ffa19a, 0xba37957b, 0xaab861d9, 0x267fe85f, 0x0059232a},
+            {0xf94f75e5, 0xe58ae51e, 0x9dea9e10, 0x7b099211, 0x9141c210, 0xbb092f98, 0x920a9c12, 0x031dae0e},
+        },
+        { // 2 * 256^15 * G
+            {0xfd7a4753, 0xcc23a21f, 0xa1535bb5, 0xd262f1ed, 0x2650b4ad, 0xebd18fba, 0x10a48d5f, 0x036ba50e},
+            {0x1e35ada9, 0x5d34cf6a, 0x0bb1b104, 0xe91417aa, 0xf058d482, 0xaa1d403b, 0x35a6e3b6, 0x02bee46f},
+            {0x4c1b23d0, 0x58e8e5fd, 0x1f53a566, 0xe3c3f03e, 0xfe042f78, 0x628b9ecc, 0x93db1fe7, 0x00828b3f},
+        },
+        { // 3 * 256^15 * G
+            {0xe0b9c757, 0x1ce7b777, 0x2a916a97, 0x8149a13f, 0xb22f153b, 0x3c4923ef, 0x6c01aa56, 0x0733c650},
+            {0xc7c94d19, 0xab970105, 0xceecc87a, 0x9966e967, 0xc19d615a, 0x0511b3c2, 0x93c38351, 0x0563dd40},
+            {0xc510cf31, 0x92f9bdf3, 0x1b64634c, 0x35193dbe, 0xb9069efa, 0x5d7085eb, 0x25888937, 0x02adfe56},
+        },
+        { // 4 * 256^15 * G
+            {0xb0ec1d11, 0x05c947fc, 0x35d1d9d8, 0xfe96221f, 0x4e990227, 0x33b26ef4, 0x90d730e0, 0x069f8cc5},
+            {0x264465b5, 0x84702e48, 0xad3f69e0, 0x1a280229, 0x39ada08f, 0x060b6d4e, 0xbd21e2eb, 0x05863fc9},
+            {0x01afc87f, 0x1ab343b9, 0x735bc022, 0x0df04ebc, 0x0b5effc3, 0x7b46fe43, 0xf086796b, 0x045f52dd},
+        },
+        { // 5 * 256^15 * G
+            {0xeca2017c, 0x76d18018, 0x093af2ee, 0x2aba7470, 0x2fc37b8e, 0xdfafd905, 0x3f25f05b, 0x044bab6a},
+            {0x40ee8125, 0x870c124b, 0x8afbd315, 0xa6ccbe77, 0x16359f48, 0xf6abe0a5, 0xbe8e8cda, 0x0023b140},
+            {0xbb339cc7, 0x922dbca5, 0x13889eb7, 0xb6be879f, 0xccbf7ca4, 0xd3cf481e, 0x27b1f674, 0x0467cfa2},
+        },
+        { // 6 * 256^15 * G
+            {0xe2395988, 0x4fb764d5, 0xd65a6deb, 0x7059f9e7, 0x1a38e608, 0x8d2fa0ff, 0x3992cf58, 0x02b5562a},
+            {0x4fd30547, 0x48c48221, 0x1c576391, 0xe3afb1e7, 0xd20fca47, 0x3c2c180e, 0x3a3ce235, 0x02b68767},
+            {0xbc0bb580, 0x5b0efba4, 0xed159fdf, 0x46b9f70e, 0x25312d75, 0xeeae69df, 0x9c3faf0e, 0x076e57a2},
+        },
+        { // 7 * 256^15 * G
+            {0xe0c59a4f, 0x5bd0b43d, 0x9edd320f, 0x4562c718, 0x2870a4b7, 0x55630c2f, 0x9a82b25c, 0x0108bbc7},
+            {0x9a0eec16, 0x8f7f355b, 0x029de209, 0x9f4f028d, 0x9ed13b29, 0xc8fde127, 0x24ac72b7, 0x04f743e9},
+            {0xd1f0f72d, 0x6b9db61a, 0x09e4379a, 0x546604e9, 0xc5c58abf, 0xf8eefd36, 0xabd3fc52, 0x02465074},
+        },
+        { // 8 * 256^15 * G
+            {0xb9cfadde, 0xdef1da11, 0xf50be34e, 0x447b9b0a, 0x4cbd45a2, 0x2f1e1684, 0x89316202, 0x04f2660c},
+            {0x84ecc6ed, 0x83daaaad, 0x9a6b1fe5, 0xcfa5a70e, 0x5fbd0281, 0x33deaaed, 0xc95506c8, 0x05455198},
+            {0xa9cd97d1, 0x9803b23c, 0x039791c3, 0xc65f6267, 0xa1f936d7, 0xf39dbd8e, 0x21418b77, 0x00f46c20},
+        },
+    },
+    {
+        { // 1 * 256^16 * G
+            {0xee076ef4, 0xe7642af5, 0xcd3372bf, 0x82818498, 0x8ac307e4, 0x21d1109a, 0x834bcec7, 0x013512e3},
+            {0xebfa77ac, 0x7aab7902, 0x8d8c4cbd, 0xb78d6925, 0xaf3f5c20, 0xf89c7f70, 0xf1ac99b5, 0x044bac00},
+            {0x8ca35642, 0xee5eda8f, 0x8ef486fd, 0xcef1959f, 0x57e11d6e, 0xe892648a, 0x9eabdfb8, 0x039659ab},
+        },
+        { // 2 * 256^16 * G
+            {0xbb988041, 0xd4b43481, 0x5f810ddc, 0x47d1646c, 0x4d089348, 0xc6d74619, 0xddc2d98d, 0x005ce164},
+            {0x8a58c828, 0xfe3b6529, 0x3ed6ec25, 0xc06e2d41, 0xe4874d7b, 0x741ed7f9, 0xb8eda368, 0x0380e320},
+            {0x3da699c3, 0xead2d897, 0x08977fc7, 0x8e3af8d9, 0xf8305a0d, 0x9de110fe, 0xd5c7abff, 0x07298b0c},
+        },
+        { // 3 * 256^16 * G
+            {0xe0d84c1a, 0x04628bd7, 0xca958cbc, 0x2309cf34, 0xdf8b9367, 0x011fde8c, 0x291bd448, 0x01d85a13},
+            {0xda9bfd33, 0x3f48f15c, 0xec752c16, 0xd9ed3427, 0xd5a1f68f, 0xc19d511e, 0xe3a174e5, 0x0687f0e5},
+            {0x94bbb397, 0x8f407e7f, 0x0c60f70e, 0xf0d613ac, 0x00a7d245, 0x2d7b5aa2, 0xbd0cbcea, 0x057451c4},
+        },
+        { // 4 * 256^16 * G
+            {0x2f080584, 0xca5bdbe0, 0x00784541, 0xd443b310, 0x66b376d4, 0x2fa681d8, 0x3fe30d4f, 0x0511e013},
+            {0xa58a0ce7, 0xfdf917bc, 0xab368d3d, 0xbadcd916, 0x78d9c137, 0x97ba7862, 0xbd96d482, 0x056c63d9},
+            {0x1f45ceb4, 0x882b1bba, 0xb2696e64, 0x3b2561b2, 0xc13183c6, 0x13e7d05d, 0xd90b39d6, 0x00e77f5b},
+        },
+        { // 5 * 256^16 * G
+            {0x4b8a48df, 0x649be279, 0x9652a5c6, 0x866591c5, 0x02b3edb0, 0x046b5182, 0x61ed7b58, 0x0527a24b},
+            {0xfe044f6d, 0x35e65714, 0x5d783fe5, 0x5cf7d34f, 0x00324182, 0x14a16a74, 0x56f5410a, 0x041fdf27},
+            {0xc86bfbaf, 0xbb9c73e1, 0xd96368f1, 0x5ad8c71e, 0x4b92d9da, 0x27b6acdc, 0xee2bf073, 0x0593a475},
+        },
+        { // 6 * 256^16 * G
+            {0xe38e78af, 0xc4ba6d7e, 0xa79ec672, 0x1ab3b43b, 0x16780bc1, 0xd2ebab08, 0x410339b0, 0x06387a80},
+            {0xa9b92afb, 0x23e49d5f, 0x98b56b1f, 0xe75897b5, 0x99d69bcc, 0xebda3ddb, 0x0a56dfc5, 0x051e2009},
+            {0x6a13ba7c, 0x2d687459, 0xec34efaa, 0xfb2cccf8, 0x0f658acd, 0xf95463e6, 0x9ab5abbf, 0x073daf3f},
+        },
+        { // 7 * 256^16 * G
+            {0xd50c9002, 0x327811c6, 0x8b5edc2d, 0x3aba060d, 0xa4201ffd, 0x5c3f9aaf, 0xc886e408, 0x07feb1c4},
+            {0x400252b7, 0xa149451e, 0xf988b2d8, 0x512e01b6, 0xc92160b2, 0xa89631d7, 0x0f47b2d2, 0x00f76001},
+            {0x19c5795d, 0x369801b7, 0x3258f7cd, 0x3f7c8dda, 0x2b80c50d, 0xe345585d, 0x3811f6bc, 0x052a1f4d},
+        },
+        { // 8 * 256^16 * G
+            {0x4ac5c4a7, 0xc69bc74d, 0xfb37e8a8, 0x6bdb2246, 0x09d9db06, 0x05cfb847, 0x9b746aea, 0x040ee7aa},
+            {0xda59898d, 0xacf47298, 0x75d61cf8, 0x7311b030, 0xb022e8c5, 0x5292e33b, 0x044a74c6, 0x0766ddea},
+            {0xe5ce86f9, 0xf9e4cd9d, 0xf1f5128e, 0xe5ba2421, 0x478d3afc, 0x4f6a0268, 0xc9f03b7d, 0x074f5403},
+        },
+    },
+    {
+        { // 1 * 256^17 * G
+            {0x06c7344a, 0x4269c503, 0xe6e437c3, 0xf8c383a5, 0xc243b52d, 0x37760da8, 0xba44c6eb, 0x005c3503},
+            {0x0ed8afd1, 0xf89da5f2, 0xedcba855, 0x13f2494d, 0x17234c0e, 0x20ada0e0, 0xf7738bf0, 0x04e4042e},
+            {0x22dc1545, 0xb5dfdff2, 0x3dc756b1, 0x09819c83, 0x2dddc6ef, 0x2ed353ab, 0x95b17c3a, 0x03f39404},
+        },
+        { // 2 * 256^17 * G
+            {0xa016d742, 0x5a5d2910, 0x8567b2e3, 0x21e0a5ac, 0xa524806d, 0xa7e417c3, 0x7a5731bb, 0x02d2a69d},
+            {0x3aa754ff, 0xb8e2debd, 0xf00dc6a6, 0x201309da, 0x7da38cc2, 0x8c656bc2, 0x47691586, 0x064e1520},
+            {0x5e166cbc, 0x50efe583, 0x8a6b31d7, 0x20b85bc8, 0xbf2cd6eb, 0xab1110d3, 0x77a90418, 0x052c6331},
+        },
+        { // 3 * 256^17 * G
+            {0x81aca3fa, 0xf9cb3f86, 0x283168aa, 0x22dd3162, 0x9ad558cb, 0x55c93966, 0xbdeda456, 0x006e468b},
+            {0x7409cbdf, 0x28c7ed11, 0x8113e4e8, 0x3a737fc5, 0x9ee021f4, 0xd27ace65, 0xa8aee858, 0x05ae7541},
+            {0xef44c555, 0x87ee2df1, 0x58eaf61e, 0x975d0cc0, 0x42b9a9d9, 0x24913162, 0x90ec5e27, 0x04bc9e4b},
+        },
+        { // 4 * 256^17 * G
+            {0x7de58e48, 0x230265c1, 0x9f7ce915, 0x50310d95, 0x4d48ace0, 0x8ba03531, 0x0c65c181, 0x0736387a},
+            {0x8697e891, 0x364fe03a, 0x149beab4, 0xd2584920, 0x5184776f, 0x69cfb526, 0x69ae465d, 0x054e4953},
+            {0xad618d97, 0x87f0bfdf, 0x4c899331, 0x6e2a12f4, 0x0b4abc62, 0xe2081760, 0x2b8a9d36, 0x01371651},
+        },
+        { // 5 * 256^17 * G
+            {0x9e161af4, 0x45fe221b, 0xbdd1aa06, 0x0f596bf2, 0xc64c3988, 0x5cd48569, 0xed087e23, 0x07a6e12b},
+            {0x68979fff, 0x82c9e1d9, 0xf2f98837, 0x1bf566a0, 0x000178a4, 0x5e18b718, 0xaa349c7a, 0x024b8449},
+            {0x0ad99597, 0x393fe8fc, 0x3c219c22, 0x2cff63c9, 0x1ae85d54, 0x7ac37ef2, 0x8a9753dc, 0x07a2da30},
+        },
+        { // 6 * 256^17 * G
+            {0xeec0ba52, 0x9a824a1e, 0xd9015b59, 0xebbf4bc0, 0x3be83c5a, 0xf889fcf7, 0x65e6d2b7, 0x02575ba6},
+            {0x75d9fbb9, 0x371dce87, 0xd6073369, 0xa36f230f, 0x73a219b1, 0x8271c363, 0xea9e609e, 0x02033d3a},
+            {0x1fdf13af, 0xed38bc14, 0x6e50daf9, 0x2d87f5f8, 0xe4e75585, 0xb4bed17a, 0x55398b4c, 0x0634420f},
+        },
+        { // 7 * 256^17 * G
+            {0x6c168bbc, 0x848592a6, 0x72140386, 0xf6bb2f6c, 0x7bd646e1, 0xeb62dd0a, 0xafb3e554, 0x07a03ffd},
+            {0x7a182b05, 0x61d81dd0, 0x310db9f7, 0x345263e8, 0xad9d1a5c, 0x51ad5865, 0x04c06432, 0x0564114c},
+            {0x7c5f91db, 0x3a6d89f4, 0x10bb2625, 0x94ff1144, 0x2b1a40dc, 0x5df709ea, 0x5d453d27, 0x01b336a8},
+        },
+        { // 8 * 256^17 * G
+            {0x4d4a85de, 0x788274f6, 0xb7d2950e, 0x35d0bb59, 0x9f6f739e, 0x36729244, 0xe4233181, 0x03a2fc4e},
+            {0xebb59acd, 0x4a4f443b, 0x5ed02a7e, 0xa33ce554, 0xce36b278, 0x5409c39f, 0x132993e5, 0x0275978c},
+            {0xfc771753, 0x7c1458fb, 0x46b9194b, 0x549dba26, 0x134f24f7, 0x3f86c04f, 0xa184f166, 0x064bd3cf},
+        },
+    },
+    {
+        { // 1 * 256^18 * G
+            {0x094e1aba, 0x6bd49d85, 0x243f28ca, 0x2dd94796, 0x2e45f30e, 0x5b93e230, 0x156a6e17, 0x012fda3d},
+            {0xba3c898d, 0xea9ecafb, 0x0ed8f73d, 0x61342665, 0x853e4609, 0x77779beb, 0x934148c7, 0x0105873b},
+            {0xf2a16102, 0xc4d3aa29, 0xb6a2caab, 0x7011a571, 0x87c5fb3a, 0x3609dda3, 0xc498d668, 0x007870e8},
+        },
+        { // 2 * 256^18 * G
+            {0xd4b494fa, 0xb07400ce, 0xf3fa339f, 0x7c2f7b4c, 0xbd822fd2, 0xfb8a04ab, 0xde65eab5, 0x07df3342},
+            {0x4ce50c96, 0xec51d238, 0x213e2bfa, 0x9bf21cd6, 0x556b4e64, 0x510b9fb8, 0x7cabee43, 0x065caceb},
+            {0x658c41dc, 0x20e737ac, 0x67a7c9e3, 0xdbf0a274, 0xb1054985, 0xd279c6c8, 0x8c4e8220, 0x06cdf228},
+        },
+        { // 3 * 256^18 * G
+            {0xee28ef65, 0x8210a3a2, 0x8f428ae5, 0xc7341f11, 0xd0fe041c, 0x4d053631, 0x96235a39, 0x0669d983},
+            {0xadaeae84, 0x0dd744bb, 0x4c7abe26, 0x54a16c00, 0x7bacba1b, 0x9cff96d0, 0x0dba9e5c, 0x05831a4c},
+            {0x4bc1582f, 0x7ad2eabe, 0xfe591f24, 0xc0823b9f, 0x8c4c1cc7, 0x26a7f467, 0x59223d17, 0x06788da0},
+        },
+        { // 4 * 256^18 * G
+            {0x3b6d050b, 0x62c4ce89, 0xf814c14d, 0x2fdd4ea2, 0x9621eaeb, 0x4f13d476, 0xc35b7061, 0x029dcacb},
+            {0x32ac7511, 0x22faaf54, 0xce9f456b, 0xdf4f7aa7, 0x042b0296, 0x428d3ae5, 0xe7d9de81, 0x047a2e7f},
+            {0x3b84b25c, 0xa6e4193f, 0xb8cbb80f, 0x1ab1648d, 0x694725ab, 0xfa9cdb16, 0x03f4cb2a, 0x02529d96},
+        },
+        { // 5 * 256^18 * G
+            {0xf310555d, 0x25a1cd92, 0xad02a1bc, 0x1f3be11c, 0x5cd7c895, 0x2664bc4c, 0x44917b9a, 0x05807e18},
+            {0x8dd3cad1, 0xe246bb3d, 0xd0c5023d, 0x6279705b, 0x7dfc9636, 0x48582ccd, 0xcf845ab7, 0x07bb473e},
+            {0x12ce8aaf, 0x5b74d329, 0x9849b2a4, 0x5919bcba, 0x547cc695, 0xdec70834, 0xcf4ab437, 0x066d1c43},
+        },
+        { // 6 * 256^18 * G
+            {0xfd1da2ca, 0xd6943103, 0xa4838aec, 0xbfbf3478, 0x1cac049a, 0xcb46a336, 0xfb2224ac, 0x02bc249c},
+            {0x6b5366f7, 0x6905e3dc, 0x107fee53, 0xc811ffc5, 0x97c3148c, 0x261c97b0, 0xda859e7e, 0x04144035},
+            {0xf38f92ed, 0x307258b5, 0x29f01a28, 0x9379a0d0, 0xadeb2f8b, 0x9d0fcac7, 0xea8f9f9e, 0x0176a2a2},
+        },
+        { // 7 * 256^18 * G
+            {0xd6a5f2fc, 0x942a3892, 0xfc73b745, 0xba1feb80, 0xa89220f3, 0xb0f0508b, 0x2acf1a13, 0x00d45fe9},
+            {0x91c96fab, 0x181a2b68, 0xbc3bbf2f, 0x1aaa9e7d, 0x138e1f69, 0xac3fd422, 0xed5a75e1, 0x014ea42f},
+            {0x9e1ed319, 0xa3b51297, 0x39cc52e3, 0x8b5aa2f4, 0x00ffe910, 0x3a08bcdf, 0x37cd4fab, 0x063ac2c3},
+        },
+        { // 8 * 256^18 * G
+            {0xa36ab64e, 0xeaeb6ead, 0x81fc15d6, 0xd0aece64, 0x29717a0a, 0xad659a72, 0x63278bd9, 0x00cbc1a1},
+            {0x1e14c4a7, 0x79b4c080, 0x5b4565ca, 0xd8da83a4, 0xb8db1a9f, 0x5eb4519d, 0x8b66f53e, 0x034472f7},
+            {0x99d93bf1, 0x3ab5c375, 0x06abd4d9, 0x55bc6036, 0xb359233e, 0xeb411790, 0x7eef307b, 0x01726dc6},
+        },
+    },
+    {
+        { // 1 * 256^19 * G
+            {0x20caaae0, 0x88745fdc, 0xf6978805, 0x9d764794, 0x7206002d, 0xf14503f5, 0x07c3ce6e, 0x07792523},
+            {0xf64c75f7, 0xc65c3ca8, 0x68280c59, 0xb7bacf00, 0x7330f042, 0x5a9d041f, 0xeb315ac5, 0x03037bf0},
+            {0xf0cf3494, 0xcb23149b, 0x336746e0, 0xa562a261, 0x4302920c, 0x95b3a515, 0xdfea3db6, 0x0283741d},
+        },
+        { // 2 * 256^19 * G
+            {0x14398104, 0x7d3cdd68, 0x9f645602, 0xce0f7926, 0xb3a99ac9, 0xd756118e, 0xad9f35ae, 0x036e4ac6},
+            {0xf949eff7, 0xc8f89eef, 0x4cb20a74, 0x27033834, 0x3860fa5c, 0x4c9f5100, 0x3cf3f3d1, 0x0357465e},
+            {0x040e2c2e, 0x35424321, 0x51358baa, 0xa24fd3a3, 0x63319b4e, 0x2bdfafac, 0xb4b54fd0, 0x03069136},
+        },
+        { // 3 * 256^19 * G
+            {0x061be856, 0x394fe236, 0xe0c55188, 0x52af7753, 0x8ed27b5b, 0xb5c5c229, 0xf7c703f8, 0x0793fb77},
+            {0xd903c669, 0x8a86754d, 0xfd58abde, 0x951141fc, 0xa6fc0b44, 0x8dc56262, 0x283f121c, 0x011f0ac9},
+            {0xaf583f27, 0x7fe3c953, 0x0c6aa209, 0x7be8a9c4, 0x641c296b, 0xfa1cabf0, 0x41dfa2b8, 0x07cb63b1},
+        },
+        { // 4 * 256^19 * G
+            {0x2479150f, 0x178f0011, 0xfdc88e92, 0x6a6978af, 0x5684a1f0, 0xfe9e6e04, 0x51945723, 0x05406b7a},
+            {0x6b1fbf06, 0x492bcbc1, 0x8feec11b, 0xc4a38988, 0x6548eca2, 0x00dc3834, 0x7deda020, 0x037894e5},
+            {0xcf72bd16, 0xddefc86c, 0xfdcb5335, 0x8d0653ae, 0x7504bd83, 0x172a706e, 0x8176ca37, 0x07bf2b63},
+        },
+        { // 5 * 256^19 * G
+            {0xbaca6d2d, 0x2379c128, 0x2a720869, 0x61a2f083, 0x8e75ecd1, 0x6243291b, 0xfda54cea, 0x04c584e9},
+            {0xe2f26013, 0x7942a4ac, 0xdd6dbdf6, 0x24ef5c95, 0x9c96ee8b, 0x0db1ee2a, 0x13fb2ea5, 0x03b182f0},
+            {0xec2c2e73, 0x8d0d3c13, 0x69bf9a1c, 0x4b071fdd, 0x1eb6e906, 0xa3b7c3a4, 0x35310d4a, 0x00c5c79a},
+        },
+        { // 6 * 256^19 * G
+            {0xd5312e7e, 0xc7c0d9bc, 0x635b1263, 0x0ed62708, 0x60130e3c, 0x8b1e51bc, 0x2d5cedb2, 0x01e3b85f},
+            {0x11612577, 0xdf344f61, 0x9dda5168, 0x2b8670cc, 0x604e3037, 0x972265e0, 0x884c4f9d, 0x00e776ae},
+            {0x8dc179f6, 0xee10041e, 0x1371f85b, 0x5c196c18, 0x489c7679, 0x316be865, 0x6ebb82ca, 0x047af39d},
+        },
+        { // 7 * 256^19 * G
+            {0x0650a970, 0x93b28224, 0x939277f4, 0x5a917b35, 0x0eadf703, 0x69b9b5d7, 0x37663420, 0x04aa05da},
+            {0x7269815f, 0xf84d903c, 0x27a7c6e0, 0x19e68577, 0xb537bfe2, 0xec3bdf1d, 0xd69b8ec0, 0x04ed2197},
+            {0x0eff8e8d, 0xde186095, 0x55ddb47f, 0xa32fa27b, 0xb3c8554b, 0x880acbf3, 0x8eb6eba7, 0x00167a5b},
+        },
+        { // 8 * 256^19 * G
+            {0xd20089fe, 0xeb18c115, 0x961a7763, 0xa5c0e7a5, 0x9175dfc7, 0x8844bf36, 0x62164131, 0x0642e1d2},
+            {0xfdbedf9e, 0x8b92565d, 0x643a3eb2, 0xf0d36df7, 0x1f08ed7f, 0x33b51f95, 0xbeca1cba, 0x06f1181b},
+            {0x2d36f81c, 0xee4e9450, 0xf0bc69b2, 0x607d2e3b, 0x20aa5937, 0x60332ca2, 0xc2a46729, 0x0773ba7f},
+        },
+    },
+    {
+        { // 1 * 256^20 * G
+            {0xc398e850, 0x07fe5892, 0x4323e8b0, 0x680a50c5, 0x5103714f, 0xb8a6dc3e, 0xc67191a8, 0x03027480},
+            {0x3578895f, 0x4fed348f, 0xe3111816, 0xedd9cf96, 0x24e5dfbb, 0xb28450e4, 0xcc8da6fb, 0x0272aa0a},
+            {0x873d9a5f, 0x74178004, 0x72188bfa, 0x12bdcbbc, 0x54e24b03, 0xb3be9b85, 0x34f3eaa1, 0x06e7c57f},
+        },
+        { // 2 * 256^20 * G
+            {0xff99a64a, 0x94eb0c72, 0x2ed74d77, 0xc89c4383, 0xd5cbdc33, 0x2b79dde2, 0xdd4731e6, 0x07d2bc05},
+            {0xcaaecbbf, 0xd1db38c2, 0x79aea805, 0x37fa1bfd, 0x32b097d3, 0xd134ab2b, 0x15f17251, 0x01d79fcf},
+            {0x9c9a8bc6, 0xb7dca80d, 0xe2b411df, 0x058b08cb, 0x21cb565d, 0x60644052, 0x2441d334, 0x0409da43},
+        },
+        { // 3 * 256^20 * G
+            {0x63ddb3a3, 0xd191658b, 0x6ca8f803, 0xf427bb5a, 0x045345ef, 0x1bebbc24, 0x53730a87, 0x05ee02d2},
+            {0x3ea621a5, 0x19936999, 0x702bb3af, 0xa0072af6, 0xdb334782, 0xac29e201, 0xa4209ce6, 0x07e0f742},
+            {0xe404e5b8, 0xd917e9f7, 0xec2dd58e, 0xa09fade3, 0xf14c0571, 0x11eafc48, 0x6e8a5e86, 0x06d1da17},
+        },
+        { // 4 * 256^20 * G
+            {0x011bcbcd, 0xd41e2ac5, 0x0ec082e5, 0x9df17d30, 0x7388365b, 0xc106471c, 0x35ba5ff2, 0x06bf4ac8},
+            {0x6b492091, 0xb6c0f411, 0xf73f27e6, 0x503b3b8f, 0x566d52a8, 0x51c11775, 0xb45f5660, 0x0694bba2},
+            {0xc9c42127, 0x8bcfdf4b, 0x87268e2f, 0x4954b59f, 0xd17cf1d8, 0x63f74139, 0xc9ea509c, 0x064adf92},
+        },
+        { // 5 * 256^20 * G
+            {0x51c67391, 0x3b42579e, 0x8935d579, 0xb0bddd02, 0xfe79d1fd, 0x3b7c405c, 0x702ce733, 0x01eef025},
+            {0x0ba198d3, 0xfad9ab19, 0x15fa7d85, 0x304c3544, 0xed3fec8d, 0xaa92c982, 0xc7bbac0e, 0x07c43a28},
+            {0x27fa53ec, 0x592ecceb, 0x6567d565, 0xb3b575d1, 0x59a475eb, 0x7bfafce7, 0x7f7aee24, 0x05c5541c},
+        },
+        { // 6 * 256^20 * G
+            {0xe5d6fa28, 0xec06bd22, 0xee6ccd94, 0xfe06a3d9, 0xe25ff538, 0x111e6721, 0x7d75d22d, 0x058e0a6c},
+            {0xf7af6d74, 0x29ebaacf, 0x31d26f8c, 0x355ca75c, 0xee46f671, 0xf79bb43f, 0x21d7d0ce, 0x033e5aa4},
+            {0x6e459d3a, 0xc57c5d24, 0x54721a39, 0x2b5052a1, 0x2931057d, 0x390d3290, 0x192b5cb7, 0x0762d5ae},
+        },
+        { // 7 * 256^20 * G
+            {0x06338cc3, 0xcd029de1, 0x297d50c6, 0x8c60d00b, 0xd1436f0f, 0xba25b2cb, 0x4396a851, 0x0052656f},
+            {0x879851a0, 0x596d704a, 0x4763ca75, 0x80adf79a, 0xab43ff5c, 0x2f2fbc27, 0x5f653191, 0x0757c7ad},
+            {0xec943233, 0xf78e38df, 0xcd1cc50f, 0x020a8a99, 0xd8ec3d36, 0xbdfe0acf, 0x0022653f, 0x02a7e1f9},
+        },
+        { // 8 * 256^20 * G
+            {0xf92e605c, 0xa473ca7e, 0x6fae138c, 0x582de44a, 0x77c6a445, 0xd8279d91, 0xa8762194, 0x0354211b},
+            {0xfe975c3a, 0xabb17f32, 0x6e41386d, 0x26cb7f85, 0x6db7b572, 0x2fe61f10, 0xa5e2c6f1, 0x0523a1bc},
+            {0x01ef7d83, 0x3ec0425f, 0x7e175adc, 0x94ca3e13, 0xe2529511, 0x0e2a776f, 0xf23f3f09, 0x00b669a0},
+        },
+    },
+    {
+        { // 1 * 256^21 * G
+            {0x8cab9a2e, 0x69887134, 0xb488a377, 0xc2d8e1b0, 0x9cd12705, 0xdde5ece0, 0x0a74793e, 0x029a352d},
+            {0x9a3c670d, 0xf56fa5ed, 0x58218d9d, 0x366c2e1e, 0xb712f4b3, 0x5a37e82f, 0xf40ed1ac, 0x018077a6},
+            {0x22197519, 0x66966f92, 0x6ab71583, 0x74eb36df, 0x8491b72d, 0xea23fd4e, 0x27d428b8, 0x0061e640},
+        },
+        { // 2 * 256^21 * G
+            {0x172dd675, 0x6e13baa3, 0xde7b4608, 0x0343a5ae, 0x11442fe9, 0x864b8226, 0x0a5c283b, 0x0128dc88},
+            {0xb0095883, 0x58cbd95b, 0x6a7b37a0, 0xee464269, 0xbbc8866d, 0xe6f53fae, 0x8a321894, 0x06437012},
+            {0xfcc54f94, 0xcf9245d7, 0x29255e9b, 0xe256bbac, 0x5dd6a831, 0x6145560e, 0xe1c428b1, 0x01e3c4a6},
+        },
+        { // 3 * 256^21 * G
+            {0x7e53b3db, 0x246deee0, 0xe61eca80, 0xe3790a17, 0x40ff0292, 0xff3abd2f, 0x89ecc9b4, 0x049171fb},
+            {0x2b7b7ac4, 0x7cde5d12, 0x549abc52, 0x532d8156, 0xd744efc8, 0xbcc6e1a1, 0x6240ea7a, 0x03b00565},
+            {0xccfab14f, 0xe7d238ec, 0x8d0c9730, 0xedc9934a, 0x9091a6b5, 0xa2e0a807, 0x334a191f, 0x01a8c1f2},
+        },
+        { // 4 * 256^21 * G
+            {0xffa05607, 0x5cdc2a74, 0xa82bfe57, 0x6d04fd1e, 0xb3f26c6d, 0xf08d98ff, 0x58fd377d, 0x03d81809},
+            {0x1f0d1b85, 0x73f58ac8, 0x730c814a, 0xf53bc606, 0xa936f255, 0x0d242545, 0x18e5979f, 0x03afd15c},
+            {0xe2b2c890, 0xa31a860c, 0xf13f59d0, 0xaa7df48a, 0x7f6a462f, 0x30f866a9, 0xac2d4908, 0x00d74df5},
+        },
+        { // 5 * 256^21 * G
+            {0x6ae414ef, 0xcc330707, 0xad8796cd, 0x583ef55f, 0x10fa1694, 0xf9f7f491, 0xd0293340, 0x003edc3c},
+            {0x7bc2b05b, 0x98ce7eae, 0xde3d6eba, 0x18cf08d1, 0xe3b0815e, 0x90bb3c7c, 0x0b0292cd, 0x00188b37},
+            {0x62c0047a, 0xc7ccd8e1, 0x6e0a5d24, 0x1d4c3140, 0x0e0ff615, 0x52e48671, 0x88ad9baa, 0x075221a1},
+        },
+        { // 6 * 256^21 * G
+            {0x9fc95994, 0x9e90441b, 0xc59e25cc, 0x34e2f5a6, 0xbeef02b9, 0x04e8c015, 0x363d2564, 0x0048882d},
+            {0x4437f14f, 0x65d1ad25, 0x1ea0ba51, 0xa44086fe, 0xf81f4958, 0x9d5fbf5f, 0x25e91984, 0x01c08987},
+            {0xb64fb6e4, 0x06a7a38a, 0x7c323ca7, 0xd95a8a1d, 0xf0ede7de, 0x15b08938, 0xe3283aa1, 0x06d6ce92},
+        },
+        { // 7 * 256^21 * G
+            {0xbf858c86, 0x9697a181, 0x6d1479e3, 0x2f32954b, 0x2dfcdaa7, 0x18ca5207, 0xecde62ee, 0x03e4ff50},
+            {0x1feccaf0, 0x5dffd93b, 0x6ce811a8, 0x98076ecb, 0x4af84d1f, 0xb0a5ef0d, 0xa9a6da85, 0x01398dae},
+            {0x67e11ae2, 0xd035300d, 0x5ba6e89e, 0xa8ba827e, 0xb31775c3, 0xab12ab28, 0x465b9f69, 0x01ea1b63},
+        },
+        { // 8 * 256^21 * G
+            {0x9defc27d, 0x9bd35078, 0x68260e58, 0x12ec5271, 0x9c660c33, 0xc652cf90, 0x6ac04081, 0x00fa983d},
+            {0x185fdb7d, 0xe516b5fc, 0x09f9afa9, 0x13f69ac4, 0x498c2d22, 0x3e33e862, 0x0043023a, 0x0307f847},
+            {0x6f36de0c, 0x5ac967a4, 0x2eff623b, 0x7e2a6c7f, 0x5912d44e, 0x2f551847, 0x6c9be3f3, 0x058bcc63},
+        },
+    },
+    {
+        { // 1 * 256^22 * G
+            {0xfab61b4e, 0x99f89d46, 0xbd230923, 0xbe27f146, 0x3a4bd606, 0x6df0dc69, 0xaec0f1be, 0x040bbd99},
+            {0x16433a23, 0xb5d92dc5, 0xcfe1ad24, 0xda8c790f, 0xa88c2b30, 0xfad3ee6f, 0xd5ea12e7, 0x01abd69b},
+            {0x85809853, 0x0cedf225, 0x52794140, 0xff2a9ea3, 0x1b6c2733, 0xa5cb17eb, 0xb0438801, 0x0314812e},
+        },
+        { // 2 * 256^22 * G
+            {0x34cd780f, 0xdb2c8926, 0xe748398e, 0x73df2966, 0x92d0a9fd, 0x58bf9a61, 0xd44cd3aa, 0x02003880},
+            {0x952fffce, 0xab28f916, 0xa3b8087c, 0x263ae4fc, 0xc3404734, 0x345977ab, 0xc996e21e, 0x025ccab5},
+            {0x4af98fa0, 0x5205b4cb, 0x0cb085bd, 0x1b5b519a, 0x73e0b38a, 0x8746baf3, 0xd50c7306, 0x034e8ce6},
+        },
+        { // 3 * 256^22 * G
+            {0x17462400, 0xfb363fe5, 0x807dbcd8, 0x415aeefc, 0x8c4308e4, 0x733f3025, 0xa179eaed, 0x03a8c641},
+            {0xaa0a522c, 0x24ed33d5, 0x65dba32b, 0xff8c6b45, 0x516be6fb, 0x800efe37, 0xb691e927, 0x02802af1},
+            {0x44a7a5e8, 0x826995fe, 0x46928995, 0xe0279fa8, 0x0e22bdae, 0x86f2f512, 0x47f402bc, 0x03ecbf11},
+        },
+        { // 4 * 256^22 * G
+            {0xf20b967c, 0x4b8f9ee6, 0xcb0c2dbd, 0x4a9438d9, 0x8ade21a7, 0xa52276ad, 0x96410a13, 0x02a6a604},
+            {0x2728c1ac, 0x435b316a, 0xfb1faae3, 0x08862793, 0xf33896b5, 0x88677586, 0x82cc0940, 0x07b805bf},
+            {0xa2984a69, 0x5f678e84, 0x27f0e83e, 0x4b5e1947, 0x5485c566, 0x73977018, 0xbaaf74aa, 0x04f24479},
+        },
+        { // 5 * 256^22 * G
+            {0xcc45cc50, 0x69a3133c, 0xd688bf5c, 0xe0b77b41, 0xa25bf045, 0xcf9cb646, 0xf17d8361, 0x021719ea},
+            {0xa7dca068, 0xab4a4a0b, 0x43907aac, 0x2fdac2bb, 0x37891119, 0xcb6d38fa, 0xf68327a1, 0x05ffd782},
+            {0xe604f30d, 0xe65289e0, 0xda429ecc, 0x4dbef4d4, 0x4bb792e8, 0x6e929067, 0xeaea9357, 0x01e51ae9},
+        },
+        { // 6 * 256^22 * G
+            {0xa803504b, 0xc30366b8, 0x95984a6a, 0xbe1a267c, 0x000b9c27, 0x589e1f25, 0x5940227f, 0x02aea5d6},
+            {0x088ed43e, 0x70d3ebf3, 0x2208b9b2, 0x442cddb0, 0x0d71ae30, 0x8d11ba9f, 0xac297fea, 0x07d6484e},
+            {0x56dd7a57, 0x3cd2547f, 0x87aac52a, 0xc79d1504, 0x1fab8fec, 0xe1f74bc8, 0x78dad7d5, 0x00089167},
+        },
+        { // 7 * 256^22 * G
+            {0x169b6ab3, 0xb1ef490d, 0x3a42ae70, 0xabf31f6c, 0x16c3ff49, 0xe8a704ee, 0x039d5806, 0x017bd017},
+            {0xc3289709, 0x44ef93f2, 0xdc688d1b, 0x4310801f, 0x862673f8, 0x2da12b9d, 0xe3a23127, 0x07951d89},
+            {0x56504dbc, 0x99bd9a13, 0xb1163c55, 0x037ff6cd, 0x5fedec1e, 0x2c9ede69, 0xc26fcf36, 0x02519457},
+        },
+        { // 8 * 256^22 * G
+            {0xe9b9dcd1, 0x2bb19f40, 0x6934f68e, 0x64758754, 0x167b4c5f, 0x7203e7ae, 0x730bf69c, 0x009ddd37},
+            {0xe994220e, 0xc14818a0, 0x788edf56, 0x2e5083e9, 0x3925b64e, 0xc30160fb, 0xcd6207f9, 0x03a9d491},
+            {0xd5790766, 0x56a1fe9e, 0x68063aad, 0xb4688d98, 0x6e9753c8, 0xbc9c8b36, 0x74d77657, 0x02f7a79b},
+        },
+    },
+    {
+        { // 1 * 256^23 * G
+            {0x32c479ba, 0xd326f262, 0xd1a6ca54, 0x8c186380, 0x96602b58, 0xb95c57c0, 0x3d203f9b, 0x058f9234},
+            {0x9c615baa, 0x3b43bb8a, 0x6267dd70, 0x4a31ed01, 0xaf7e5908, 0x799eb5b4, 0xa4b60190, 0x00026359},
+            {0x69c05580, 0x331b8cc6, 0x29adfe18, 0x8c2213a2, 0xfaf63964, 0xdb21acd0, 0x9c998209, 0x05c41a0f},
+        },
+        { // 2 * 256^23 * G
+            {0x759c5586, 0xdcb47aa4, 0x88d72305, 0x1e3ca56f, 0x6bd49a49, 0x8fc10bec, 0xf71eb3f1, 0x00fbe1c3},
+            {0x81b264e8, 0x0fc87d62, 0xaada9986, 0x57ba6849, 0xa2677bb4, 0x49999d44, 0xb98fa486, 0x0015f323},
+            {0xa708d036, 0xa73e52ac, 0x34f73a61, 0xeadd2504, 0x9e08a8a6, 0x5fa4d1b9, 0xaa66d629, 0x00a66d92},
+        },
+        { // 3 * 256^23 * G
+            {0xfd8b5a52, 0x98fec956, 0x87ce4577, 0xa0a4544f, 0xa3d1a9c7, 0x6c7a5598, 0xbb707fe9, 0x04937ff8},
+            {0x533da6a4, 0x8af3d1ae, 0xbec092d7, 0x6fe60cbd, 0xc965c863, 0x8ba82d83, 0xf7a7e38c, 0x014f3f03},
+            {0x478a759f, 0x6df29bff, 0xff3df013, 0xd2df06e1, 0x3d9b48d7, 0x4de2c0ef, 0xd1fd4fec, 0x01bf17a1},
+        },
+        { // 4 * 256^23 * G
+            {0xe9b46060, 0x88d3327a, 0x95082a50, 0x7e1f90b7, 0xcc0e914d, 0xff0c2999, 0x60f1c1d6, 0x029ed96c},
+            {0x9ff9808b, 0x1f64896d, 0xcd24e36b, 0x3208725b, 0x20c433f3, 0x658b18e1, 0x9140e72d, 0x06c96d7c},
+            {0x1cd903c8, 0x769ea282, 0x84a3c966, 0xdad8f637, 0xd8732cd6, 0xade6785b, 0x66381ccd, 0x0028abae},
+        },
+        { // 5 * 256^23 * G
+            {0xa973403d, 0xac32c8fd, 0x06d47062, 0x7ad90263, 0x1bac4c06, 0x2ac9c919, 0x35279c32, 0x0205a7fe},
+            {0xbf0dda3c, 0x4348043f, 0xc5ca2db3, 0xdf841b25, 0x928b96b4, 0x7f3b7264, 0xa7342ff6, 0x07781b61},
+            {0x77d16ce7, 0x5a95ad9b, 0x3e3ebec0, 0x081694d1, 0x8a456465, 0x39672d45, 0x3fb314d2, 0x069bbe7a},
+        },
+        { // 6 * 256^23 * G
+            {0x1c8dd67e, 0x01c906f5, 0x4a171973, 0x854059fe, 0x85164bc3, 0xdfec9d36, 0xe3a5d607, 0x03b3ae6f},
+            {0x0953ed3a, 0x2fc9b8a6, 0xd6cbad4a, 0x7ebb4fb7, 0x0e6055f2, 0x9396b8bc, 0x135fff77, 0x05bf1561},
+            {0x05b26f72, 0xc8ea181f, 0xa1af1ee0, 0xad3608ad, 0xd790ca07, 0x1fb32b43, 0x5a45e75c, 0x01a7c64b},
+        },
+        { // 7 * 256^23 * G
+            {0x2b344469, 0xc72ac3aa, 0x8918a5b8, 0x348e12aa, 0xe53bfcc7, 0x6375468e, 0xe11225f2, 0x016fada8},
+            {0x476b55cc, 0x83b4d754, 0xfaf1f2c5, 0x56c5b8d8, 0x555c8fb2, 0x920afec2, 0xd56d2f8d, 0x05db9f14},
+            {0x6200862a, 0x5a2b135d, 0xcafa2609, 0x024f92ba, 0xe47f15b6, 0x9c7033df, 0x92625ec8, 0x04779db3},
+        },
+        { // 8 * 256^23 * G
+            {0x6ae33244, 0xb4061e95, 0x79305abf, 0x8bfffddd, 0x26f0abd4, 0x7f8e22a0, 0xb506f530, 0x0572fe07},
+            {0x4b1c25e8, 0xc85c9dc3, 0x6ac67012, 0x4235228b, 0xdac99f65, 0xe6dd8593, 0xd20decf6, 0x043daa6b},
+            {0x3bd73cc0, 0xa214bc9d, 0x0cfaa63f, 0x5c44dcdb, 0x691adfc7, 0xcf70a0ac, 0x547c20c0, 0x0373b90b},
+        },
+    },
+    {
+        { // 1 * 256^24 * G
+            {0x3f329dd0, 0x2e388979, 0x8702b84a, 0x4d1ea3d7, 0x3d66701d, 0xa334ea56, 0x9605fe6b, 0x04f1d707},
+            {0xc525c2d9, 0x826e5fb0, 0x855eba09, 0xb947caf9, 0xb78a7243, 0x557bf4b0, 0x785e9007, 0x0750053e},
+            {0xa60cb5e6, 0x84990ff1, 0xd9053cf0, 0xe0a66aea, 0xce8e59fb, 0xd03643e5, 0xee98e083, 0x05b3dc8a},
+        },
+        { // 2 * 256^24 * G
+            {0xa815f984, 0x4367290d, 0xb2b41ecf, 0x4a20cf96, 0xaed533b6, 0x16997bda, 0xbd578075, 0x056ff160},
+            {0xb43df79e, 0x871582c7, 0xda3f4044, 0xc85df7a2, 0x9772b1cb, 0xe947152c, 0x6c59f587, 0x0283bd17},
+            {0xd1740f93, 0x012798d8, 0x8603ff30, 0x6723d582, 0xbe7eccf2, 0x4073dd30, 0xe493bddc, 0x042bf087},
+        },
+        { // 3 * 256^24 * G
+            {0xe343e6e5, 0xe3a0c301, 0x5249ec65, 0xfacadd92, 0xa4edd09a, 0x696dcda9, 0x16b2ef10, 0x05aaa310},
+            {0x26b015e3, 0x3ab51809, 0x0c9a6acf, 0x924c20f5, 0xf24339c0, 0x82550567, 0x5cb0095e, 0x06b9fb38},
+            {0x259bd21e, 0x886d67dc, 0xc8c42f67, 0x0b75cc04, 0x4c2e2b34, 0x0d705e6a, 0x933ec9ff, 0x068bb85c},
+        },
+        { // 4 * 256^24 * G
+            {0x07558ef3, 0x2fa77450, 0x077a3e59, 0x01aa1f6b, 0xef791883, 0x66c2e9f9, 0x4cae58ed, 0x044061af},
+            {0x82ffc655, 0x1894cb69, 0xd3b95d3d, 0x703d2dfa, 0x124151fd, 0xe85a3095, 0xa5a3f11a, 0x05584649},
+            {0x1f4271b0, 0xe2ffa52f, 0x68517533, 0x7bb37e42, 0x5cf34040, 0x6c8da506, 0x9a2af349, 0x03e7397d},
+        },
+        { // 5 * 256^24 * G
+            {0x311a44e6, 0x1513f5b4, 0x1b4515bd, 0x7dcbcf8a, 0x112a74a8, 0x5ce88ad0, 0x29defc94, 0x078822a6},
+            {0xfd917f11, 0xa932a3c9, 0x8877206b, 0xd17e45cc, 0x25382e58, 0x6bd0e88d, 0xad868c62, 0x070b4792},
+            {0x07ca9090, 0x4279a877, 0xa4a4cdcf, 0xde198a53, 0x5f53871a, 0xda65f838, 0x8a4737a7, 0x02f5b727},
+        },
+        { // 6 * 256^24 * G
+            {0x9880fddf, 0xd39bd72f, 0x9886f036, 0x2f38da24, 0x0af97e56, 0xb734a736, 0x089cfa1b, 0x07669a63},
+            {0x110c6347, 0x22d349ba, 0x597da621, 0x0924e2a4, 0x6226d7d4, 0x00aed127, 0xa1d17a3f, 0x0716998c},
+            {0xe2f1fc64, 0x8c0c0ce9, 0x6c6752d6, 0x4b8ee70e, 0x63211214, 0x9830637b, 0x9c08c75f, 0x014d6efe},
+        },
+        { // 7 * 256^24 * G
+            {0x1592102c, 0x82061106, 0x5e52ae80, 0xde67f629, 0xe5a1d5e4, 0xa2519b33, 0x60441e52, 0x00a03cf1},
+            {0xcd943bd4, 0x1a20242a, 0xf88b73e2, 0xec108f7f, 0x0a99911f, 0xce80c220, 0x243c8be4, 0x032abec8},
+            {0x5196a5c7, 0x827e85f2, 0xcffec76e, 0x371c0837, 0x53cf492b, 0x3c009b2f, 0x8369d9aa, 0x0342716c},
+        },
+        { // 8 * 256^24 * G
+            {0x0c1005ac, 0x898cbdfb, 0x8ec27c70, 0xdf481f2f, 0x13bef1b0, 0x82c76ed3, 0x4c3ccde8, 0x03f9a9cd},
+            {0xee325768, 0x496ae0ce, 0x2eff6db5, 0xb574f6cd, 0xc34e636b, 0x78db1118, 0x691be7ac, 0x04168c7b},
+            {0x9b0f0cf4, 0x71ce99bb, 0xa8b281b1, 0x87bf2d04, 0x129d953b, 0xb9f1fd45, 0x530418f1, 0x01863c6d},
+        },
+    },
+    {
+        { // 1 * 256^25 * G
+            {0xf3d44b42, 0x7a6f128b, 0xf4a9ad58, 0x8f868142, 0x5047c3a6, 0x601408e1, 0xd7bdfced, 0x00544f07},
+            {0xfd78cccc, 0x5c956f74, 0x19e42f48, 0x7284039d, 0x43f5aefc, 0xc2129d2f, 0x21f0de4e, 0x06c7ce0c},
+            {0xa9cc6f64, 0xd7cb19d2, 0x2929c45d, 0xe30c04ac, 0x0de32a87, 0xfd407378, 0xe2dbd846, 0x009cb971},
+        },
+        { // 2 * 256^25 * G
+            {0x9c45a319, 0x91270f81, 0x10310265, 0xa32ad30a, 0xb29ab019, 0x24bc3688, 0x8a6a0363, 0x0059db7d},
+            {0xf8e41078, 0x1f0485c9, 0xef76ff28, 0xd922dccc, 0x6e82c4e6, 0x6def1ad2, 0x45e3e539, 0x06ff23a0},
+            {0x8c88294d, 0xfc256b86, 0x8e74cb11, 0x55b55e3b, 0x7cd8d266, 0xbcf7cdae, 0xa1565453, 0x010c2855},
+        },
+        { // 3 * 256^25 * G
+            {0x3ecb1662, 0x29e5f8f8, 0xa227f3c2, 0xb9cebfff, 0xa3a4ee9a, 0x724d7a3f, 0x8feef6b6, 0x00daa0cb},
+            {0xdeb1af5b, 0x0beaa0e3, 0xdf8869d0, 0x2b3d2fd9, 0x9b2f876a, 0x196ea487, 0x5194d1f6, 0x07f76c48},
+            {0x68f7f202, 0x0faa14fc, 0x7fc65f0e, 0x7b6ba0d6, 0xc54a54a7, 0xc733d41e, 0xf69d9a4f, 0x032e4a31},
+        },
+        { // 4 * 256^25 * G
+            {0x3a15f122, 0x5974f726, 0x9ee8623b, 0x08fe733e, 0xec07154f, 0xfa937635, 0xef444f7b, 0x07bc16c1},
+            {0x6e2670b6, 0x77264d2d, 0x999ba79f, 0xdcad9f26, 0xa750492a, 0xbe1a5482, 0x5452afec, 0x000bf6a5},
+            {0xbe490147, 0xf317cc35, 0x05a511b1, 0x4f6fb9ad, 0x2141e5ec, 0x606e686d, 0xcaf69033, 0x02b6b397},
+        },
+        { // 5 * 256^25 * G
+            {0x471dd936, 0x664b469c, 0x20afc597, 0x3bbf0a72, 0xd1210e69, 0x9f6d01ba, 0x09702d5c, 0x008b98ae},
+            {0x61effbb7, 0x37e37327, 0x6eedce16, 0x62f9dac7, 0xbc8936c6, 0xa8595586, 0x004a83ac, 0x07840a8f},
+            {0x8b706dff, 0x6091b598, 0x751bdd5c, 0xd48f7de3, 0xadc4a402, 0xa762e7e9, 0xfefbbc9c, 0x079f873b},
+        },
+        { // 6 * 256^25 * G
+            {0x63625b3d, 0x0b936b81, 0x6b226be7, 0x08a886ba, 0x68179fa6, 0xb98897dd, 0xf85983e0, 0x06002eda},
+            {0xac627d66, 0x876e7d08, 0xfb3cd59c, 0x64bfd38a, 0x8afb87ea, 0x32bcfa68, 0xb626a8dd, 0x03ea452d},
+            {0x6c29102b, 0xb92dac42, 0x5a80d0ca, 0xb664535e, 0x4fc3cee2, 0xc2616195, 0xb31b84a9, 0x043a1771},
+        },
+        { // 7 * 256^25 * G
+            {0x3f7d848c, 0xbfeeef73, 0xd4397bb3, 0x7a029f9a, 0xbcfe9d96, 0x61f267cd, 0xde3d6d61, 0x00bcb429},
+            {0x04ad6b07, 0x8e3ab168, 0x535f7f75, 0xb712902f, 0x9b667ab0, 0x9a0e8462, 0xd208d4ef, 0x066090a5},
+            {0xf50bda9f, 0x446a81e0, 0x8cda9395, 0xd6857549, 0x25ba0e9f, 0xf0e5d61b, 0x9c8c7e00, 0x05c072e3},
+        },
+        { // 8 * 256^25 * G
+            {0x2fa25f46, 0xdecfaf8e, 0xf9507c1a, 0xbd71dd4c, 0xf05c3c03, 0x0214b3f8, 0x09869a3f, 0x052ea49d},
+            {0xeaa09309, 0x6991a071, 0x520e1749, 0x59b4508e, 0xd3fc4b59, 0x26452675, 0x9abd1fcd, 0x038181ce},
+            {0xdb8c79b5, 0x798633d2, 0x4c0be76c, 0xeb3bcf76, 0x6f12cf05, 0xe740a819, 0x2b014127, 0x055af508},
+        },
+    },
+    {
+        { // 1 * 256^26 * G
+            {0xee549771, 0xbd4b2a85, 0x90efbe48, 0x6c032d5e, 0x93e43c93, 0x76aa573f, 0x3f93352f, 0x05e6c741},
+            {0xb7a88c05, 0xb901369e, 0xcfb7a441, 0xc68e32be, 0x2239a046, 0xf90aa30c, 0x3d48ce32, 0x05e40543},
+            {0xf8ebc7ea, 0x31c7fede, 0x99568ab0, 0xeedfae74, 0xa65dafaf, 0xef59336c, 0xeb157216, 0x00e7ebf5},
+        },
+        { // 2 * 256^26 * G
+            {0xd06cf28c, 0x107c0115, 0x7d2d258f, 0x8e3ac064, 0x8cde8aed, 0x13bda749, 0x319bb44d, 0x073dcc18},
+            {0xf878874a, 0xad53c151, 0xc67dbb65, 0x60421165, 0x01433507, 0x2dfa543a, 0x615195ac, 0x0239da57},
+            {0x54e5a37c, 0x62b4fd9f, 0x91287543, 0x45441201, 0x154370fe, 0x62ee339b, 0x6049293d, 0x06254011},
+        },
+        { // 3 * 256^26 * G
+            {0x21bf36f7, 0xbb45fa98, 0x2b142234, 0xaf70a971, 0x48d2f2bd, 0x0449cc21, 0x6ac34bd3, 0x01e53d58},
+            {0x3f513313, 0x766c9d59, 0x09d4cf20, 0x2d58d65b, 0x37618bd7, 0x249cead3, 0xe4d79b32, 0x043443f6},
+            {0x22969693, 0x01415b14, 0x0fdc32a5, 0xcef283b5, 0x6100e7c4, 0x197e2cae, 0x5476a995, 0x016d505b},
+        },
+        { // 4 * 256^26 * G
+            {0xa70f7201, 0x70286cc5, 0x600bd575, 0x4e278b40, 0x5f5e0508, 0x3216110e, 0xa46ff678, 0x05ac7f37},
+            {0xd43a0f3e, 0x1f344868, 0x5bdc2d84, 0x018f7c8f, 0x0e053470, 0x2b7b2879, 0x079958ad, 0x00f57d51},
+            {0x2420a236, 0x78549634, 0x7abfe254, 0xf3429e37, 0x0da2cf04, 0x0b748074, 0xb242f8f0, 0x0411547c},
+        },
+        { // 5 * 256^26 * G
+            {0x4eab337e, 0xc30bf3f5, 0x49a71bc7, 0x235996ef, 0x61c66cfd, 0xafb3fbad, 0xdeda8ed9, 0x0140a53a},
+            {0xce2b3bf3, 0x1010da68, 0x64a37cdf, 0x31196871, 0xa330a543, 0x41fb6499, 0x3d1e71c6, 0x0046e534},
+            {0x88cc6a8d, 0xa115bbc1, 0xc662a2bb, 0x95df9f6f, 0xf466c4e6, 0xc37a4459, 0x0356b16a, 0x014b9640},
+        },
+        { // 6 * 256^26 * G
+            {0x5f2586cc, 0xfcb3de74, 0x3ffbf37f, 0xa3c21657, 0xef968f07, 0x6b8c4270, 0x624488d3, 0x07d783e4},
+            {0x33cd25fd, 0xb25bc852, 0x80ba657e, 0x1d94d5ef, 0xcff78622, 0x2c8c76a6, 0x6e86a654, 0x035b9cd8},
+            {0x179f6f59, 0xff9ef5de, 0x8c2bab7e, 0x34d55dd4, 0xaedf626f, 0x87fbc292, 0x2dc74968, 0x0747b088},
+        },
+        { // 7 * 256^26 * G
+            {0xc0843ea0, 0xfe1a5623, 0x45d5b2d6, 0xf10a9aaf, 0x66bbbde3, 0x639a514a, 0xe7847d3d, 0x07b288b8},
+            {0x7fd97066, 0xe45e98f1, 0xab52431c, 0xf14f0c6f, 0xd8b09e09, 0x2c1b4cb0, 0x7526c9da, 0x05fc14a0},
+            {0x8d6b5ff7, 0xe9db82b9, 0xb4b2f5c9, 0x67d58e33, 0x484f00c5, 0xab227361, 0x869f3dad, 0x0029f89c},
+        },
+        { // 8 * 256^26 * G
+            {0x0e875241, 0x61493e6d, 0x97ea7497, 0x9da14885, 0x38468552, 0xc1556c64, 0xf41499e5, 0x00125c9b},
+            {0xf78a0ba5, 0x3adbba90, 0x9e8ab787, 0x8dd960c8, 0x1b36fc5b, 0x104a4c0f, 0x75169fc1, 0x02dfdd41},
+            {0xc7657f9f, 0xb4e69541, 0xd8d1b1ab, 0x0a488e44, 0x96b57014, 0x6337f61c, 0x334bef08, 0x0501bc29},
+        },
+    },
+    {
+        { // 1 * 256^27 * G
+            {0xd528597c, 0x28561603, 0x67c747c4, 0xd7248d9a, 0xba436c01, 0x7a8cef5a, 0x47638d68, 0x0747ffb9},
+            {0xb3f447ef, 0x617c7fb9, 0x996b1f1a, 0xe81bc0b7, 0x9bc0baf7, 0xb5185e7c, 0x04f0ac61, 0x06d44003},
+            {0x94900986, 0x04124d32, 0x731aa6be, 0xe71b5d48, 0x436ae57e, 0xf13b15a8, 0x05cdf877, 0x02c3f3e0},
+        },
+        { // 2 * 256^27 * G
+            {0x1b6e1d9e, 0x7b3334ea, 0xd9a256e0, 0x0646e472, 0xf5f7dfa5, 0x261001f4, 0x8792d028, 0x0370f310},
+            {0x6ba058d6, 0x2a8618c0, 0x3eead668, 0xd1329b47, 0xb2766186, 0x6cfd686c, 0xf82d5e58, 0x068f9c09},
+            {0xceb72a2a, 0xad0bd938, 0xc464e46c, 0x31bf560e, 0x8d01b3c7, 0xfee973a6, 0x60e326f6, 0x04e79ffb},
+        },
+        { // 3 * 256^27 * G
+            {0xb90443ae, 0xf60a4496, 0x37ab3fa7, 0xc295e17d, 0xa6251f34, 0x108b1089, 0x7c446551, 0x018cf235},
+            {0xa3baf0de, 0x22c5184a, 0xcc20641b, 0x76395c26, 0x4efe45ae, 0x4cdb1f55, 0x52aad9ed, 0x073db0bd},
+            {0x36ce132a, 0x6b69ede1, 0xe66d8509, 0xb488ecd9, 0x07ecb87d, 0x5c483210, 0x384c2861, 0x003caf75},
+        },
+        { // 4 * 256^27 * G
+            {0x7ca21f08, 0x62fc5bcf, 0x53b46574, 0xeaf684c0, 0xbac691bb, 0x7d69c775, 0x338c6f18, 0x06ae1cdf},
+            {0x932e61b4, 0x933b3e7e, 0x196f09f4, 0x0cb3e754, 0x680c7ee9, 0xbf5834b4, 0x96f6d53f, 0x00510023},
+            {0xc7ae91a0, 0x04c794e7, 0x9f10def0, 0x7900d752, 0x570a93b9, 0x5e308fd4, 0x4e707593, 0x0798d70c},
+        },
+        { // 5 * 256^27 * G
+            {0x70e9a900, 0x966fd304, 0x5d62c107, 0x6732b4bc, 0x8f76739c, 0xd28a8f16, 0x8344b6af, 0x06734f3f},
+            {0xba5ba04e, 0x1640712d, 0x3220deca, 0xfca998f1, 0x4a3196c9, 0xa833bbd7, 0xb7733300, 0x06cae4d0},
+            {0x96e36b2e, 0xee08f504, 0x5c73edc2, 0xeae375bb, 0x68c28e44, 0x7df870c8, 0x2967085c, 0x013f00f7},
+        },
+        { // 6 * 256^27 * G
+            {0x557b0d87, 0x9bf4b58b, 0x4a0e9924, 0x2e474345, 0xd1d85b35, 0xded11e10, 0xed914c19, 0x0519adc5},
+            {0x2123fe97, 0x432883c3, 0xb078f5ee, 0xbea9d384, 0xd3d8da2d, 0xe7991d2c, 0xe51ec44b, 0x06025128},
+            {0x3ceec59d, 0x7d3d70a8, 0x9d9073a4, 0x0697fdab, 0xb3d00aad, 0x02868052, 0x03c45a58, 0x076b9c44},
+        },
+        { // 7 * 256^27 * G
+            {0xdd3bc9dd, 0x2a856a2c, 0x844a163e, 0xe786d430, 0x5e0d1e9f, 0x408d146d, 0xdc7637f4, 0x05c97e9c},
+            {0x5a0de8fa, 0x45d54e19, 0x8e2381cb, 0xe9042740, 0x7290fbc7, 0x3b39432b, 0x646c0c85, 0x04cfd609},
+            {0xa7aaff83, 0xbbc26055, 0x970de559, 0x72a7bb54, 0x7a28bee8, 0x7c54c808, 0xd009b71a, 0x066da024},
+        },
+        { // 8 * 256^27 * G
+            {0x5ae29dd3, 0x1edb0011, 0x05a29c6e, 0xe7017bf1, 0xdd74d642, 0x95126567, 0x7fe50787, 0x02afdd8f},
+            {0x94377a7a, 0x26f45f34, 0x002f05a2, 0x435ab2a7, 0x68b8a05d, 0x0da79803, 0xf8d49046, 0x04861a55},
+            {0xc632f311, 0xd73ff142, 0x9cd8bd60, 0xd7344876, 0xd1fdac85, 0x23d99076, 0xd0f056bb, 0x006d9eb7},
+        },
+    },
+    {
+        { // 1 * 256^28 * G
+            {0x0f180960, 0xd1c7d34b, 0xc2042857, 0xc2a91843, 0x5b23bfa2, 0xd0fd5a07, 0x73bc9306, 0x00805a05},
+            {0x19abfd0e, 0x94d0ec55, 0x3b880d09, 0x725233e2, 0xd34141d7, 0x4eba6ea2, 0x74d0be14, 0x06663cfb},
+            {0xf123a7de, 0x66565b6b, 0x62893568, 0x9e1ec85e, 0xd9ad7443, 0x230ae072, 0xd3fa0666, 0x03767f1f},
+        },
+        { // 2 * 256^28 * G
+            {0x37bd04a4, 0xa265dcba, 0x1d1c2768, 0x35c1f29d, 0xc22f5b0f, 0x1fa40ead, 0xc016e928, 0x052d013e},
+            {0x9c5418ee, 0xaa5a9269, 0xe62369da, 0x68611fab, 0xd7324d92, 0xffdeab26, 0x2d2c8cce, 0x075c5bf5},
+            {0x9d19fcaa, 0xea1c8f5a, 0x523e24ad, 0x15416c18, 0x2e1f2d2e, 0x93244a28, 0x91040914, 0x0269b65d},
+        },
+        { // 3 * 256^28 * G
+            {0x89ad310d, 0x23b86840, 0x462a99cd, 0x7c54e31b, 0xc515d479, 0x6e95485b, 0x3de4930c, 0x00db4e13},
+            {0xa97e213a, 0x39c56f41, 0x11b53d3a, 0x458d4828, 0x19effbc2, 0xbfdff938, 0x7d0293ee, 0x0107f945},
+            {0x36f4befa, 0xa715d187, 0xecb7b699, 0x6fd82ed3, 0xcdaedcf0, 0xcef1a57c, 0xf2afd7f0, 0x029b3661},
+        },
+        { // 4 * 256^28 * G
+            {0xedb94d05, 0x443e23d4, 0x70fb7168, 0x106ad333, 0x4b45e113, 0x6161a26c, 0xa8060a70, 0x03124bf4},
+            {0x6db97313, 0x26dd78ca, 0x5238f79e, 0x184cf7a8, 0x70b35f36, 0x7b810f36, 0x7a6f2bda, 0x02e151e2},
+            {0xbb6a7227, 0xa056903c, 0x05fd2276, 0x694bd278, 0xf0311ed3, 0xdba9f697, 0x6afbe094, 0x03e3f08d},
+        },
+        { // 5 * 256^28 * G
+            {0xadb8bce5, 0x08d0e5e4, 0x445c3da3, 0xc6f189e5, 0xd2a21003, 0xe65cf515, 0xb29abd82, 0x05339f2a},
+            {0x55e3347f, 0x12110ad3, 0xcf24859b, 0xa5f3914c, 0x5f287317, 0x14a1b741, 0xfcd0a924, 0x072c24b4},
+            {0xee9a39ec, 0x3e0be9dc, 0xafb00f55, 0x82c674fb, 0xc1b9db22, 0xe01b808c, 0xe065cfbd, 0x012acb0b},
+        },
+        { // 6 * 256^28 * G
+            {0xc4000869, 0xc3f5dca2, 0x53d1fb1a, 0xe5a5a19d, 0x27395eee, 0x2ae8ba30, 0x5dbd34d2, 0x0264eef4},
+            {0x98c5d609, 0x58db0487, 0xa49f6c99, 0x7b9f770e, 0xcb2f47aa, 0x2234cc57, 0xc1b8a897, 0x04a300e2},
+            {0x3adce82f, 0x7d0e91da, 0x6421357b, 0xaf630cf9, 0xaf8e4670, 0xfc6c4a63, 0x549dda24, 0x02b1f6cd},
+        },
+        { // 7 * 256^28 * G
+            {0x6e96e1b8, 0x813816dc, 0xa5731c27, 0x9dc6521b, 0xc6b5efdc, 0x182177a7, 0x70d641b4, 0x042fa4ad},
+            {0xbdfca2eb, 0x180b4c28, 0xf4e1e37d, 0x3aeba738, 0x1140aa78, 0x8d3e6291, 0xb302cd7b, 0x03029017},
+            {0xd8ecc760, 0x967956c9, 0x6a659c06, 0x0628bd1e, 0x01591023, 0x0549c1eb, 0x88bc24b2, 0x04b930d3},
+        },
+        { // 8 * 256^28 * G
+            {0x2b6dc219, 0x0c519d86, 0xef1015df, 0xbfbda37d, 0xdd2b501c, 0x7f1b1c6d, 0x4e9732b9, 0x06f2fb1b},
+            {0xd701b830, 0xcbb8af99, 0xba5e87c1, 0x9cdb81b8, 0x88277518, 0xd4fcb0bd, 0x67a5dbca, 0x04bcf54f},
+            {0xd9dec2a6, 0xbf8bebe0, 0xd4ea9db7, 0x0d311feb, 0xedcef8d6, 0x17ffdd49, 0x5cae90a3, 0x00e2065f},
+        },
+    },
+    {
+        { // 1 * 256^29 * G
+            {0xda722652, 0x30504d8f, 0x0979e023, 0xbe6954f1, 0xc2a18a8d, 0xc417134e, 0x254bef87, 0x065644c3},
+            {0x0e031785, 0x519a36ca, 0x089ce9b0, 0x91ef2b13, 0x8d34be97, 0x43eb4c58, 0xa045776e, 0x077da97c},
+            {0xa1aaf61c, 0x64bd6e76, 0xa0a1443f, 0x4f771a08, 0xa17ba5f7, 0xd81bff8e, 0xd614eb81, 0x0413e615},
+        },
+        { // 2 * 256^29 * G
+            {0xe064c6ca, 0x95b15809, 0xcfafadd0, 0x4b478c34, 0x02d0724e, 0x1d1d743d, 0xfac77653, 0x014bfb55},
+            {0x6921aa00, 0xb126314a, 0xa6486c8a, 0xe8cbac44, 0xfbb4e794, 0x91d9e383, 0x564b2b38, 0x017ab7fa},
+            {0x9581646c, 0x06062887, 0xf6812d71, 0xd5e658bc, 0xe6c139e3, 0x962be7bb, 0x9156d745, 0x053ec1cd},
+        },
+        { // 3 * 256^29 * G
+            {0xc170fa4b, 0xe94ace75, 0xa2977ee3, 0x2a4665d3, 0x9912af51, 0xb13339e0, 0x30792bf9, 0x00695e3e},
+            {0x04cd8224, 0x8d0ce1c8, 0x8520f5d4, 0xc5a7b686, 0x91e6bf72, 0x711f388f, 0xe2008d3b, 0x0237120b},
+            {0x0d04f288, 0x0d3ce8de, 0x9f3a470c, 0x59bbec6c, 0x32d8695d, 0x07f527ba, 0x415904b6, 0x014db575},
+        },
+        { // 4 * 256^29 * G
+            {0x650d2082, 0xee6ae0ca, 0xe0805725, 0xaabde3fa, 0xce513bd2, 0x6fb05608, 0x9db4a471, 0x02d0638c},
+            {0x8ec4fd13, 0x06abca08, 0x61c20926, 0x40d452bb, 0xf1de368d, 0x82cda199, 0x6d2927ec, 0x049bedf7},
+            {0x6d928fe1, 0x0770be42, 0xe62d851b, 0xd196131b, 0xe1de428c, 0x2ea2a2f6, 0x84d84d35, 0x047686e1},
+        },
+        { // 5 * 256^29 * G
+            {0x7f2e0f43, 0x717a1077, 0x4e6b1ebd, 0x01e0463d, 0x850280c0, 0x95077189, 0xe7800f59, 0x05cb48fa},
+            {0x721d3c9d, 0x60f83c1a, 0xf7e9477c, 0xf273fc4a, 0xf83fec54, 0x9ced1683, 0x33c87bc0, 0x00db2174},
+            {0xf781b91a, 0x833bae50, 0x3bf43533, 0x7923b116, 0xef525f82, 0xbdd0d57f, 0xb2f9d3db, 0x00f62e76},
+        },
+        { // 6 * 256^29 * G
+            {0x353f7ccb, 0x36b6f7f7, 0xc81bb697, 0x66faf2fe, 0x7e838708, 0x5d6fdd63, 0x08969400, 0x00147816},
+            {0x1aa1f6e0, 0xb44da147, 0x9d37a14d, 0x5adc63ae, 0x6b24e3ba, 0xed04e987, 0x78ac3218, 0x044573b7},
+            {0x9a897e9e, 0x53e77cc7, 0x30b66db8, 0xe4b0054d, 0x2366af73, 0x834ad504, 0x43c5b004, 0x05844128},
+        },
+        { // 7 * 256^29 * G
+            {0x28135531, 0x5cff7125, 0x0c98e513, 0x1837d9cf, 0x9f8f62d2, 0x37618bfd, 0xf5fde1f6, 0x00141708},
+            {0xb9f587c1, 0x6a44571a, 0x20ec8d13, 0x718a0df3, 0xea51cf68, 0xc379022e, 0xfa26aa27, 0x05f4374c},
+            {0xbd6ae135, 0x319aed88, 0x0b551f60, 0xcff8cfb0, 0xa28b5c2d, 0xb074013a, 0x081c6d77, 0x0423472d},
+        },
+        { // 8 * 256^29 * G
+            {0xe9dd02b5, 0x05790666, 0xdcc724e6, 0x697df953, 0x133aafda, 0x4e1f3d9f, 0xa83c126b, 0x07feb21c},
+            {0x389448d9, 0x949abad0, 0xb5c2d430, 0x57fce62f, 0xc25e5b17, 0xcec2be2c, 0x069862df, 0x06f591fb},
+            {0x9eefd1fb, 0xa98270c0, 0xe50f1674, 0x38780e51, 0x4040ff27, 0xfa2a2df4, 0x8d43b670, 0x01f50ff8},
+        },
+    },
+    {
+        { // 1 * 256^30 * G
+            {0x7577a70a, 0x786e9ae7, 0x1202b535, 0x2f281f75, 0x1dc664ba, 0x4392869e, 0x620c27c9, 0x0022bc10},
+            {0x99a84655, 0xbb9b07b0, 0x4ab4b1e0, 0x25a26b28, 0x1832025a, 0x67fd27cb, 0xa1928b3e, 0x0121ec21},
+            {0x3740be35, 0x63fde4ca, 0xf9ae5ae2, 0x69ec7bda, 0xa1227786, 0x38b6be4e, 0x76c7face, 0x072ac394},
+        },
+        { // 2 * 256^30 * G
+            {0x39f75018, 0x3143ac4a, 0xeddaa0db, 0x983e96f7, 0x0624c2d6, 0x92bf8fc4, 0xbfee3338, 0x05d119d6},
+            {0xb1f295ac, 0x6ec15a7a, 0x93423f9b, 0xd6e7a738, 0x2f7449ea, 0xd3137930, 0x3aafc1e3, 0x0686c79f},
+            {0xa51d7952, 0x86ac021d, 0x1d8ae323, 0xfdccd196, 0xceb89c84, 0x209585e3, 0x7b046b3d, 0x040d63c5},
+        },
+        { // 3 * 256^30 * G
+            {0xf81a79a1, 0x725ec851, 0x3a9f951b, 0xb45cec73, 0xe7b3b009, 0xbbb81cce, 0x4851f925, 0x011b37d9},
+            {0xb4af3cc1, 0x07c3458d, 0x8ed8f800, 0xa73a906f, 0x225c1378, 0xedbdb31f, 0xdebd9c82, 0x014ca80e},
+            {0xd5ac4981, 0x8b3ca243, 0xc13f4245, 0x96d3d34f, 0x7db4cba9, 0x39d10698, 0xab276ef1, 0x0666a8b9},
+        },
+        { // 4 * 256^30 * G
+            {0x547924ad, 0x09e26d13, 0xfbe029e2, 0xc501bd1f, 0xc68ba68a, 0x56fd47b8, 0x6e0526de, 0x00122540},
+            {0x101b6152, 0x11a9ed7f, 0x00a3eb15, 0xec2404ba, 0x9391f70a, 0x57aa4443, 0xa08dc4e5, 0x02a922e9},
+            {0x9550edcc, 0x5d25c5e1, 0xf3db371d, 0x2264683a, 0x3178f74d, 0xdd0be41e, 0x5f29e2f3, 0x015c59d6},
+        },
+        { // 5 * 256^30 * G
+            {0xfc780e7f, 0xe58515d9, 0xf44cc269, 0x5e6f1df7, 0xa666d85a, 0x708ade0a, 0x9ce27d8a, 0x04670d43},
+            {0x1c1e7959, 0x205b23e9, 0xf1d78664, 0x7cb857ac, 0x52de1ea5, 0xfa91c132, 0x2835cbb1, 0x023a62d1},
+            {0xe249b465, 0xb5004d3b, 0x83cfbf39, 0x6be4097c, 0xa3eea3fd, 0x5c9427cb, 0xa8d94590, 0x00556317},
+        },
+        { // 6 * 256^30 * G
+            {0xb44a0503, 0xb0004cab, 0x46315d8f, 0x9c1e6353, 0x4ce745aa, 0x830a2677, 0xed50349f, 0x00a61163},
+            {0xd389e9ee, 0xbedaf912, 0x18f9ef24, 0x9439a536, 0xb758907a, 0x34329862, 0x58709e2d, 0x027336ce},
+            {0x8e60f463, 0xae7f6937, 0x79789ce0, 0x87a884f0, 0xf6d5b43c, 0xf61c8ac8, 0x0609b398, 0x0242942a},
+        },
+        { // 7 * 256^30 * G
+            {0xd768132c, 0xd6559a88, 0xa3da1493, 0xd8adb988, 0x300a85dc, 0x89459a44, 0x99e5ccc3, 0x03a76146},
+            {0xc1ca9999, 0xe205d85a, 0x06d84721, 0xd5b9000f, 0xf747e78a, 0x4c8fca22, 0x357111b3, 0x032ef2fc},
+            {0xc2287c7b, 0x3dfbafdf, 0x5b9a0559, 0x5f15b960, 0xea3b2a0f, 0xf544f829, 0x7ddd3f50, 0x0382833d},
+        },
+        { // 8 * 256^30 * G
+            {0x32803ede, 0xae1f9184, 0x35b7682f, 0x596a54a3, 0x4382b436, 0x91df86fc, 0x77183312, 0x03c54968},
+            {0xf48038fe, 0x7d0f6641, 0x4f753f94, 0x0c070393, 0xeeeb23db, 0x3f4db69e, 0x9ca2a4c2, 0x062b7df0},
+            {0xa8f46ff4, 0x378d250f, 0x0e2cbcbd, 0x43cb0d2d, 0x14342d33, 0x81f8d75c, 0xf817f20f, 0x07c68874},
+        },
+    },
+    {
+        { // 1 * 256^31 * G
+            {0x70f36294, 0x638513fe, 0x26a5b60f, 0xb62eb29d, 0xc527049d, 0x781471fa, 0x41c96ae2, 0x0718ab1d},
+            {0x26b8cfbd, 0x5cd9a6a7, 0xbb2ef946, 0xac9bf89a, 0xcd8df504, 0x2107d977, 0xe8c0819c, 0x01485b29},
+            {0x9f8e2949, 0xbc87de6e, 0x6513af75, 0x02480570, 0x56c1de26, 0x6d387ecb, 0x63fbb449, 0x0226d1fc},
+        },
+        { // 2 * 256^31 * G
+            {0x14320156, 0xd567a760, 0x7ba54a3a, 0x45aaee20, 0x44ceaf5b, 0xfd859683, 0x2fe18e35, 0x05c8f70d},
+            {0xe647849d, 0x324cc90d, 0x3c7c7423, 0xb13a3098, 0x5e4932c2, 0x955670bf, 0x507f3053, 0x04f5cb96},
+            {0x61dc9896, 0x6e80307b, 0x38e99b63, 0x3bddf56e, 0xaf0d89e0, 0x21f03f7b, 0x6c0a71b4, 0x0028c10e},
+        },
+        { // 3 * 256^31 * G
+            {0x6ef330e8, 0x81285e12, 0x1c1b71ec, 0x1a82de92, 0xe7ab956b, 0x480f148f, 0x4f1ef84b, 0x06379bfb},
+            {0x84b81f2c, 0xa20d646d, 0xd9d66d36, 0x38ac26b2, 0x1e04e0b2, 0x85f6ca61, 0xdd1eb0db, 0x0193e20d},
+            {0xdaf73dac, 0xa7ea356a, 0x0b9c9611, 0x2f4c4798, 0xc35aa00f, 0xb680d359, 0x61cc5185, 0x00fbfeac},
+        },
+        { // 4 * 256^31 * G
+            {0x345edce1, 0x241e84ae, 0x99c25242, 0xd0f175f3, 0x5bf9fa47, 0x16544cf2, 0xd5a85654, 0x035d41d1},
+            {0x642523f7, 0xaad0ea95, 0x07fda4a0, 0x44e390fe, 0xadb11c8d, 0x9283d96a, 0xf76dbcd0, 0x074b7107},
+            {0x2013162d, 0xb6c09952, 0x58c47412, 0xf386629c, 0x52590db1, 0xd366db31, 0x33d3babf, 0x0503c77c},
+        },
+        { // 5 * 256^31 * G
+            {0x34e2c3fc, 0x97e8038e, 0x23e771f6, 0x9de36312, 0x18e0d53f, 0xf9572723, 0x4f85a205, 0x07c0663f},
+            {0xef3ea806, 0xa943520b, 0x52bc081e, 0x2b3cb530, 0xadf7a144, 0x0caa5964, 0xdfa74e81, 0x0563b1a5},
+            {0x9a70f938, 0x5e48952b, 0x70b2c250, 0xf181b9c3, 0xcfb5aa58, 0xd0a790d2, 0x70fedf31, 0x05c5aa4a},
+        },
+        { // 6 * 256^31 * G
+            {0xd45332d4, 0x34f28c1b, 0x8b8dc5e5, 0xa9e22aea, 0x71a8ab46, 0x620df72b, 0xdf4740c0, 0x0647d58c},
+            {0xf7a92415, 0x2a648b13, 0x7648ba49, 0x8abf9b16, 0xee6f9827, 0xb0d80bc0, 0x005256d6, 0x01277a4b},
+            {0xfe844d19, 0x1e4d8755, 0x7fe5f9d3, 0xa4175cc2, 0xbd01382f, 0xe132e3d1, 0x38a667ab, 0x01b3ec12},
+        },
+        { // 7 * 256^31 * G
+            {0xadba8e57, 0xb2c171ad, 0xd13fe262, 0x3e6e7da0, 0xecfd566a, 0xbc9778d1, 0xaf92b838, 0x0582b517},
+            {0x92e03409, 0x2c918e0f, 0xb5dcfa58, 0xfc6fc1b4, 0xac90797b, 0x4ae14f81, 0xdaf2604f, 0x04f2b528},
+            {0x1925d1c8, 0xde44ae84, 0x6f9361cf, 0x5e458798, 0xc53872fd, 0x10648c0d, 0xe1096d94, 0x0332603c},
+        },
+        { // 8 * 256^31 * G
+            {0x2d2af4f9, 0xe0d59456, 0x7f432eae, 0x3e094650, 0x526f3e52, 0x86aa6c49, 0xe11c3d98, 0x05162a79},
+            {0xd6fde568, 0x058906b5, 0x28c3729f, 0x2297a726, 0xe3ffcd78, 0x4a4b2510, 0xa0ec4f9d, 0x0487c94b},
+            {0xa270566d, 0x9e235e6a, 0x0990758e, 0xa4731966, 0xe795c21e, 0xd5827afb, 0x8fb3780c, 0x07e23d85},
+        },
+    },
+};
+
+#endif // CURVE1174_BASE_TABLE_H_
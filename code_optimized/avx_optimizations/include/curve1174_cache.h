@@ -0,0 +1,91 @@
+#ifndef CURVE1174_CACHE_H_    /* Include guard */
+#define CURVE1174_CACHE_H_
+
+#include <stdint.h>
+#include "bigint.h"
+#include "elligator.h"
+#include "curve1174_scalar.h"
+
+// Keys are the Elligator 1 strings, 32 bytes big-endian
+#define CURVE1174_CACHE_KEY_SIZE 32
+
+// Marks the end of the LRU list and of the bucket chains
+#define CURVE1174_CACHE_NIL UINT32_MAX
+
+// Identifies snapshot files ("E1CACHE" and the layout version)
+#define CURVE1174_CACHE_MAGIC 0x4531434143484501ULL
+
+/**
+ * Decoded point of a peer string together with its wNAF table. Entries are
+ * linked by indices, not pointers, such that the cache can be mapped from a
+ * snapshot file at any address.
+ */
+typedef struct Curve1174CacheEntry
+{
+    CurvePointWnafTable table;
+    CurvePoint point;
+    uint8_t key[CURVE1174_CACHE_KEY_SIZE];
+    uint32_t lru_prev;      // towards the most recently used entry
+    uint32_t lru_next;      // towards the least recently used entry
+    uint32_t bucket_next;
+} Curve1174CacheEntry;
+
+/**
+ * Start of the cache memory, followed by the buckets and the entries
+ */
+typedef struct Curve1174CacheHeader
+{
+    uint64_t magic;
+    uint64_t entry_size;
+    uint64_t capacity;
+    uint64_t nr_buckets;
+    uint64_t nr_used;
+    uint32_t lru_head;
+    uint32_t lru_tail;
+
+    // Counters, kept across restarts when using a snapshot
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t miss_cycles;   // Cycles spent decoding and precomputing
+} Curve1174CacheHeader;
+
+/**
+ * LRU cache of wNAF tables keyed by the peer's string. The memory is either
+ * anonymous or a shared mapping of a snapshot file, such that warm tables
+ * survive restarts.
+ * NOTE: the cache is not thread-safe.
+ */
+typedef struct Curve1174Cache
+{
+    Curve1174CacheHeader *header;
+    uint32_t *buckets;
+    Curve1174CacheEntry *entries;
+    void *mem;
+    uint64_t mem_size;
+    int fd;                 // -1 if there is no snapshot file
+    uint64_t hash_key[2];   // Random per process, keys the bucket hash
+} Curve1174Cache;
+
+typedef struct Curve1174CacheStats
+{
+    uint64_t hits;
+    uint64_t misses;
+    double hit_rate;
+    uint64_t saved_cycles;  // Estimated as hits * average cycles of a miss
+} Curve1174CacheStats;
+
+uint64_t curve1174_cache_capacity(uint64_t max_bytes);
+Curve1174Cache *curve1174_cache_init(Curve1174Cache *cache, uint64_t max_bytes,
+    const char *path);
+void curve1174_cache_sync(Curve1174Cache *cache);
+void curve1174_cache_free(Curve1174Cache *cache);
+
+Curve1174CacheEntry *curve1174_cache_get(Curve1174Cache *cache, BigInt *t,
+    Curve curve);
+CurvePointExt *curve1174_cache_scalar_mul(CurvePointExt *r,
+    Curve1174Cache *cache, BigInt *k, BigInt *t, Curve curve);
+
+Curve1174CacheStats *curve1174_cache_stats(Curve1174CacheStats *r,
+    Curve1174Cache *cache);
+
+#endif // CURVE1174_CACHE_H_
@@ -0,0 +1,62 @@
+#ifndef CURVE1174_POINT_H_    /* Include guard */
+#define CURVE1174_POINT_H_
+
+#include <stdint.h>
+#include "bigint.h"
+#include "elligator.h"
+
+// |d| for Curve1174 (d = -1174), small enough for a single chunk multiplication
+#define CURVE1174_D_ABS 1174
+
+// Compressed points: y as 32 bytes big-endian, the most significant bit
+// (unused since y < q < 2^251) holds the least significant bit of x
+#define CURVE1174_POINT_COMPRESSED_SIZE 32
+#define CURVE1174_POINT_SIGN_BIT 0x80
+
+// Extended coordinates: x = X/Z, y = Y/Z and x * y = T/Z
+typedef struct CurvePointExt
+{
+    BigInt x;
+    BigInt y;
+    BigInt z;
+    BigInt t;
+} CurvePointExt;
+
+// Affine point prepared for mixed additions. Negating the point swaps
+// y_plus_x and y_minus_x and negates t2d.
+typedef struct CurvePointPrecomp
+{
+    BigInt y_plus_x;  // y + x
+    BigInt y_minus_x; // y - x
+    BigInt t2d;       // 2 * d * x * y
+} CurvePointPrecomp;
+
+// Conversions
+CurvePointExt *curve1174_point_set_neutral(CurvePointExt *r);
+CurvePointExt *curve1174_point_from_affine(CurvePointExt *r, CurvePoint *a);
+CurvePoint *curve1174_point_to_affine(CurvePoint *r, CurvePointExt *a);
+CurvePointPrecomp *curve1174_point_precompute(CurvePointPrecomp *r,
+    CurvePoint *a);
+CurvePointPrecomp *curve1174_point_precompute_batch(CurvePointPrecomp *r,
+    CurvePointExt *a, uint64_t n);
+CurvePointPrecomp *curve1174_point_precomp_neg(CurvePointPrecomp *r,
+    CurvePointPrecomp *a);
+
+// Group operations
+CurvePointExt *curve1174_point_add(CurvePointExt *r, CurvePointExt *a,
+    CurvePointExt *b);
+CurvePointExt *curve1174_point_double(CurvePointExt *r, CurvePointExt *a);
+CurvePointExt *curve1174_point_neg(CurvePointExt *r, CurvePointExt *a);
+CurvePointExt *curve1174_point_add_mixed(CurvePointExt *r, CurvePointExt *a,
+    CurvePointPrecomp *b);
+
+int8_t curve1174_point_equal(CurvePointExt *a, CurvePointExt *b);
+int8_t curve1174_point_is_on_curve(CurvePoint *p);
+
+// Point compression
+uint8_t *curve1174_point_compress(uint8_t *buf, CurvePoint *p);
+int8_t curve1174_point_decompress(CurvePoint *r, const uint8_t *buf);
+int8_t curve1174_point_decompress_batch(CurvePoint *r, const uint8_t *buf,
+    uint64_t n, uint8_t *ok);
+
+#endif // CURVE1174_POINT_H_
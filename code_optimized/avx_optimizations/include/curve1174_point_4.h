@@ -0,0 +1,71 @@
+#ifndef CURVE1174_POINT_4_H_    /* Include guard */
+#define CURVE1174_POINT_4_H_
+
+#include <stdint.h>
+#include <immintrin.h>
+#include "bigint.h"
+#include "bigint_curve1174_constants.h"
+#include "curve1174_point.h"
+
+/**
+ * Four field elements mod q, one per 64-bit lane: limbs[i] holds the i-th
+ * 32-bit chunk of all four values. The values are only partially reduced,
+ * i.e., 0 <= v < 2^256, the canonical representative is computed when
+ * converting back to BigInts.
+ * NOTE: these structs need 32-byte alignment, do not allocate them with malloc.
+ */
+typedef struct Curve1174FieldElem4
+{
+    __m256i limbs[Q_CHUNKS];
+} Curve1174FieldElem4;
+
+// Point in extended coordinates with lanes (X, Y, Z, T)
+typedef struct CurvePointExt4
+{
+    Curve1174FieldElem4 xyzt;
+} CurvePointExt4;
+
+// Affine point prepared for mixed additions, with lanes (2x, 2y, y + x, 2dxy)
+typedef struct CurvePointPrecomp4
+{
+    Curve1174FieldElem4 v;
+} CurvePointPrecomp4;
+
+// Field arithmetic on all four lanes
+Curve1174FieldElem4 *curve1174_fe4_pack(Curve1174FieldElem4 *r, BigInt *a0,
+    BigInt *a1, BigInt *a2, BigInt *a3);
+void curve1174_fe4_unpack(BigInt *r0, BigInt *r1, BigInt *r2, BigInt *r3,
+    Curve1174FieldElem4 *a);
+Curve1174FieldElem4 *curve1174_fe4_add(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a, Curve1174FieldElem4 *b);
+Curve1174FieldElem4 *curve1174_fe4_sub(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a, Curve1174FieldElem4 *b);
+Curve1174FieldElem4 *curve1174_fe4_mul(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a, Curve1174FieldElem4 *b);
+
+// Conversions
+CurvePointExt4 *curve1174_point_4_set_neutral(CurvePointExt4 *r);
+CurvePointExt4 *curve1174_point_4_from_ext(CurvePointExt4 *r,
+    CurvePointExt *a);
+CurvePointExt *curve1174_point_4_to_ext(CurvePointExt *r, CurvePointExt4 *a);
+CurvePointPrecomp4 *curve1174_point_4_from_precomp(CurvePointPrecomp4 *r,
+    CurvePointPrecomp *a);
+CurvePointPrecomp4 *curve1174_point_4_precomp_from_chunks(
+    CurvePointPrecomp4 *r, const uint32_t *y_plus_x, const uint32_t *y_minus_x,
+    const uint32_t *t2d);
+CurvePointPrecomp4 *curve1174_point_4_precomp_neg(CurvePointPrecomp4 *r,
+    CurvePointPrecomp4 *a);
+
+// Group operations
+CurvePointExt4 *curve1174_point_4_add(CurvePointExt4 *r, CurvePointExt4 *a,
+    CurvePointExt4 *b);
+CurvePointExt4 *curve1174_point_4_double(CurvePointExt4 *r,
+    CurvePointExt4 *a);
+CurvePointExt4 *curve1174_point_4_add_mixed(CurvePointExt4 *r,
+    CurvePointExt4 *a, CurvePointPrecomp4 *b);
+CurvePointExt4 *curve1174_point_4_neg(CurvePointExt4 *r, CurvePointExt4 *a);
+
+// Validation of untrusted points, four points per vector operation
+int8_t curve1174_validate_batch(CurvePoint *p, uint64_t n, uint8_t *ok);
+
+#endif // CURVE1174_POINT_4_H_
@@ -0,0 +1,87 @@
+#ifndef CURVE1174_SCALAR_H_    /* Include guard */
+#define CURVE1174_SCALAR_H_
+
+#include <stdint.h>
+#include "bigint.h"
+#include "elligator.h"
+#include "curve1174_point.h"
+#include "curve1174_point_4.h"
+
+// Number of signed radix 16 digits of a scalar reduced mod l
+#define CURVE1174_SCALAR_RADIX16_DIGITS 64
+
+// Window width of the variable-base wNAF, the table holds the odd multiples
+// P, 3P, ..., (2^(w-1) - 1)P
+#define CURVE1174_SCALAR_WNAF_WINDOW 5
+#define CURVE1174_SCALAR_WNAF_TABLE_SIZE (1 << (CURVE1174_SCALAR_WNAF_WINDOW - 2))
+#define CURVE1174_SCALAR_MAX_BITS (BIGINT_FIXED_SIZE * BIGINT_CHUNK_BIT_SIZE)
+
+// Number of points from which on curve1174_msm switches from Straus' method to
+// Pippenger's bucket method (see the CURVE_1174_MSM_* benchmarks)
+#define CURVE1174_MSM_PIPPENGER_THRESHOLD 16
+
+// Largest bucket window of Pippenger's method, 2^(c-1) buckets are used
+#define CURVE1174_MSM_MAX_WINDOW 16
+
+/**
+ * Odd multiples P, 3P, ..., (2^(w-1) - 1)P of a point and their negations, as
+ * used by the variable-base wNAF
+ * NOTE: this struct needs 32-byte alignment, do not allocate it with malloc.
+ */
+typedef struct CurvePointWnafTable
+{
+    CurvePointPrecomp4 pos[CURVE1174_SCALAR_WNAF_TABLE_SIZE];
+    CurvePointPrecomp4 neg[CURVE1174_SCALAR_WNAF_TABLE_SIZE];
+} CurvePointWnafTable;
+
+/**
+ * Order l = 2^249 - 11332719920821432534773113288178349711 of the base point
+ */
+BIG_INT_DEFINE_STATIC_STRUCT_PTR(curve1174_order, 0, 0, 8,
+    (0xd166c971, 0x8944d45f, 0xdfd30734, 0xf77965c4,
+     0xffffffff, 0xffffffff, 0xffffffff, 0x01ffffff));
+
+/**
+ * Base point G of Curve1174
+ */
+BIG_INT_DEFINE_STATIC_STRUCT_PTR(curve1174_base_x, 0, 0, 8,
+    (0xbce29eda, 0x16123f27, 0x492ecd65, 0xc021d96a,
+     0xc029a190, 0x9343aee7, 0xea308c47, 0x037fbb0c));
+BIG_INT_DEFINE_STATIC_STRUCT_PTR(curve1174_base_y, 0, 0, 8,
+    (0x9b46360e, 0xa4ccb1bf, 0xaf3f976b, 0x4fe2dee2,
+     0x69840e0c, 0x66568411, 0xd47fb7cc, 0x06b72f82));
+
+CurvePoint *curve1174_base_point(CurvePoint *r);
+BigInt *curve1174_scalar_reduce(BigInt *r, BigInt *k);
+
+// Fixed-base scalar multiplication r = [k]G
+CurvePointExt *curve1174_scalar_mul_base(CurvePointExt *r, BigInt *k);
+
+// Variable-base scalar multiplication r = [k]P
+CurvePointExt *curve1174_scalar_mul(CurvePointExt *r, BigInt *k,
+    CurvePoint *p);
+CurvePointWnafTable *curve1174_scalar_wnaf_table(CurvePointWnafTable *r,
+    CurvePoint *p);
+CurvePointExt *curve1174_scalar_mul_table(CurvePointExt *r, BigInt *k,
+    CurvePointWnafTable *t);
+
+// Multi-scalar multiplication r = sum_i [k_i]P_i
+CurvePointExt *curve1174_msm(CurvePointExt *r, BigInt *k, CurvePoint *p,
+    uint64_t n);
+CurvePointExt *curve1174_msm_straus(CurvePointExt *r, BigInt *k,
+    CurvePoint *p, uint64_t n);
+CurvePointExt *curve1174_msm_pippenger(CurvePointExt *r, BigInt *k,
+    CurvePoint *p, uint64_t n);
+uint64_t curve1174_msm_pippenger_window(uint64_t n, uint64_t bits);
+
+// Multi-scalar multiplication with points given as Elligator 1 strings
+CurvePointExt *curve1174_msm_str(CurvePointExt *r, BigInt *k, BigInt *t,
+    uint64_t n, Curve curve);
+
+// Cofactor clearing r = [4]a and membership in the subgroup of order l
+CurvePointExt *curve1174_clear_cofactor(CurvePointExt *r, CurvePointExt *a);
+int8_t curve1174_point_is_in_subgroup(CurvePoint *p);
+int8_t curve1174_point_is_in_subgroup_batch(CurvePoint *p, uint64_t n,
+    uint8_t *ok);
+
+#endif // CURVE1174_SCALAR_H_
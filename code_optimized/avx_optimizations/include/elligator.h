@@ -10,6 +10,14 @@ typedef struct CurvePoint
     BigInt y;
 } CurvePoint;
 
+// Compact storage of affine points (64 instead of 288 bytes), e.g., for large
+// arrays of points
+typedef struct CurvePointPacked
+{
+    BigInt256Packed x;
+    BigInt256Packed y;
+} CurvePointPacked;
+
 typedef struct Curve // edward curve
 {
     BigInt q; // prime field
@@ -38,9 +46,43 @@ BIG_INT_DEFINE_STATIC_STRUCT_PTR(big_int_four, 0, 0, 1, (4));
 __attribute__((unused))
 BIG_INT_DEFINE_STATIC_STRUCT_PTR(big_int_five, 0, 0, 1, (5));
 
+// Number of elements processed together by the batched functions. Bounds the
+// stack usage, the inversions are shared among the elements of one block.
+#define ELLIGATOR_BATCH_SIZE 16
+
 void init_curve1174(Curve *curve);
 
 CurvePoint *elligator_1_string_to_point(CurvePoint *curve_point, BigInt *t, Curve curve);
 BigInt *elligator_1_point_to_string(BigInt *t, CurvePoint p, Curve curve);
+int8_t elligator_1_is_in_image(CurvePoint *p, Curve *curve);
+
+// Batched mappings
+CurvePoint *elligator_1_string_to_point_batch(CurvePoint *r, BigInt *t,
+    uint64_t n, Curve curve);
+BigInt *elligator_1_point_to_string_batch(BigInt *t, CurvePoint *p,
+    uint64_t n, Curve curve);
+
+// Batched mappings on packed arrays
+CurvePointPacked *curve_point_pack(CurvePointPacked *r, CurvePoint *p,
+    uint64_t n);
+CurvePoint *curve_point_unpack(CurvePoint *r, CurvePointPacked *p, uint64_t n);
+CurvePointPacked *elligator_1_string_to_point_batch_packed(CurvePointPacked *r,
+    BigInt256Packed *t, uint64_t n, Curve curve);
+BigInt256Packed *elligator_1_point_to_string_batch_packed(BigInt256Packed *t,
+    CurvePointPacked *p, uint64_t n, Curve curve);
+
+// Affine point addition (or subtraction if sub is set) with shared inversions
+CurvePoint *curve_point_add_batch(CurvePoint *r, CurvePoint *a, CurvePoint *b,
+    uint64_t stride, uint64_t n, int8_t sub, Curve curve);
+
+// Elligator Squared: P = f(u1) + f(u2), every point is encodable
+BigInt *elligator_squared_encode(BigInt *u1, BigInt *u2, CurvePoint p,
+    Curve curve);
+CurvePoint *elligator_squared_decode(CurvePoint *p, BigInt *u1, BigInt *u2,
+    Curve curve);
+BigInt *elligator_squared_encode_batch(BigInt *u, CurvePoint *p, uint64_t n,
+    Curve curve);
+CurvePoint *elligator_squared_decode_batch(CurvePoint *p, BigInt *u,
+    uint64_t n, Curve curve);
 
 #endif // ELLIGATOR_H_
@@ -0,0 +1,34 @@
+#ifndef ELLIGATOR_DH_H_    /* Include guard */
+#define ELLIGATOR_DH_H_
+
+#include <stdint.h>
+#include "bigint.h"
+#include "elligator.h"
+#include "curve1174_cache.h"
+
+// Secret scalars are multiples of the cofactor 4 of Curve1174, such that a
+// peer point with a small-order component cannot leak bits of the secret
+#define ELLIGATOR_DH_COFACTOR_SHIFT 2
+
+// Bit length of the order l of the base point
+#define ELLIGATOR_DH_ORDER_BITS 249
+
+/**
+ * Ephemeral key pair whose public key [secret]G is in the image of the
+ * Elligator 1 map, i.e., public_str is indistinguishable from a random
+ * string in [0, (q-1)/2].
+ */
+typedef struct ElligatorDhKeypair
+{
+    BigInt secret;
+    BigInt public_str;
+} ElligatorDhKeypair;
+
+ElligatorDhKeypair *elligator1_dh_keypair(ElligatorDhKeypair *kp,
+    Curve curve);
+int8_t elligator1_dh_shared(CurvePoint *shared, BigInt *secret,
+    BigInt *peer_str, Curve curve);
+int8_t elligator1_dh_shared_cached(CurvePoint *shared, BigInt *secret,
+    BigInt *peer_str, Curve1174Cache *cache, Curve curve);
+
+#endif // ELLIGATOR_DH_H_
@@ -0,0 +1,76 @@
+#ifndef ELLIGATOR_PARALLEL_H_    /* Include guard */
+#define ELLIGATOR_PARALLEL_H_
+
+#include <stdint.h>
+#include <pthread.h>
+#include "bigint.h"
+#include "elligator.h"
+
+// Used if the L2 size cannot be queried from the system
+#define ELLIGATOR_POOL_DEFAULT_L2_SIZE (256 * 1024)
+
+// Size of the per-thread scratch arena handed to every job
+#define ELLIGATOR_POOL_SCRATCH_SIZE (64 * 1024)
+
+#define ELLIGATOR_POOL_CACHE_LINE 64
+
+/**
+ * \brief Job run by the pool on the elements [start, start + len) of the
+ *        input. scratch points to the arena of the executing thread.
+ */
+typedef void (*ElligatorPoolJobFn)(void *arg, uint64_t start, uint64_t len,
+    uint8_t *scratch);
+
+/**
+ * \brief Per-thread state. Every worker owns a contiguous range of chunks
+ *        [head, tail), takes chunks from the front and lets idle workers
+ *        steal the back half.
+ */
+typedef struct ElligatorPoolWorker
+{
+    pthread_mutex_t lock;   // Protects head and tail
+    uint64_t head;
+    uint64_t tail;
+    pthread_t thread;
+    struct ElligatorPool *pool;
+    uint64_t id;
+    uint8_t *scratch;
+} __attribute__((aligned(ELLIGATOR_POOL_CACHE_LINE))) ElligatorPoolWorker;
+
+typedef struct ElligatorPool
+{
+    ElligatorPoolWorker *workers;
+    uint64_t nr_threads;
+
+    // Current job, only changed while all workers are idle
+    ElligatorPoolJobFn job_fn;
+    void *job_arg;
+    uint64_t job_n;
+    uint64_t job_chunk_size;
+
+    pthread_mutex_t lock;       // Protects the fields below
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    uint64_t generation;        // Incremented for every job
+    uint64_t nr_busy;           // Workers still working on the current job
+    uint8_t stop;
+} ElligatorPool;
+
+// Pool management, nr_threads = 0 uses all online cores
+ElligatorPool *elligator_pool_create(uint64_t nr_threads);
+void elligator_pool_destroy(ElligatorPool *pool);
+uint64_t elligator_pool_chunk_size(uint64_t bytes_per_element);
+void elligator_pool_run(ElligatorPool *pool, ElligatorPoolJobFn job_fn,
+    void *arg, uint64_t n, uint64_t chunk_size);
+
+// Parallel bulk versions of the batched mappings
+CurvePoint *elligator_1_string_to_point_parallel(CurvePoint *r, BigInt *t,
+    uint64_t n, Curve curve, ElligatorPool *pool);
+BigInt *elligator_1_point_to_string_parallel(BigInt *t, CurvePoint *p,
+    uint64_t n, Curve curve, ElligatorPool *pool);
+BigInt *elligator_squared_encode_parallel(BigInt *u, CurvePoint *p,
+    uint64_t n, Curve curve, ElligatorPool *pool);
+CurvePoint *elligator_squared_decode_parallel(CurvePoint *p, BigInt *u,
+    uint64_t n, Curve curve, ElligatorPool *pool);
+
+#endif // ELLIGATOR_PARALLEL_H_
@@ -0,0 +1,35 @@
+#ifndef ELLIGATOR_RECORDS_H_    /* Include guard */
+#define ELLIGATOR_RECORDS_H_
+
+#include <stdint.h>
+#include "bigint.h"
+#include "elligator.h"
+#include "elligator_parallel.h"
+
+// Serialized field elements are 32 bytes big-endian, points are x || y
+#define ELLIGATOR_RECORD_STRING_SIZE 32
+#define ELLIGATOR_RECORD_POINT_SIZE (2 * ELLIGATOR_RECORD_STRING_SIZE)
+
+/**
+ * \brief Buffers and thread pool for mapping serialized records
+ */
+typedef struct ElligatorRecordCtx
+{
+    Curve curve;
+    ElligatorPool *pool;    // NULL if single-threaded
+    BigInt *t;
+    CurvePoint *p;
+    uint64_t capacity;      // Max. number of records per call
+} ElligatorRecordCtx;
+
+ElligatorRecordCtx *elligator_records_init(ElligatorRecordCtx *ctx,
+    uint64_t capacity, uint64_t nr_threads);
+void elligator_records_free(ElligatorRecordCtx *ctx);
+
+// String (32 bytes) to point (64 bytes) and back
+uint8_t *elligator_records_decode(uint8_t *out, const uint8_t *in, uint64_t n,
+    ElligatorRecordCtx *ctx);
+uint8_t *elligator_records_encode(uint8_t *out, const uint8_t *in, uint64_t n,
+    ElligatorRecordCtx *ctx);
+
+#endif // ELLIGATOR_RECORDS_H_
@@ -0,0 +1,31 @@
+#ifndef ELLIGATOR_SERVICE_H_    /* Include guard */
+#define ELLIGATOR_SERVICE_H_
+
+#include <stdint.h>
+#include "elligator_records.h"
+
+/*
+ * Protocol of the Elligator 1 daemon over a Unix domain stream socket:
+ * A request is one op byte followed by the input record, the response is the
+ * output record. Requests on one connection may be pipelined and are
+ * answered in order.
+ *
+ *      ELLIGATOR_SERVICE_OP_DECODE: 32-byte string -> 64-byte point (x || y)
+ *      ELLIGATOR_SERVICE_OP_ENCODE: 64-byte point (x || y) -> 32-byte string
+ */
+#define ELLIGATOR_SERVICE_DEFAULT_PATH "/tmp/elligator1.sock"
+
+#define ELLIGATOR_SERVICE_OP_DECODE 0
+#define ELLIGATOR_SERVICE_OP_ENCODE 1
+
+#define ELLIGATOR_SERVICE_MAX_REQUEST_SIZE (1 + ELLIGATOR_RECORD_POINT_SIZE)
+
+// Size of the input record of a request with the given op
+#define ELLIGATOR_SERVICE_IN_SIZE(op) (((op) == ELLIGATOR_SERVICE_OP_DECODE) \
+    ? ELLIGATOR_RECORD_STRING_SIZE : ELLIGATOR_RECORD_POINT_SIZE)
+
+// Size of the output record of a request with the given op
+#define ELLIGATOR_SERVICE_OUT_SIZE(op) (((op) == ELLIGATOR_SERVICE_OP_DECODE) \
+    ? ELLIGATOR_RECORD_POINT_SIZE : ELLIGATOR_RECORD_STRING_SIZE)
+
+#endif // ELLIGATOR_SERVICE_H_
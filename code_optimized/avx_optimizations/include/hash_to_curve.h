@@ -0,0 +1,47 @@
+#ifndef HASH_TO_CURVE_H_    /* Include guard */
+#define HASH_TO_CURVE_H_
+
+#include <stdint.h>
+#include "bigint.h"
+#include "elligator.h"
+#include "sha512.h"
+
+// L = ceil((ceil(log2(q)) + k) / 8) for q = 2^251 - 9 and security level
+// k = 128 bits, i.e., the number of uniform bytes per field element
+#define HASH_TO_CURVE_L 48
+
+// Suite identifier, used as default domain separation tag (DST)
+#define HASH_TO_CURVE_SUITE_ID "CURVE1174_XMD:SHA-512_ELL1_RO_"
+
+#define HASH_TO_CURVE_MAX_DST_LEN 255
+
+/**
+ * \brief State of an incremental hash_to_curve computation
+ */
+typedef struct HashToCurveCtx
+{
+    Sha512Ctx sha;          // Absorbs Z_pad || msg of expand_message_xmd
+    const uint8_t *dst;     // Domain separation tag, not copied
+    uint64_t dst_len;
+} HashToCurveCtx;
+
+// expand_message_xmd with SHA-512 (RFC 9380, section 5.3.1)
+uint8_t *expand_message_xmd(uint8_t *out, uint64_t out_len,
+    const uint8_t *msg, uint64_t msg_len, const uint8_t *dst, uint64_t dst_len);
+
+// Streaming interface for long messages
+HashToCurveCtx *hash_to_curve_init(HashToCurveCtx *ctx, const uint8_t *dst,
+    uint64_t dst_len);
+HashToCurveCtx *hash_to_curve_update(HashToCurveCtx *ctx, const uint8_t *msg,
+    uint64_t msg_len);
+CurvePoint *hash_to_curve_final(CurvePoint *r, HashToCurveCtx *ctx,
+    Curve curve);
+
+// One-shot and batched interfaces
+CurvePoint *hash_to_curve(CurvePoint *r, const uint8_t *msg, uint64_t msg_len,
+    const uint8_t *dst, uint64_t dst_len, Curve curve);
+CurvePoint *hash_to_curve_batch(CurvePoint *r, const uint8_t **msgs,
+    const uint64_t *msg_lens, uint64_t n, const uint8_t *dst, uint64_t dst_len,
+    Curve curve);
+
+#endif // HASH_TO_CURVE_H_
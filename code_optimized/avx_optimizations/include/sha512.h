@@ -0,0 +1,28 @@
+#ifndef SHA512_H_    /* Include guard */
+#define SHA512_H_
+
+#include <stdint.h>
+
+#define SHA512_BLOCK_SIZE 128   // bytes
+#define SHA512_DIGEST_SIZE 64   // bytes
+
+/**
+ * \brief State of an incremental SHA-512 computation (FIPS 180-4)
+ */
+typedef struct Sha512Ctx
+{
+    uint64_t state[8];
+    uint64_t nr_bytes;              // Total number of hashed bytes so far
+    uint8_t buf[SHA512_BLOCK_SIZE]; // Not yet compressed bytes
+    uint64_t buf_len;               // Number of used bytes in buf
+} Sha512Ctx;
+
+// Streaming interface
+Sha512Ctx *sha512_init(Sha512Ctx *ctx);
+Sha512Ctx *sha512_update(Sha512Ctx *ctx, const uint8_t *data, uint64_t len);
+uint8_t *sha512_final(uint8_t *digest, Sha512Ctx *ctx);
+
+// One-shot interface
+uint8_t *sha512(uint8_t *digest, const uint8_t *data, uint64_t len);
+
+#endif // SHA512_H_
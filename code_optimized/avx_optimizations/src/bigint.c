@@ -28,6 +28,8 @@
  */
 #include <stdlib.h>
 #include <time.h> // for random BigInt
+#include <unistd.h> // for getentropy
+#include <pthread.h> // for pthread_atfork
 #include <immintrin.h>
 
 // header files
@@ -38,6 +40,7 @@
  * Macros
  */
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
 
 /*
  * Function prototypes (for internal use)
@@ -48,7 +51,7 @@ BigInt *big_int_prune_leading_zeros(BigInt *r, BigInt *a);
 /**
  * Global variables
  */
-uint8_t do_seed_rand = 1;
+uint64_t big_int_stats[BIGINT_TYPE_LAST];
 
 /**
  * \brief if r = a:     return pointer to a; this is an in-place modification.
@@ -146,18 +149,18 @@ BigInt *big_int_create_from_hex(BigInt *r, char *s)
 
     size_t s_len;
     int64_t chunk_size, i;
-    // buf needs space for zero byte and sign too
-    char buf[BIGINT_CHUNK_HEX_SIZE + 2];
+    // buf needs space for the zero byte too
+    char buf[BIGINT_CHUNK_HEX_SIZE + 1];
     char *s_end;
-    long long parsed_int;
+
+    // Strip the sign, such that all chunks can be parsed as unsigned integers
+    r->sign = (*s == '-');
+    if (r->sign)
+        s++;
 
     s_len = strlen(s);
     s_end = s + s_len;
 
-    // Don't count sign to integer size
-    if (*s == '-')
-        s_len--;
-
     // chunk_size = ceil(s_len/BIGINT_CHUNK_HEX_SIZE)
     chunk_size = (s_len + BIGINT_CHUNK_HEX_SIZE - 1) / BIGINT_CHUNK_HEX_SIZE;
     ADD_STAT_COLLECTION(BASIC_DIV)
@@ -165,27 +168,520 @@ BigInt *big_int_create_from_hex(BigInt *r, char *s)
     r->overflow = 0;
     r->size = chunk_size;
 
-    // Null terinate buffer to stop strtoll
+    // Null terinate buffer to stop strtoull
     buf[BIGINT_CHUNK_HEX_SIZE] = 0;
     for (i = 0; i < chunk_size - 1; ++i)
     {
         s_end -= BIGINT_CHUNK_HEX_SIZE;
         strncpy(buf, s_end, BIGINT_CHUNK_HEX_SIZE);
 
-        r->chunks[i] = (dbl_chunk_size_t)STR_TO_CHUNK(buf, NULL, 16);
+        r->chunks[i] = (chunk_size_t)STR_TO_CHUNK(buf, NULL, 16);
     }
 
-    // Parse the last (leftmost) chunk and store the sign bit
+    // Parse the last (leftmost) chunk
     s_len = (size_t)((uintptr_t)s_end - (uintptr_t)s);
     buf[s_len] = 0;
     strncpy(buf, s, s_len);
-    parsed_int = (int64_t)STR_TO_CHUNK(buf, NULL, 16);
-    r->sign = parsed_int < 0;
-    r->chunks[i] = (dbl_chunk_size_t)(CHUNK_ABS(parsed_int) % BIGINT_RADIX);
-    ADD_STAT_COLLECTION(BASIC_MOD)
+    r->chunks[i] = (chunk_size_t)STR_TO_CHUNK(buf, NULL, 16);
+
+    return r;
+}
+
+/**
+ * \brief Create a non-negative BigInt from a big-endian byte string
+ *        (OS2IP in RFC 8017).
+ *
+ * \assumption r, buf != NULL
+ * \assumption 1 <= len <= BIGINT_FIXED_SIZE_INTERNAL * BIGINT_CHUNK_BYTE_SIZE
+ */
+BigInt *big_int_create_from_bytes(BigInt *r, const uint8_t *buf, uint64_t len)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_CREATE_FROM_BYTES);
+
+    uint64_t i, chunk_idx;
+
+    r->sign = 0;
+    r->overflow = 0;
+    r->size = (len + BIGINT_CHUNK_BYTE_SIZE - 1) / BIGINT_CHUNK_BYTE_SIZE;
+
+    for (i = 0; i < r->size; ++i)
+        r->chunks[i] = 0;
+
+    // The last byte is the least significant one
+    for (i = 0; i < len; ++i)
+    {
+        chunk_idx = i / BIGINT_CHUNK_BYTE_SIZE;
+        r->chunks[chunk_idx] |= ((dbl_chunk_size_t) buf[len - 1 - i])
+            << (8 * (i % BIGINT_CHUNK_BYTE_SIZE));
+    }
+
+    return big_int_prune_leading_zeros(r, r);
+}
+
+/**
+ * \brief Write |a| as big-endian byte string of length len (I2OSP in
+ *        RFC 8017). Chunks that do not fit into len bytes are cut off.
+ *
+ * \assumption buf, a != NULL
+ */
+uint8_t *big_int_to_bytes(uint8_t *buf, BigInt *a, uint64_t len)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_TO_BYTES);
+
+    uint64_t i, chunk_idx;
+
+    for (i = 0; i < len; ++i)
+    {
+        chunk_idx = i / BIGINT_CHUNK_BYTE_SIZE;
+        buf[len - 1 - i] = (chunk_idx < a->size) ?
+            (uint8_t) (a->chunks[chunk_idx] >> (8 * (i % BIGINT_CHUNK_BYTE_SIZE)))
+            : 0;
+    }
+
+    return buf;
+}
+
+/**
+ * \brief Pack n BigInts into the compact 32-byte representation
+ *
+ * \assumption r, a != NULL
+ * \assumption 0 <= a[i] < 2^256
+ */
+BigInt256Packed *big_int_pack(BigInt256Packed *r, BigInt *a, uint64_t n)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_PACK);
+
+    uint64_t i;
+    __m256i size, lo;
+
+#ifdef BIGINT_LIMB_64
+    const __m256i idx = _mm256_setr_epi64x(0, 1, 2, 3);
+
+    for (i = 0; i < n; ++i)
+    {
+        // Chunks above the size are not initialized, mask them out
+        size = _mm256_set1_epi64x(a[i].size);
+        lo = _mm256_loadu_si256((__m256i *) a[i].chunks);
+        lo = _mm256_and_si256(lo, _mm256_cmpgt_epi64(size, idx));
+        ADD_STAT_COLLECTION(AVX_OTHER)
+        _mm256_storeu_si256((__m256i *) r[i].chunks, lo);
+    }
+#else
+    __m256i hi;
+
+    const __m256i idx_lo = _mm256_setr_epi64x(0, 1, 2, 3);
+    const __m256i idx_hi = _mm256_setr_epi64x(4, 5, 6, 7);
+    // Moves the lower halves of the 64-bit words to the lower 128 bits
+    const __m256i perm = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+    for (i = 0; i < n; ++i)
+    {
+        // Chunks above the size are not initialized, mask them out
+        size = _mm256_set1_epi64x(a[i].size);
+        lo = _mm256_loadu_si256((__m256i *) a[i].chunks);
+        hi = _mm256_loadu_si256((__m256i *) &(a[i].chunks[4]));
+        lo = _mm256_and_si256(lo, _mm256_cmpgt_epi64(size, idx_lo));
+        ADD_STAT_COLLECTION(AVX_OTHER)
+        hi = _mm256_and_si256(hi, _mm256_cmpgt_epi64(size, idx_hi));
+        ADD_STAT_COLLECTION(AVX_OTHER)
+
+        lo = _mm256_permutevar8x32_epi32(lo, perm);
+        hi = _mm256_permutevar8x32_epi32(hi, perm);
+        lo = _mm256_permute2x128_si256(lo, hi, 0x20);
+        _mm256_storeu_si256((__m256i *) r[i].chunks, lo);
+    }
+#endif
+
+    return r;
+}
+
+/**
+ * \brief Unpack n BigInts from the compact 32-byte representation
+ *
+ * \assumption r, a != NULL
+ */
+BigInt *big_int_unpack(BigInt *r, BigInt256Packed *a, uint64_t n)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_UNPACK);
+
+    uint64_t i;
+    uint32_t non_zero;
+    __m256i v;
+
+    const __m256i zero = _mm256_setzero_si256();
+
+    for (i = 0; i < n; ++i)
+    {
+        v = _mm256_loadu_si256((__m256i *) a[i].chunks);
+
+#ifdef BIGINT_LIMB_64
+        non_zero = ~_mm256_movemask_pd(_mm256_castsi256_pd(
+            _mm256_cmpeq_epi64(v, zero))) & 0xf;
+        _mm256_storeu_si256((__m256i *) r[i].chunks, v);
+#else
+        non_zero = ~_mm256_movemask_ps(_mm256_castsi256_ps(
+            _mm256_cmpeq_epi32(v, zero))) & 0xff;
+        _mm256_storeu_si256((__m256i *) r[i].chunks,
+            _mm256_cvtepu32_epi64(_mm256_castsi256_si128(v)));
+        _mm256_storeu_si256((__m256i *) &(r[i].chunks[4]),
+            _mm256_cvtepu32_epi64(_mm256_extracti128_si256(v, 1)));
+#endif
+        ADD_STAT_COLLECTION(AVX_OTHER)
+
+        // Index of the most significant non-zero chunk plus one, at least 1.
+        // NOTE: set all bit fields together, such that the compiler merges the
+        // updates of the metadata word (partial writes stall the subsequent
+        // reads on store forwarding).
+        r[i].size = (non_zero) ? 32 - __builtin_clz(non_zero) : 1;
+        r[i].sign = 0;
+        r[i].overflow = 0;
+    }
+
     return r;
 }
 
+// === === === === === === === === === === === === === === === === === === ===
+// Random numbers
+// === === === === === === === === === === === === === === === === === === ===
+
+// Number of 64-bit words needed for the chunks of the largest BigInt
+#define BIGINT_RNG_WORDS                                                       \
+    ((BIGINT_FIXED_SIZE_INTERNAL * BIGINT_CHUNK_BIT_SIZE + 63) / 64)
+
+// Number of BigInts whose random words big_int_fill_random draws at once
+#define BIGINT_FILL_RANDOM_BATCH 32
+
+// Generators of the calling thread. The default and the secure generator are
+// seeded on first use, big_int_rng_current is NULL for the default.
+static __thread BigIntRng big_int_rng_default;
+static __thread BigIntRng big_int_rng_secure_state;
+static __thread BigIntRng *big_int_rng_current;
+
+// Registers big_int_rng_atfork_child once per process
+static pthread_once_t big_int_rng_atfork_once = PTHREAD_ONCE_INIT;
+
+static inline uint64_t big_int_rotl64(uint64_t x, uint64_t k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+static inline uint32_t big_int_rotl32(uint32_t x, uint32_t k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+/**
+ * \brief Advance the splitmix64 state x and return its next output, used to
+ *        expand a 64-bit seed into the xoshiro256** state
+ */
+static inline uint64_t big_int_splitmix64(uint64_t *x)
+{
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * \brief Fill function of xoshiro256** (Blackman and Vigna, "Scrambled linear
+ *        pseudorandom number generators", 2021)
+ */
+static void big_int_rng_xoshiro_fill(BigIntRng *rng, uint64_t *out, uint64_t n)
+{
+    uint64_t s0, s1, s2, s3, t;
+
+    s0 = rng->state.xoshiro[0];
+    s1 = rng->state.xoshiro[1];
+    s2 = rng->state.xoshiro[2];
+    s3 = rng->state.xoshiro[3];
+
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        out[i] = big_int_rotl64(s1 * 5, 7) * 9;
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+
+        t = s1 << 17;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = big_int_rotl64(s3, 45);
+        ADD_STAT_COLLECTION(BASIC_BITWISE)
+    }
+
+    rng->state.xoshiro[0] = s0;
+    rng->state.xoshiro[1] = s1;
+    rng->state.xoshiro[2] = s2;
+    rng->state.xoshiro[3] = s3;
+}
+
+#define BIGINT_CHACHA_QR(x, a, b, c, d)                                        \
+    do {                                                                       \
+        x[a] += x[b]; x[d] = big_int_rotl32(x[d] ^ x[a], 16);                  \
+        x[c] += x[d]; x[b] = big_int_rotl32(x[b] ^ x[c], 12);                  \
+        x[a] += x[b]; x[d] = big_int_rotl32(x[d] ^ x[a], 8);                   \
+        x[c] += x[d]; x[b] = big_int_rotl32(x[b] ^ x[c], 7);                   \
+    } while (0)
+
+/**
+ * \brief Compute the ChaCha20 block (RFC 8439) for the given key and block
+ *        counter with an all-zero nonce
+ */
+static void big_int_chacha20_block(uint32_t *out, const uint32_t *key,
+    uint32_t counter)
+{
+    uint32_t x[16];
+
+    out[0] = 0x61707865;
+    out[1] = 0x3320646e;
+    out[2] = 0x79622d32;
+    out[3] = 0x6b206574;
+    for (uint64_t i = 0; i < 8; ++i)
+        out[4 + i] = key[i];
+    out[12] = counter;
+    out[13] = out[14] = out[15] = 0;
+
+    memcpy(x, out, sizeof(x));
+    for (uint64_t i = 0; i < 10; ++i)
+    {
+        BIGINT_CHACHA_QR(x, 0, 4, 8, 12);
+        BIGINT_CHACHA_QR(x, 1, 5, 9, 13);
+        BIGINT_CHACHA_QR(x, 2, 6, 10, 14);
+        BIGINT_CHACHA_QR(x, 3, 7, 11, 15);
+        BIGINT_CHACHA_QR(x, 0, 5, 10, 15);
+        BIGINT_CHACHA_QR(x, 1, 6, 11, 12);
+        BIGINT_CHACHA_QR(x, 2, 7, 8, 13);
+        BIGINT_CHACHA_QR(x, 3, 4, 9, 14);
+    }
+
+    for (uint64_t i = 0; i < 16; ++i)
+        out[i] += x[i];
+}
+
+/**
+ * \brief Compute the next BIGINT_RNG_CHACHA_BLOCKS blocks of key stream. The
+ *        first 256 bits replace the key and are erased ("fast key erasure"),
+ *        such that earlier outputs cannot be recovered from the state.
+ */
+static void big_int_rng_chacha_refill(BigIntRng *rng)
+{
+    uint32_t block[16];
+    uint64_t *buf = rng->state.chacha.buf;
+
+    for (uint64_t b = 0; b < BIGINT_RNG_CHACHA_BLOCKS; ++b)
+    {
+        big_int_chacha20_block(block, rng->state.chacha.key, b);
+        for (uint64_t j = 0; j < 8; ++j)
+            buf[8 * b + j] = block[2 * j] | ((uint64_t) block[2 * j + 1] << 32);
+    }
+
+    for (uint64_t j = 0; j < 4; ++j)
+    {
+        rng->state.chacha.key[2 * j] = (uint32_t) buf[j];
+        rng->state.chacha.key[2 * j + 1] = (uint32_t) (buf[j] >> 32);
+        buf[j] = 0;
+    }
+    rng->state.chacha.pos = 4;
+}
+
+/**
+ * \brief Fill function of the ChaCha20 CSPRNG, used outputs are erased
+ */
+static void big_int_rng_chacha_fill(BigIntRng *rng, uint64_t *out, uint64_t n)
+{
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        if (rng->state.chacha.pos == BIGINT_RNG_CHACHA_WORDS)
+            big_int_rng_chacha_refill(rng);
+
+        out[i] = rng->state.chacha.buf[rng->state.chacha.pos];
+        rng->state.chacha.buf[rng->state.chacha.pos++] = 0;
+    }
+}
+
+/**
+ * \brief Initialize a xoshiro256** generator, the seed is expanded with
+ *        splitmix64
+ *
+ * \assumption rng != NULL
+ */
+BigIntRng *big_int_rng_xoshiro_init(BigIntRng *rng, uint64_t seed)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_RNG_XOSHIRO_INIT);
+
+    for (uint64_t i = 0; i < 4; ++i)
+        rng->state.xoshiro[i] = big_int_splitmix64(&seed);
+    rng->fill = big_int_rng_xoshiro_fill;
+
+    return rng;
+}
+
+/**
+ * \brief Initialize a ChaCha20 CSPRNG with a 32-byte key
+ *
+ * \assumption rng, key != NULL
+ */
+BigIntRng *big_int_rng_chacha_init(BigIntRng *rng, const uint8_t *key)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_RNG_CHACHA_INIT);
+
+    for (uint64_t i = 0; i < 8; ++i)
+    {
+        rng->state.chacha.key[i] = (uint32_t) key[4 * i]
+            | ((uint32_t) key[4 * i + 1] << 8)
+            | ((uint32_t) key[4 * i + 2] << 16)
+            | ((uint32_t) key[4 * i + 3] << 24);
+    }
+    memset(rng->state.chacha.buf, 0, sizeof(rng->state.chacha.buf));
+    rng->state.chacha.pos = BIGINT_RNG_CHACHA_WORDS;
+    rng->fill = big_int_rng_chacha_fill;
+
+    return rng;
+}
+
+/**
+ * \brief Seed the default generator from the OS, or from the clock if that
+ *        fails
+ */
+static void big_int_rng_default_seed(void)
+{
+    struct timespec ts;
+    uint64_t seed;
+
+    if (getentropy(&seed, sizeof(seed)))
+    {
+        clock_gettime(CLOCK_REALTIME, &ts);
+        seed = ((uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec)
+            ^ (uint64_t) (uintptr_t) &big_int_rng_default
+            ^ ((uint64_t) getpid() << 32);
+    }
+    big_int_rng_xoshiro_init(&big_int_rng_default, seed);
+}
+
+/**
+ * \brief Key the secure generator from the OS, the key is erased from the
+ *        stack afterwards
+ */
+static void big_int_rng_secure_seed(void)
+{
+    volatile uint8_t *p;
+    uint8_t key[32];
+
+    if (getentropy(key, sizeof(key)))
+        FATAL("Failed to get entropy from the OS\n");
+    big_int_rng_chacha_init(&big_int_rng_secure_state, key);
+
+    p = key;
+    for (uint64_t i = 0; i < sizeof(key); ++i)
+        p[i] = 0;
+}
+
+/**
+ * \brief Reseed the generators in a child process. Otherwise, parent and child
+ *        would continue with the same state and, e.g., generate the same
+ *        secrets. The child only has the thread that called fork, so only its
+ *        generators are in use. They are reseeded in place, such that
+ *        generators selected with big_int_rng_use remain valid.
+ */
+static void big_int_rng_atfork_child(void)
+{
+    if (big_int_rng_default.fill)
+        big_int_rng_default_seed();
+    if (big_int_rng_secure_state.fill)
+        big_int_rng_secure_seed();
+}
+
+static void big_int_rng_atfork_register(void)
+{
+    if (pthread_atfork(NULL, NULL, big_int_rng_atfork_child))
+        FATAL("Failed to register the fork handler of the RNG\n");
+}
+
+/**
+ * \brief Returns the default generator of the calling thread, seeded on first
+ *        use
+ */
+static BigIntRng *big_int_rng_default_get(void)
+{
+    if (!big_int_rng_default.fill)
+    {
+        pthread_once(&big_int_rng_atfork_once, big_int_rng_atfork_register);
+        big_int_rng_default_seed();
+    }
+
+    return &big_int_rng_default;
+}
+
+/**
+ * \brief Returns the ChaCha20 CSPRNG of the calling thread, keyed from the OS
+ *        on first use and again in child processes after fork. Use it for key
+ *        material.
+ */
+BigIntRng *big_int_rng_secure(void)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_RNG_SECURE);
+
+    if (!big_int_rng_secure_state.fill)
+    {
+        pthread_once(&big_int_rng_atfork_once, big_int_rng_atfork_register);
+        big_int_rng_secure_seed();
+    }
+
+    return &big_int_rng_secure_state;
+}
+
+/**
+ * \brief Make rng the generator of the calling thread, or the default
+ *        xoshiro256** if rng is NULL
+ *
+ * \returns the previous generator of the calling thread
+ */
+BigIntRng *big_int_rng_use(BigIntRng *rng)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_RNG_USE);
+
+    BigIntRng *prev = big_int_rng_current;
+
+    big_int_rng_current = rng;
+
+    return prev ? prev : big_int_rng_default_get();
+}
+
+/**
+ * \brief Write n random 64-bit words to out, drawn from rng or from the
+ *        generator of the calling thread if rng is NULL
+ *
+ * \assumption out != NULL
+ */
+void big_int_rng_fill(BigIntRng *rng, uint64_t *out, uint64_t n)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_RNG_FILL);
+
+    if (!rng)
+        rng = big_int_rng_current ? big_int_rng_current
+                                  : big_int_rng_default_get();
+    rng->fill(rng, out, n);
+}
+
+/**
+ * \brief Set the chunks of r from random 64-bit words
+ */
+static inline void big_int_chunks_from_words(BigInt *r, uint64_t *words,
+    int64_t nr_of_chunks)
+{
+    uint64_t pos;
+
+    for (int64_t i = 0; i < nr_of_chunks; i++)
+    {
+        pos = i * BIGINT_CHUNK_BIT_SIZE;
+        r->chunks[i] = (chunk_size_t) (words[pos / 64] >> (pos % 64));
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+    }
+}
+
 /**
  * \brief Create a random BigInt
  *
@@ -199,33 +695,63 @@ BigInt *big_int_create_random(BigInt *r, int64_t nr_of_chunks)
 {
     ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_CREATE_RANDOM);
 
-    int64_t i, offset;
+    uint64_t words[BIGINT_RNG_WORDS + 1];
+    uint64_t nr_of_words = (nr_of_chunks * BIGINT_CHUNK_BIT_SIZE + 63) / 64;
 
-    if (do_seed_rand)
-    {
-        srand(time(NULL));
-        do_seed_rand = 0;
-    }
+    // One more word for the sign
+    big_int_rng_fill(NULL, words, nr_of_words + 1);
 
-    r->sign = rand() % 2;
-    ADD_STAT_COLLECTION(BASIC_MOD)
+    r->sign = words[nr_of_words] & 1;
     r->overflow = 0;
     r->size = nr_of_chunks;
+    big_int_chunks_from_words(r, words, nr_of_chunks);
+
+    return r;
+}
+
+/**
+ * \brief Set arr[0], ..., arr[n - 1] to independent, uniformly random BigInts
+ *        in [0, 2^bits). The random words of up to BIGINT_FILL_RANDOM_BATCH
+ *        BigInts are drawn at once.
+ *
+ * \assumption arr != NULL
+ * \assumption 1 <= bits <= BIGINT_FIXED_SIZE_INTERNAL * BIGINT_CHUNK_BIT_SIZE
+ */
+BigInt *big_int_fill_random(BigInt *arr, uint64_t n, uint64_t bits)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_FILL_RANDOM);
+
+    uint64_t words[BIGINT_FILL_RANDOM_BATCH * BIGINT_RNG_WORDS];
+    uint64_t nr_of_words, nr_of_chunks, top_bits, m;
+    chunk_size_t top_mask;
+    BigInt *r;
 
-    for (i = 0; i < nr_of_chunks; i++)
+    nr_of_words = (bits + 63) / 64;
+    nr_of_chunks = (bits + BIGINT_CHUNK_BIT_SIZE - 1) / BIGINT_CHUNK_BIT_SIZE;
+    top_bits = bits - (nr_of_chunks - 1) * BIGINT_CHUNK_BIT_SIZE;
+    top_mask = (top_bits == BIGINT_CHUNK_BIT_SIZE)
+        ? (chunk_size_t) -1 : (((chunk_size_t) 1) << top_bits) - 1;
+
+    for (uint64_t i = 0; i < n; i += BIGINT_FILL_RANDOM_BATCH)
     {
-        offset = 1;
-        r->chunks[i] = 0;
-        while (offset < BIGINT_RADIX)
+        m = MIN(BIGINT_FILL_RANDOM_BATCH, n - i);
+        big_int_rng_fill(NULL, words, m * nr_of_words);
+
+        for (uint64_t j = 0; j < m; ++j)
         {
-            r->chunks[i] += ((dbl_chunk_size_t)rand()) * offset;
-            offset *= RAND_MAX;
+            r = arr + i + j;
+            r->sign = 0;
+            r->overflow = 0;
+            r->size = nr_of_chunks;
+            big_int_chunks_from_words(r, words + j * nr_of_words,
+                nr_of_chunks);
+            r->chunks[nr_of_chunks - 1] &= top_mask;
+            ADD_STAT_COLLECTION(BASIC_BITWISE)
+            big_int_prune_leading_zeros(r, r);
         }
-        r->chunks[i] %= BIGINT_RADIX;
-        ADD_STAT_COLLECTION(BASIC_MOD)
     }
 
-    return r;
+    return arr;
 }
 
 /**
@@ -251,12 +777,13 @@ BigInt *big_int_copy(BigInt *a, BigInt *b)
  */
 void big_int_print(BigInt *a)
 {
-    printf("%s0x%08" PRIx64, (a->sign == 1) ? "-" : "", a->chunks[a->size - 1]);
+    printf("%s0x%0*" PRIx64, (a->sign == 1) ? "-" : "",
+           (int) BIGINT_CHUNK_HEX_SIZE, a->chunks[a->size - 1]);
     if (a->size >= 2)
     {
         for (int64_t i = a->size - 2; i >= 0; --i)
         {
-            printf(" %08" PRIx64, a->chunks[i]);
+            printf(" %0*" PRIx64, (int) BIGINT_CHUNK_HEX_SIZE, a->chunks[i]);
         }
     }
 }
@@ -358,12 +885,12 @@ BigInt *big_int_fast_add(BigInt *r, BigInt *a, BigInt *b)
 {
     ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_ADD);
 
+#ifndef BIGINT_LIMB_64
     if (a->size == 8 && b->size == 8) {
         return big_int_add_256(r, a, b);
     }
-    else {
-        return big_int_add_general(r, a, b);
-    }
+#endif
+    return big_int_add_general(r, a, b);
 }
 
 /**
@@ -405,7 +932,7 @@ BigInt *big_int_add_general(BigInt *r, BigInt *a, BigInt *b)
     r_size = 0;
     for (i = 0; i < bb->size; ++i) {
         ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-        sum = aa->chunks[i] + bb->chunks[i] + carry;
+        sum = (dbl_chunk_size_t)aa->chunks[i] + bb->chunks[i] + carry;
         ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
         ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
         r->chunks[i] = sum & BIGINT_CHUNK_MASK;
@@ -420,7 +947,7 @@ BigInt *big_int_add_general(BigInt *r, BigInt *a, BigInt *b)
     // Second, finish possible remaining chunks of larger integer
     for (; i < aa->size; ++i) {
         ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-        sum = aa->chunks[i] + carry;
+        sum = (dbl_chunk_size_t)aa->chunks[i] + carry;
         ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
         r->chunks[i] = sum & BIGINT_CHUNK_MASK;
         ADD_STAT_COLLECTION(BASIC_BITWISE)
@@ -448,6 +975,7 @@ BigInt *big_int_add_general(BigInt *r, BigInt *a, BigInt *b)
 }
 
 
+#ifndef BIGINT_LIMB_64
 /**
  * r = a + b for 256-bit BigInts
  *
@@ -708,6 +1236,29 @@ BigInt *big_int_add_optimal_bound(BigInt *r, BigInt *a, BigInt *b)
     return r;
 }
 
+#else
+
+/*
+ * With 64-bit chunks, the 256-bit kernels above do not apply and there is no
+ * room for lazy carries. Fall back to the generic implementation.
+ */
+BigInt *big_int_add_256(BigInt *r, BigInt *a, BigInt *b)
+{
+    return big_int_add_general(r, a, b);
+}
+
+BigInt *big_int_add_256_avx(BigInt *r, BigInt *a, BigInt *b)
+{
+    return big_int_add_general(r, a, b);
+}
+
+BigInt *big_int_add_optimal_bound(BigInt *r, BigInt *a, BigInt *b)
+{
+    return big_int_add_general(r, a, b);
+}
+
+#endif // BIGINT_LIMB_64
+
 /**
  * \brief Calculate r = a - b
  *
@@ -764,11 +1315,13 @@ BigInt *big_int_fast_sub(BigInt *r, BigInt *a, BigInt *b)
 
     // Assertion: aa_abs >= bb_abs
     ADD_STAT_COLLECTION(BASIC_BITWISE)
+#ifndef BIGINT_LIMB_64
     if (a->size == 8 && b->size == 8)
     {
         big_int_sub_256(r, aa_abs, bb_abs);
     }
     else
+#endif
     {
         // Note an underflow sets the 1 bit at position MSB+1 of the chunk:
         // 0x0000000000000000 - 1 = 0xffffffff00000000
@@ -778,7 +1331,7 @@ BigInt *big_int_fast_sub(BigInt *r, BigInt *a, BigInt *b)
         for (i = 0; i < bb_abs->size; ++i)
         {
             ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-            diff = aa_abs->chunks[i] - bb_abs->chunks[i] - borrow;
+            diff = (dbl_chunk_size_t)aa_abs->chunks[i] - bb_abs->chunks[i] - borrow;
             ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
             ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
             r->chunks[i] = diff & BIGINT_CHUNK_MASK;
@@ -794,7 +1347,7 @@ BigInt *big_int_fast_sub(BigInt *r, BigInt *a, BigInt *b)
         for (; i < aa_abs->size; ++i)
         {
             ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-            diff = aa_abs->chunks[i] - borrow;
+            diff = (dbl_chunk_size_t)aa_abs->chunks[i] - borrow;
             ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
             r->chunks[i] = diff & BIGINT_CHUNK_MASK;
             ADD_STAT_COLLECTION(BASIC_BITWISE)
@@ -819,6 +1372,7 @@ BigInt *big_int_fast_sub(BigInt *r, BigInt *a, BigInt *b)
     return r;
 }
 
+#ifndef BIGINT_LIMB_64
 /**
  * \brief Calculate r = a - b without taking borrows into account
  *
@@ -953,6 +1507,20 @@ BigInt *big_int_sub_256(BigInt *r, BigInt *a, BigInt *b)
     return r;
 }
 
+#else
+
+BigInt *big_int_sub_optimal_bound(BigInt *r, BigInt *a, BigInt *b)
+{
+    return big_int_fast_sub(r, a, b);
+}
+
+BigInt *big_int_sub_256(BigInt *r, BigInt *a, BigInt *b)
+{
+    return big_int_fast_sub(r, a, b);
+}
+
+#endif // BIGINT_LIMB_64
+
 /**
  * \brief Calculate r = a * b
  *
@@ -976,7 +1544,7 @@ BigInt *big_int_mul_single_chunk(BigInt *r, BigInt *a, dbl_chunk_size_t b)
     for (j = 0; j < a->size; ++j)
     {
         ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-        carry += a->chunks[j] * b;
+        carry += (dbl_chunk_size_t)a->chunks[j] * b;
         ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
         ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
 
@@ -1011,6 +1579,7 @@ BigInt *big_int_square(BigInt *r, BigInt *a)
 {
     ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_SQUARE);
 
+#ifndef BIGINT_LIMB_64
     if (a->size == 8)
     {
         return big_int_square_256(r, a);
@@ -1043,57 +1612,72 @@ BigInt *big_int_square(BigInt *r, BigInt *a)
     {
         return big_int_square_32(r, a);
     }
+#endif
 
     int64_t i, j;
-    unsigned __int128 carry;
+    dbl_chunk_size_t carry, sq;
 
     // Set BigInt to all zeros (initializes chunks, sign, and overflow)
     *r = (BigInt){0};
     r->size = 2 * a->size;
     ADD_STAT_COLLECTION(BASIC_MUL_SIZE)
 
+    // Sum up the products a_i * a_j with i < j. Doubling is postponed, such
+    // that the intermediate results also fit for 64-bit chunks.
     for (i = 0; i < a->size; ++i)
     {
         ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
         // shortcut for zero chunk
         if (a->chunks[i] == 0)
+            continue;
+
+        carry = 0;
+        for (j = i + 1; j < a->size; j++)
         {
-            r->chunks[i + a->size] = 0;
             ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-        }
-        else
-        {
-            // Multiply and add chunks
-            carry = a->chunks[i] * a->chunks[i] + r->chunks[i + i];
+            carry += (dbl_chunk_size_t)a->chunks[j] * a->chunks[i] + r->chunks[i + j];
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
             ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
             ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
             ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
 
-            r->chunks[i + i] = (dbl_chunk_size_t)(carry & BIGINT_RADIX_FOR_MOD_128);
+            r->chunks[i + j] = carry & BIGINT_RADIX_FOR_MOD;
             ADD_STAT_COLLECTION(BASIC_BITWISE)
             ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
             carry >>= BIGINT_CHUNK_BIT_SIZE;
             ADD_STAT_COLLECTION(BASIC_SHIFT)
+        }
+        r->chunks[i + a->size] = carry;
+        ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
+    }
 
-            for (j = i + 1; j < a->size; j++)
-            {
-                ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                carry += (unsigned __int128)2 * a->chunks[j] * a->chunks[i] + r->chunks[i + j];
-                ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
-                ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
-                ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
-                ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+    // Double the cross products and add the squares a_i * a_i
+    carry = 0;
+    for (i = 0; i < a->size; ++i)
+    {
+        ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
+        sq = (dbl_chunk_size_t)a->chunks[i] * a->chunks[i];
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
 
-                r->chunks[i + j] = (dbl_chunk_size_t)(carry & BIGINT_RADIX_FOR_MOD_128);
-                ADD_STAT_COLLECTION(BASIC_BITWISE)
-                ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                carry >>= BIGINT_CHUNK_BIT_SIZE;
-                ADD_STAT_COLLECTION(BASIC_SHIFT)
-            }
-            r->chunks[i + a->size] = carry;
-            ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-        }
+        carry += ((dbl_chunk_size_t)r->chunks[i + i] << 1) + (sq & BIGINT_RADIX_FOR_MOD);
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+        ADD_STAT_COLLECTION(BASIC_BITWISE)
+        r->chunks[i + i] = carry & BIGINT_RADIX_FOR_MOD;
+        ADD_STAT_COLLECTION(BASIC_BITWISE)
+        carry >>= BIGINT_CHUNK_BIT_SIZE;
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+
+        carry += ((dbl_chunk_size_t)r->chunks[i + i + 1] << 1) + (sq >> BIGINT_CHUNK_BIT_SIZE);
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+        r->chunks[i + i + 1] = carry & BIGINT_RADIX_FOR_MOD;
+        ADD_STAT_COLLECTION(BASIC_BITWISE)
+        carry >>= BIGINT_CHUNK_BIT_SIZE;
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
     }
 
     // Remove leading zeros
@@ -1109,6 +1693,7 @@ BigInt *big_int_square(BigInt *r, BigInt *a)
     return r;
 }
 
+#ifndef BIGINT_LIMB_64
 BigInt *big_int_square_256(BigInt *r, BigInt *a)
 {
     ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_SQUARE_256);
@@ -2091,6 +2676,50 @@ BigInt *big_int_square_32(BigInt *r, BigInt *a)
     return r;
 }
 
+#else
+
+BigInt *big_int_square_256(BigInt *r, BigInt *a)
+{
+    return big_int_square(r, a);
+}
+
+BigInt *big_int_square_224(BigInt *r, BigInt *a)
+{
+    return big_int_square(r, a);
+}
+
+BigInt *big_int_square_192(BigInt *r, BigInt *a)
+{
+    return big_int_square(r, a);
+}
+
+BigInt *big_int_square_160(BigInt *r, BigInt *a)
+{
+    return big_int_square(r, a);
+}
+
+BigInt *big_int_square_128(BigInt *r, BigInt *a)
+{
+    return big_int_square(r, a);
+}
+
+BigInt *big_int_square_96(BigInt *r, BigInt *a)
+{
+    return big_int_square(r, a);
+}
+
+BigInt *big_int_square_64(BigInt *r, BigInt *a)
+{
+    return big_int_square(r, a);
+}
+
+BigInt *big_int_square_32(BigInt *r, BigInt *a)
+{
+    return big_int_square(r, a);
+}
+
+#endif // BIGINT_LIMB_64
+
 // === === === === === === === === === === === === === === === === === === ===
 
 /**
@@ -2107,12 +2736,15 @@ void big_int_mul_4(BigInt *r0, BigInt *r1, BigInt *r2, BigInt *r3,
 {
     ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_MUL_4);
 
+#ifndef BIGINT_LIMB_64
     if (a0->size == a1->size && a1->size == a2->size && a2->size == a3->size
         && b0->size == b1->size && b1->size == b2->size && b2->size == b3->size)
     {
         big_int_mul_4_fast(r0, r1, r2, r3, a0, a1, a2, a3, b0, b1, b2, b3);
     }
-    else {
+    else
+#endif
+    {
         big_int_mul(r0, a0, b0);
         big_int_mul(r1, a1, b1);
         big_int_mul(r2, a2, b2);
@@ -2120,6 +2752,7 @@ void big_int_mul_4(BigInt *r0, BigInt *r1, BigInt *r2, BigInt *r3,
     }
 }
 
+#ifndef BIGINT_LIMB_64
 /**
  * for all i, j in [0, 1, 2, 3]
  *      \brief Calculate r<i> = a<i> * b<i>
@@ -2239,28 +2872,168 @@ void big_int_mul_4_fast(BigInt *r0, BigInt *r1, BigInt *r2, BigInt *r3,
     }
 }
 
+#else
+
+void big_int_mul_4_fast(BigInt *r0, BigInt *r1, BigInt *r2, BigInt *r3,
+                        BigInt *a0, BigInt *a1, BigInt *a2, BigInt *a3,
+                        BigInt *b0, BigInt *b1, BigInt *b2, BigInt *b3)
+{
+    big_int_mul_general(r0, a0, b0);
+    big_int_mul_general(r1, a1, b1);
+    big_int_mul_general(r2, a2, b2);
+    big_int_mul_general(r3, a3, b3);
+}
+
+#endif // BIGINT_LIMB_64
 
 // === === === === === === === === === === === === === === === === === === ===
 
+// Largest operand size (in chunks) with a product-scanning kernel
+#define BIGINT_MUL_COMBA_MAX 16
+
+/**
+ * \brief Calculate the na + nb chunks of r := |a| * |b| column by column
+ *        (Comba's product scanning), such that every chunk of r is written
+ *        exactly once. With 32-bit chunks, a column sum always fits into 128
+ *        bits. With 64-bit chunks, the overflows of the 128-bit sum are counted
+ *        separately.
+ *
+ * \assumption r does not alias a or b
+ */
+static inline __attribute__((always_inline))
+void big_int_mul_comba(chunk_storage_t *r, chunk_storage_t *a,
+    chunk_storage_t *b, int64_t na, int64_t nb)
+{
+    unsigned __int128 acc = 0;
+#ifdef BIGINT_LIMB_64
+    unsigned __int128 p, overflows = 0;
+#endif
+
+#pragma GCC unroll 32
+    for (int64_t k = 0; k < na + nb - 1; ++k)
+    {
+#pragma GCC unroll 16
+        for (int64_t i = MAX(0, k - nb + 1); i <= MIN(k, na - 1); ++i)
+        {
+#ifdef BIGINT_LIMB_64
+            p = (unsigned __int128) a[i] * b[k - i];
+            acc += p;
+            overflows += acc < p;
+#else
+            acc += (uint64_t) a[i] * b[k - i];
+#endif
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        }
+
+        r[k] = (chunk_size_t) acc;
+        acc >>= BIGINT_CHUNK_SHIFT;
+#ifdef BIGINT_LIMB_64
+        acc |= overflows << BIGINT_CHUNK_SHIFT;
+        overflows = 0;
+#endif
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+    }
+    r[na + nb - 1] = (chunk_size_t) acc;
+}
+
+// Instantiate big_int_mul_comba for every pair of operand sizes whose product
+// fits into a BigInt. The size check is resolved at compile time.
+#define BIGINT_MUL_COMBA_CASE(na, nb)                                          \
+    case (na) * (BIGINT_MUL_COMBA_MAX + 1) + (nb):                             \
+        if ((na) + (nb) <= BIGINT_FIXED_SIZE_INTERNAL)                         \
+            big_int_mul_comba(r->chunks, a->chunks, b->chunks, na, nb);        \
+        break;
+
+#define BIGINT_MUL_COMBA_ROW(na)                                               \
+    BIGINT_MUL_COMBA_CASE(na, 1)  BIGINT_MUL_COMBA_CASE(na, 2)                 \
+    BIGINT_MUL_COMBA_CASE(na, 3)  BIGINT_MUL_COMBA_CASE(na, 4)                 \
+    BIGINT_MUL_COMBA_CASE(na, 5)  BIGINT_MUL_COMBA_CASE(na, 6)                 \
+    BIGINT_MUL_COMBA_CASE(na, 7)  BIGINT_MUL_COMBA_CASE(na, 8)                 \
+    BIGINT_MUL_COMBA_CASE(na, 9)  BIGINT_MUL_COMBA_CASE(na, 10)                \
+    BIGINT_MUL_COMBA_CASE(na, 11) BIGINT_MUL_COMBA_CASE(na, 12)                \
+    BIGINT_MUL_COMBA_CASE(na, 13) BIGINT_MUL_COMBA_CASE(na, 14)                \
+    BIGINT_MUL_COMBA_CASE(na, 15) BIGINT_MUL_COMBA_CASE(na, 16)
+
+/**
+ * \brief Calculate r = a * b for operands whose sizes add up to more than
+ *        BIGINT_FIXED_SIZE_INTERNAL chunks. The product is calculated into a
+ *        wider buffer and must fit into a BigInt after pruning.
+ *
+ * \assumption r, a, b != NULL
+ */
+static BigInt *big_int_mul_wide(BigInt *r, BigInt *a, BigInt *b)
+{
+    chunk_storage_t wide[2 * BIGINT_FIXED_SIZE_INTERNAL];
+    int64_t i;
+
+    big_int_mul_comba(wide, a->chunks, b->chunks, a->size, b->size);
+
+    for (i = BIGINT_FIXED_SIZE_INTERNAL; i < a->size + b->size; ++i)
+        if (wide[i])
+            FATAL("Product does not fit into a BigInt!\n");
+
+    memcpy(r->chunks, wide, sizeof(r->chunks));
+
+    r->sign = a->sign ^ b->sign;
+    r->overflow = 0;
+    r->size = BIGINT_FIXED_SIZE_INTERNAL;
+
+    // Prune leading zeros
+    while (r->size > 1 && !r->chunks[r->size - 1])
+        r->size--;
+
+    return r;
+}
+
 /**
  * \brief Calculate r = a * b
  *
  * \assumption r, a, b != NULL
- * \assumption a->size + b->size <= BIGINT_FIXED_SIZE_INTERNAL
+ * \assumption a * b fits into BIGINT_FIXED_SIZE_INTERNAL chunks
  * \assumption a != b, i.e., no aliasing
  */
 BigInt *big_int_mul(BigInt *r, BigInt *a, BigInt *b)
 {
     ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_MUL);
 
-    if (a->size == 8 && b->size == 8)
+    if (a->size + b->size > BIGINT_FIXED_SIZE_INTERNAL)
+        return big_int_mul_wide(r, a, b);
+
+    switch (a->size * (BIGINT_MUL_COMBA_MAX + 1) + b->size)
     {
-        return big_int_mul_256(r, a, b);
+        BIGINT_MUL_COMBA_ROW(1)
+        BIGINT_MUL_COMBA_ROW(2)
+        BIGINT_MUL_COMBA_ROW(3)
+        BIGINT_MUL_COMBA_ROW(4)
+        BIGINT_MUL_COMBA_ROW(5)
+        BIGINT_MUL_COMBA_ROW(6)
+        BIGINT_MUL_COMBA_ROW(7)
+        BIGINT_MUL_COMBA_ROW(8)
+        BIGINT_MUL_COMBA_ROW(9)
+        BIGINT_MUL_COMBA_ROW(10)
+        BIGINT_MUL_COMBA_ROW(11)
+        BIGINT_MUL_COMBA_ROW(12)
+        BIGINT_MUL_COMBA_ROW(13)
+        BIGINT_MUL_COMBA_ROW(14)
+        BIGINT_MUL_COMBA_ROW(15)
+        BIGINT_MUL_COMBA_ROW(16)
     }
-    else
+
+    r->sign = a->sign ^ b->sign;
+    ADD_STAT_COLLECTION(BASIC_BITWISE)
+    r->overflow = 0;
+    r->size = a->size + b->size;
+    ADD_STAT_COLLECTION(BASIC_ADD_SIZE)
+
+    // Prune leading zeros
+    while (r->size > 1 && !r->chunks[r->size - 1])
     {
-        return big_int_mul_general(r, a, b);
+        r->size--;
+        ADD_STAT_COLLECTION(BASIC_ADD_SIZE)
     }
+
+    return r;
 }
 
 /**
@@ -2299,7 +3072,7 @@ BigInt *big_int_mul_general(BigInt *r, BigInt *a, BigInt *b)
             for (j = 0; j < a->size; ++j)
             {
                 ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                carry += a->chunks[j] * b->chunks[i] + r->chunks[i + j];
+                carry += (dbl_chunk_size_t)a->chunks[j] * b->chunks[i] + r->chunks[i + j];
                 ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
                 ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
                 ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
@@ -2327,6 +3100,7 @@ BigInt *big_int_mul_general(BigInt *r, BigInt *a, BigInt *b)
     return r;
 }
 
+#ifndef BIGINT_LIMB_64
 BigInt *big_int_mul_256(BigInt *r, BigInt *a, BigInt *b)
 {
     ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_MUL_256);
@@ -2830,264 +3604,456 @@ BigInt *big_int_mul_256_avx(BigInt *r, BigInt *a, BigInt *b)
     return r;
 }
 
+#else
+
+BigInt *big_int_mul_256(BigInt *r, BigInt *a, BigInt *b)
+{
+    return big_int_mul_general(r, a, b);
+}
+
+BigInt *big_int_mul_256_avx(BigInt *r, BigInt *a, BigInt *b)
+{
+    return big_int_mul_general(r, a, b);
+}
+
+#endif // BIGINT_LIMB_64
+
+// === === === === === === === === === === === === === === === === === === ===
+// Division
+// === === === === === === === === === === === === === === === === === === ===
+
+// Number of 64-bit limbs needed for the largest internal BigInt
+#define BIGINT_DIV_LIMBS                                                       \
+    ((BIGINT_FIXED_SIZE_INTERNAL * BIGINT_CHUNK_BIT_SIZE + 63) / 64)
+
 /**
- * \brief Calculate quotient q and remainder r, such that: a = q * b + r
- *        We round numbers towards 0, e.g., -13/8 = (-1, -5)
+ * \brief Load the absolute value of a BigInt into n 64-bit limbs
  *
- * \param r if r is not NULL, it will be set to the remainder.
- * \returns pointer to q
+ * \assumption |a| < 2^(64 * n)
+ */
+static inline void big_int_limbs_load(uint64_t *r, BigInt *a, uint64_t n)
+{
+#ifdef BIGINT_LIMB_64
+    for (uint64_t i = 0; i < n; ++i)
+        r[i] = (i < a->size) ? a->chunks[i] : 0;
+#else
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        uint64_t lo = (2 * i < a->size) ? a->chunks[2 * i] : 0;
+        uint64_t hi = (2 * i + 1 < a->size) ? a->chunks[2 * i + 1] : 0;
+        r[i] = lo | (hi << 32);
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+        ADD_STAT_COLLECTION(BASIC_BITWISE)
+    }
+#endif
+}
+
+/**
+ * \brief Store n 64-bit limbs as non-negative BigInt r
  *
- * \assumption q, a, b != NULL
+ * \assumption the value fits into BIGINT_FIXED_SIZE_INTERNAL chunks
  */
-BigInt *big_int_div_rem(BigInt *q, BigInt *r, BigInt *a, BigInt *b)
+static inline BigInt *big_int_limbs_store(BigInt *r, uint64_t *a, uint64_t n)
 {
-    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_DIV_REM);
+    r->sign = 0;
+    r->overflow = 0;
+#ifdef BIGINT_LIMB_64
+    for (uint64_t i = 0; i < n; ++i)
+        r->chunks[i] = a[i];
+    r->size = n;
+#else
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        r->chunks[2 * i] = a[i] & BIGINT_RADIX_FOR_MOD;
+        ADD_STAT_COLLECTION(BASIC_BITWISE)
+        // The top chunk of a full-size BigInt has no partner
+        if (2 * i + 1 < BIGINT_FIXED_SIZE_INTERNAL)
+            r->chunks[2 * i + 1] = a[i] >> 32;
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+    }
+    r->size = MIN(2 * n, BIGINT_FIXED_SIZE_INTERNAL);
+#endif
+    return big_int_prune_leading_zeros(r, r);
+}
 
-    dbl_chunk_size_t a_tmp, b_tmp, tmp, q_c, r_c;
-    uint8_t q_sign;
-    uint64_t factor;
-    int64_t q_idx, a_idx, i;
+/**
+ * \brief Number of 64-bit limbs of |a|, without leading zero limbs (at least 1)
+ */
+static inline uint64_t big_int_limbs_size(uint64_t *a, uint64_t n)
+{
+    while (n > 1 && a[n - 1] == 0)
+        --n;
+    return n;
+}
 
-    BIG_INT_DEFINE_PTR(a_abs);
-    BIG_INT_DEFINE_PTR(b_abs);
-    BIG_INT_DEFINE_PTR(a_loc);
-    BIG_INT_DEFINE_PTR(a_loc_2);
-    BIG_INT_DEFINE_PTR(b_loc);
-    BIG_INT_DEFINE_PTR(b_loc_2);
-    BIG_INT_DEFINE_PTR(a_part);
-    BIG_INT_DEFINE_PTR(q_c_bigint);
-    BIG_INT_DEFINE_PTR(qb);
-    BIG_INT_DEFINE_PTR(r_loc);
+/**
+ * \brief Calculate the reciprocal v = floor((2^128 - 1) / d) - 2^64 of a
+ *        normalized limb d, i.e., d >= 2^63.
+ */
+static inline uint64_t big_int_reciprocal_2by1(uint64_t d)
+{
+    ADD_STAT_COLLECTION(BASIC_DIV)
+    return (uint64_t) ((((unsigned __int128) ~d) << 64 | ~(uint64_t) 0) / d);
+}
 
-    BIG_INT_DEFINE_PTR_ZEROED(radix_pow);
+/**
+ * \brief Calculate the reciprocal v = floor((2^192 - 1) / d) - 2^64 of a
+ *        normalized two-limb divisor d = (d1, d0), i.e., d1 >= 2^63.
+ *        (cf. Algorithm 6, N. Moller and T. Granlund, "Improved division by
+ *        invariant integers")
+ */
+static inline uint64_t big_int_reciprocal_3by2(uint64_t d1, uint64_t d0)
+{
+    uint64_t v, p, mask;
+    unsigned __int128 t;
 
-    if (big_int_is_zero(b))
-        FATAL("Division by zero!\n");
+    v = big_int_reciprocal_2by1(d1);
+    p = d1 * v + d0;
+    ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+    if (p < d0)
+    {
+        --v;
+        mask = -(uint64_t) (p >= d1);
+        p -= d1;
+        v += mask;
+        p -= mask & d1;
+    }
 
-    // DEBUG_BIGINT(a, "div_rem; a = ");
-    // DEBUG_BIGINT(b, "div_rem; b = ");
+    t = (unsigned __int128) v * d0;
+    ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+    p += (uint64_t) (t >> 64);
+    if (p < (uint64_t) (t >> 64))
+    {
+        --v;
+        if (p > d1 || (p == d1 && (uint64_t) t >= d0))
+            --v;
+    }
 
-    /*
-     * Special cases
-     */
-    big_int_abs(a_abs, a);
-    big_int_abs(b_abs, b);
+    return v;
+}
 
-    // zero dividend
-    if (big_int_is_zero(a))
+/**
+ * \brief Divide (u1, u0) by the normalized limb d with its reciprocal v.
+ *        (cf. Algorithm 4, Moller and Granlund)
+ *
+ * \assumption u1 < d
+ * \returns quotient, the remainder is written to r
+ */
+static inline uint64_t big_int_udiv_2by1(uint64_t *r, uint64_t u1,
+    uint64_t u0, uint64_t d, uint64_t v)
+{
+    unsigned __int128 q;
+    uint64_t q1, q0, r_loc;
+
+    q = (unsigned __int128) v * u1 + (((unsigned __int128) u1 << 64) | u0);
+    ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+    q1 = (uint64_t) (q >> 64) + 1;
+    q0 = (uint64_t) q;
+
+    r_loc = u0 - q1 * d;
+    ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+    if (r_loc > q0)
     {
-        big_int_create_from_chunk(q, 0, 0);
-        big_int_create_from_chunk(r_loc, 0, 0);
+        --q1;
+        r_loc += d;
     }
-    // divisor larger than dividend
-    else if (big_int_compare(b_abs, a_abs) == 1)
+    if (r_loc >= d)
     {
-        big_int_create_from_chunk(q, 0, 0);
+        ++q1;
+        r_loc -= d;
+    }
 
-        // Save unsigned rest, account for signs later
-        big_int_copy(r_loc, a);
-        big_int_abs(r_loc, r_loc);
+    *r = r_loc;
+    return q1;
+}
+
+/**
+ * \brief Divide (n2, n1, n0) by the normalized divisor d = (d1, d0) with its
+ *        reciprocal v. (cf. Algorithm 5, Moller and Granlund)
+ *
+ * \assumption (n2, n1) < (d1, d0)
+ * \returns quotient, the remainder is written to (r1, r0)
+ */
+static inline uint64_t big_int_udiv_3by2(uint64_t *r1, uint64_t *r0,
+    uint64_t n2, uint64_t n1, uint64_t n0, uint64_t d1, uint64_t d0,
+    uint64_t v)
+{
+    unsigned __int128 q, r_loc, d;
+    uint64_t q1, q0;
+
+    d = ((unsigned __int128) d1 << 64) | d0;
+
+    q = (unsigned __int128) v * n2 + (((unsigned __int128) n2 << 64) | n1);
+    ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+    q1 = (uint64_t) (q >> 64);
+    q0 = (uint64_t) q;
+
+    r_loc = ((unsigned __int128) (n1 - d1 * q1) << 64) | n0;
+    r_loc -= d + (unsigned __int128) d0 * q1;
+    ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+    ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+    ++q1;
+
+    if ((uint64_t) (r_loc >> 64) >= q0)
+    {
+        --q1;
+        r_loc += d;
     }
-    // Simple case for small BigInts, just use normal C division (but round
-    // towards -inf at the end)
-    else if (a->size == 1)
+    if (r_loc >= d)
     {
-        big_int_create_from_chunk(q, a->chunks[0] / b->chunks[0], 0);
-        ADD_STAT_COLLECTION(BASIC_DIV)
-        q->sign = a->sign ^ b->sign;
-        ADD_STAT_COLLECTION(BASIC_BITWISE)
-        big_int_create_from_chunk(r_loc, a->chunks[0] % b->chunks[0], 0);
+        ++q1;
+        r_loc -= d;
     }
-    // Since we do operations on double chunks, we can also do the shortcut for length 2
-    else if (a->size == 2)
+
+    *r1 = (uint64_t) (r_loc >> 64);
+    *r0 = (uint64_t) r_loc;
+    return q1;
+}
+
+/**
+ * \brief Calculate r := r - a * b on n limbs
+ * \returns the borrow limb
+ */
+static inline uint64_t big_int_limbs_submul(uint64_t *r, uint64_t *a,
+    uint64_t n, uint64_t b)
+{
+    unsigned __int128 p;
+    uint64_t borrow = 0, lo, t;
+
+    for (uint64_t i = 0; i < n; ++i)
     {
-        a_tmp = a->chunks[1] * BIGINT_RADIX + a->chunks[0];
-        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        p = (unsigned __int128) a[i] * b + borrow;
+        lo = (uint64_t) p;
+        t = r[i];
+        r[i] = t - lo;
+        borrow = (uint64_t) (p >> 64) + (t < lo);
         ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
-        b_tmp = b->chunks[0];
-        if (b->size == 2)
-            b_tmp += b->chunks[1] * BIGINT_RADIX;
         ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
-        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
-        q_sign = a->sign ^ b->sign;
-        ADD_STAT_COLLECTION(BASIC_BITWISE)
-
-        q = big_int_create_from_dbl_chunk(q, a_tmp / b_tmp, q_sign);
-        ADD_STAT_COLLECTION(BASIC_DIV)
-        r_loc = big_int_create_from_dbl_chunk(r_loc, a_tmp % b_tmp, 0);
-        ADD_STAT_COLLECTION(BASIC_MOD)
     }
-    else
-    {
-        // Below: Division for a->size > 2
 
-        q->sign = a->sign ^ b->sign;
-        ADD_STAT_COLLECTION(BASIC_BITWISE)
-        q->size = a->size - b->size + 1;
-        ADD_STAT_COLLECTION(BASIC_ADD_SIZE)
-        ADD_STAT_COLLECTION(BASIC_ADD_SIZE)
+    return borrow;
+}
 
-        // Preserve values of a, b
-        big_int_copy(a_loc, a);
-        big_int_copy(b_loc, b);
+/**
+ * \brief Calculate r := r + a on n limbs
+ * \returns the carry
+ */
+static inline uint64_t big_int_limbs_add(uint64_t *r, uint64_t *a, uint64_t n)
+{
+    unsigned __int128 c = 0;
 
-        // Operate on absolute values, account for signs at the end
-        big_int_abs(a_loc, a_loc);
-        big_int_abs(b_loc, b_loc);
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        c = (unsigned __int128) r[i] + a[i] + (uint64_t) (c >> 64);
+        r[i] = (uint64_t) c;
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+    }
 
-        // Normalize: find factor such that b->chunks[b->size - 1] >= BIGINT_RADIX/2
-        factor = 0;
-        tmp = b_loc->chunks[b->size - 1];
-        ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-        while (2 * tmp < BIGINT_RADIX)
-        {
-            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
-            ++factor;
-            ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-            tmp <<= 1;
-            ADD_STAT_COLLECTION(BASIC_SHIFT)
-        }
+    return (uint64_t) (c >> 64);
+}
 
-        if (factor > 0)
-        {
-            big_int_sll_small(a_loc_2, a_loc, factor);
-            a_loc = a_loc_2;
-            big_int_sll_small(b_loc_2, b_loc, factor);
-            b_loc = b_loc_2;
-        }
+/**
+ * \brief Calculate q := u / d and r := u mod d on 64-bit limbs. The divisor is
+ *        normalized, such that each quotient limb is computed with a 3/2
+ *        division by the top two divisor limbs using a precomputed reciprocal
+ *        instead of a hardware division. Divisors of one or two limbs take
+ *        a fast path without multiply and subtract loop.
+ *
+ * \assumption nu >= nd >= 1, d[nd - 1] != 0
+ * \assumption q has space for nu - nd + 1 limbs, r for nd limbs
+ */
+static void big_int_div_rem_limbs(uint64_t *q, uint64_t *r, uint64_t *u_in,
+    uint64_t nu, uint64_t *d_in, uint64_t nd)
+{
+    uint64_t u[BIGINT_DIV_LIMBS + 1], d[BIGINT_DIV_LIMBS];
+    uint64_t v, s, m, n0, n1, n2, d0, d1, cy, cy1, rem;
+    int64_t i, j;
+
+    // Normalize: shift such that the top limb of d has its MSB set
+    s = __builtin_clzll(d_in[nd - 1]);
+    ADD_STAT_COLLECTION(BASIC_BITWISE)
+    if (s)
+    {
+        for (i = nd - 1; i > 0; --i)
+            d[i] = (d_in[i] << s) | (d_in[i - 1] >> (64 - s));
+        d[0] = d_in[0] << s;
+
+        u[nu] = u_in[nu - 1] >> (64 - s);
+        for (i = nu - 1; i > 0; --i)
+            u[i] = (u_in[i] << s) | (u_in[i - 1] >> (64 - s));
+        u[0] = u_in[0] << s;
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+    }
+    else
+    {
+        memcpy(d, d_in, nd * sizeof(uint64_t));
+        memcpy(u, u_in, nu * sizeof(uint64_t));
+        u[nu] = 0;
+    }
+
+    if (nd == 1)
+    {
+        v = big_int_reciprocal_2by1(d[0]);
+        rem = u[nu];
+        for (j = nu - 1; j >= 0; --j)
+            q[j] = big_int_udiv_2by1(&rem, rem, u[j], d[0], v);
+        r[0] = rem >> s;
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+        return;
+    }
+
+    d1 = d[nd - 1];
+    d0 = d[nd - 2];
+    v = big_int_reciprocal_3by2(d1, d0);
+
+    if (nd == 2)
+    {
+        n1 = u[nu];
+        n0 = u[nu - 1];
+        for (j = nu - 2; j >= 0; --j)
+            q[j] = big_int_udiv_3by2(&n1, &n0, n1, n0, u[j], d1, d0, v);
+
+        r[0] = s ? (n0 >> s) | (n1 << (64 - s)) : n0;
+        r[1] = n1 >> s;
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+        return;
+    }
 
-        if (a_loc->size == a->size)
+    // Schoolbook division, one quotient limb per iteration (cf. Algorithm D,
+    // D. Knuth, TAOCP Vol. 2, 4.3.1), where the estimate of the 3/2 division
+    // is off by at most one
+    m = nu - nd;
+    n2 = u[nu];
+    for (j = m; j >= 0; --j)
+    {
+        n1 = u[j + nd - 1];
+        n0 = u[j + nd - 2];
+
+        if (n2 == d1 && n1 == d0)
         {
-            // Special case where we actually have a zero in the MSB, just to make
-            // subsequent ops easier
-            a_loc->chunks[a->size] = 0;
-            a_loc->size += 1;
-            ADD_STAT_COLLECTION(BASIC_ADD_SIZE)
+            q[j] = ~(uint64_t) 0;
+            big_int_limbs_submul(u + j, d, nd, q[j]);
+            n2 = u[j + nd - 1];
+            continue;
         }
 
-        radix_pow->chunks[b->size] = 1;
-        radix_pow->size = b->size + 1;
-        ADD_STAT_COLLECTION(BASIC_ADD_SIZE)
+        q[j] = big_int_udiv_3by2(&n1, &n0, n2, n1, n0, d1, d0, v);
 
-        // Calculate quotient digit by digit
-        for (q_idx = q->size - 1; q_idx >= 0; --q_idx)
-        {
-            ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-            // Calculate quotient and remainder of
-            // a->chunks[q_idx : q_idx + b->size] / b_loc
+        // Subtract q[j] * d from the remaining limbs
+        cy = big_int_limbs_submul(u + j, d, nd - 2, q[j]);
+        cy1 = n0 < cy;
+        n0 -= cy;
+        cy = n1 < cy1;
+        n1 -= cy1;
+        u[j + nd - 2] = n0;
 
-            a_idx = q_idx + b->size;
-            ADD_STAT_COLLECTION(BASIC_ADD_SIZE)
+        // Rare case that the estimate was one too large, add back d
+        if (cy)
+        {
+            n1 += d1 + big_int_limbs_add(u + j, d, nd - 1);
+            --q[j];
+        }
+        u[j + nd - 1] = n1;
+        n2 = n1;
+    }
 
-            q_c = a_loc->chunks[a_idx] * BIGINT_RADIX + a_loc->chunks[a_idx - 1];
-            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
-            ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
-            r_c = q_c % b_loc->chunks[b->size - 1];
-            ADD_STAT_COLLECTION(BASIC_MOD)
-            ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-            q_c /= b_loc->chunks[b->size - 1];
-            ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
+    // Unnormalize the remainder
+    if (s)
+    {
+        for (i = 0; i < (int64_t) nd - 1; ++i)
+            r[i] = (u[i] >> s) | (u[i + 1] << (64 - s));
+        r[nd - 1] = u[nd - 1] >> s;
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+    }
+    else
+    {
+        memcpy(r, u, nd * sizeof(uint64_t));
+    }
+}
 
-            do
-            {
-                ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
-                ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
-                ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
-                ADD_STAT_COLLECTION(BASIC_BITWISE)
-                if (q_c >= BIGINT_RADIX || (b->size > 1 && q_c * b_loc->chunks[b->size - 2] > BIGINT_RADIX * r_c + a_loc->chunks[a_idx - 2]))
-                {
-                    --q_c;
-                    ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                    r_c += b_loc->chunks[b_loc->size - 1];
-                    ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
-                    ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                }
-                else
-                {
-                    break;
-                }
-            } while (r_c < BIGINT_RADIX);
+/**
+ * \brief Calculate quotient q and remainder r, such that: a = q * b + r
+ *        We round numbers towards -inf, e.g., -13/8 = (-2, 3)
+ *
+ * \param r if r is not NULL, it will be set to the remainder.
+ * \returns pointer to q
+ *
+ * \assumption q, a, b != NULL
+ */
+BigInt *big_int_div_rem(BigInt *q, BigInt *r, BigInt *a, BigInt *b)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_DIV_REM);
 
-            // Multiply and subtract
-            // XXX: this entire part can surely be done more efficiently. However,
-            // we avoid using divrem in Elligator, so it does not matter for us.
-            for (i = 0; i <= b_loc->size; ++i)
-            {
-                ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                if (q_idx + i >= a_loc->size)
-                    break;
-                a_part->chunks[i] = a_loc->chunks[q_idx + i];
-                ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-            }
-            a_part->size = i;
-            a_part->sign = 0;
+    uint64_t a_limbs[BIGINT_DIV_LIMBS], b_limbs[BIGINT_DIV_LIMBS];
+    uint64_t q_limbs[BIGINT_DIV_LIMBS], r_limbs[BIGINT_DIV_LIMBS];
+    uint64_t na, nb;
+    uint8_t a_sign = a->sign, b_sign = b->sign;
 
-            big_int_create_from_chunk(q_c_bigint, q_c, 0);
-            big_int_sub(qb, a_part, big_int_mul(qb, q_c_bigint, b_loc));
+    BIG_INT_DEFINE_PTR(a_abs);
+    BIG_INT_DEFINE_PTR(b_abs);
+    BIG_INT_DEFINE_PTR(r_loc);
 
-            // This is a very unlikely case (cf. step D6 in D. Knuth's book section 4.3)
-            if (qb->sign == 1)
-            {
-                // WARNING("Rare case in div_rem triggered\n");
-                big_int_add(qb, qb, radix_pow);
+    if (big_int_is_zero(b))
+        FATAL("Division by zero!\n");
 
-                --q_c;
-                ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                // NOTE: we intentionally ignore the overflow in a_part, it cancels
-                // out with the borrow that we ignored from the previous add.
-                big_int_add(qb, qb, b_loc);
+    /*
+     * Special cases
+     */
+    big_int_abs(a_abs, a);
+    big_int_abs(b_abs, b);
 
-                for (i = 0; i <= b->size; ++i)
-                {
-                    ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                    ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                    if (q_idx + i >= a_loc->size)
-                        break;
-                    a_loc->chunks[q_idx + i] = qb->chunks[i];
-                    ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                }
-            }
-            else
-            {
-                for (i = 0; i <= b->size; ++i)
-                {
-                    ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                    ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                    if (q_idx + i >= a_loc->size)
-                        break;
+    // zero dividend
+    if (big_int_is_zero(a))
+    {
+        big_int_create_from_chunk(q, 0, 0);
+        big_int_create_from_chunk(r_loc, 0, 0);
+    }
+    // divisor larger than dividend
+    else if (big_int_compare(b_abs, a_abs) == 1)
+    {
+        big_int_create_from_chunk(q, 0, 0);
 
-                    a_loc->chunks[q_idx + i] = qb->chunks[i];
-                    ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-                }
-            }
+        // Save unsigned rest, account for signs later
+        big_int_copy(r_loc, a_abs);
+    }
+    else
+    {
+        big_int_limbs_load(a_limbs, a_abs, BIGINT_DIV_LIMBS);
+        big_int_limbs_load(b_limbs, b_abs, BIGINT_DIV_LIMBS);
+        na = big_int_limbs_size(a_limbs, BIGINT_DIV_LIMBS);
+        nb = big_int_limbs_size(b_limbs, BIGINT_DIV_LIMBS);
 
-            q->chunks[q_idx] = q_c;
+        // Simple case for small BigInts, just use normal C division
+        if (na == 1)
+        {
+            q_limbs[0] = a_limbs[0] / b_limbs[0];
+            r_limbs[0] = a_limbs[0] % b_limbs[0];
+            ADD_STAT_COLLECTION(BASIC_DIV)
+            ADD_STAT_COLLECTION(BASIC_MOD)
+        }
+        else
+        {
+            big_int_div_rem_limbs(q_limbs, r_limbs, a_limbs, na, b_limbs, nb);
         }
 
-        // Unnormalize
-        a_loc->size = b->size;
-        r_loc = big_int_copy(r_loc, a_loc);
-        big_int_srl_small(r_loc, r_loc, factor);
-        big_int_prune_leading_zeros(r_loc, r_loc);
-
-        big_int_prune_leading_zeros(q, q);
+        big_int_limbs_store(q, q_limbs, na - nb + 1);
+        big_int_limbs_store(r_loc, r_limbs, nb);
     }
+
+    q->sign = a_sign ^ b_sign;
+    ADD_STAT_COLLECTION(BASIC_BITWISE)
+
     ADD_STAT_COLLECTION(BASIC_BITWISE)
     // Round towards -inf if either operand is negative
-    if (a->sign ^ b->sign && !big_int_is_zero(r_loc))
+    if (a_sign ^ b_sign && !big_int_is_zero(r_loc))
     {
         big_int_sub(q, q, big_int_one);
-
-        big_int_abs(b_loc, b);
-        big_int_sub(r_loc, b_loc, r_loc);
+        big_int_sub(r_loc, b_abs, r_loc);
     }
     ADD_STAT_COLLECTION(BASIC_BITWISE)
     // If b is negative, flip the sign of the remainder to maintain the
     // invariant q * b + r = a
-    if (b->sign)
+    if (b_sign)
         big_int_neg(r_loc, r_loc);
 
     if (r)
@@ -3136,7 +4102,7 @@ BigInt *big_int_sll_small(BigInt *r, BigInt *a, uint64_t shift)
     for (i = 0; i < a->size; ++i)
     {
         ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-        carry = (a->chunks[i] << shift) | carry;
+        carry = ((dbl_chunk_size_t)a->chunks[i] << shift) | carry;
         ADD_STAT_COLLECTION(BASIC_BITWISE)
         r->chunks[r_idx] = carry % BIGINT_RADIX;
         ADD_STAT_COLLECTION(BASIC_MOD)
@@ -3231,7 +4197,7 @@ BigInt *big_int_srl_small(BigInt *r, BigInt *a, uint64_t shift)
     for (i = 0; i < r->size - 1; ++i)
     {
         ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-        carry = (a->chunks[a_idx + 1] << (BIGINT_CHUNK_BIT_SIZE - shift)) % BIGINT_RADIX;
+        carry = ((dbl_chunk_size_t)a->chunks[a_idx + 1] << (BIGINT_CHUNK_BIT_SIZE - shift)) % BIGINT_RADIX;
         ADD_STAT_COLLECTION(BASIC_SHIFT)
         ADD_STAT_COLLECTION(BASIC_MOD)
         ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
@@ -3384,7 +4350,98 @@ BigInt *big_int_inv(BigInt *r, BigInt *a, BigInt *q)
 }
 
 /**
- * \brief Calculate r := (b^e) mod q
+ * \brief Returns bit i of |a|
+ */
+static inline uint64_t big_int_get_bit(BigInt *a, uint64_t i)
+{
+    ADD_STAT_COLLECTION(BASIC_SHIFT)
+    ADD_STAT_COLLECTION(BASIC_BITWISE)
+    return (a->chunks[i / BIGINT_CHUNK_BIT_SIZE] >> (i % BIGINT_CHUNK_BIT_SIZE))
+        & 1;
+}
+
+/**
+ * \brief Returns the number of bits of |a|, i.e., 0 for a = 0
+ *
+ * \assumption a != NULL
+ */
+uint64_t big_int_bit_length(BigInt *a)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_BIT_LENGTH);
+
+    int64_t i;
+
+    for (i = a->size - 1; i >= 0 && !a->chunks[i]; --i)
+        ;
+
+    if (i < 0)
+        return 0;
+
+    return i * BIGINT_CHUNK_BIT_SIZE + 64 - __builtin_clzll(a->chunks[i]);
+}
+
+/**
+ * \brief Returns the window width for the sliding-window exponentiation with
+ *        an exponent of the given number of bits. Larger windows need fewer
+ *        multiplications, but a table of 2^(w-1) odd powers.
+ */
+uint64_t big_int_pow_window_size(uint64_t bits)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_POW_WINDOW_SIZE);
+
+    if (bits > 671)
+        return 6;
+    if (bits > 239)
+        return 5;
+    if (bits > 79)
+        return 4;
+    if (bits > 23)
+        return 3;
+    return 1;
+}
+
+/**
+ * \brief Get the next window of the sliding-window exponentiation, scanning
+ *        the exponent from bit i downwards. A window has at most w bits and
+ *        ends with a set bit.
+ *
+ * \param len is set to the number of bits of the window.
+ * \returns the odd value of the window, or 0 if bit i is not set (then the
+ *          window consists of that bit only).
+ *
+ * \assumption e, len != NULL, 1 <= w <= BIGINT_POW_MAX_WINDOW
+ */
+uint64_t big_int_pow_window(BigInt *e, int64_t i, uint64_t w, uint64_t *len)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_POW_WINDOW);
+
+    int64_t l;
+    uint64_t val = 0;
+
+    if (!big_int_get_bit(e, i))
+    {
+        *len = 1;
+        return 0;
+    }
+
+    for (l = MAX(i - (int64_t) w + 1, 0); !big_int_get_bit(e, l); ++l)
+        ;
+
+    for (int64_t j = i; j >= l; --j)
+    {
+        val = (val << 1) | big_int_get_bit(e, j);
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+    }
+    *len = i - l + 1;
+
+    return val;
+}
+
+/**
+ * \brief Calculate r := (b^e) mod q with sliding-window exponentiation. For
+ *        odd moduli of up to 256 bits, we use Montgomery arithmetic (see
+ *        big_int_pow_mont), otherwise the products are reduced with
+ *        big_int_mul_mod. For e <= 0, the result is 1.
  *
  * \assumption r, b, e, q != NULL
  *
@@ -3395,53 +4452,67 @@ BigInt *big_int_pow(BigInt *r, BigInt *b, BigInt *e, BigInt *q)
 {
     ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_POW);
 
-    BIG_INT_DEFINE_PTR(e_loc);
-    BIG_INT_DEFINE_PTR(b_loc1);
-    BIG_INT_DEFINE_PTR(b_loc2);
-    BIG_INT_DEFINE_PTR(r_loc1);
+    BigInt table[BIGINT_POW_TABLE_SIZE];
+    BigIntMontCtx ctx;
 
-    BIG_INT_DEFINE_FROM_CHUNK(r_loc2, 0, 1);
+    BIG_INT_DEFINE_PTR(q_abs);
+    BIG_INT_DEFINE_PTR(b_sq);
+    BIG_INT_DEFINE_PTR(r_loc1);
+    BIG_INT_DEFINE_PTR(r_loc2);
 
     BigInt *r_loc_tmp;
+    uint64_t bits, w, len, val;
+    int64_t i;
+
+    bits = big_int_bit_length(e);
+    if (e->sign || !bits)
+        return big_int_create_from_chunk(r, 1, 0);
+
+    big_int_abs(q_abs, q);
+    if (big_int_is_odd(q_abs) && big_int_compare(q_abs, big_int_one) > 0
+        && big_int_bit_length(q_abs) <= 64 * BIGINT_MONT_LIMBS)
+    {
+        big_int_mont_ctx_init(&ctx, q_abs);
+        big_int_pow_mont(r, b, e, &ctx);
+
+        // Results mod negative q are in (q, 0]
+        if (q->sign && !big_int_is_zero(r))
+            big_int_sub(r, r, q_abs);
+        return r;
+    }
 
-    big_int_copy(e_loc, e);
-    big_int_copy(b_loc1, b);
+    // Table of the odd powers b, b^3, ..., b^(2^w - 1)
+    w = big_int_pow_window_size(bits);
+    big_int_mod(&table[0], b, q);
+    if (w > 1)
+        big_int_square_mod(b_sq, &table[0], q);
+    for (i = 1; i < 1 << (w - 1); ++i)
+        big_int_mul_mod(&table[i], &table[i - 1], b_sq, q);
 
-    while (big_int_compare(e_loc, big_int_zero) > 0)
+    // The first window only copies its table entry
+    i = bits - 1;
+    val = big_int_pow_window(e, i, w, &len);
+    big_int_copy(r_loc2, &table[val >> 1]);
+
+    for (i -= len; i >= 0; i -= len)
     {
-        // If power is odd
-        if (big_int_is_odd(e_loc))
+        val = big_int_pow_window(e, i, w, &len);
+        for (uint64_t k = 0; k < len; ++k)
         {
-            big_int_mul_mod(r_loc1, r_loc2, b_loc1, q);
+            big_int_square_mod(r_loc1, r_loc2, q);
             r_loc_tmp = r_loc1;
             r_loc1 = r_loc2;
             r_loc2 = r_loc_tmp;
         }
-
-        big_int_srl_small(e_loc, e_loc, 1);
-
-        if (big_int_is_zero(e_loc))
-            break;
-
-        big_int_square_mod(b_loc2, b_loc1, q);
-
-        // ------ unroll ------
-        if (big_int_is_odd(e_loc))
+        if (val)
         {
-            big_int_mul_mod(r_loc1, r_loc2, b_loc2, q);
+            big_int_mul_mod(r_loc1, r_loc2, &table[val >> 1], q);
             r_loc_tmp = r_loc1;
             r_loc1 = r_loc2;
             r_loc2 = r_loc_tmp;
         }
-
-        big_int_srl_small(e_loc, e_loc, 1);
-
-        if (!big_int_is_zero(e_loc))
-            big_int_square_mod(b_loc1, b_loc2, q);
     }
 
-    // This copy could be saved if we assume no aliasing, but we don't use
-    // this function for Elligator anymore internally.
     return big_int_copy(r, r_loc2);
 }
 
@@ -3529,94 +4600,316 @@ int8_t big_int_compare(BigInt *a, BigInt *b)
 }
 
 /**
- * \brief Calculate the greatest common divisor using the extended Euclidean
- *        algorithm (iterative version).
- * \returns Pointer to EgcdResult (x, y, g), where x * a + y * b = g
- *          and g is the GCD.
- *
- * \assumption r, a, b != NULL
+ * \brief Extract the 64 bits starting at bit s of the n-limb number a
  */
-EgcdResult *big_int_egcd(EgcdResult *r, BigInt *a, BigInt *b)
+static inline uint64_t big_int_limbs_extract(uint64_t *a, uint64_t n,
+    uint64_t s)
 {
-    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_EGCD);
+    uint64_t i = s / 64, b = s % 64;
+    uint64_t r = a[i] >> b;
 
-    BIG_INT_DEFINE_PTR(q);
-    BIG_INT_DEFINE_PTR(a_loc);
-    BIG_INT_DEFINE_PTR(x1);
-    BIG_INT_DEFINE_PTR(y1);
-    BIG_INT_DEFINE_PTR(tmp);
-    BIG_INT_DEFINE_PTR(tmp2);
+    if (b && i + 1 < n)
+        r |= a[i + 1] << (64 - b);
+    ADD_STAT_COLLECTION(BASIC_SHIFT)
+
+    return r;
+}
 
-    // Avoid copying intermediate results to final result by using the latter
-    // from the start
-    BigInt *b_loc = &(r->g);
-    BigInt *x0 = &(r->x);
-    BigInt *y0 = &(r->y);
+/**
+ * \brief Calculate r := x * a + y * b on n limbs for signed factors x, y
+ *
+ * \assumption |x|, |y| < 2^62, the result is in [0, 2^(64 * n))
+ * \assumption r does not alias a or b
+ */
+static inline void big_int_limbs_lin_comb(uint64_t *r, uint64_t *a, int64_t x,
+    uint64_t *b, int64_t y, uint64_t n)
+{
+    __int128 t, c = 0;
 
-    if (big_int_is_zero(a) && big_int_is_zero(b))
+    for (uint64_t i = 0; i < n; ++i)
     {
-        big_int_create_from_chunk(x0, 0, 0);
-        ADD_STAT_COLLECTION(BASIC_BITWISE)
-        big_int_create_from_chunk(y0, 0, 0);
-        big_int_create_from_chunk(b_loc, 0, 0);
-        return r;
+        t = (__int128) x * a[i] + (__int128) y * b[i] + c;
+        r[i] = (uint64_t) t;
+        c = t >> 64;
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
     }
+}
 
-    big_int_create_from_chunk(x0, 0, 0);
-    big_int_create_from_chunk(x1, 1, 0);
-    big_int_create_from_chunk(y0, 1, 0);
-    big_int_create_from_chunk(y1, 0, 0);
-
-    big_int_copy(a_loc, a);
-    big_int_copy(b_loc, b);
-
-    // Take the GCD of positive numbers, then just flig the signs of x, y at the end
-    big_int_abs(a_loc, a_loc);
-    big_int_abs(b_loc, b_loc);
+/**
+ * \brief Calculate r := x * a + y * b on n limbs for unsigned factors x, y
+ *
+ * \assumption the result is in [0, 2^(64 * n))
+ * \assumption r does not alias a or b
+ */
+static inline void big_int_limbs_lin_comb_abs(uint64_t *r, uint64_t *a,
+    uint64_t x, uint64_t *b, uint64_t y, uint64_t n)
+{
+    // The carry stays below 2^65, such that no 128-bit sum overflows
+    unsigned __int128 p, t, c = 0;
 
-    while (big_int_compare(a_loc, big_int_zero) != 0)
+    for (uint64_t i = 0; i < n; ++i)
     {
-        big_int_div_rem(q, tmp, b_loc, a_loc);
-        big_int_copy(b_loc, a_loc);
-        big_int_copy(a_loc, tmp);
+        p = (unsigned __int128) x * a[i] + c;
+        t = (unsigned __int128) y * b[i] + (uint64_t) p;
+        r[i] = (uint64_t) t;
+        c = (p >> 64) + (t >> 64);
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+    }
+}
 
-        big_int_copy(tmp, y1);
-        big_int_mul(tmp2, y1, q);
-        big_int_sub(y1, y0, tmp2);
-        big_int_copy(y0, tmp);
+/**
+ * \brief Calculate r := r + a * b on n limbs, truncated to n limbs
+ */
+static inline void big_int_limbs_addmul_1(uint64_t *r, uint64_t *a,
+    uint64_t n, uint64_t b)
+{
+    unsigned __int128 c = 0;
 
-        big_int_copy(tmp, x1);
-        big_int_mul(tmp2, x1, q);
-        big_int_sub(x1, x0, tmp2);
-        big_int_copy(x0, tmp);
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        c = (unsigned __int128) a[i] * b + r[i] + (uint64_t) (c >> 64);
+        r[i] = (uint64_t) c;
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
     }
+}
 
-    // Account for signs of a and b
-    x0->sign ^= a->sign;
-    ADD_STAT_COLLECTION(BASIC_BITWISE)
-    y0->sign ^= b->sign;
-    ADD_STAT_COLLECTION(BASIC_BITWISE)
+/**
+ * \brief Apply the cofactor matrix of one or more Euclidean steps to the
+ *        magnitudes of a pair of cofactors, i.e., (c0, c1) := (m00 * c0 +
+ *        m01 * c1, m10 * c0 + m11 * c1) on n limbs.
+ */
+static inline void big_int_limbs_cofactors(uint64_t *c0, uint64_t *c1,
+    uint64_t m00, uint64_t m01, uint64_t m10, uint64_t m11, uint64_t n)
+{
+    uint64_t t0[BIGINT_DIV_LIMBS], t1[BIGINT_DIV_LIMBS];
 
-    return r;
+    big_int_limbs_lin_comb_abs(t0, c0, m00, c1, m01, n);
+    big_int_limbs_lin_comb_abs(t1, c0, m10, c1, m11, n);
+    memcpy(c0, t0, n * sizeof(uint64_t));
+    memcpy(c1, t1, n * sizeof(uint64_t));
 }
 
 /**
- * \brief Calculate the Chi function chi(t) = t**((q-1)/2) mod q
- * \returns 0 if t = 0, 1 if t is a non-zero square, -1 otherwise
+ * \brief Calculate the greatest common divisor using the extended Euclidean
+ *        algorithm.
  *
- * \assumption r, t, q != NULL
- * \assumption q is prime
+ * We use Lehmer's acceleration (cf. Algorithm L, D. Knuth, TAOCP Vol. 2,
+ * 4.5.2): the Euclidean steps are simulated on the leading 62 bits of the
+ * remainders, as long as the quotients are guaranteed to be the same as for
+ * the full numbers. The resulting 2x2 matrix is then applied to the remainders
+ * and cofactors at once. Once the remainders fit into a single limb, the
+ * remaining steps are done exactly on words. Since the quotient sequence is
+ * the one of the classical extended Euclidean algorithm, x, y, and g are the
+ * same as those of mpz_gcdext for non-negative a, b.
  *
- * NOTE: there is an optimized Chi function for Elligator in bigint_curve1174,
- * that we use instead. Not all optimizations were ported back to this function.
+ * The cofactors are tracked as magnitudes, their signs alternate with the
+ * number of steps.
+ *
+ * \returns Pointer to EgcdResult (x, y, g), where x * a + y * b = g
+ *          and g is the GCD.
+ *
+ * \assumption r, a, b != NULL
  */
-BigInt *big_int_chi(BigInt *r, BigInt *t, BigInt *q)
+EgcdResult *big_int_egcd(EgcdResult *r, BigInt *a, BigInt *b)
 {
-    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_CHI);
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_EGCD);
 
-    BIG_INT_DEFINE_PTR(e);
+    uint64_t u[BIGINT_DIV_LIMBS], v[BIGINT_DIV_LIMBS];
+    uint64_t t0[BIGINT_DIV_LIMBS], t1[BIGINT_DIV_LIMBS];
+    uint64_t x0[BIGINT_DIV_LIMBS] = {0}, x1[BIGINT_DIV_LIMBS] = {0};
+    uint64_t y0[BIGINT_DIV_LIMBS] = {0}, y1[BIGINT_DIV_LIMBS] = {0};
+    uint64_t n, nu, nv, sh, u_hat, v_hat, q, steps = 0;
+    uint64_t m00, m01, m10, m11, tmp;
+    int64_t ma, mb, mc, md, mt;
+    int8_t x_neg, y_neg;
 
-    if (big_int_compare(t, big_int_zero) == 0)
+    if (big_int_is_zero(a) && big_int_is_zero(b))
+    {
+        big_int_create_from_chunk(&(r->x), 0, 0);
+        big_int_create_from_chunk(&(r->y), 0, 0);
+        big_int_create_from_chunk(&(r->g), 0, 0);
+        return r;
+    }
+
+    // Take the GCD of positive numbers, then flip the signs of x, y at the end
+    big_int_limbs_load(u, b, BIGINT_DIV_LIMBS);
+    big_int_limbs_load(v, a, BIGINT_DIV_LIMBS);
+    n = MAX(big_int_limbs_size(u, BIGINT_DIV_LIMBS),
+        big_int_limbs_size(v, BIGINT_DIV_LIMBS));
+
+    x1[0] = 1;
+    y0[0] = 1;
+
+    // Make sure that u >= v, the classical algorithm does this with a first
+    // step with quotient 0
+    for (int64_t i = n - 1; i >= 0; --i)
+    {
+        if (u[i] == v[i])
+            continue;
+        if (u[i] < v[i])
+        {
+            memcpy(t0, u, n * sizeof(uint64_t));
+            memcpy(u, v, n * sizeof(uint64_t));
+            memcpy(v, t0, n * sizeof(uint64_t));
+            x0[0] = 1; x1[0] = 0;
+            y0[0] = 0; y1[0] = 1;
+            steps = 1;
+        }
+        break;
+    }
+
+    nu = big_int_limbs_size(u, n);
+    nv = big_int_limbs_size(v, n);
+
+    while (nv > 1 || v[0] != 0)
+    {
+        if (nu == 1)
+        {
+            // Both remainders fit into a word, finish the algorithm exactly
+            // and accumulate the cofactor matrix (bounded by u in magnitude)
+            m00 = 1; m01 = 0; m10 = 0; m11 = 1;
+            while (v[0])
+            {
+                q = u[0] / v[0];
+                tmp = u[0] - q * v[0];
+                u[0] = v[0];
+                v[0] = tmp;
+                ADD_STAT_COLLECTION(BASIC_DIV)
+
+                tmp = m00 + q * m10;
+                m00 = m10;
+                m10 = tmp;
+                tmp = m01 + q * m11;
+                m01 = m11;
+                m11 = tmp;
+                ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+                ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+                ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+                ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+                ++steps;
+            }
+            big_int_limbs_cofactors(x0, x1, m00, m01, m10, m11, n);
+            big_int_limbs_cofactors(y0, y1, m00, m01, m10, m11, n);
+            break;
+        }
+
+        // Leading 62 bits of u and the bits of v at the same positions
+        sh = 64 * nu - __builtin_clzll(u[nu - 1]) - 62;
+        ADD_STAT_COLLECTION(BASIC_BITWISE)
+        u_hat = big_int_limbs_extract(u, nu, sh);
+        v_hat = big_int_limbs_extract(v, nu, sh);
+
+        // Simulate the Euclidean steps while the quotients of the lower and
+        // upper bounds of the exact quotient agree
+        ma = 1; mb = 0; mc = 0; md = 1;
+        while (v_hat + mc != 0 && v_hat + md != 0)
+        {
+            q = (u_hat + ma) / (v_hat + mc);
+            if (q != (u_hat + mb) / (v_hat + md))
+                break;
+            ADD_STAT_COLLECTION(BASIC_DIV)
+            ADD_STAT_COLLECTION(BASIC_DIV)
+
+            mt = ma - (int64_t) q * mc;
+            ma = mc;
+            mc = mt;
+            mt = mb - (int64_t) q * md;
+            mb = md;
+            md = mt;
+            tmp = u_hat - q * v_hat;
+            u_hat = v_hat;
+            v_hat = tmp;
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+            ++steps;
+        }
+
+        if (mb == 0)
+        {
+            // No step could be simulated (large quotient), do a full
+            // multi-precision step
+            memset(t0, 0, n * sizeof(uint64_t));
+            big_int_div_rem_limbs(t0, t1, u, nu, v, nv);
+            memcpy(u, v, nv * sizeof(uint64_t));
+            memset(u + nv, 0, (n - nv) * sizeof(uint64_t));
+            memcpy(v, t1, nv * sizeof(uint64_t));
+
+            // (c0, c1) := (c1, c0 + q * c1)
+            for (uint64_t j = 0; j <= nu - nv; ++j)
+            {
+                big_int_limbs_addmul_1(x0 + j, x1, n - j, t0[j]);
+                big_int_limbs_addmul_1(y0 + j, y1, n - j, t0[j]);
+            }
+            memcpy(t1, x0, n * sizeof(uint64_t));
+            memcpy(x0, x1, n * sizeof(uint64_t));
+            memcpy(x1, t1, n * sizeof(uint64_t));
+            memcpy(t1, y0, n * sizeof(uint64_t));
+            memcpy(y0, y1, n * sizeof(uint64_t));
+            memcpy(y1, t1, n * sizeof(uint64_t));
+            ++steps;
+        }
+        else
+        {
+            big_int_limbs_lin_comb(t0, u, ma, v, mb, nu);
+            big_int_limbs_lin_comb(t1, u, mc, v, md, nu);
+            memcpy(u, t0, nu * sizeof(uint64_t));
+            memcpy(v, t1, nu * sizeof(uint64_t));
+
+            // The entries of each row have opposite signs, just like the
+            // cofactors, so the magnitudes add up
+            big_int_limbs_cofactors(x0, x1, llabs(ma), llabs(mb), llabs(mc),
+                llabs(md), n);
+            big_int_limbs_cofactors(y0, y1, llabs(ma), llabs(mb), llabs(mc),
+                llabs(md), n);
+        }
+
+        nu = big_int_limbs_size(u, nu);
+        nv = big_int_limbs_size(v, nu);
+    }
+
+    big_int_limbs_store(&(r->g), u, n);
+    big_int_limbs_store(&(r->x), x0, n);
+    big_int_limbs_store(&(r->y), y0, n);
+
+    // x_i is positive for odd i, y_i for even i (zero stays positive)
+    x_neg = !(steps & 1) && !big_int_is_zero(&(r->x));
+    y_neg = (steps & 1) && !big_int_is_zero(&(r->y));
+
+    // Account for signs of a and b
+    r->x.sign = x_neg ^ a->sign;
+    ADD_STAT_COLLECTION(BASIC_BITWISE)
+    r->y.sign = y_neg ^ b->sign;
+    ADD_STAT_COLLECTION(BASIC_BITWISE)
+
+    return r;
+}
+
+/**
+ * \brief Calculate the Chi function chi(t) = t**((q-1)/2) mod q
+ * \returns 0 if t = 0, 1 if t is a non-zero square, -1 otherwise
+ *
+ * \assumption r, t, q != NULL
+ * \assumption q is prime
+ *
+ * NOTE: there is an optimized Chi function for Elligator in bigint_curve1174,
+ * that we use instead. Not all optimizations were ported back to this function.
+ */
+BigInt *big_int_chi(BigInt *r, BigInt *t, BigInt *q)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_CHI);
+
+    BIG_INT_DEFINE_PTR(e);
+
+    if (big_int_compare(t, big_int_zero) == 0)
     {
         // XXX: [Optimization] change return value to int8_t
         big_int_create_from_chunk(r, 0, 0);
@@ -3636,6 +4929,662 @@ BigInt *big_int_chi(BigInt *r, BigInt *t, BigInt *q)
     return r;
 }
 
+// === === === === === === === === === === === === === === === === === === ===
+// Montgomery arithmetic
+// === === === === === === === === === === === === === === === === === === ===
+
+/**
+ * \brief Calculate r := t - q if t >= q, otherwise r := t, where t has n + 1
+ *        limbs. This is the final conditional subtraction of a Montgomery
+ *        reduction, done without branches.
+ */
+static inline __attribute__((always_inline))
+void big_int_mont_final_sub(uint64_t *r, uint64_t *t, const uint64_t *q,
+    uint64_t n)
+{
+    uint64_t d[BIGINT_MONT_LIMBS];
+    uint64_t borrow = 0, mask;
+    unsigned __int128 c;
+
+    for (uint64_t j = 0; j < n; ++j)
+    {
+        c = (unsigned __int128) t[j] - q[j] - borrow;
+        d[j] = (uint64_t) c;
+        borrow = (uint64_t) (c >> 64) & 1;
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+    }
+
+    // t - q >= 0 iff there is a carry chunk or no borrow
+    mask = -(uint64_t) (t[n] | (borrow ^ 1));
+    for (uint64_t j = 0; j < n; ++j)
+    {
+        r[j] = (d[j] & mask) | (t[j] & ~mask);
+        ADD_STAT_COLLECTION(BASIC_BITWISE)
+    }
+}
+
+/**
+ * \brief Calculate r := a * b * R^-1 mod q on n 64-bit limbs, using the
+ *        coarsely integrated operand scanning (CIOS) method.
+ *
+ * \assumption a, b < q
+ * \assumption n <= BIGINT_MONT_LIMBS
+ */
+static inline __attribute__((always_inline))
+void big_int_mont_mul_limbs(uint64_t *r, const uint64_t *a, const uint64_t *b,
+    const uint64_t *q, uint64_t q_inv, uint64_t n)
+{
+    uint64_t t[BIGINT_MONT_LIMBS + 2] = {0};
+    uint64_t carry, m;
+    unsigned __int128 c;
+
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        // t += a * b[i]
+        carry = 0;
+        for (uint64_t j = 0; j < n; ++j)
+        {
+            c = (unsigned __int128) a[j] * b[i] + t[j] + carry;
+            t[j] = (uint64_t) c;
+            carry = (uint64_t) (c >> 64);
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        }
+        c = (unsigned __int128) t[n] + carry;
+        t[n] = (uint64_t) c;
+        t[n + 1] = (uint64_t) (c >> 64);
+
+        // t = (t + m * q) / 2^64, where m is chosen s.t. the division is exact
+        m = t[0] * q_inv;
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+        c = (unsigned __int128) m * q[0] + t[0];
+        carry = (uint64_t) (c >> 64);
+        for (uint64_t j = 1; j < n; ++j)
+        {
+            c = (unsigned __int128) m * q[j] + t[j] + carry;
+            t[j - 1] = (uint64_t) c;
+            carry = (uint64_t) (c >> 64);
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        }
+        c = (unsigned __int128) t[n] + carry;
+        t[n - 1] = (uint64_t) c;
+        t[n] = t[n + 1] + (uint64_t) (c >> 64);
+    }
+
+    big_int_mont_final_sub(r, t, q, n);
+}
+
+/**
+ * \brief Calculate r := a^2 * R^-1 mod q on n 64-bit limbs. The square is
+ *        computed first, such that each cross product is only computed once,
+ *        and then reduced (separated operand scanning).
+ *
+ * \assumption a < q
+ * \assumption n <= BIGINT_MONT_LIMBS
+ */
+static inline __attribute__((always_inline))
+void big_int_mont_square_limbs(uint64_t *r, const uint64_t *a,
+    const uint64_t *q, uint64_t q_inv, uint64_t n)
+{
+    uint64_t t[2 * BIGINT_MONT_LIMBS + 1] = {0};
+    uint64_t carry, top, m;
+    unsigned __int128 c;
+
+    // Cross products a[i] * a[j] for i < j
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        carry = 0;
+        for (uint64_t j = i + 1; j < n; ++j)
+        {
+            c = (unsigned __int128) a[i] * a[j] + t[i + j] + carry;
+            t[i + j] = (uint64_t) c;
+            carry = (uint64_t) (c >> 64);
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        }
+        t[i + n] = carry;
+    }
+
+    // Double the cross products and add the squares a[i]^2
+    carry = 0;
+    top = 0;
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        uint64_t lo = t[2 * i], hi = t[2 * i + 1];
+        uint64_t dbl_lo = (lo << 1) | top;
+        uint64_t dbl_hi = (hi << 1) | (lo >> 63);
+        top = hi >> 63;
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+
+        c = (unsigned __int128) a[i] * a[i] + dbl_lo + carry;
+        t[2 * i] = (uint64_t) c;
+        c = (c >> 64) + dbl_hi;
+        t[2 * i + 1] = (uint64_t) c;
+        carry = (uint64_t) (c >> 64);
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+    }
+
+    // Reduce: t = t / R mod q, top accumulates the carries at position 2n
+    top = 0;
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        m = t[i] * q_inv;
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+        carry = 0;
+        for (uint64_t j = 0; j < n; ++j)
+        {
+            c = (unsigned __int128) m * q[j] + t[i + j] + carry;
+            t[i + j] = (uint64_t) c;
+            carry = (uint64_t) (c >> 64);
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        }
+        c = (unsigned __int128) t[i + n] + carry + top;
+        t[i + n] = (uint64_t) c;
+        top = (uint64_t) (c >> 64);
+    }
+    t[2 * n] = top;
+
+    big_int_mont_final_sub(r, t + n, q, n);
+}
+
+/**
+ * \brief Calculate r := a * b * R^-1 mod q, dispatching to a fully unrolled
+ *        kernel for 256-bit moduli.
+ */
+static inline void big_int_mont_mul_ctx(uint64_t *r, const uint64_t *a,
+    const uint64_t *b, BigIntMontCtx *ctx)
+{
+    if (ctx->nr_limbs == BIGINT_MONT_LIMBS)
+        big_int_mont_mul_limbs(r, a, b, ctx->q, ctx->q_inv, BIGINT_MONT_LIMBS);
+    else
+        big_int_mont_mul_limbs(r, a, b, ctx->q, ctx->q_inv, ctx->nr_limbs);
+}
+
+/**
+ * \brief Calculate r := a^2 * R^-1 mod q, dispatching to a fully unrolled
+ *        kernel for 256-bit moduli.
+ */
+static inline void big_int_mont_square_ctx(uint64_t *r, const uint64_t *a,
+    BigIntMontCtx *ctx)
+{
+    if (ctx->nr_limbs == BIGINT_MONT_LIMBS)
+        big_int_mont_square_limbs(r, a, ctx->q, ctx->q_inv, BIGINT_MONT_LIMBS);
+    else
+        big_int_mont_square_limbs(r, a, ctx->q, ctx->q_inv, ctx->nr_limbs);
+}
+
+/**
+ * \brief Load a into limbs, reducing it mod q first if it is negative or has
+ *        more limbs than q.
+ */
+static inline void big_int_mont_load_reduced(uint64_t *r, BigInt *a,
+    BigIntMontCtx *ctx)
+{
+    BIG_INT_DEFINE_PTR(a_loc);
+
+    if (a->sign || a->size > ctx->q_big.size)
+        a = big_int_mod(a_loc, a, &ctx->q_big);
+    big_int_limbs_load(r, a, ctx->nr_limbs);
+}
+
+/**
+ * \brief Initialize the Montgomery context for modulus q, i.e., precompute
+ *        -q^-1 mod 2^64, R mod q, and R^2 mod q.
+ *
+ * \assumption ctx, q != NULL
+ * \assumption q is odd, 1 < q < 2^256
+ */
+BigIntMontCtx *big_int_mont_ctx_init(BigIntMontCtx *ctx, BigInt *q)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_MONT_CTX_INIT);
+
+    uint64_t n, s, k, bits, inv, x[BIGINT_MONT_LIMBS + 1] = {0};
+
+    big_int_prune_leading_zeros(&ctx->q_big, q);
+
+    n = (ctx->q_big.size * BIGINT_CHUNK_BIT_SIZE + 63) / 64;
+    ctx->nr_limbs = n;
+    big_int_limbs_load(ctx->q, &ctx->q_big, BIGINT_MONT_LIMBS);
+
+    // Newton iteration for q^-1 mod 2^64. Starting with q, which is correct
+    // mod 2^3 for odd q, each step doubles the number of correct bits.
+    inv = ctx->q[0];
+    for (uint64_t i = 0; i < 5; ++i)
+    {
+        inv *= 2 - ctx->q[0] * inv;
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+    }
+    ctx->q_inv = -inv;
+
+    // Write 64 n = s * 2^k with s odd. Compute 2^i mod q for i = 64 n (R) and
+    // i = 64 n + s (2^s R) by doubling, starting from the largest power of two
+    // below q, such that each step only needs the final conditional
+    // subtraction.
+    s = n >> __builtin_ctzll(n);
+    k = 6 + __builtin_ctzll(n);
+    bits = big_int_bit_length(&ctx->q_big);
+    x[(bits - 1) / 64] = 1ULL << ((bits - 1) % 64);
+    ADD_STAT_COLLECTION(BASIC_SHIFT)
+
+    for (uint64_t i = bits - 1; i < 64 * n + s; ++i)
+    {
+        x[n] = x[n - 1] >> 63;
+        for (uint64_t j = n - 1; j > 0; --j)
+            x[j] = (x[j] << 1) | (x[j - 1] >> 63);
+        x[0] <<= 1;
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+
+        big_int_mont_final_sub(x, x, ctx->q, n);
+        x[n] = 0;
+
+        if (i + 1 == 64 * n)
+            memcpy(ctx->one, x, n * sizeof(uint64_t));
+    }
+
+    // Each Montgomery squaring maps 2^t R to 2^(2t) R, so k squarings give
+    // 2^(s 2^k) R = R^2
+    for (uint64_t i = 0; i < k; ++i)
+        big_int_mont_square_ctx(x, x, ctx);
+    memcpy(ctx->r2, x, n * sizeof(uint64_t));
+
+    return ctx;
+}
+
+/**
+ * \brief Calculate r := a * R mod q, i.e., convert a to Montgomery form
+ *
+ * \assumption r, a, ctx != NULL
+ */
+BigInt *big_int_to_mont(BigInt *r, BigInt *a, BigIntMontCtx *ctx)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_TO_MONT);
+
+    uint64_t a_limbs[BIGINT_MONT_LIMBS] = {0}, r_limbs[BIGINT_MONT_LIMBS];
+
+    big_int_mont_load_reduced(a_limbs, a, ctx);
+    big_int_mont_mul_ctx(r_limbs, a_limbs, ctx->r2, ctx);
+
+    return big_int_limbs_store(r, r_limbs, ctx->nr_limbs);
+}
+
+/**
+ * \brief Calculate r := a * R^-1 mod q, i.e., convert a from Montgomery form
+ *
+ * \assumption r, a, ctx != NULL
+ * \assumption 0 <= a < q
+ */
+BigInt *big_int_from_mont(BigInt *r, BigInt *a, BigIntMontCtx *ctx)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_FROM_MONT);
+
+    uint64_t a_limbs[BIGINT_MONT_LIMBS] = {0}, r_limbs[BIGINT_MONT_LIMBS];
+    uint64_t one[BIGINT_MONT_LIMBS] = {1};
+
+    big_int_limbs_load(a_limbs, a, ctx->nr_limbs);
+    big_int_mont_mul_ctx(r_limbs, a_limbs, one, ctx);
+
+    return big_int_limbs_store(r, r_limbs, ctx->nr_limbs);
+}
+
+/**
+ * \brief Calculate r := a * b * R^-1 mod q, i.e., the product of a and b in
+ *        Montgomery form
+ *
+ * \assumption r, a, b, ctx != NULL
+ * \assumption 0 <= a, b < q
+ */
+BigInt *big_int_mont_mul(BigInt *r, BigInt *a, BigInt *b, BigIntMontCtx *ctx)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_MONT_MUL);
+
+    uint64_t a_limbs[BIGINT_MONT_LIMBS] = {0}, b_limbs[BIGINT_MONT_LIMBS] = {0};
+    uint64_t r_limbs[BIGINT_MONT_LIMBS];
+
+    big_int_limbs_load(a_limbs, a, ctx->nr_limbs);
+    big_int_limbs_load(b_limbs, b, ctx->nr_limbs);
+    big_int_mont_mul_ctx(r_limbs, a_limbs, b_limbs, ctx);
+
+    return big_int_limbs_store(r, r_limbs, ctx->nr_limbs);
+}
+
+/**
+ * \brief Calculate r := a^2 * R^-1 mod q, i.e., the square of a in
+ *        Montgomery form
+ *
+ * \assumption r, a, ctx != NULL
+ * \assumption 0 <= a < q
+ */
+BigInt *big_int_mont_square(BigInt *r, BigInt *a, BigIntMontCtx *ctx)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_MONT_SQUARE);
+
+    uint64_t a_limbs[BIGINT_MONT_LIMBS] = {0}, r_limbs[BIGINT_MONT_LIMBS];
+
+    big_int_limbs_load(a_limbs, a, ctx->nr_limbs);
+    big_int_mont_square_ctx(r_limbs, a_limbs, ctx);
+
+    return big_int_limbs_store(r, r_limbs, ctx->nr_limbs);
+}
+
+/**
+ * \brief Calculate r := (b^e) mod q with sliding-window exponentiation in
+ *        Montgomery form. Unlike the generic big_int_pow, no division is
+ *        needed. The window width depends on the exponent length (see
+ *        big_int_pow_window_size).
+ *
+ * \assumption r, b, e, ctx != NULL
+ * \assumption e >= 0
+ */
+BigInt *big_int_pow_mont(BigInt *r, BigInt *b, BigInt *e, BigIntMontCtx *ctx)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_POW_MONT);
+
+    uint64_t table[BIGINT_POW_TABLE_SIZE][BIGINT_MONT_LIMBS];
+    uint64_t b_sq[BIGINT_MONT_LIMBS], acc[BIGINT_MONT_LIMBS];
+    uint64_t one[BIGINT_MONT_LIMBS] = {1};
+    uint64_t bits, w, len, val;
+    int64_t i;
+
+    bits = big_int_bit_length(e);
+    w = big_int_pow_window_size(bits);
+
+    // Table of the odd powers b, b^3, ..., b^(2^w - 1) in Montgomery form
+    big_int_mont_load_reduced(acc, b, ctx);
+    big_int_mont_mul_ctx(table[0], acc, ctx->r2, ctx);
+    if (w > 1)
+        big_int_mont_square_ctx(b_sq, table[0], ctx);
+    for (i = 1; i < 1 << (w - 1); ++i)
+        big_int_mont_mul_ctx(table[i], table[i - 1], b_sq, ctx);
+
+    memcpy(acc, ctx->one, sizeof(acc));
+
+    // The first window only copies its table entry
+    i = bits - 1;
+    if (i >= 0)
+    {
+        val = big_int_pow_window(e, i, w, &len);
+        memcpy(acc, table[val >> 1], sizeof(acc));
+        i -= len;
+    }
+
+    for (; i >= 0; i -= len)
+    {
+        val = big_int_pow_window(e, i, w, &len);
+        for (uint64_t k = 0; k < len; ++k)
+            big_int_mont_square_ctx(acc, acc, ctx);
+        if (val)
+            big_int_mont_mul_ctx(acc, acc, table[val >> 1], ctx);
+    }
+
+    big_int_mont_mul_ctx(acc, acc, one, ctx);
+
+    return big_int_limbs_store(r, acc, ctx->nr_limbs);
+}
+
+// === === === === === === === === === === === === === === === === === === ===
+// Barrett reduction
+// === === === === === === === === === === === === === === === === === === ===
+
+/**
+ * \brief Calculate r := a * b on n 64-bit limbs, r has 2n limbs
+ *
+ * \assumption n <= BIGINT_MONT_LIMBS
+ */
+static inline __attribute__((always_inline))
+void big_int_mul_limbs(uint64_t *r, const uint64_t *a, const uint64_t *b,
+    uint64_t n)
+{
+    uint64_t carry;
+    unsigned __int128 c;
+
+    for (uint64_t j = 0; j < n; ++j)
+        r[j] = 0;
+
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        carry = 0;
+        for (uint64_t j = 0; j < n; ++j)
+        {
+            c = (unsigned __int128) a[j] * b[i] + r[i + j] + carry;
+            r[i + j] = (uint64_t) c;
+            carry = (uint64_t) (c >> 64);
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        }
+        r[i + n] = carry;
+    }
+}
+
+/**
+ * \brief Calculate r := r - q if r >= q on n + 1 limbs, without branches
+ */
+static inline __attribute__((always_inline))
+void big_int_barrett_cond_sub(uint64_t *r, const uint64_t *q, uint64_t n)
+{
+    uint64_t d[BIGINT_MONT_LIMBS + 1];
+    uint64_t borrow = 0, mask;
+    unsigned __int128 c;
+
+    for (uint64_t j = 0; j <= n; ++j)
+    {
+        c = (unsigned __int128) r[j] - (j < n ? q[j] : 0) - borrow;
+        d[j] = (uint64_t) c;
+        borrow = (uint64_t) (c >> 64) & 1;
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+    }
+
+    mask = borrow - 1;
+    for (uint64_t j = 0; j <= n; ++j)
+    {
+        r[j] = (d[j] & mask) | (r[j] & ~mask);
+        ADD_STAT_COLLECTION(BASIC_BITWISE)
+    }
+}
+
+/**
+ * \brief Calculate r := x mod q for x with 2n 64-bit limbs, with b = 2^64:
+ *        q3 = floor(floor(x / b^(n-1)) * mu / b^(n+1)) underestimates
+ *        floor(x / q) by at most two, so x - q3 * q < 3q.
+ *        (cf. Algorithm 14.42, Handbook of Applied Cryptography)
+ *
+ * \assumption n <= BIGINT_MONT_LIMBS
+ */
+static inline __attribute__((always_inline))
+void big_int_barrett_reduce_limbs(uint64_t *r, const uint64_t *x,
+    const uint64_t *q, const uint64_t *mu, uint64_t n)
+{
+    uint64_t q2[2 * BIGINT_MONT_LIMBS + 2] = {0};
+    uint64_t t[BIGINT_MONT_LIMBS + 1] = {0};
+    uint64_t *q3 = q2 + n + 1;
+    uint64_t carry, borrow;
+    unsigned __int128 c;
+
+    // q2 = floor(x / b^(n-1)) * mu
+    for (uint64_t i = 0; i <= n; ++i)
+    {
+        carry = 0;
+        for (uint64_t j = 0; j <= n; ++j)
+        {
+            c = (unsigned __int128) x[n - 1 + i] * mu[j] + q2[i + j] + carry;
+            q2[i + j] = (uint64_t) c;
+            carry = (uint64_t) (c >> 64);
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        }
+        q2[i + n + 1] = carry;
+    }
+
+    // t = q3 * q mod b^(n+1)
+    for (uint64_t i = 0; i <= n; ++i)
+    {
+        carry = 0;
+        for (uint64_t j = 0; j < n && i + j <= n; ++j)
+        {
+            c = (unsigned __int128) q3[i] * q[j] + t[i + j] + carry;
+            t[i + j] = (uint64_t) c;
+            carry = (uint64_t) (c >> 64);
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        }
+        if (i == 0)
+            t[n] = carry;
+    }
+
+    // r = (x - t) mod b^(n+1), which is the exact difference as it is < 3q
+    borrow = 0;
+    for (uint64_t j = 0; j <= n; ++j)
+    {
+        c = (unsigned __int128) x[j] - t[j] - borrow;
+        r[j] = (uint64_t) c;
+        borrow = (uint64_t) (c >> 64) & 1;
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+    }
+
+    big_int_barrett_cond_sub(r, q, n);
+    big_int_barrett_cond_sub(r, q, n);
+}
+
+/**
+ * \brief Reduce the 2n limbs of x mod q and store the result, negated mod q
+ *        if negative is set.
+ */
+static inline BigInt *big_int_barrett_finish(BigInt *r, uint64_t *x,
+    uint8_t negative, BigIntBarrettCtx *ctx)
+{
+    uint64_t t[BIGINT_MONT_LIMBS + 1];
+    uint64_t n = ctx->nr_limbs, nonzero = 0, borrow = 0;
+    unsigned __int128 c;
+
+    if (n == BIGINT_MONT_LIMBS)
+        big_int_barrett_reduce_limbs(t, x, ctx->q, ctx->mu, BIGINT_MONT_LIMBS);
+    else
+        big_int_barrett_reduce_limbs(t, x, ctx->q, ctx->mu, n);
+
+    // -x mod q = q - (|x| mod q), unless |x| mod q = 0
+    for (uint64_t j = 0; j < n; ++j)
+        nonzero |= t[j];
+    if (negative && nonzero)
+    {
+        for (uint64_t j = 0; j < n; ++j)
+        {
+            c = (unsigned __int128) ctx->q[j] - t[j] - borrow;
+            t[j] = (uint64_t) c;
+            borrow = (uint64_t) (c >> 64) & 1;
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        }
+    }
+
+    return big_int_limbs_store(r, t, n);
+}
+
+/**
+ * \brief Initialize the Barrett context for modulus q, i.e., precompute
+ *        mu = floor(2^(128 n) / q), where n is the number of 64-bit limbs of q
+ *
+ * \assumption ctx, q != NULL
+ * \assumption 1 < q < 2^256
+ * \assumption q is not a power of 2^64
+ */
+BigIntBarrettCtx *big_int_barrett_ctx_init(BigIntBarrettCtx *ctx, BigInt *q)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_BARRETT_CTX_INIT);
+
+    uint64_t n, rem[BIGINT_MONT_LIMBS + 1] = {0}, d[BIGINT_MONT_LIMBS + 1];
+    uint64_t borrow;
+    unsigned __int128 c;
+
+    big_int_prune_leading_zeros(&ctx->q_big, q);
+
+    n = (ctx->q_big.size * BIGINT_CHUNK_BIT_SIZE + 63) / 64;
+    ctx->nr_limbs = n;
+    big_int_limbs_load(ctx->q, &ctx->q_big, BIGINT_MONT_LIMBS);
+    memset(ctx->mu, 0, sizeof(ctx->mu));
+
+    // Bitwise long division of 2^(128 n) by q, only done once per modulus
+    for (int64_t k = 128 * n; k >= 0; --k)
+    {
+        for (uint64_t j = n; j > 0; --j)
+            rem[j] = (rem[j] << 1) | (rem[j - 1] >> 63);
+        rem[0] = (rem[0] << 1) | (k == 128 * n);
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+
+        borrow = 0;
+        for (uint64_t j = 0; j <= n; ++j)
+        {
+            c = (unsigned __int128) rem[j] - (j < n ? ctx->q[j] : 0) - borrow;
+            d[j] = (uint64_t) c;
+            borrow = (uint64_t) (c >> 64) & 1;
+        }
+
+        if (!borrow && k < 64 * (n + 1))
+        {
+            memcpy(rem, d, (n + 1) * sizeof(uint64_t));
+            ctx->mu[k / 64] |= 1ULL << (k % 64);
+        }
+    }
+
+    return ctx;
+}
+
+/**
+ * \brief Calculate r := a mod q with Barrett reduction
+ *
+ * \assumption r, a, ctx != NULL
+ */
+BigInt *big_int_mod_barrett(BigInt *r, BigInt *a, BigIntBarrettCtx *ctx)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_MOD_BARRETT);
+
+    uint64_t x[2 * BIGINT_MONT_LIMBS];
+
+    // Barrett reduction needs a < 2^(128 n)
+    if (a->size * BIGINT_CHUNK_BIT_SIZE > 128 * ctx->nr_limbs)
+        return big_int_mod(r, a, &ctx->q_big);
+
+    big_int_limbs_load(x, a, 2 * ctx->nr_limbs);
+
+    return big_int_barrett_finish(r, x, a->sign, ctx);
+}
+
+/**
+ * \brief Calculate r := (a * b) mod q with Barrett reduction
+ *
+ * \assumption r, a, b, ctx != NULL
+ */
+BigInt *big_int_mul_mod_barrett(BigInt *r, BigInt *a, BigInt *b,
+    BigIntBarrettCtx *ctx)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_MUL_MOD_BARRETT);
+
+    uint64_t a_limbs[BIGINT_MONT_LIMBS], b_limbs[BIGINT_MONT_LIMBS];
+    uint64_t x[2 * BIGINT_MONT_LIMBS];
+    uint64_t n = ctx->nr_limbs;
+
+    BIG_INT_DEFINE_PTR(r_loc);
+
+    // Operands larger than q are multiplied by the generic code
+    if (a->size * BIGINT_CHUNK_BIT_SIZE > 64 * n
+        || b->size * BIGINT_CHUNK_BIT_SIZE > 64 * n)
+    {
+        big_int_mul(r_loc, a, b);
+        return big_int_mod_barrett(r, r_loc, ctx);
+    }
+
+    big_int_limbs_load(a_limbs, a, n);
+    big_int_limbs_load(b_limbs, b, n);
+
+    if (n == BIGINT_MONT_LIMBS)
+        big_int_mul_limbs(x, a_limbs, b_limbs, BIGINT_MONT_LIMBS);
+    else
+        big_int_mul_limbs(x, a_limbs, b_limbs, n);
+
+    return big_int_barrett_finish(r, x, a->sign ^ b->sign, ctx);
+}
+
 // This function has to be at the end of this file for the type auto-generation
 // to work.
 void reset_stats()
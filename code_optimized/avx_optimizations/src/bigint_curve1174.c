@@ -453,6 +453,50 @@ BigInt *big_int_curve1174_inv_fermat(BigInt *r, BigInt *a)
 }
 
 
+/**
+ * \brief Calculate r[i] := a[i]^-1 mod q for all i in [0, n)
+ *
+ * Uses Montgomery's trick: accumulate the prefix products in r, invert the
+ * full product once and recover the individual inverses in a backward pass.
+ * This costs one inversion plus 3(n-1) multiplications instead of n
+ * inversions.
+ *
+ * \assumption r, a != NULL
+ * \assumption r != a, i.e., NO ALIASING (arrays must not overlap)
+ * \assumption n >= 1
+ * \assumption a[i] != 0 mod q for all i (a single zero zeroes all results)
+ */
+BigInt *big_int_curve1174_inv_batch(BigInt *r, BigInt *a, uint64_t n)
+{
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_CURVE1174_INV_BATCH);
+
+    uint64_t i;
+
+    BIG_INT_DEFINE_PTR(acc);
+    BIG_INT_DEFINE_PTR(tmp);
+
+    // r[i] = a[0] * ... * a[i]
+    big_int_copy(r, a);
+    big_int_curve1174_mod(r);
+    for (i = 1; i < n; ++i)
+        big_int_curve1174_mul_mod(r + i, r + i - 1, a + i);
+
+    // acc = (a[0] * ... * a[n-1])^-1
+    big_int_curve1174_inv_fermat(acc, r + n - 1);
+
+    for (i = n - 1; i > 0; --i) {
+        // r[i] = (a[0] * ... * a[i])^-1 * (a[0] * ... * a[i-1]) = a[i]^-1
+        big_int_curve1174_mul_mod(r + i, acc, r + i - 1);
+        // acc = (a[0] * ... * a[i-1])^-1
+        big_int_curve1174_mul_mod(tmp, acc, a + i);
+        big_int_copy(acc, tmp);
+    }
+    big_int_copy(r, acc);
+
+    return r;
+}
+
+
 // TODO: consider implementing Montgommery inverse, which are based on cheaper
 // shifting operations and compare it to fermat.
 
@@ -517,98 +561,65 @@ BigInt *big_int_curve1174_pow_small(BigInt *r, BigInt *b, uint64_t e)
 }
 
 /**
- * \brief Calculate r := (b^e) mod q
+ * \brief Calculate r := (b^|e|) mod q with sliding-window exponentiation. The
+ *        window width depends on the exponent length (see
+ *        big_int_pow_window_size).
  *
- * \assumption r != b, i.e., NO ALIASING
  * \assumption r, b, e != NULL
  */
 BigInt *big_int_curve1174_pow(BigInt *r, BigInt *b, BigInt *e)
 {
     ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_CURVE1174_POW);
 
-    BIG_INT_DEFINE_PTR(b_loc1);
-    BIG_INT_DEFINE_PTR(b_loc2);
+    BigInt table[BIGINT_POW_TABLE_SIZE];
 
-    dbl_chunk_size_t e_chunk;
-    uint32_t i, j;
+    BIG_INT_DEFINE_PTR(b_sq);
+    BIG_INT_DEFINE_PTR(r1);
 
     BIG_INT_DEFINE_FROM_CHUNK(r2, 0, 1);
 
-    BigInt* r_tmp, *r1;
+    BigInt *r_tmp;
+    uint64_t bits, w, len, val;
+    int64_t i;
 
-    r1 = r;
-    big_int_copy(b_loc1, b);
-
-    // Operate on exponent chunk by chunk
-    for (i = 0; i < e->size - 1; ++i) { ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-        e_chunk = e->chunks[i];
-
-        for (j = 0; j < BIGINT_CHUNK_BIT_SIZE; ++j) { ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-            // If power is odd
-            if (e_chunk & 1) {
-                big_int_curve1174_mul_mod(r1, r2, b_loc1);
-                r_tmp = r1;
-                r1 = r2;
-                r2 = r_tmp;
-            }
+    bits = big_int_bit_length(e);
+    w = big_int_pow_window_size(bits);
 
-            e_chunk >>= 1; ADD_STAT_COLLECTION(BASIC_SHIFT)
-            big_int_curve1174_square_mod(b_loc2, b_loc1);
-
-            // -- unroll --
-            if (e_chunk & 1) {
-                big_int_curve1174_mul_mod(r1, r2, b_loc2);
-                r_tmp = r1;
-                r1 = r2;
-                r2 = r_tmp;
-            } ADD_STAT_COLLECTION(BASIC_BITWISE)
-
-            e_chunk >>= 1; ADD_STAT_COLLECTION(BASIC_SHIFT)
+    // Table of the odd powers b, b^3, ..., b^(2^w - 1)
+    big_int_curve1174_mod(big_int_copy(table, b));
+    if (w > 1)
+        big_int_curve1174_square_mod(b_sq, table);
+    for (i = 1; i < 1 << (w - 1); ++i) { ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
+        big_int_curve1174_mul_mod(table + i, table + i - 1, b_sq);
+    }
 
-            big_int_curve1174_square_mod(b_loc1, b_loc2);
-        }
+    // The first window only copies its table entry
+    i = bits - 1;
+    if (i >= 0) {
+        val = big_int_pow_window(e, i, w, &len);
+        big_int_copy(r2, table + (val >> 1));
+        i -= len; ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
     }
 
-    // Special case for the last chunk
-    e_chunk = e->chunks[e->size - 1];
-    for (j = 0; j < BIGINT_CHUNK_BIT_SIZE; ++j) { ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
-        // If power is odd
-        if (e_chunk & 1) {
-            big_int_curve1174_mul_mod(r1, r2, b_loc1);
+    for (; i >= 0; i -= len) { ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
+        val = big_int_pow_window(e, i, w, &len);
+
+        for (uint64_t k = 0; k < len; ++k) { ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
+            big_int_curve1174_square_mod(r1, r2);
             r_tmp = r1;
             r1 = r2;
             r2 = r_tmp;
-        } ADD_STAT_COLLECTION(BASIC_BITWISE)
-
-        e_chunk >>= 1; ADD_STAT_COLLECTION(BASIC_SHIFT)
-
-        // Early exit: avoid cleanup due to unrolling, avoid unnecessary square op
-        if (!e_chunk)
-            break;
-
-        big_int_curve1174_square_mod(b_loc2, b_loc1);
+        }
 
-        // -- unroll --
-        if (e_chunk & 1) {
-            big_int_curve1174_mul_mod(r1, r2, b_loc2);
+        if (val) {
+            big_int_curve1174_mul_mod(r1, r2, table + (val >> 1));
             r_tmp = r1;
             r1 = r2;
             r2 = r_tmp;
-        } ADD_STAT_COLLECTION(BASIC_BITWISE)
-
-        e_chunk >>= 1; ADD_STAT_COLLECTION(BASIC_SHIFT)
-
-        // Early exit: avoid unnecessary square op
-        if (e)
-            big_int_curve1174_square_mod(b_loc1, b_loc2);
-
-        big_int_curve1174_square_mod(b_loc1, b_loc2);
+        }
     }
 
-    if (r != r2)
-        big_int_copy(r, r2);
-
-    return r;
+    return big_int_copy(r, r2);
 }
 
 
@@ -1030,8 +1041,8 @@ int8_t big_int_curve1174_gt_q_m1_d2(BigInt *a)
     if (a->chunks[Q_CHUNKS-1] > Q_M1_D2_CHUNK_7)
         return 1;
     ADD_STAT_COLLECTION(BASIC_BITWISE)
-    // Compare to lowest chunk of Q
-    if (a->chunks[0] <= Q_LSB_CHUNK)
+    // Compare to lowest chunk of (q - 1) / 2
+    if (a->chunks[0] <= Q_M1_D2_CHUNK_0)
         return 0;
 
     // Compare to intermediate chunks
@@ -0,0 +1,705 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This file implements the fixed-width BigInt families of bigint_n.h. The
+ * kernels below take the number of limbs as argument and are always inlined
+ * into the functions of each width, such that the compiler can unroll them for
+ * the constant limb count.
+ */
+
+/*
+ * Includes
+ */
+// standard headers
+#include <string.h>
+
+// header files
+#include "bigint_n.h"
+#include "debug.h"
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+
+#define BIGINT_N_INLINE static inline __attribute__((always_inline))
+
+// Smallest number of limbs multiplied with a level of Karatsuba. Up to 1024
+// bits, Comba alone is faster (512 bits: 86 vs. 116 cycles, 1024 bits: 355 vs.
+// 388 cycles), so the generated widths only use Karatsuba if this is lowered,
+// e.g., with -DBIGINT_N_KARATSUBA_LIMBS=8.
+#ifndef BIGINT_N_KARATSUBA_LIMBS
+#define BIGINT_N_KARATSUBA_LIMBS 32
+#endif
+
+// === === === === === === === === === === === === === === === === === === ===
+// Limb kernels
+// === === === === === === === === === === === === === === === === === === ===
+
+/**
+ * \brief Calculate r := a + b on n limbs
+ * \returns the carry
+ */
+BIGINT_N_INLINE uint64_t big_int_n_add_limbs(uint64_t *r, const uint64_t *a,
+    const uint64_t *b, uint64_t n)
+{
+    unsigned __int128 c = 0;
+
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        c = (unsigned __int128) a[i] + b[i] + (uint64_t) (c >> 64);
+        r[i] = (uint64_t) c;
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+    }
+
+    return (uint64_t) (c >> 64);
+}
+
+/**
+ * \brief Calculate r := a - b on n limbs
+ * \returns the borrow
+ */
+BIGINT_N_INLINE uint64_t big_int_n_sub_limbs(uint64_t *r, const uint64_t *a,
+    const uint64_t *b, uint64_t n)
+{
+    unsigned __int128 c;
+    uint64_t borrow = 0;
+
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        c = (unsigned __int128) a[i] - b[i] - borrow;
+        r[i] = (uint64_t) c;
+        borrow = (uint64_t) (c >> 64) & 1;
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+    }
+
+    return borrow;
+}
+
+/**
+ * \brief Calculate r := mask ? a : b on n limbs without branches, where mask is
+ *        all zeros or all ones
+ */
+BIGINT_N_INLINE void big_int_n_select_limbs(uint64_t *r, const uint64_t *a,
+    const uint64_t *b, uint64_t mask, uint64_t n)
+{
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        r[i] = (a[i] & mask) | (b[i] & ~mask);
+        ADD_STAT_COLLECTION(BASIC_BITWISE)
+    }
+}
+
+/**
+ * \brief Compare a and b on n limbs
+ * \returns -1 if a < b, 0 if a == b, 1 if a > b
+ */
+BIGINT_N_INLINE int8_t big_int_n_compare_limbs(const uint64_t *a,
+    const uint64_t *b, uint64_t n)
+{
+    for (int64_t i = n - 1; i >= 0; --i)
+    {
+        if (a[i] != b[i])
+            return (a[i] > b[i]) ? 1 : -1;
+    }
+
+    return 0;
+}
+
+/**
+ * \brief Returns the number of bits of a on n limbs
+ */
+BIGINT_N_INLINE uint64_t big_int_n_bit_length_limbs(const uint64_t *a,
+    uint64_t n)
+{
+    int64_t i;
+
+    for (i = n - 1; i >= 0 && !a[i]; --i)
+        ;
+
+    if (i < 0)
+        return 0;
+
+    return 64 * i + 64 - __builtin_clzll(a[i]);
+}
+
+/**
+ * \brief Calculate r := a * b on n limbs column by column (Comba's product
+ *        scanning), r has 2n limbs. The overflows of the 128-bit column sums
+ *        are counted separately.
+ *
+ * \assumption r does not alias a or b
+ */
+BIGINT_N_INLINE void big_int_n_mul_comba_limbs(uint64_t *r, const uint64_t *a,
+    const uint64_t *b, uint64_t n)
+{
+    unsigned __int128 acc = 0, p;
+    uint64_t overflows = 0;
+
+#pragma GCC unroll 32
+    for (int64_t k = 0; k < 2 * (int64_t) n - 1; ++k)
+    {
+#pragma GCC unroll 16
+        for (int64_t i = (k - (int64_t) n + 1 > 0) ? k - (int64_t) n + 1 : 0;
+             i <= ((k < (int64_t) n - 1) ? k : (int64_t) n - 1); ++i)
+        {
+            p = (unsigned __int128) a[i] * b[k - i];
+            acc += p;
+            overflows += acc < p;
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        }
+
+        r[k] = (uint64_t) acc;
+        acc = (acc >> 64) | ((unsigned __int128) overflows << 64);
+        overflows = 0;
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+    }
+    r[2 * n - 1] = (uint64_t) acc;
+}
+
+/**
+ * \brief Calculate r := a * b on n limbs with one level of Karatsuba on top of
+ *        Comba, r has 2n limbs. With a = a1 B + a0, b = b1 B + b0, and
+ *        B = 2^(32 n), the middle term is (a0 + a1)(b0 + b1) - a0 b0 - a1 b1.
+ *
+ * \assumption n is even
+ * \assumption r does not alias a or b
+ */
+BIGINT_N_INLINE void big_int_n_mul_karatsuba_limbs(uint64_t *r,
+    const uint64_t *a, const uint64_t *b, uint64_t n)
+{
+    uint64_t sa[BIGINT_N_MAX_LIMBS / 2], sb[BIGINT_N_MAX_LIMBS / 2];
+    uint64_t t[BIGINT_N_MAX_LIMBS / 2], m[BIGINT_N_MAX_LIMBS + 1];
+    uint64_t h = n / 2, ca, cb, carry;
+    unsigned __int128 c;
+
+    // r := a0 b0 + a1 b1 B^2
+    big_int_n_mul_comba_limbs(r, a, b, h);
+    big_int_n_mul_comba_limbs(r + n, a + h, b + h, h);
+
+    // m := (a0 + a1)(b0 + b1), where the sums have a carry bit each
+    ca = big_int_n_add_limbs(sa, a, a + h, h);
+    cb = big_int_n_add_limbs(sb, b, b + h, h);
+    big_int_n_mul_comba_limbs(m, sa, sb, h);
+    m[n] = ca & cb;
+
+    for (uint64_t i = 0; i < h; ++i)
+        t[i] = sb[i] & -ca;
+    m[n] += big_int_n_add_limbs(m + h, m + h, t, h);
+    for (uint64_t i = 0; i < h; ++i)
+        t[i] = sa[i] & -cb;
+    m[n] += big_int_n_add_limbs(m + h, m + h, t, h);
+
+    // m := m - a0 b0 - a1 b1
+    m[n] -= big_int_n_sub_limbs(m, m, r, n);
+    m[n] -= big_int_n_sub_limbs(m, m, r + n, n);
+
+    // r := r + m B
+    carry = big_int_n_add_limbs(r + h, r + h, m, n + 1);
+    for (uint64_t i = n + h + 1; i < 2 * n; ++i)
+    {
+        c = (unsigned __int128) r[i] + carry;
+        r[i] = (uint64_t) c;
+        carry = (uint64_t) (c >> 64);
+        ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+    }
+}
+
+/**
+ * \brief Calculate r := t - q if t >= q, otherwise r := t, where t has n + 1
+ *        limbs, without branches
+ */
+BIGINT_N_INLINE void big_int_n_final_sub_limbs(uint64_t *r, const uint64_t *t,
+    const uint64_t *q, uint64_t n)
+{
+    uint64_t d[BIGINT_N_MAX_LIMBS];
+    uint64_t borrow;
+
+    borrow = big_int_n_sub_limbs(d, t, q, n);
+
+    // t - q >= 0 iff there is a carry limb or no borrow
+    big_int_n_select_limbs(r, d, t, -(uint64_t) (t[n] | (borrow ^ 1)), n);
+}
+
+/**
+ * \brief Calculate r := a * b * R^-1 mod q on n limbs, with R = 2^(64 n),
+ *        using the coarsely integrated operand scanning (CIOS) method
+ *
+ * \assumption a, b < q
+ */
+BIGINT_N_INLINE void big_int_n_mont_mul_limbs(uint64_t *r, const uint64_t *a,
+    const uint64_t *b, const uint64_t *q, uint64_t q_inv, uint64_t n)
+{
+    uint64_t t[BIGINT_N_MAX_LIMBS + 2] = {0};
+    unsigned __int128 c;
+    uint64_t m;
+
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        // t := t + a * b[i]
+        c = 0;
+        for (uint64_t j = 0; j < n; ++j)
+        {
+            c = (unsigned __int128) a[j] * b[i] + t[j] + (uint64_t) (c >> 64);
+            t[j] = (uint64_t) c;
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        }
+        c = (unsigned __int128) t[n] + (uint64_t) (c >> 64);
+        t[n] = (uint64_t) c;
+        t[n + 1] = (uint64_t) (c >> 64);
+
+        // t := (t + m * q) / 2^64, where m makes the lowest limb zero
+        m = t[0] * q_inv;
+        c = (unsigned __int128) m * q[0] + t[0];
+        for (uint64_t j = 1; j < n; ++j)
+        {
+            c = (unsigned __int128) m * q[j] + t[j] + (uint64_t) (c >> 64);
+            t[j - 1] = (uint64_t) c;
+            ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+            ADD_STAT_COLLECTION(BASIC_ADD_CHUNK)
+        }
+        c = (unsigned __int128) t[n] + (uint64_t) (c >> 64);
+        t[n - 1] = (uint64_t) c;
+        t[n] = t[n + 1] + (uint64_t) (c >> 64);
+    }
+
+    big_int_n_final_sub_limbs(r, t, q, n);
+}
+
+/**
+ * \brief Precompute -q^-1 mod 2^64, R mod q, and R^2 mod q on n limbs, with
+ *        R = 2^(64 n)
+ *
+ * \assumption q is odd, q > 1
+ */
+BIGINT_N_INLINE void big_int_n_mont_ctx_init_limbs(uint64_t *r2,
+    uint64_t *one, uint64_t *q_inv, const uint64_t *q, uint64_t n)
+{
+    uint64_t x[BIGINT_N_MAX_LIMBS + 1] = {0};
+    uint64_t inv, s, k, bits;
+
+    // Newton iteration for q^-1 mod 2^64. Starting with q, which is correct
+    // mod 2^3 for odd q, each step doubles the number of correct bits.
+    inv = q[0];
+    for (uint64_t i = 0; i < 5; ++i)
+    {
+        inv *= 2 - q[0] * inv;
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+        ADD_STAT_COLLECTION(BASIC_MUL_CHUNK)
+    }
+    *q_inv = -inv;
+
+    // Write 64 n = s * 2^k with s odd. Compute 2^i mod q for i = 64 n (R) and
+    // i = 64 n + s (2^s R) by doubling, starting from the largest power of two
+    // below q (cf. big_int_mont_ctx_init).
+    s = n >> __builtin_ctzll(n);
+    k = 6 + __builtin_ctzll(n);
+    bits = big_int_n_bit_length_limbs(q, n);
+    x[(bits - 1) / 64] = 1ULL << ((bits - 1) % 64);
+
+    for (uint64_t i = bits - 1; i < 64 * n + s; ++i)
+    {
+        x[n] = x[n - 1] >> 63;
+        for (uint64_t j = n - 1; j > 0; --j)
+            x[j] = (x[j] << 1) | (x[j - 1] >> 63);
+        x[0] <<= 1;
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+
+        big_int_n_final_sub_limbs(x, x, q, n);
+        x[n] = 0;
+
+        if (i + 1 == 64 * n)
+            memcpy(one, x, n * sizeof(uint64_t));
+    }
+
+    // Each Montgomery squaring maps 2^t R to 2^(2t) R
+    for (uint64_t i = 0; i < k; ++i)
+        big_int_n_mont_mul_limbs(x, x, x, q, *q_inv, n);
+    memcpy(r2, x, n * sizeof(uint64_t));
+}
+
+/**
+ * \brief Get the next window of the sliding-window exponentiation on n limbs
+ *        (cf. big_int_pow_window)
+ */
+BIGINT_N_INLINE uint64_t big_int_n_pow_window_limbs(const uint64_t *e,
+    int64_t i, uint64_t w, uint64_t *len)
+{
+    int64_t l;
+    uint64_t val = 0;
+
+    if (!((e[i / 64] >> (i % 64)) & 1))
+    {
+        *len = 1;
+        return 0;
+    }
+
+    for (l = (i - (int64_t) w + 1 > 0) ? i - (int64_t) w + 1 : 0;
+         !((e[l / 64] >> (l % 64)) & 1); ++l)
+        ;
+
+    for (int64_t j = i; j >= l; --j)
+    {
+        val = (val << 1) | ((e[j / 64] >> (j % 64)) & 1);
+        ADD_STAT_COLLECTION(BASIC_SHIFT)
+        ADD_STAT_COLLECTION(BASIC_BITWISE)
+    }
+    *len = i - l + 1;
+
+    return val;
+}
+
+/**
+ * \brief Calculate r := b^e mod q with sliding-window exponentiation in
+ *        Montgomery form on n limbs, for b in normal form
+ *
+ * \assumption b < q
+ */
+BIGINT_N_INLINE void big_int_n_pow_mont_limbs(uint64_t *r, const uint64_t *b,
+    const uint64_t *e, const uint64_t *q, uint64_t q_inv, const uint64_t *r2,
+    const uint64_t *one, uint64_t n)
+{
+    uint64_t table[BIGINT_POW_TABLE_SIZE][BIGINT_N_MAX_LIMBS];
+    uint64_t b_sq[BIGINT_N_MAX_LIMBS], acc[BIGINT_N_MAX_LIMBS];
+    uint64_t unit[BIGINT_N_MAX_LIMBS] = {1};
+    uint64_t bits, w, len, val;
+    int64_t i;
+
+    bits = big_int_n_bit_length_limbs(e, n);
+    w = big_int_pow_window_size(bits);
+
+    // Table of the odd powers b, b^3, ..., b^(2^w - 1) in Montgomery form
+    big_int_n_mont_mul_limbs(table[0], b, r2, q, q_inv, n);
+    if (w > 1)
+        big_int_n_mont_mul_limbs(b_sq, table[0], table[0], q, q_inv, n);
+    for (i = 1; i < 1 << (w - 1); ++i)
+        big_int_n_mont_mul_limbs(table[i], table[i - 1], b_sq, q, q_inv, n);
+
+    memcpy(acc, one, n * sizeof(uint64_t));
+
+    // The first window only copies its table entry
+    i = bits - 1;
+    if (i >= 0)
+    {
+        val = big_int_n_pow_window_limbs(e, i, w, &len);
+        memcpy(acc, table[val >> 1], n * sizeof(uint64_t));
+        i -= len;
+    }
+
+    for (; i >= 0; i -= len)
+    {
+        val = big_int_n_pow_window_limbs(e, i, w, &len);
+        for (uint64_t k = 0; k < len; ++k)
+            big_int_n_mont_mul_limbs(acc, acc, acc, q, q_inv, n);
+        if (val)
+            big_int_n_mont_mul_limbs(acc, acc, table[val >> 1], q, q_inv, n);
+    }
+
+    big_int_n_mont_mul_limbs(r, acc, unit, q, q_inv, n);
+}
+
+// === === === === === === === === === === === === === === === === === === ===
+// Families of fixed widths
+// === === === === === === === === === === === === === === === === === === ===
+
+#define BIGINT_N_DEFINE(bits)                                                  \
+                                                                               \
+/**                                                                            \
+ * \brief Convert |a| to a fixed-width BigInt                                  \
+ *                                                                             \
+ * \assumption |a| < 2^bits                                                    \
+ */                                                                            \
+BigInt##bits *big_int_##bits##_from_big_int(BigInt##bits *r, BigInt *a)        \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_FROM_BIG_INT);                   \
+                                                                               \
+    uint64_t pos;                                                              \
+                                                                               \
+    memset(r->limbs, 0, sizeof(r->limbs));                                     \
+    for (uint64_t i = 0; i < a->size; ++i)                                     \
+    {                                                                          \
+        pos = i * BIGINT_CHUNK_BIT_SIZE;                                       \
+        if (pos >= bits)                                                       \
+            break;                                                             \
+        r->limbs[pos / 64] |= (uint64_t) a->chunks[i] << (pos % 64);           \
+        ADD_STAT_COLLECTION(BASIC_SHIFT)                                       \
+    }                                                                          \
+                                                                               \
+    return r;                                                                  \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Convert a fixed-width BigInt to a (non-negative) BigInt              \
+ *                                                                             \
+ * \assumption a fits into BIGINT_FIXED_SIZE_INTERNAL chunks                   \
+ */                                                                            \
+BigInt *big_int_##bits##_to_big_int(BigInt *r, BigInt##bits *a)                \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_TO_BIG_INT);                     \
+                                                                               \
+    uint64_t pos, size;                                                        \
+                                                                               \
+    size = MIN(bits / BIGINT_CHUNK_BIT_SIZE, BIGINT_FIXED_SIZE_INTERNAL);      \
+    for (uint64_t i = 0; i < size; ++i)                                        \
+    {                                                                          \
+        pos = i * BIGINT_CHUNK_BIT_SIZE;                                       \
+        r->chunks[i] = (chunk_size_t) (a->limbs[pos / 64] >> (pos % 64));      \
+        ADD_STAT_COLLECTION(BASIC_SHIFT)                                       \
+    }                                                                          \
+    r->sign = 0;                                                               \
+    r->overflow = 0;                                                           \
+    r->size = size;                                                            \
+                                                                               \
+    return big_int_prune_leading_zeros(r, r);                                  \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Create a fixed-width BigInt from a string of hex digits (without     \
+ *        prefix or sign). Digits beyond the width are ignored.                \
+ */                                                                            \
+BigInt##bits *big_int_##bits##_from_hex(BigInt##bits *r, const char *s)        \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_FROM_HEX);                       \
+                                                                               \
+    uint64_t len = strlen(s), d;                                               \
+    char c;                                                                    \
+                                                                               \
+    memset(r->limbs, 0, sizeof(r->limbs));                                     \
+    for (uint64_t i = 0; i < len && i < bits / 4; ++i)                         \
+    {                                                                          \
+        c = s[len - 1 - i];                                                    \
+        if (c >= '0' && c <= '9')                                              \
+            d = c - '0';                                                       \
+        else if (c >= 'a' && c <= 'f')                                         \
+            d = c - 'a' + 10;                                                  \
+        else                                                                   \
+            d = c - 'A' + 10;                                                  \
+        r->limbs[i / 16] |= (d & 0xf) << (4 * (i % 16));                       \
+    }                                                                          \
+                                                                               \
+    return r;                                                                  \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Compare a and b                                                      \
+ * \returns -1 if a < b, 0 if a == b, 1 if a > b                               \
+ */                                                                            \
+int8_t big_int_##bits##_compare(BigInt##bits *a, BigInt##bits *b)             \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_COMPARE);                        \
+    return big_int_n_compare_limbs(a->limbs, b->limbs, BIGINT_N_LIMBS(bits));  \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Returns true if a is zero                                            \
+ */                                                                            \
+int8_t big_int_##bits##_is_zero(BigInt##bits *a)                               \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_IS_ZERO);                        \
+                                                                               \
+    uint64_t acc = 0;                                                          \
+                                                                               \
+    for (uint64_t i = 0; i < BIGINT_N_LIMBS(bits); ++i)                        \
+        acc |= a->limbs[i];                                                    \
+                                                                               \
+    return !acc;                                                               \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Calculate r := a + b mod 2^bits                                      \
+ * \returns the carry                                                          \
+ */                                                                            \
+uint64_t big_int_##bits##_add(BigInt##bits *r, BigInt##bits *a,                \
+    BigInt##bits *b)                                                           \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_ADD);                            \
+    return big_int_n_add_limbs(r->limbs, a->limbs, b->limbs,                   \
+        BIGINT_N_LIMBS(bits));                                                 \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Calculate r := a - b mod 2^bits                                      \
+ * \returns the borrow                                                         \
+ */                                                                            \
+uint64_t big_int_##bits##_sub(BigInt##bits *r, BigInt##bits *a,                \
+    BigInt##bits *b)                                                           \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_SUB);                            \
+    return big_int_n_sub_limbs(r->limbs, a->limbs, b->limbs,                   \
+        BIGINT_N_LIMBS(bits));                                                 \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Calculate r := a * b                                                 \
+ *                                                                             \
+ * \assumption r does not alias a or b                                         \
+ */                                                                            \
+BigInt##bits##Wide *big_int_##bits##_mul(BigInt##bits##Wide *r,                \
+    BigInt##bits *a, BigInt##bits *b)                                          \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_MUL);                            \
+                                                                               \
+    if (BIGINT_N_LIMBS(bits) >= BIGINT_N_KARATSUBA_LIMBS)                      \
+        big_int_n_mul_karatsuba_limbs(r->limbs, a->limbs, b->limbs,            \
+            BIGINT_N_LIMBS(bits));                                             \
+    else                                                                       \
+        big_int_n_mul_comba_limbs(r->limbs, a->limbs, b->limbs,                \
+            BIGINT_N_LIMBS(bits));                                             \
+    return r;                                                                  \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Initialize the Montgomery context for modulus q, with R = 2^bits     \
+ *                                                                             \
+ * \assumption q is odd, q > 1                                                 \
+ */                                                                            \
+BigInt##bits##MontCtx *big_int_##bits##_mont_ctx_init(                         \
+    BigInt##bits##MontCtx *ctx, BigInt##bits *q)                               \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_MONT_CTX_INIT);                  \
+                                                                               \
+    ctx->q = *q;                                                               \
+    big_int_n_mont_ctx_init_limbs(ctx->r2.limbs, ctx->one.limbs, &ctx->q_inv,  \
+        ctx->q.limbs, BIGINT_N_LIMBS(bits));                                   \
+                                                                               \
+    return ctx;                                                                \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Calculate r := a * R mod q, i.e., convert a to Montgomery form       \
+ *                                                                             \
+ * \assumption a < q                                                           \
+ */                                                                            \
+BigInt##bits *big_int_##bits##_to_mont(BigInt##bits *r, BigInt##bits *a,       \
+    BigInt##bits##MontCtx *ctx)                                                \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_TO_MONT);                        \
+    big_int_n_mont_mul_limbs(r->limbs, a->limbs, ctx->r2.limbs, ctx->q.limbs,  \
+        ctx->q_inv, BIGINT_N_LIMBS(bits));                                     \
+    return r;                                                                  \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Calculate r := a * R^-1 mod q, i.e., convert a from Montgomery form  \
+ *                                                                             \
+ * \assumption a < q                                                           \
+ */                                                                            \
+BigInt##bits *big_int_##bits##_from_mont(BigInt##bits *r, BigInt##bits *a,     \
+    BigInt##bits##MontCtx *ctx)                                                \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_FROM_MONT);                      \
+                                                                               \
+    BigInt##bits unit = {{1}};                                                 \
+                                                                               \
+    big_int_n_mont_mul_limbs(r->limbs, a->limbs, unit.limbs, ctx->q.limbs,     \
+        ctx->q_inv, BIGINT_N_LIMBS(bits));                                     \
+    return r;                                                                  \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Calculate r := (a + b) mod q                                         \
+ *                                                                             \
+ * \assumption a, b < q                                                        \
+ */                                                                            \
+BigInt##bits *big_int_##bits##_add_mod(BigInt##bits *r, BigInt##bits *a,       \
+    BigInt##bits *b, BigInt##bits##MontCtx *ctx)                               \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_ADD_MOD);                        \
+                                                                               \
+    uint64_t t[BIGINT_N_LIMBS(bits) + 1];                                      \
+                                                                               \
+    t[BIGINT_N_LIMBS(bits)] = big_int_n_add_limbs(t, a->limbs, b->limbs,       \
+        BIGINT_N_LIMBS(bits));                                                 \
+    big_int_n_final_sub_limbs(r->limbs, t, ctx->q.limbs,                       \
+        BIGINT_N_LIMBS(bits));                                                 \
+    return r;                                                                  \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Calculate r := (a - b) mod q                                         \
+ *                                                                             \
+ * \assumption a, b < q                                                        \
+ */                                                                            \
+BigInt##bits *big_int_##bits##_sub_mod(BigInt##bits *r, BigInt##bits *a,       \
+    BigInt##bits *b, BigInt##bits##MontCtx *ctx)                               \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_SUB_MOD);                        \
+                                                                               \
+    uint64_t t[BIGINT_N_LIMBS(bits)], mask;                                    \
+                                                                               \
+    mask = -big_int_n_sub_limbs(t, a->limbs, b->limbs, BIGINT_N_LIMBS(bits));  \
+    for (uint64_t i = 0; i < BIGINT_N_LIMBS(bits); ++i)                        \
+    {                                                                          \
+        r->limbs[i] = ctx->q.limbs[i] & mask;                                  \
+        ADD_STAT_COLLECTION(BASIC_BITWISE)                                     \
+    }                                                                          \
+    big_int_n_add_limbs(r->limbs, t, r->limbs, BIGINT_N_LIMBS(bits));          \
+    return r;                                                                  \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Calculate r := a * b * R^-1 mod q                                    \
+ *                                                                             \
+ * \assumption a, b < q                                                        \
+ */                                                                            \
+BigInt##bits *big_int_##bits##_mont_mul(BigInt##bits *r, BigInt##bits *a,      \
+    BigInt##bits *b, BigInt##bits##MontCtx *ctx)                               \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_MONT_MUL);                       \
+    big_int_n_mont_mul_limbs(r->limbs, a->limbs, b->limbs, ctx->q.limbs,       \
+        ctx->q_inv, BIGINT_N_LIMBS(bits));                                     \
+    return r;                                                                  \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Calculate r := a^2 * R^-1 mod q                                      \
+ *                                                                             \
+ * \assumption a < q                                                           \
+ */                                                                            \
+BigInt##bits *big_int_##bits##_mont_square(BigInt##bits *r, BigInt##bits *a,   \
+    BigInt##bits##MontCtx *ctx)                                                \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_MONT_SQUARE);                    \
+    big_int_n_mont_mul_limbs(r->limbs, a->limbs, a->limbs, ctx->q.limbs,       \
+        ctx->q_inv, BIGINT_N_LIMBS(bits));                                     \
+    return r;                                                                  \
+}                                                                              \
+                                                                               \
+/**                                                                            \
+ * \brief Calculate r := b^e mod q with sliding-window exponentiation in       \
+ *        Montgomery form, b and r are in normal form                          \
+ *                                                                             \
+ * \assumption b < q                                                           \
+ */                                                                            \
+BigInt##bits *big_int_##bits##_pow_mont(BigInt##bits *r, BigInt##bits *b,      \
+    BigInt##bits *e, BigInt##bits##MontCtx *ctx)                               \
+{                                                                              \
+    ADD_STAT_COLLECTION(BIGINT_TYPE_BIG_INT_N_POW_MONT);                       \
+    big_int_n_pow_mont_limbs(r->limbs, b->limbs, e->limbs, ctx->q.limbs,       \
+        ctx->q_inv, ctx->r2.limbs, ctx->one.limbs, BIGINT_N_LIMBS(bits));      \
+    return r;                                                                  \
+}
+
+BIGINT_N_DEFINE(256)
+BIGINT_N_DEFINE(384)
+BIGINT_N_DEFINE(512)
+BIGINT_N_DEFINE(1024)
@@ -0,0 +1,453 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This file implements an LRU cache for the variable-base precomputation of
+ * peers' public keys. A lookup by the peer's Elligator 1 string returns the
+ * decoded point and its wNAF table, on a miss both are computed and replace
+ * the least recently used entry. The cache lives in one block of memory with
+ * a fixed layout (header, hash buckets, entries), which can be a shared
+ * mapping of a snapshot file.
+ */
+
+/*
+ * Includes
+ */
+// standard headers
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <x86intrin.h>
+
+// header files
+#include "curve1174_cache.h"
+#include "debug.h"
+
+// Alignment of the buckets and the entries within the cache memory
+#define CURVE1174_CACHE_ALIGN 64
+#define CURVE1174_CACHE_ROUND_UP(x) \
+    (((x) + CURVE1174_CACHE_ALIGN - 1) & ~((uint64_t) CURVE1174_CACHE_ALIGN - 1))
+
+#define CURVE1174_CACHE_ROTL(x, b) (((x) << (b)) | ((x) >> (64 - (b))))
+#define CURVE1174_CACHE_SIPROUND(v0, v1, v2, v3)                             \
+    do {                                                                     \
+        v0 += v1; v1 = CURVE1174_CACHE_ROTL(v1, 13); v1 ^= v0;               \
+        v0 = CURVE1174_CACHE_ROTL(v0, 32);                                   \
+        v2 += v3; v3 = CURVE1174_CACHE_ROTL(v3, 16); v3 ^= v2;               \
+        v0 += v3; v3 = CURVE1174_CACHE_ROTL(v3, 21); v3 ^= v0;               \
+        v2 += v1; v1 = CURVE1174_CACHE_ROTL(v1, 17); v1 ^= v2;               \
+        v2 = CURVE1174_CACHE_ROTL(v2, 32);                                   \
+    } while (0)
+
+/*
+ * Function prototypes (for internal use)
+ */
+uint64_t curve1174_cache_nr_buckets(uint64_t capacity);
+uint64_t curve1174_cache_mem_size(uint64_t capacity);
+uint64_t curve1174_cache_hash(Curve1174Cache *cache, const uint8_t *key);
+int8_t curve1174_cache_lru_is_valid(Curve1174Cache *cache);
+void curve1174_cache_rebuild_buckets(Curve1174Cache *cache);
+void curve1174_cache_lru_unlink(Curve1174Cache *cache, uint32_t i);
+void curve1174_cache_lru_push_front(Curve1174Cache *cache, uint32_t i);
+void curve1174_cache_bucket_unlink(Curve1174Cache *cache, uint32_t i);
+
+
+/**
+ * \brief Number of buckets for capacity entries, a power of two
+ */
+uint64_t curve1174_cache_nr_buckets(uint64_t capacity)
+{
+    uint64_t nr_buckets = 1;
+
+    while (nr_buckets < capacity)
+        nr_buckets <<= 1;
+
+    return nr_buckets;
+}
+
+
+/**
+ * \brief Size in bytes of the cache memory for capacity entries
+ */
+uint64_t curve1174_cache_mem_size(uint64_t capacity)
+{
+    uint64_t size;
+
+    size = CURVE1174_CACHE_ROUND_UP(sizeof(Curve1174CacheHeader));
+    size += CURVE1174_CACHE_ROUND_UP(curve1174_cache_nr_buckets(capacity)
+        * sizeof(uint32_t));
+    size += capacity * sizeof(Curve1174CacheEntry);
+
+    return size;
+}
+
+
+/**
+ * \brief Return the number of entries that fit into max_bytes
+ */
+uint64_t curve1174_cache_capacity(uint64_t max_bytes)
+{
+    uint64_t capacity;
+
+    capacity = max_bytes / (sizeof(Curve1174CacheEntry) + 2 * sizeof(uint32_t));
+    if (capacity >= CURVE1174_CACHE_NIL)
+        capacity = CURVE1174_CACHE_NIL - 1;
+
+    while (capacity && curve1174_cache_mem_size(capacity) > max_bytes)
+        --capacity;
+
+    return capacity;
+}
+
+
+/**
+ * \brief Check that the LRU list of a snapshot links exactly the used
+ *        entries [0, nr_used) in both directions
+ */
+int8_t curve1174_cache_lru_is_valid(Curve1174Cache *cache)
+{
+    Curve1174CacheHeader *header = cache->header;
+    uint64_t n;
+    uint32_t i, prev;
+
+    prev = CURVE1174_CACHE_NIL;
+    i = header->lru_head;
+    for (n = 0; n < header->nr_used; ++n)
+    {
+        if (i >= header->nr_used || cache->entries[i].lru_prev != prev)
+            return 0;
+        prev = i;
+        i = cache->entries[i].lru_next;
+    }
+
+    // Visiting nr_used entries without reaching the end rules out cycles
+    return i == CURVE1174_CACHE_NIL && header->lru_tail == prev;
+}
+
+
+/**
+ * \brief Link the used entries into the buckets of the hash of this process
+ */
+void curve1174_cache_rebuild_buckets(Curve1174Cache *cache)
+{
+    uint64_t i, bucket;
+
+    for (i = 0; i < cache->header->nr_buckets; ++i)
+        cache->buckets[i] = CURVE1174_CACHE_NIL;
+
+    for (i = 0; i < cache->header->nr_used; ++i)
+    {
+        bucket = curve1174_cache_hash(cache, cache->entries[i].key);
+        cache->entries[i].bucket_next = cache->buckets[bucket];
+        cache->buckets[bucket] = i;
+    }
+}
+
+
+/**
+ * \brief Create a cache using at most max_bytes of memory
+ *
+ * If path is not NULL, the cache is a shared mapping of that file. A file
+ * written by a cache of the same size is reused including its entries and
+ * counters, if its LRU list is intact. Any other file is overwritten. The
+ * buckets of a reused file are rebuilt, since the bucket hash is keyed per
+ * process.
+ *
+ * \assumption cache != NULL
+ * \assumption max_bytes is large enough for one entry
+ */
+Curve1174Cache *curve1174_cache_init(Curve1174Cache *cache, uint64_t max_bytes,
+    const char *path)
+{
+    uint64_t i, capacity, nr_buckets, buckets_offset, entries_offset;
+    struct stat st;
+    int8_t is_warm;
+    Curve1174CacheHeader *header;
+
+    if (getentropy(cache->hash_key, sizeof(cache->hash_key)))
+        FATAL("Failed to get entropy from the OS\n");
+
+    capacity = curve1174_cache_capacity(max_bytes);
+    if (!capacity)
+        FATAL("Cache size too small for a single entry\n");
+    nr_buckets = curve1174_cache_nr_buckets(capacity);
+
+    cache->mem_size = curve1174_cache_mem_size(capacity);
+    is_warm = 0;
+
+    if (path) {
+        cache->fd = open(path, O_RDWR | O_CREAT, 0600);
+        if (cache->fd < 0)
+            FATAL("Failed to open cache snapshot\n");
+        if (fstat(cache->fd, &st))
+            FATAL("Failed to stat cache snapshot\n");
+        is_warm = ((uint64_t) st.st_size == cache->mem_size);
+        if (ftruncate(cache->fd, cache->mem_size))
+            FATAL("Failed to resize cache snapshot\n");
+
+        cache->mem = mmap(NULL, cache->mem_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED, cache->fd, 0);
+    }
+    else {
+        cache->fd = -1;
+        cache->mem = mmap(NULL, cache->mem_size, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+    if (cache->mem == MAP_FAILED)
+        FATAL("Failed to map cache memory\n");
+
+    buckets_offset = CURVE1174_CACHE_ROUND_UP(sizeof(Curve1174CacheHeader));
+    entries_offset = buckets_offset
+        + CURVE1174_CACHE_ROUND_UP(nr_buckets * sizeof(uint32_t));
+
+    header = (Curve1174CacheHeader *) cache->mem;
+    cache->header = header;
+    cache->buckets = (uint32_t *) ((uint8_t *) cache->mem + buckets_offset);
+    cache->entries = (Curve1174CacheEntry *) ((uint8_t *) cache->mem
+        + entries_offset);
+
+    is_warm = is_warm && header->magic == CURVE1174_CACHE_MAGIC
+        && header->entry_size == sizeof(Curve1174CacheEntry)
+        && header->capacity == capacity && header->nr_buckets == nr_buckets
+        && header->nr_used <= capacity && curve1174_cache_lru_is_valid(cache);
+
+    if (is_warm) {
+        curve1174_cache_rebuild_buckets(cache);
+    }
+    else {
+        memset(header, 0, sizeof(Curve1174CacheHeader));
+        header->entry_size = sizeof(Curve1174CacheEntry);
+        header->capacity = capacity;
+        header->nr_buckets = nr_buckets;
+        header->lru_head = CURVE1174_CACHE_NIL;
+        header->lru_tail = CURVE1174_CACHE_NIL;
+        for (i = 0; i < nr_buckets; ++i)
+            cache->buckets[i] = CURVE1174_CACHE_NIL;
+
+        // Written last, such that a partially initialized snapshot is
+        // discarded on the next start
+        header->magic = CURVE1174_CACHE_MAGIC;
+    }
+
+    return cache;
+}
+
+
+/**
+ * \brief Write the cache to its snapshot file, if any
+ *
+ * \assumption cache != NULL
+ */
+void curve1174_cache_sync(Curve1174Cache *cache)
+{
+    if (cache->fd >= 0 && msync(cache->mem, cache->mem_size, MS_SYNC))
+        FATAL("Failed to write cache snapshot\n");
+}
+
+
+void curve1174_cache_free(Curve1174Cache *cache)
+{
+    curve1174_cache_sync(cache);
+    munmap(cache->mem, cache->mem_size);
+    if (cache->fd >= 0)
+        close(cache->fd);
+}
+
+
+/**
+ * \brief Bucket of key, using SipHash-2-4 of the whole string keyed with the
+ *        random key of this process. Keys are chosen by peers, which must not
+ *        be able to predict collisions and fill a single bucket chain.
+ */
+uint64_t curve1174_cache_hash(Curve1174Cache *cache, const uint8_t *key)
+{
+    uint64_t v0, v1, v2, v3, m;
+    uint64_t i;
+
+    v0 = cache->hash_key[0] ^ 0x736f6d6570736575ULL;
+    v1 = cache->hash_key[1] ^ 0x646f72616e646f6dULL;
+    v2 = cache->hash_key[0] ^ 0x6c7967656e657261ULL;
+    v3 = cache->hash_key[1] ^ 0x7465646279746573ULL;
+
+    // Little-endian words, as on x86
+    for (i = 0; i < CURVE1174_CACHE_KEY_SIZE; i += sizeof(uint64_t))
+    {
+        memcpy(&m, key + i, sizeof(uint64_t));
+        v3 ^= m;
+        CURVE1174_CACHE_SIPROUND(v0, v1, v2, v3);
+        CURVE1174_CACHE_SIPROUND(v0, v1, v2, v3);
+        v0 ^= m;
+    }
+
+    // Final block, which only holds the length
+    m = (uint64_t) CURVE1174_CACHE_KEY_SIZE << 56;
+    v3 ^= m;
+    CURVE1174_CACHE_SIPROUND(v0, v1, v2, v3);
+    CURVE1174_CACHE_SIPROUND(v0, v1, v2, v3);
+    v0 ^= m;
+
+    v2 ^= 0xff;
+    for (i = 0; i < 4; ++i)
+        CURVE1174_CACHE_SIPROUND(v0, v1, v2, v3);
+
+    return (v0 ^ v1 ^ v2 ^ v3) & (cache->header->nr_buckets - 1);
+}
+
+
+void curve1174_cache_lru_unlink(Curve1174Cache *cache, uint32_t i)
+{
+    Curve1174CacheEntry *e = cache->entries + i;
+
+    if (e->lru_prev != CURVE1174_CACHE_NIL)
+        cache->entries[e->lru_prev].lru_next = e->lru_next;
+    else
+        cache->header->lru_head = e->lru_next;
+
+    if (e->lru_next != CURVE1174_CACHE_NIL)
+        cache->entries[e->lru_next].lru_prev = e->lru_prev;
+    else
+        cache->header->lru_tail = e->lru_prev;
+}
+
+
+void curve1174_cache_lru_push_front(Curve1174Cache *cache, uint32_t i)
+{
+    Curve1174CacheEntry *e = cache->entries + i;
+
+    e->lru_prev = CURVE1174_CACHE_NIL;
+    e->lru_next = cache->header->lru_head;
+    if (e->lru_next != CURVE1174_CACHE_NIL)
+        cache->entries[e->lru_next].lru_prev = i;
+    else
+        cache->header->lru_tail = i;
+    cache->header->lru_head = i;
+}
+
+
+void curve1174_cache_bucket_unlink(Curve1174Cache *cache, uint32_t i)
+{
+    uint32_t *link;
+
+    link = cache->buckets + curve1174_cache_hash(cache, cache->entries[i].key);
+    while (*link != i)
+        link = &(cache->entries[*link].bucket_next);
+    *link = cache->entries[i].bucket_next;
+}
+
+
+/**
+ * \brief Return the entry of the string t, decoding it and computing its
+ *        wNAF table on a miss
+ *
+ * The returned entry stays valid until the next call.
+ *
+ * \assumption cache, t != NULL
+ * \assumption 0 <= t <= (q - 1) / 2
+ */
+Curve1174CacheEntry *curve1174_cache_get(Curve1174Cache *cache, BigInt *t,
+    Curve curve)
+{
+    Curve1174CacheHeader *header = cache->header;
+    Curve1174CacheEntry *e;
+    uint8_t key[CURVE1174_CACHE_KEY_SIZE];
+    uint64_t bucket, start;
+    uint32_t i;
+
+    big_int_to_bytes(key, t, CURVE1174_CACHE_KEY_SIZE);
+    bucket = curve1174_cache_hash(cache, key);
+
+    for (i = cache->buckets[bucket]; i != CURVE1174_CACHE_NIL;
+         i = cache->entries[i].bucket_next) {
+        if (!memcmp(cache->entries[i].key, key, CURVE1174_CACHE_KEY_SIZE)) {
+            if (header->lru_head != i) {
+                curve1174_cache_lru_unlink(cache, i);
+                curve1174_cache_lru_push_front(cache, i);
+            }
+            header->hits++;
+            return cache->entries + i;
+        }
+    }
+
+    start = __rdtsc();
+
+    // Take a free entry or evict the least recently used one
+    if (header->nr_used < header->capacity) {
+        i = header->nr_used++;
+    }
+    else {
+        i = header->lru_tail;
+        curve1174_cache_lru_unlink(cache, i);
+        curve1174_cache_bucket_unlink(cache, i);
+    }
+
+    e = cache->entries + i;
+    elligator_1_string_to_point(&(e->point), t, curve);
+    curve1174_scalar_wnaf_table(&(e->table), &(e->point));
+    memcpy(e->key, key, CURVE1174_CACHE_KEY_SIZE);
+
+    e->bucket_next = cache->buckets[bucket];
+    cache->buckets[bucket] = i;
+    curve1174_cache_lru_push_front(cache, i);
+
+    header->misses++;
+    header->miss_cycles += __rdtsc() - start;
+
+    return e;
+}
+
+
+/**
+ * \brief Calculate r := [k]P, where P is the point encoded by the string t,
+ *        using the cached wNAF table of P
+ *
+ * \assumption r, cache, k, t != NULL
+ * \assumption |k| < 2^CURVE1174_SCALAR_MAX_BITS
+ * \assumption 0 <= t <= (q - 1) / 2
+ */
+CurvePointExt *curve1174_cache_scalar_mul(CurvePointExt *r,
+    Curve1174Cache *cache, BigInt *k, BigInt *t, Curve curve)
+{
+    Curve1174CacheEntry *e = curve1174_cache_get(cache, t, curve);
+
+    return curve1174_scalar_mul_table(r, k, &(e->table));
+}
+
+
+/**
+ * \brief Report the hit rate and the estimated number of saved cycles
+ *
+ * \assumption r, cache != NULL
+ */
+Curve1174CacheStats *curve1174_cache_stats(Curve1174CacheStats *r,
+    Curve1174Cache *cache)
+{
+    Curve1174CacheHeader *header = cache->header;
+    uint64_t lookups = header->hits + header->misses;
+
+    r->hits = header->hits;
+    r->misses = header->misses;
+    r->hit_rate = lookups ? (double) header->hits / lookups : 0;
+    r->saved_cycles = header->misses ? (uint64_t) ((double) header->hits
+        * header->miss_cycles / header->misses) : 0;
+
+    return r;
+}
@@ -0,0 +1,586 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This file implements Curve1174 point arithmetic in extended coordinates
+ * (X:Y:Z:T) following Hisil, Wong, Carter and Dawson ("Twisted Edwards Curves
+ * Revisited", 2008) for a = 1 and d = -1174. Additions and doublings need no
+ * inversion, only the conversion back to affine coordinates does.
+ * Affine points are compressed to y and the parity of x, decompression
+ * recovers x from the curve equation with one square root.
+ */
+
+/*
+ * Includes
+ */
+// header files
+#include "curve1174_point.h"
+#include "bigint_curve1174.h"
+#include "debug.h"
+
+/*
+ * Function prototypes (for internal use)
+ */
+BigInt *curve1174_point_mul_d_abs(BigInt *r, BigInt *a);
+int8_t curve1174_point_decompress_prepare(BigInt *y, BigInt *num, BigInt *den,
+    uint8_t *sign, const uint8_t *buf);
+int8_t curve1174_point_decompress_finish(CurvePoint *r, BigInt *y,
+    BigInt *num, BigInt *den_inv, uint8_t sign);
+
+
+/**
+ * \brief Calculate r := (|d| * a) mod q = (-d * a) mod q
+ *
+ * \assumption r, a != NULL
+ * \assumption r != a, i.e., NO ALIASING
+ * \assumption 0 <= a < q
+ */
+BigInt *curve1174_point_mul_d_abs(BigInt *r, BigInt *a)
+{
+    big_int_mul_single_chunk(r, a, CURVE1174_D_ABS);
+    return big_int_curve1174_mod(r);
+}
+
+
+/**
+ * \brief Set r to the neutral element (0:1:1:0)
+ *
+ * \assumption r != NULL
+ */
+CurvePointExt *curve1174_point_set_neutral(CurvePointExt *r)
+{
+    big_int_create_from_chunk(&(r->x), 0, 0);
+    big_int_create_from_chunk(&(r->y), 1, 0);
+    big_int_create_from_chunk(&(r->z), 1, 0);
+    big_int_create_from_chunk(&(r->t), 0, 0);
+
+    return r;
+}
+
+
+/**
+ * \brief Convert the affine point a to extended coordinates (x:y:1:xy)
+ *
+ * \assumption r, a != NULL
+ * \assumption a->x, a->y are reduced mod q
+ */
+CurvePointExt *curve1174_point_from_affine(CurvePointExt *r, CurvePoint *a)
+{
+    BIG_INT_DEFINE_PTR(xy);
+
+    big_int_curve1174_mul_mod(xy, &(a->x), &(a->y));
+
+    big_int_copy(&(r->x), &(a->x));
+    big_int_copy(&(r->y), &(a->y));
+    big_int_create_from_chunk(&(r->z), 1, 0);
+    big_int_copy(&(r->t), xy);
+
+    return r;
+}
+
+
+/**
+ * \brief Convert the extended point a to affine coordinates (X/Z, Y/Z)
+ *
+ * \assumption r, a != NULL
+ * \assumption a->z != 0 mod q
+ */
+CurvePoint *curve1174_point_to_affine(CurvePoint *r, CurvePointExt *a)
+{
+    BIG_INT_DEFINE_PTR(z_inv);
+
+    big_int_curve1174_inv_fermat(z_inv, &(a->z));
+    big_int_curve1174_mul_mod(&(r->x), &(a->x), z_inv);
+    big_int_curve1174_mul_mod(&(r->y), &(a->y), z_inv);
+
+    return r;
+}
+
+
+/**
+ * \brief Prepare the affine point a for mixed additions, i.e., compute
+ *        (y + x, y - x, 2 * d * x * y)
+ *
+ * \assumption r, a != NULL
+ * \assumption a->x, a->y are reduced mod q
+ */
+CurvePointPrecomp *curve1174_point_precompute(CurvePointPrecomp *r,
+    CurvePoint *a)
+{
+    BIG_INT_DEFINE_PTR(xy);
+    BIG_INT_DEFINE_PTR(dxy);
+
+    big_int_curve1174_mul_mod(xy, &(a->x), &(a->y));
+
+    // 2 * d * x * y = -(2 * |d| * x * y)
+    big_int_mul_single_chunk(dxy, xy, 2 * CURVE1174_D_ABS);
+    big_int_curve1174_sub_mod(&(r->t2d), big_int_zero, dxy);
+
+    big_int_curve1174_add_mod(&(r->y_plus_x), &(a->y), &(a->x));
+    big_int_curve1174_sub_mod(&(r->y_minus_x), &(a->y), &(a->x));
+
+    return r;
+}
+
+
+/**
+ * \brief Prepare the extended points a[i] for mixed additions, i.e., compute
+ *        r[i] := (y + x, y - x, 2 * d * x * y) for the affine (x, y) of a[i]
+ *
+ * The Z coordinates are inverted together in blocks of ELLIGATOR_BATCH_SIZE,
+ * which costs one inversion per block instead of one per point.
+ *
+ * \assumption r, a != NULL
+ * \assumption a[i]->z != 0 mod q for all i
+ */
+CurvePointPrecomp *curve1174_point_precompute_batch(CurvePointPrecomp *r,
+    CurvePointExt *a, uint64_t n)
+{
+    uint64_t i, j, block_len;
+
+    BigInt z[ELLIGATOR_BATCH_SIZE];
+    BigInt z_inv[ELLIGATOR_BATCH_SIZE];
+    CurvePoint p;
+
+    for (i = 0; i < n; i += ELLIGATOR_BATCH_SIZE)
+    {
+        block_len = n - i;
+        if (block_len > ELLIGATOR_BATCH_SIZE)
+            block_len = ELLIGATOR_BATCH_SIZE;
+
+        for (j = 0; j < block_len; ++j)
+            big_int_copy(z + j, &(a[i + j].z));
+        big_int_curve1174_inv_batch(z_inv, z, block_len);
+
+        for (j = 0; j < block_len; ++j) {
+            big_int_curve1174_mul_mod(&(p.x), &(a[i + j].x), z_inv + j);
+            big_int_curve1174_mul_mod(&(p.y), &(a[i + j].y), z_inv + j);
+            curve1174_point_precompute(r + i + j, &p);
+        }
+    }
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r := -a for a precomputed point, i.e., swap y + x and
+ *        y - x and negate 2dxy
+ *
+ * \assumption r, a != NULL
+ * \assumption r != a, i.e., NO ALIASING
+ */
+CurvePointPrecomp *curve1174_point_precomp_neg(CurvePointPrecomp *r,
+    CurvePointPrecomp *a)
+{
+    big_int_copy(&(r->y_plus_x), &(a->y_minus_x));
+    big_int_copy(&(r->y_minus_x), &(a->y_plus_x));
+    big_int_curve1174_sub_mod(&(r->t2d), big_int_zero, &(a->t2d));
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r := a + b (unified addition, also valid for a == b and
+ *        the neutral element)
+ *
+ * Uses add-2008-hwcd with a = 1, the multiplication by d is a single chunk
+ * multiplication. Cost: 9M (in two mul_mod_4 calls plus one mul_mod).
+ *
+ * \assumption r, a, b != NULL
+ * \assumption r may alias a or b
+ */
+CurvePointExt *curve1174_point_add(CurvePointExt *r, CurvePointExt *a,
+    CurvePointExt *b)
+{
+    BIG_INT_DEFINE_PTR(x1x2);
+    BIG_INT_DEFINE_PTR(y1y2);
+    BIG_INT_DEFINE_PTR(t1t2);
+    BIG_INT_DEFINE_PTR(z1z2);
+    BIG_INT_DEFINE_PTR(c_abs);
+    BIG_INT_DEFINE_PTR(s1);
+    BIG_INT_DEFINE_PTR(s2);
+    BIG_INT_DEFINE_PTR(e);
+    BIG_INT_DEFINE_PTR(f);
+    BIG_INT_DEFINE_PTR(g);
+    BIG_INT_DEFINE_PTR(h);
+
+    big_int_curve1174_mul_mod_4(x1x2, y1y2, t1t2, z1z2,
+                                &(a->x), &(a->y), &(a->t), &(a->z),
+                                &(b->x), &(b->y), &(b->t), &(b->z));
+
+    // E = (X1 + Y1) * (X2 + Y2) - X1 X2 - Y1 Y2
+    big_int_curve1174_add_mod(s1, &(a->x), &(a->y));
+    big_int_curve1174_add_mod(s2, &(b->x), &(b->y));
+    big_int_curve1174_mul_mod(e, s1, s2);
+    big_int_curve1174_sub_mod(e, e, x1x2);
+    big_int_curve1174_sub_mod(e, e, y1y2);
+
+    // C = d * T1 T2 = -|d| * T1 T2, thus F = Z1 Z2 - C and G = Z1 Z2 + C are
+    // computed with |d| * T1 T2 and swapped operations.
+    curve1174_point_mul_d_abs(c_abs, t1t2);
+    big_int_curve1174_add_mod(f, z1z2, c_abs);
+    big_int_curve1174_sub_mod(g, z1z2, c_abs);
+
+    // H = Y1 Y2 - a * X1 X2
+    big_int_curve1174_sub_mod(h, y1y2, x1x2);
+
+    big_int_curve1174_mul_mod_4(&(r->x), &(r->y), &(r->t), &(r->z),
+                                e, g, e, f,
+                                f, h, h, g);
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r := 2 * a
+ *
+ * Uses dbl-2008-hwcd with a = 1. Cost: 4S + 4M.
+ *
+ * \assumption r, a != NULL
+ * \assumption r may alias a
+ */
+CurvePointExt *curve1174_point_double(CurvePointExt *r, CurvePointExt *a)
+{
+    BIG_INT_DEFINE_PTR(xx);
+    BIG_INT_DEFINE_PTR(yy);
+    BIG_INT_DEFINE_PTR(zz);
+    BIG_INT_DEFINE_PTR(s);
+    BIG_INT_DEFINE_PTR(e);
+    BIG_INT_DEFINE_PTR(f);
+    BIG_INT_DEFINE_PTR(g);
+    BIG_INT_DEFINE_PTR(h);
+
+    big_int_curve1174_add_mod(s, &(a->x), &(a->y));
+
+    big_int_curve1174_square_mod(xx, &(a->x));
+    big_int_curve1174_square_mod(yy, &(a->y));
+    big_int_curve1174_square_mod(zz, &(a->z));
+    big_int_curve1174_square_mod(e, s);
+
+    // E = (X + Y)^2 - X^2 - Y^2
+    big_int_curve1174_sub_mod(e, e, xx);
+    big_int_curve1174_sub_mod(e, e, yy);
+
+    // G = a X^2 + Y^2, F = G - 2 Z^2, H = a X^2 - Y^2
+    big_int_curve1174_add_mod(g, xx, yy);
+    big_int_curve1174_add_mod(zz, zz, zz);
+    big_int_curve1174_sub_mod(f, g, zz);
+    big_int_curve1174_sub_mod(h, xx, yy);
+
+    big_int_curve1174_mul_mod_4(&(r->x), &(r->y), &(r->t), &(r->z),
+                                e, g, e, f,
+                                f, h, h, g);
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r := -a = (-X:Y:Z:-T)
+ *
+ * \assumption r, a != NULL
+ * \assumption r may alias a
+ */
+CurvePointExt *curve1174_point_neg(CurvePointExt *r, CurvePointExt *a)
+{
+    big_int_curve1174_sub_mod(&(r->x), big_int_zero, &(a->x));
+    big_int_copy(&(r->y), &(a->y));
+    big_int_copy(&(r->z), &(a->z));
+    big_int_curve1174_sub_mod(&(r->t), big_int_zero, &(a->t));
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r := a + b, where b is a precomputed affine point
+ *
+ * The (y + x, y - x) representation is meant for a = -1. For a = 1 we
+ * recover 2x and 2y from it and compute all intermediate values of
+ * madd-2008-hwcd scaled by two, which scales the result by four and leaves
+ * the projective point unchanged. Cost: 8M (in two mul_mod_4 calls).
+ *
+ * \assumption r, a, b != NULL
+ * \assumption r may alias a
+ */
+CurvePointExt *curve1174_point_add_mixed(CurvePointExt *r, CurvePointExt *a,
+    CurvePointPrecomp *b)
+{
+    BIG_INT_DEFINE_PTR(x2_2);
+    BIG_INT_DEFINE_PTR(y2_2);
+    BIG_INT_DEFINE_PTR(s1);
+    BIG_INT_DEFINE_PTR(a2);
+    BIG_INT_DEFINE_PTR(b2);
+    BIG_INT_DEFINE_PTR(p);
+    BIG_INT_DEFINE_PTR(c2);
+    BIG_INT_DEFINE_PTR(d2);
+    BIG_INT_DEFINE_PTR(e);
+    BIG_INT_DEFINE_PTR(f);
+    BIG_INT_DEFINE_PTR(g);
+    BIG_INT_DEFINE_PTR(h);
+
+    big_int_curve1174_sub_mod(x2_2, &(b->y_plus_x), &(b->y_minus_x));
+    big_int_curve1174_add_mod(y2_2, &(b->y_plus_x), &(b->y_minus_x));
+    big_int_curve1174_add_mod(s1, &(a->x), &(a->y));
+
+    // 2A = X1 * 2x2, 2B = Y1 * 2y2, P = (X1 + Y1)(x2 + y2), 2C = T1 * 2dx2y2
+    big_int_curve1174_mul_mod_4(a2, b2, p, c2,
+                                &(a->x), &(a->y), s1, &(a->t),
+                                x2_2, y2_2, &(b->y_plus_x), &(b->t2d));
+
+    // 2E = 2P - 2A - 2B
+    big_int_curve1174_add_mod(e, p, p);
+    big_int_curve1174_sub_mod(e, e, a2);
+    big_int_curve1174_sub_mod(e, e, b2);
+
+    // 2D = 2 Z1, 2F = 2D - 2C, 2G = 2D + 2C, 2H = 2B - 2A
+    big_int_curve1174_add_mod(d2, &(a->z), &(a->z));
+    big_int_curve1174_sub_mod(f, d2, c2);
+    big_int_curve1174_add_mod(g, d2, c2);
+    big_int_curve1174_sub_mod(h, b2, a2);
+
+    big_int_curve1174_mul_mod_4(&(r->x), &(r->y), &(r->t), &(r->z),
+                                e, g, e, f,
+                                f, h, h, g);
+
+    return r;
+}
+
+
+/**
+ * \brief Check whether a and b represent the same point, i.e.,
+ *        X1 Z2 = X2 Z1 and Y1 Z2 = Y2 Z1
+ *
+ * \assumption a, b != NULL
+ * \returns 1 if the points are equal, 0 otherwise
+ */
+int8_t curve1174_point_equal(CurvePointExt *a, CurvePointExt *b)
+{
+    BIG_INT_DEFINE_PTR(x1z2);
+    BIG_INT_DEFINE_PTR(x2z1);
+    BIG_INT_DEFINE_PTR(y1z2);
+    BIG_INT_DEFINE_PTR(y2z1);
+
+    big_int_curve1174_mul_mod_4(x1z2, x2z1, y1z2, y2z1,
+                                &(a->x), &(b->x), &(a->y), &(b->y),
+                                &(b->z), &(a->z), &(b->z), &(a->z));
+
+    return big_int_compare(x1z2, x2z1) == 0 && big_int_compare(y1z2, y2z1) == 0;
+}
+
+
+/**
+ * \brief Check whether p is a point on the curve, i.e., 0 <= x, y < q and
+ *        x^2 + y^2 = 1 + d x^2 y^2
+ *
+ * See curve1174_validate_batch for validating many points at once.
+ *
+ * \assumption p != NULL
+ * \returns 1 if p is on the curve, 0 otherwise
+ */
+int8_t curve1174_point_is_on_curve(CurvePoint *p)
+{
+    BIG_INT_DEFINE_PTR(xx);
+    BIG_INT_DEFINE_PTR(yy);
+    BIG_INT_DEFINE_PTR(xxyy);
+    BIG_INT_DEFINE_PTR(lhs);
+
+    if (p->x.sign || p->y.sign || big_int_compare(&(p->x), q) >= 0
+        || big_int_compare(&(p->y), q) >= 0)
+        return 0;
+
+    big_int_curve1174_square_mod(xx, &(p->x));
+    big_int_curve1174_square_mod(yy, &(p->y));
+    big_int_curve1174_mul_mod(lhs, xx, yy);
+    curve1174_point_mul_d_abs(xxyy, lhs);
+
+    // x^2 + y^2 - d x^2 y^2 = 1
+    big_int_curve1174_add_mod(lhs, xx, yy);
+    big_int_curve1174_add_mod(lhs, lhs, xxyy);
+
+    return big_int_compare(lhs, big_int_one) == 0;
+}
+
+
+/**
+ * \brief Write the 32-byte compressed form of p to buf
+ *
+ * \assumption buf != NULL has space for CURVE1174_POINT_COMPRESSED_SIZE bytes
+ * \assumption p != NULL with coordinates reduced mod q
+ */
+uint8_t *curve1174_point_compress(uint8_t *buf, CurvePoint *p)
+{
+    big_int_to_bytes(buf, &(p->y), CURVE1174_POINT_COMPRESSED_SIZE);
+    if (big_int_is_odd(&(p->x)))
+        buf[0] |= CURVE1174_POINT_SIGN_BIT;
+
+    return buf;
+}
+
+
+/**
+ * \brief Parse y and the sign bit from buf and compute x^2 = num / den, where
+ *        num = 1 - y^2 and den = 1 - d y^2 follow from the curve equation
+ *        x^2 + y^2 = 1 + d x^2 y^2. Since d is not a square, den != 0.
+ *
+ * \assumption y, num, den, sign, buf != NULL
+ * \returns 1 if y < q, 0 otherwise
+ */
+int8_t curve1174_point_decompress_prepare(BigInt *y, BigInt *num, BigInt *den,
+    uint8_t *sign, const uint8_t *buf)
+{
+    uint8_t y_buf[CURVE1174_POINT_COMPRESSED_SIZE];
+
+    BIG_INT_DEFINE_PTR(yy);
+    BIG_INT_DEFINE_PTR(tmp);
+
+    memcpy(y_buf, buf, CURVE1174_POINT_COMPRESSED_SIZE);
+    *sign = (y_buf[0] & CURVE1174_POINT_SIGN_BIT) != 0;
+    y_buf[0] &= ~CURVE1174_POINT_SIGN_BIT;
+
+    big_int_create_from_bytes(y, y_buf, CURVE1174_POINT_COMPRESSED_SIZE);
+    // Continue with the neutral element for invalid encodings
+    if (big_int_compare(y, q) >= 0) {
+        big_int_copy(y, big_int_one);
+        big_int_copy(num, big_int_zero);
+        big_int_copy(den, big_int_one);
+        return 0;
+    }
+
+    big_int_curve1174_square_mod(yy, y);
+    big_int_curve1174_sub_mod(num, big_int_one, yy);
+    curve1174_point_mul_d_abs(tmp, yy);
+    big_int_curve1174_add_mod(den, big_int_one, tmp);
+
+    return 1;
+}
+
+
+/**
+ * \brief Set r := (x, y) with x = sqrt(num * den_inv) of the given parity
+ *
+ * The square root is b^((q+1)/4) for q = 3 mod 4, which is only a root if b
+ * is a square. On failure, r is set to the neutral element (0, 1).
+ *
+ * \assumption r, y, num, den_inv != NULL
+ * \returns 1 if the point is valid, 0 otherwise
+ */
+int8_t curve1174_point_decompress_finish(CurvePoint *r, BigInt *y,
+    BigInt *num, BigInt *den_inv, uint8_t sign)
+{
+    BIG_INT_DEFINE_PTR(xx);
+    BIG_INT_DEFINE_PTR(x);
+    BIG_INT_DEFINE_PTR(tmp);
+
+    big_int_curve1174_mul_mod(xx, num, den_inv);
+    big_int_curve1174_pow_q_p1_d4(x, xx);
+
+    big_int_curve1174_square_mod(tmp, x);
+    if (big_int_compare(tmp, xx) != 0 || (sign && big_int_is_zero(x))) {
+        big_int_copy(&(r->x), big_int_zero);
+        big_int_copy(&(r->y), big_int_one);
+        return 0;
+    }
+
+    if (big_int_is_odd(x) != sign)
+        big_int_curve1174_sub_mod(x, big_int_zero, x);
+
+    big_int_copy(&(r->x), x);
+    big_int_copy(&(r->y), y);
+
+    return 1;
+}
+
+
+/**
+ * \brief Recover the point r from its compressed form in buf
+ *
+ * \assumption r, buf != NULL
+ * \returns 1 if buf encodes a point on the curve, 0 otherwise (r is then the
+ *          neutral element)
+ */
+int8_t curve1174_point_decompress(CurvePoint *r, const uint8_t *buf)
+{
+    uint8_t sign;
+    int8_t ok;
+
+    BIG_INT_DEFINE_PTR(y);
+    BIG_INT_DEFINE_PTR(num);
+    BIG_INT_DEFINE_PTR(den);
+    BIG_INT_DEFINE_PTR(den_inv);
+
+    ok = curve1174_point_decompress_prepare(y, num, den, &sign, buf);
+    big_int_curve1174_inv_fermat(den_inv, den);
+
+    return curve1174_point_decompress_finish(r, y, num, den_inv, sign) && ok;
+}
+
+
+/**
+ * \brief Decompress n points from buf (CURVE1174_POINT_COMPRESSED_SIZE bytes
+ *        each)
+ *
+ * The denominators are inverted together in blocks of ELLIGATOR_BATCH_SIZE,
+ * which costs one inversion per block instead of one per point.
+ *
+ * \assumption r, buf != NULL
+ * \param ok if not NULL, ok[i] is set to 1 if point i is valid, 0 otherwise
+ * \returns 1 if all points are valid, 0 otherwise
+ */
+int8_t curve1174_point_decompress_batch(CurvePoint *r, const uint8_t *buf,
+    uint64_t n, uint8_t *ok)
+{
+    uint64_t i, j, block_len;
+    uint8_t sign[ELLIGATOR_BATCH_SIZE];
+    int8_t valid, all_valid;
+
+    BigInt y[ELLIGATOR_BATCH_SIZE];
+    BigInt num[ELLIGATOR_BATCH_SIZE];
+    BigInt den[ELLIGATOR_BATCH_SIZE];
+    BigInt den_inv[ELLIGATOR_BATCH_SIZE];
+    int8_t parsed[ELLIGATOR_BATCH_SIZE];
+
+    all_valid = 1;
+    for (i = 0; i < n; i += ELLIGATOR_BATCH_SIZE)
+    {
+        block_len = n - i;
+        if (block_len > ELLIGATOR_BATCH_SIZE)
+            block_len = ELLIGATOR_BATCH_SIZE;
+
+        for (j = 0; j < block_len; ++j)
+            parsed[j] = curve1174_point_decompress_prepare(y + j, num + j,
+                den + j, sign + j,
+                buf + (i + j) * CURVE1174_POINT_COMPRESSED_SIZE);
+        big_int_curve1174_inv_batch(den_inv, den, block_len);
+
+        for (j = 0; j < block_len; ++j) {
+            valid = curve1174_point_decompress_finish(r + i + j, y + j,
+                num + j, den_inv + j, sign[j]) && parsed[j];
+            if (ok)
+                ok[i + j] = valid;
+            all_valid &= valid;
+        }
+    }
+
+    return all_valid;
+}
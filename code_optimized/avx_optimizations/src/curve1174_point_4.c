@@ -0,0 +1,773 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This file implements Curve1174 point arithmetic with AVX2, where the four
+ * coordinates (X, Y, Z, T) of a point in extended coordinates live in the four
+ * lanes of one vector field element. Every multiplication stage of the
+ * formulas in curve1174_point.c is computed as one 4-way multiplication, the
+ * linear combinations between the stages are done with lane permutations.
+ * Field elements stay in the 4-lane representation between operations, so the
+ * repacking of big_int_mul_4 is only paid when converting from/to BigInts.
+ */
+
+/*
+ * Includes
+ */
+// header files
+#include "curve1174_point_4.h"
+#include "bigint_curve1174.h"
+#include "debug.h"
+
+// 2^256 = 288 mod q
+#define CURVE1174_FE4_FOLD 288
+
+// Lane indices of the coordinates
+#define LANE_X 0
+#define LANE_Y 1
+#define LANE_Z 2
+#define LANE_T 3
+
+// Bits of q = 2^251 - 9 in its top limb
+#define Q_TOP_LIMB_BITS 27
+
+// Masks for _mm256_blend_epi32 selecting 64-bit lanes from the second operand
+#define BLEND_LANE(l) (0x3 << (2 * (l)))
+
+/*
+ * Function prototypes (for internal use)
+ */
+Curve1174FieldElem4 *curve1174_fe4_normalize(Curve1174FieldElem4 *r,
+    __m256i *t);
+Curve1174FieldElem4 *curve1174_fe4_mul_d_abs(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a);
+Curve1174FieldElem4 *curve1174_fe4_reduce(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a);
+int curve1174_fe4_eq_one(Curve1174FieldElem4 *a);
+Curve1174FieldElem4 *curve1174_fe4_broadcast(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a, const int lane);
+Curve1174FieldElem4 *curve1174_fe4_blend(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a, Curve1174FieldElem4 *b, const int mask);
+CurvePointPrecomp4 *curve1174_point_4_precomp_finish(CurvePointPrecomp4 *r,
+    Curve1174FieldElem4 *u, Curve1174FieldElem4 *v);
+CurvePointExt4 *curve1174_point_4_finish(CurvePointExt4 *r,
+    Curve1174FieldElem4 *e, Curve1174FieldElem4 *f, Curve1174FieldElem4 *g,
+    Curve1174FieldElem4 *h);
+
+
+/**
+ * \brief Carry-propagate the lanes of t into 32-bit limbs and fold everything
+ *        above 2^256 back using 2^256 = 288 mod q.
+ *
+ * \assumption r, t != NULL, t has Q_CHUNKS entries
+ * \assumption every lane of t[i] is smaller than 2^62
+ * \returns r with 0 <= r < 2^256 in every lane
+ */
+Curve1174FieldElem4 *curve1174_fe4_normalize(Curve1174FieldElem4 *r,
+    __m256i *t)
+{
+    int64_t i;
+    __m256i carry;
+    __m256i mask = _mm256_set1_epi64x(BIGINT_RADIX_FOR_MOD);
+    __m256i fold = _mm256_set1_epi64x(CURVE1174_FE4_FOLD);
+
+    carry = _mm256_setzero_si256();
+    for (i = 0; i < Q_CHUNKS; ++i) {
+        carry = _mm256_add_epi64(carry, t[i]);
+        r->limbs[i] = _mm256_and_si256(carry, mask);
+        carry = _mm256_srli_epi64(carry, BIGINT_CHUNK_BIT_SIZE);
+    }
+
+    // The carry is below 2^31, fold it once more
+    carry = _mm256_mul_epu32(carry, fold);
+    for (i = 0; i < Q_CHUNKS; ++i) {
+        carry = _mm256_add_epi64(carry, r->limbs[i]);
+        r->limbs[i] = _mm256_and_si256(carry, mask);
+        carry = _mm256_srli_epi64(carry, BIGINT_CHUNK_BIT_SIZE);
+    }
+
+    // A carry of 1 is only left if the value is now below 2^41, so it fits
+    // into the lowest two limbs
+    carry = _mm256_mul_epu32(carry, fold);
+    carry = _mm256_add_epi64(carry, r->limbs[0]);
+    r->limbs[0] = _mm256_and_si256(carry, mask);
+    carry = _mm256_srli_epi64(carry, BIGINT_CHUNK_BIT_SIZE);
+    r->limbs[1] = _mm256_add_epi64(r->limbs[1], carry);
+
+    return r;
+}
+
+
+/**
+ * \brief Pack four BigInts into the lanes of r
+ *
+ * \assumption r, a0, a1, a2, a3 != NULL
+ * \assumption 0 <= a<i> < 2^256
+ */
+Curve1174FieldElem4 *curve1174_fe4_pack(Curve1174FieldElem4 *r, BigInt *a0,
+    BigInt *a1, BigInt *a2, BigInt *a3)
+{
+    int64_t i;
+    dbl_chunk_size_t c0, c1, c2, c3;
+
+    for (i = 0; i < Q_CHUNKS; ++i) {
+        c0 = (i < a0->size) ? a0->chunks[i] : 0;
+        c1 = (i < a1->size) ? a1->chunks[i] : 0;
+        c2 = (i < a2->size) ? a2->chunks[i] : 0;
+        c3 = (i < a3->size) ? a3->chunks[i] : 0;
+        r->limbs[i] = _mm256_set_epi64x(c3, c2, c1, c0);
+    }
+
+    return r;
+}
+
+
+/**
+ * \brief Unpack the lanes of a into four BigInts reduced mod q
+ *
+ * \assumption r0, r1, r2, r3, a != NULL
+ * \assumption r<i> pairwise distinct
+ * \returns r<i> with 0 <= r<i> < q
+ */
+void curve1174_fe4_unpack(BigInt *r0, BigInt *r1, BigInt *r2, BigInt *r3,
+    Curve1174FieldElem4 *a)
+{
+    int64_t i;
+    BigInt *r[4] = {r0, r1, r2, r3};
+    dbl_chunk_size_t lanes[4] __attribute__((aligned(32)));
+
+    for (i = 0; i < Q_CHUNKS; ++i) {
+        _mm256_store_si256((__m256i *) lanes, a->limbs[i]);
+        r0->chunks[i] = lanes[0];
+        r1->chunks[i] = lanes[1];
+        r2->chunks[i] = lanes[2];
+        r3->chunks[i] = lanes[3];
+    }
+
+    for (i = 0; i < 4; ++i) {
+        r[i]->sign = 0;
+        r[i]->overflow = 0;
+        r[i]->size = Q_CHUNKS;
+        big_int_prune_leading_zeros(r[i], r[i]);
+        big_int_curve1174_mod(r[i]);
+    }
+}
+
+
+/**
+ * \brief Calculate r := (a + b) mod q lane-wise
+ *
+ * \assumption r, a, b != NULL (aliasing is fine)
+ */
+Curve1174FieldElem4 *curve1174_fe4_add(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a, Curve1174FieldElem4 *b)
+{
+    int64_t i;
+    __m256i t[Q_CHUNKS];
+
+    for (i = 0; i < Q_CHUNKS; ++i)
+        t[i] = _mm256_add_epi64(a->limbs[i], b->limbs[i]);
+
+    return curve1174_fe4_normalize(r, t);
+}
+
+
+/**
+ * \brief Calculate r := (a - b) mod q lane-wise
+ *
+ * We compute a + 64q - b, where 64q = 2^257 - 576 is written with limbs of at
+ * least 2^32, such that no limb becomes negative.
+ *
+ * \assumption r, a, b != NULL (aliasing is fine)
+ */
+Curve1174FieldElem4 *curve1174_fe4_sub(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a, Curve1174FieldElem4 *b)
+{
+    int64_t i;
+    __m256i t[Q_CHUNKS];
+    __m256i q64_lo = _mm256_set1_epi64x(0x1fffffdc0);
+    __m256i q64 = _mm256_set1_epi64x(0x1fffffffe);
+
+    t[0] = _mm256_sub_epi64(_mm256_add_epi64(a->limbs[0], q64_lo), b->limbs[0]);
+    for (i = 1; i < Q_CHUNKS; ++i)
+        t[i] = _mm256_sub_epi64(_mm256_add_epi64(a->limbs[i], q64), b->limbs[i]);
+
+    return curve1174_fe4_normalize(r, t);
+}
+
+
+/**
+ * \brief Calculate r := (|d| * a) mod q lane-wise
+ *
+ * \assumption r, a != NULL (aliasing is fine)
+ */
+Curve1174FieldElem4 *curve1174_fe4_mul_d_abs(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a)
+{
+    int64_t i;
+    __m256i t[Q_CHUNKS];
+    __m256i d_abs = _mm256_set1_epi64x(CURVE1174_D_ABS);
+
+    for (i = 0; i < Q_CHUNKS; ++i)
+        t[i] = _mm256_mul_epu32(a->limbs[i], d_abs);
+
+    return curve1174_fe4_normalize(r, t);
+}
+
+
+/**
+ * \brief Calculate r := (a * b) mod q lane-wise
+ *
+ * Schoolbook multiplication as in big_int_mul_4_fast, followed by folding the
+ * upper half with 2^256 = 288 mod q.
+ *
+ * \assumption r, a, b != NULL (aliasing is fine)
+ */
+Curve1174FieldElem4 *curve1174_fe4_mul(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a, Curve1174FieldElem4 *b)
+{
+    int64_t i, j;
+    __m256i t[2 * Q_CHUNKS];
+    __m256i carry, b_i;
+    __m256i mask = _mm256_set1_epi64x(BIGINT_RADIX_FOR_MOD);
+    __m256i fold = _mm256_set1_epi64x(CURVE1174_FE4_FOLD);
+
+    for (i = 0; i < Q_CHUNKS; ++i)
+        t[i] = _mm256_setzero_si256();
+
+    for (i = 0; i < Q_CHUNKS; ++i) {
+        b_i = b->limbs[i];
+        carry = _mm256_setzero_si256();
+
+        for (j = 0; j < Q_CHUNKS; ++j) {
+            carry = _mm256_add_epi64(carry, t[i + j]);
+            carry = _mm256_add_epi64(carry, _mm256_mul_epu32(a->limbs[j], b_i));
+            t[i + j] = _mm256_and_si256(carry, mask);
+            carry = _mm256_srli_epi64(carry, BIGINT_CHUNK_BIT_SIZE);
+        }
+        t[i + Q_CHUNKS] = carry;
+    }
+
+    // t = lo + 2^256 * hi = lo + 288 * hi mod q, every lane stays below 2^42
+    for (i = 0; i < Q_CHUNKS; ++i)
+        t[i] = _mm256_add_epi64(t[i], _mm256_mul_epu32(t[i + Q_CHUNKS], fold));
+
+    return curve1174_fe4_normalize(r, t);
+}
+
+
+/**
+ * \brief Reduce every lane of a to its canonical representative mod q
+ *
+ * Folding the bits above 2^251 with 2^251 = 9 mod q leaves a value below
+ * 2^251 + 288 < 2q, from which q is subtracted if a + 9 reaches 2^251.
+ *
+ * \assumption r, a != NULL (aliasing is fine)
+ * \returns r with 0 <= r < q in every lane
+ */
+Curve1174FieldElem4 *curve1174_fe4_reduce(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a)
+{
+    int64_t i;
+    __m256i carry, ge_q;
+    __m256i w[Q_CHUNKS];
+    __m256i mask = _mm256_set1_epi64x(BIGINT_RADIX_FOR_MOD);
+    __m256i top_mask = _mm256_set1_epi64x((1ULL << Q_TOP_LIMB_BITS) - 1);
+    __m256i nine = _mm256_set1_epi64x(9);
+
+    carry = _mm256_mul_epu32(
+        _mm256_srli_epi64(a->limbs[Q_CHUNKS - 1], Q_TOP_LIMB_BITS), nine);
+    for (i = 0; i < Q_CHUNKS - 1; ++i) {
+        carry = _mm256_add_epi64(carry, a->limbs[i]);
+        r->limbs[i] = _mm256_and_si256(carry, mask);
+        carry = _mm256_srli_epi64(carry, BIGINT_CHUNK_BIT_SIZE);
+    }
+    r->limbs[i] = _mm256_add_epi64(carry,
+        _mm256_and_si256(a->limbs[i], top_mask));
+
+    // w = r + 9 = r - q + 2^251
+    carry = nine;
+    for (i = 0; i < Q_CHUNKS; ++i) {
+        carry = _mm256_add_epi64(carry, r->limbs[i]);
+        w[i] = _mm256_and_si256(carry, mask);
+        carry = _mm256_srli_epi64(carry, BIGINT_CHUNK_BIT_SIZE);
+    }
+    ge_q = _mm256_sub_epi64(_mm256_setzero_si256(),
+        _mm256_srli_epi64(w[Q_CHUNKS - 1], Q_TOP_LIMB_BITS));
+    w[Q_CHUNKS - 1] = _mm256_and_si256(w[Q_CHUNKS - 1], top_mask);
+
+    for (i = 0; i < Q_CHUNKS; ++i)
+        r->limbs[i] = _mm256_blendv_epi8(r->limbs[i], w[i], ge_q);
+
+    return r;
+}
+
+
+/**
+ * \brief Compare every lane of a with 1
+ *
+ * \assumption a != NULL
+ * \returns a 4-bit mask, bit i is set if lane i of a equals 1 mod q
+ */
+int curve1174_fe4_eq_one(Curve1174FieldElem4 *a)
+{
+    int64_t i;
+    Curve1174FieldElem4 a_red;
+    __m256i eq;
+    __m256i zero = _mm256_setzero_si256();
+
+    curve1174_fe4_reduce(&a_red, a);
+
+    eq = _mm256_cmpeq_epi64(a_red.limbs[0], _mm256_set1_epi64x(1));
+    for (i = 1; i < Q_CHUNKS; ++i)
+        eq = _mm256_and_si256(eq, _mm256_cmpeq_epi64(a_red.limbs[i], zero));
+
+    return _mm256_movemask_pd(_mm256_castsi256_pd(eq));
+}
+
+
+/**
+ * \brief Set every lane of r to the given lane of a
+ *
+ * \assumption r, a != NULL (aliasing is fine)
+ * \assumption lane is a compile-time constant in [0, 3]
+ */
+Curve1174FieldElem4 *curve1174_fe4_broadcast(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a, const int lane)
+{
+    int64_t i;
+
+    switch (lane) {
+        case 0:
+            for (i = 0; i < Q_CHUNKS; ++i)
+                r->limbs[i] = _mm256_permute4x64_epi64(a->limbs[i], 0x00);
+            break;
+        case 1:
+            for (i = 0; i < Q_CHUNKS; ++i)
+                r->limbs[i] = _mm256_permute4x64_epi64(a->limbs[i], 0x55);
+            break;
+        case 2:
+            for (i = 0; i < Q_CHUNKS; ++i)
+                r->limbs[i] = _mm256_permute4x64_epi64(a->limbs[i], 0xaa);
+            break;
+        default:
+            for (i = 0; i < Q_CHUNKS; ++i)
+                r->limbs[i] = _mm256_permute4x64_epi64(a->limbs[i], 0xff);
+            break;
+    }
+
+    return r;
+}
+
+
+/**
+ * \brief Take the lanes selected by mask (see BLEND_LANE) from b, the others
+ *        from a
+ *
+ * \assumption r, a, b != NULL (aliasing is fine)
+ */
+Curve1174FieldElem4 *curve1174_fe4_blend(Curve1174FieldElem4 *r,
+    Curve1174FieldElem4 *a, Curve1174FieldElem4 *b, const int mask)
+{
+    int64_t i;
+
+    for (i = 0; i < Q_CHUNKS; ++i)
+        r->limbs[i] = _mm256_blendv_epi8(a->limbs[i], b->limbs[i],
+            _mm256_set_epi64x(-((mask >> 6) & 1), -((mask >> 4) & 1),
+                              -((mask >> 2) & 1), -(mask & 1)));
+
+    return r;
+}
+
+
+/**
+ * \brief Set r to the neutral element (0:1:1:0)
+ *
+ * \assumption r != NULL
+ */
+CurvePointExt4 *curve1174_point_4_set_neutral(CurvePointExt4 *r)
+{
+    int64_t i;
+
+    r->xyzt.limbs[0] = _mm256_set_epi64x(0, 1, 1, 0);
+    for (i = 1; i < Q_CHUNKS; ++i)
+        r->xyzt.limbs[i] = _mm256_setzero_si256();
+
+    return r;
+}
+
+
+/**
+ * \brief Convert a point in extended coordinates to the 4-lane representation
+ *
+ * \assumption r, a != NULL
+ * \assumption the coordinates of a are reduced mod q
+ */
+CurvePointExt4 *curve1174_point_4_from_ext(CurvePointExt4 *r,
+    CurvePointExt *a)
+{
+    curve1174_fe4_pack(&(r->xyzt), &(a->x), &(a->y), &(a->z), &(a->t));
+    return r;
+}
+
+
+/**
+ * \brief Convert a point from the 4-lane representation back to BigInts
+ *
+ * \assumption r, a != NULL
+ */
+CurvePointExt *curve1174_point_4_to_ext(CurvePointExt *r, CurvePointExt4 *a)
+{
+    curve1174_fe4_unpack(&(r->x), &(r->y), &(r->z), &(r->t), &(a->xyzt));
+    return r;
+}
+
+
+/**
+ * \brief Combine u = (y + x, y + x, y + x, 2dxy) and v = (y - x, y - x, 0, 0)
+ *        to (u - v, u + v, u, u) = (2x, 2y, y + x, 2dxy)
+ *
+ * \assumption r, u, v != NULL
+ */
+CurvePointPrecomp4 *curve1174_point_4_precomp_finish(CurvePointPrecomp4 *r,
+    Curve1174FieldElem4 *u, Curve1174FieldElem4 *v)
+{
+    Curve1174FieldElem4 sum, diff;
+
+    curve1174_fe4_add(&sum, u, v);
+    curve1174_fe4_sub(&diff, u, v);
+    curve1174_fe4_blend(&(r->v), &sum, &diff, BLEND_LANE(0));
+
+    return r;
+}
+
+
+/**
+ * \brief Convert a precomputed point to the 4-lane form (2x, 2y, y + x, 2dxy)
+ *
+ * \assumption r, a != NULL
+ * \assumption the coordinates of a are reduced mod q
+ */
+CurvePointPrecomp4 *curve1174_point_4_from_precomp(CurvePointPrecomp4 *r,
+    CurvePointPrecomp *a)
+{
+    Curve1174FieldElem4 u, v;
+
+    curve1174_fe4_pack(&u, &(a->y_plus_x), &(a->y_plus_x), &(a->y_plus_x),
+        &(a->t2d));
+    curve1174_fe4_pack(&v, &(a->y_minus_x), &(a->y_minus_x), big_int_zero,
+        big_int_zero);
+
+    return curve1174_point_4_precomp_finish(r, &u, &v);
+}
+
+
+/**
+ * \brief Convert a precomputed point given as Q_CHUNKS 32-bit chunks per
+ *        coordinate (least significant first) to the 4-lane form
+ *
+ * \assumption r, y_plus_x, y_minus_x, t2d != NULL
+ * \assumption the coordinates are reduced mod q
+ */
+CurvePointPrecomp4 *curve1174_point_4_precomp_from_chunks(
+    CurvePointPrecomp4 *r, const uint32_t *y_plus_x, const uint32_t *y_minus_x,
+    const uint32_t *t2d)
+{
+    Curve1174FieldElem4 u, v;
+    int64_t i;
+
+    for (i = 0; i < Q_CHUNKS; ++i) {
+        u.limbs[i] = _mm256_set_epi64x(t2d[i], y_plus_x[i], y_plus_x[i],
+            y_plus_x[i]);
+        v.limbs[i] = _mm256_set_epi64x(0, 0, y_minus_x[i], y_minus_x[i]);
+    }
+
+    return curve1174_point_4_precomp_finish(r, &u, &v);
+}
+
+
+/**
+ * \brief Calculate r := -a for a precomputed point in the 4-lane form, i.e.,
+ *        (2x, 2y, y + x, 2dxy) -> (-2x, 2y, y - x, -2dxy)
+ *
+ * \assumption r, a != NULL (aliasing is fine)
+ */
+CurvePointPrecomp4 *curve1174_point_4_precomp_neg(CurvePointPrecomp4 *r,
+    CurvePointPrecomp4 *a)
+{
+    Curve1174FieldElem4 neg, tmp;
+    int64_t i;
+
+    // y - x = (y + x) - 2x
+    curve1174_fe4_broadcast(&tmp, &(a->v), LANE_X);
+    curve1174_fe4_sub(&tmp, &(a->v), &tmp);
+
+    for (i = 0; i < Q_CHUNKS; ++i)
+        neg.limbs[i] = _mm256_setzero_si256();
+    curve1174_fe4_sub(&neg, &neg, &(a->v));
+
+    curve1174_fe4_blend(&tmp, &tmp, &(a->v), BLEND_LANE(1));
+    curve1174_fe4_blend(&(r->v), &tmp, &neg, BLEND_LANE(0) | BLEND_LANE(3));
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r := -a = (-X : Y : Z : -T)
+ *
+ * \assumption r, a != NULL (aliasing is fine)
+ */
+CurvePointExt4 *curve1174_point_4_neg(CurvePointExt4 *r, CurvePointExt4 *a)
+{
+    int64_t i;
+    Curve1174FieldElem4 neg;
+
+    for (i = 0; i < Q_CHUNKS; ++i)
+        neg.limbs[i] = _mm256_setzero_si256();
+    curve1174_fe4_sub(&neg, &neg, &(a->xyzt));
+
+    curve1174_fe4_blend(&(r->xyzt), &(a->xyzt), &neg,
+        BLEND_LANE(LANE_X) | BLEND_LANE(LANE_T));
+
+    return r;
+}
+
+
+/**
+ * \brief Last multiplication stage shared by all formulas:
+ *        (X3, Y3, Z3, T3) = (E, G, F, E) * (F, H, G, H)
+ *
+ * \assumption all arguments != NULL
+ * \assumption e, f, g, h have the respective value in all lanes
+ */
+CurvePointExt4 *curve1174_point_4_finish(CurvePointExt4 *r,
+    Curve1174FieldElem4 *e, Curve1174FieldElem4 *f, Curve1174FieldElem4 *g,
+    Curve1174FieldElem4 *h)
+{
+    Curve1174FieldElem4 lhs, rhs;
+
+    curve1174_fe4_blend(&lhs, e, g, BLEND_LANE(LANE_Y));
+    curve1174_fe4_blend(&lhs, &lhs, f, BLEND_LANE(LANE_Z));
+
+    curve1174_fe4_blend(&rhs, h, f, BLEND_LANE(LANE_X));
+    curve1174_fe4_blend(&rhs, &rhs, g, BLEND_LANE(LANE_Z));
+
+    curve1174_fe4_mul(&(r->xyzt), &lhs, &rhs);
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r := a + b (add-2008-hwcd, see curve1174_point_add)
+ *
+ * Stages: (A, B, D, T1T2) = (X1, Y1, Z1, T1) * (X2, Y2, Z2, T2) and
+ * (X1Y2, Y1X2) = (X1, Y1) * (Y2, X2), such that E = X1Y2 + Y1X2.
+ *
+ * \assumption r, a, b != NULL (aliasing is fine)
+ */
+CurvePointExt4 *curve1174_point_4_add(CurvePointExt4 *r, CurvePointExt4 *a,
+    CurvePointExt4 *b)
+{
+    Curve1174FieldElem4 m1, m2, b_swap, tmp;
+    Curve1174FieldElem4 e, f, g, h, dd;
+    int64_t i;
+
+    curve1174_fe4_mul(&m1, &(a->xyzt), &(b->xyzt));
+
+    for (i = 0; i < Q_CHUNKS; ++i)
+        b_swap.limbs[i] = _mm256_permute4x64_epi64(b->xyzt.limbs[i],
+            _MM_SHUFFLE(3, 2, 0, 1));
+    curve1174_fe4_mul(&m2, &(a->xyzt), &b_swap);
+
+    // E = X1Y2 + Y1X2
+    curve1174_fe4_broadcast(&e, &m2, LANE_X);
+    curve1174_fe4_broadcast(&tmp, &m2, LANE_Y);
+    curve1174_fe4_add(&e, &e, &tmp);
+
+    // H = B - A
+    curve1174_fe4_broadcast(&h, &m1, LANE_Y);
+    curve1174_fe4_broadcast(&tmp, &m1, LANE_X);
+    curve1174_fe4_sub(&h, &h, &tmp);
+
+    // F = D - C = D + |d| * T1T2, G = D + C = D - |d| * T1T2
+    curve1174_fe4_broadcast(&tmp, &m1, LANE_T);
+    curve1174_fe4_mul_d_abs(&tmp, &tmp);
+    curve1174_fe4_broadcast(&dd, &m1, LANE_Z);
+    curve1174_fe4_add(&f, &dd, &tmp);
+    curve1174_fe4_sub(&g, &dd, &tmp);
+
+    return curve1174_point_4_finish(r, &e, &f, &g, &h);
+}
+
+
+/**
+ * \brief Calculate r := 2 * a (dbl-2008-hwcd, see curve1174_point_double)
+ *
+ * Stage: (A, B, C/2, (X1 + Y1)^2) = (X1, Y1, Z1, X1 + Y1)^2
+ *
+ * \assumption r, a != NULL (aliasing is fine)
+ */
+CurvePointExt4 *curve1174_point_4_double(CurvePointExt4 *r,
+    CurvePointExt4 *a)
+{
+    Curve1174FieldElem4 u, sq, tmp;
+    Curve1174FieldElem4 e, f, g, h, aa, bb;
+    int64_t i;
+
+    // u = (X1, Y1, Z1, X1) + (0, 0, 0, Y1)
+    for (i = 0; i < Q_CHUNKS; ++i) {
+        u.limbs[i] = _mm256_permute4x64_epi64(a->xyzt.limbs[i],
+            _MM_SHUFFLE(0, 2, 1, 0));
+        tmp.limbs[i] = _mm256_permute4x64_epi64(a->xyzt.limbs[i],
+            _MM_SHUFFLE(1, 3, 3, 3));
+        tmp.limbs[i] = _mm256_blend_epi32(_mm256_setzero_si256(), tmp.limbs[i],
+            BLEND_LANE(LANE_T));
+    }
+    curve1174_fe4_add(&u, &u, &tmp);
+
+    curve1174_fe4_mul(&sq, &u, &u);
+
+    curve1174_fe4_broadcast(&aa, &sq, LANE_X);
+    curve1174_fe4_broadcast(&bb, &sq, LANE_Y);
+
+    // G = A + B, H = A - B
+    curve1174_fe4_add(&g, &aa, &bb);
+    curve1174_fe4_sub(&h, &aa, &bb);
+
+    // E = (X1 + Y1)^2 - A - B
+    curve1174_fe4_broadcast(&e, &sq, LANE_T);
+    curve1174_fe4_sub(&e, &e, &g);
+
+    // F = G - C = G - 2 Z1^2
+    curve1174_fe4_broadcast(&tmp, &sq, LANE_Z);
+    curve1174_fe4_add(&tmp, &tmp, &tmp);
+    curve1174_fe4_sub(&f, &g, &tmp);
+
+    return curve1174_point_4_finish(r, &e, &f, &g, &h);
+}
+
+
+/**
+ * \brief Calculate r := a + b for a precomputed affine point b (see
+ *        curve1174_point_add_mixed)
+ *
+ * Stage: (2A, 2B, P, C) = (X1, Y1, X1 + Y1, T1) * (2x2, 2y2, y2 + x2, 2dx2y2),
+ * all further values are doubled: E' = 2P - 2A - 2B, F' = 2Z1 - C,
+ * G' = 2Z1 + C and H' = 2B - 2A.
+ *
+ * \assumption r, a, b != NULL (aliasing is fine)
+ */
+CurvePointExt4 *curve1174_point_4_add_mixed(CurvePointExt4 *r,
+    CurvePointExt4 *a, CurvePointPrecomp4 *b)
+{
+    Curve1174FieldElem4 u, m, tmp;
+    Curve1174FieldElem4 e, f, g, h, aa, bb, cc, dd;
+
+    // u = (X1, Y1, X1 + Y1, T1)
+    curve1174_fe4_broadcast(&u, &(a->xyzt), LANE_X);
+    curve1174_fe4_broadcast(&tmp, &(a->xyzt), LANE_Y);
+    curve1174_fe4_add(&tmp, &u, &tmp);
+    curve1174_fe4_blend(&u, &(a->xyzt), &tmp, BLEND_LANE(LANE_Z));
+
+    curve1174_fe4_mul(&m, &u, &(b->v));
+
+    curve1174_fe4_broadcast(&aa, &m, LANE_X);
+    curve1174_fe4_broadcast(&bb, &m, LANE_Y);
+
+    // H' = 2B - 2A
+    curve1174_fe4_sub(&h, &bb, &aa);
+
+    // E' = 2P - 2A - 2B
+    curve1174_fe4_broadcast(&e, &m, LANE_Z);
+    curve1174_fe4_add(&e, &e, &e);
+    curve1174_fe4_add(&tmp, &aa, &bb);
+    curve1174_fe4_sub(&e, &e, &tmp);
+
+    // F' = 2Z1 - C, G' = 2Z1 + C
+    curve1174_fe4_broadcast(&dd, &(a->xyzt), LANE_Z);
+    curve1174_fe4_add(&dd, &dd, &dd);
+    curve1174_fe4_broadcast(&cc, &m, LANE_T);
+    curve1174_fe4_sub(&f, &dd, &cc);
+    curve1174_fe4_add(&g, &dd, &cc);
+
+    return curve1174_point_4_finish(r, &e, &f, &g, &h);
+}
+
+
+/**
+ * \brief Check which of the n points p are on the curve, i.e., have
+ *        coordinates 0 <= x, y < q with x^2 + y^2 = 1 + d x^2 y^2
+ *
+ * Four points are checked per iteration, one per lane, with 3 vector
+ * multiplications and a single canonical reduction at the end. This is meant
+ * for untrusted input, e.g., before calling elligator_1_point_to_string.
+ *
+ * \assumption p != NULL
+ * \param ok if not NULL, ok[i] is set to 1 if point i is valid, 0 otherwise
+ * \returns 1 if all points are valid, 0 otherwise
+ */
+int8_t curve1174_validate_batch(CurvePoint *p, uint64_t n, uint8_t *ok)
+{
+    uint64_t i, j;
+    int8_t all_valid, valid;
+    int8_t in_range[4];
+    BigInt *x[4], *y[4];
+    int on_curve;
+    Curve1174FieldElem4 xx, yy, xxyy;
+
+    all_valid = 1;
+    for (i = 0; i < n; i += 4)
+    {
+        // Out-of-range coordinates and the lanes beyond n are replaced by the
+        // neutral element (0, 1)
+        for (j = 0; j < 4; ++j) {
+            in_range[j] = i + j < n
+                && !p[i + j].x.sign && !p[i + j].y.sign
+                && big_int_compare(&(p[i + j].x), q) < 0
+                && big_int_compare(&(p[i + j].y), q) < 0;
+            x[j] = in_range[j] ? &(p[i + j].x) : big_int_zero;
+            y[j] = in_range[j] ? &(p[i + j].y) : big_int_one;
+        }
+
+        curve1174_fe4_pack(&xx, x[0], x[1], x[2], x[3]);
+        curve1174_fe4_pack(&yy, y[0], y[1], y[2], y[3]);
+
+        curve1174_fe4_mul(&xx, &xx, &xx);
+        curve1174_fe4_mul(&yy, &yy, &yy);
+        curve1174_fe4_mul(&xxyy, &xx, &yy);
+        curve1174_fe4_mul_d_abs(&xxyy, &xxyy);
+
+        // x^2 + y^2 - d x^2 y^2 = 1
+        curve1174_fe4_add(&xx, &xx, &yy);
+        curve1174_fe4_add(&xx, &xx, &xxyy);
+        on_curve = curve1174_fe4_eq_one(&xx);
+
+        for (j = 0; j < 4 && i + j < n; ++j) {
+            valid = in_range[j] && ((on_curve >> j) & 1);
+            if (ok)
+                ok[i + j] = valid;
+            all_valid &= valid;
+        }
+    }
+
+    return all_valid;
+}
@@ -0,0 +1,824 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This file implements scalar multiplication on Curve1174. The fixed-base
+ * multiplication [k]G writes k in signed radix 16 and uses the table of
+ * multiples of G from curve1174_base_table.h (generated by
+ * scripts/gen_base_table.py), such that [k]G costs 64 mixed additions and 4
+ * doublings. The variable-base multiplication [k]P uses a width-w NAF of k and
+ * a table of odd multiples of P that is normalized with a single inversion.
+ * Multi-scalar multiplications sum_i [k_i]P_i interleave the wNAFs of all
+ * scalars (Straus) for few points, and sort the points into buckets
+ * (Pippenger) for many points. Cofactor clearing and the subgroup check
+ * [l]P = O are built on the same 4-lane point operations.
+ */
+
+/*
+ * Includes
+ */
+// standard headers
+#include <stdlib.h>
+
+// header files
+#include "curve1174_scalar.h"
+#include "curve1174_base_table.h"
+#include "curve1174_point_4.h"
+#include "bigint_curve1174.h"
+#include "debug.h"
+
+/*
+ * Function prototypes (for internal use)
+ */
+int8_t *curve1174_scalar_recode_radix16(int8_t *e, BigInt *k);
+CurvePointPrecomp4 *curve1174_base_table_lookup(CurvePointPrecomp4 *r,
+    uint64_t row, int8_t e);
+uint64_t curve1174_scalar_get_bits(BigInt *k, uint64_t pos, uint64_t count);
+int64_t curve1174_scalar_wnaf(int8_t *wnaf, BigInt *k, uint64_t w);
+uint64_t curve1174_scalar_bit_length(BigInt *k);
+int8_t curve1174_point_is_in_subgroup_wnaf(CurvePoint *p, int8_t *wnaf,
+    int64_t nr_digits);
+
+/*
+ * Barrett context for the order l, with mu = floor(2^512 / l), such that
+ * scalars of up to 512 bits (e.g., hash outputs) are reduced without division
+ */
+static BigIntBarrettCtx curve1174_order_barrett = {
+    .q = {0x8944d45fd166c971, 0xf77965c4dfd30734,
+          0xffffffffffffffff, 0x01ffffffffffffff},
+    .mu = {0xcae80ba64da3c916, 0xa68ec80b3e32ddae, 0x0000000000000221,
+           0x0000000000000000, 0x0000000000000080},
+    .nr_limbs = 4,
+    .q_big = {
+        .sign = 0,
+        .overflow = 0,
+        .size = 8,
+        .chunks = {0xd166c971, 0x8944d45f, 0xdfd30734, 0xf77965c4,
+                   0xffffffff, 0xffffffff, 0xffffffff, 0x01ffffff},
+    },
+};
+
+/**
+ * \brief Set r to the base point G
+ *
+ * \assumption r != NULL
+ */
+CurvePoint *curve1174_base_point(CurvePoint *r)
+{
+    big_int_copy(&(r->x), curve1174_base_x);
+    big_int_copy(&(r->y), curve1174_base_y);
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r := k mod l, where l is the order of the base point
+ *
+ * \assumption r, k != NULL
+ * \returns r with 0 <= r < l
+ */
+BigInt *curve1174_scalar_reduce(BigInt *r, BigInt *k)
+{
+    return big_int_mod_barrett(r, k, &curve1174_order_barrett);
+}
+
+
+/**
+ * \brief Write k = sum_i e[i] * 16^i with e[i] in [-8, 8)
+ *
+ * \assumption e != NULL has space for CURVE1174_SCALAR_RADIX16_DIGITS digits
+ * \assumption 0 <= k < 2^251
+ */
+int8_t *curve1174_scalar_recode_radix16(int8_t *e, BigInt *k)
+{
+    int64_t i;
+    int8_t carry;
+
+    for (i = 0; i < CURVE1174_SCALAR_RADIX16_DIGITS; ++i) {
+        if (i / 8 < k->size)
+            e[i] = (k->chunks[i / 8] >> (4 * (i % 8))) & 0xf;
+        else
+            e[i] = 0;
+    }
+
+    // Shift digits from [0, 16) to [-8, 8) by carrying into the next digit
+    carry = 0;
+    for (i = 0; i < CURVE1174_SCALAR_RADIX16_DIGITS - 1; ++i) {
+        e[i] += carry;
+        carry = (e[i] + 8) >> 4;
+        e[i] -= carry << 4;
+    }
+    e[CURVE1174_SCALAR_RADIX16_DIGITS - 1] += carry;
+
+    return e;
+}
+
+
+/**
+ * \brief Set r := e * 256^row * G, read from the precomputed table
+ *
+ * All entries of the row are scanned and combined with masks, such that the
+ * memory access pattern does not depend on e. A negative digit selects the
+ * negated point, e = 0 the neutral element (1, 1, 0).
+ *
+ * \assumption r != NULL
+ * \assumption row < CURVE1174_BASE_TABLE_ROWS
+ * \assumption -CURVE1174_BASE_TABLE_COLS <= e <= CURVE1174_BASE_TABLE_COLS
+ */
+CurvePointPrecomp4 *curve1174_base_table_lookup(CurvePointPrecomp4 *r,
+    uint64_t row, int8_t e)
+{
+    const Curve1174BaseTableEntry *entry;
+    uint32_t y_plus_x[Q_CHUNKS], y_minus_x[Q_CHUNKS], t2d[Q_CHUNKS];
+    uint32_t mask, neg_mask, is_zero, tmp;
+    uint64_t diff, borrow;
+    int8_t sign_mask;
+    uint8_t e_abs;
+    int64_t j, k;
+
+    sign_mask = e >> 7;
+    e_abs = (e ^ sign_mask) - sign_mask;
+    neg_mask = (uint32_t) (int32_t) sign_mask;
+
+    // Neutral element for e = 0
+    is_zero = (((uint32_t) e_abs) - 1) >> 31;
+    for (k = 0; k < Q_CHUNKS; ++k) {
+        y_plus_x[k] = 0;
+        y_minus_x[k] = 0;
+        t2d[k] = 0;
+    }
+    y_plus_x[0] = is_zero;
+    y_minus_x[0] = is_zero;
+
+    for (j = 0; j < CURVE1174_BASE_TABLE_COLS; ++j) {
+        entry = &curve1174_base_table[row][j];
+        mask = -((((uint32_t) (e_abs ^ (j + 1))) - 1) >> 31);
+
+        for (k = 0; k < Q_CHUNKS; ++k) {
+            y_plus_x[k] |= entry->y_plus_x[k] & mask;
+            y_minus_x[k] |= entry->y_minus_x[k] & mask;
+            t2d[k] |= entry->t2d[k] & mask;
+        }
+    }
+
+    // -(x, y) = (-x, y): swap y + x and y - x, negate 2dxy
+    borrow = 0;
+    for (k = 0; k < Q_CHUNKS; ++k) {
+        tmp = (y_plus_x[k] ^ y_minus_x[k]) & neg_mask;
+        y_plus_x[k] ^= tmp;
+        y_minus_x[k] ^= tmp;
+
+        diff = q->chunks[k] - t2d[k] - borrow;
+        borrow = (diff >> 32) & 1;
+        t2d[k] ^= (t2d[k] ^ (uint32_t) diff) & neg_mask;
+    }
+
+    return curve1174_point_4_precomp_from_chunks(r, y_plus_x, y_minus_x, t2d);
+}
+
+
+/**
+ * \brief Calculate r := [k]G for the base point G
+ *
+ * With k = sum_i e[i] * 16^i, we accumulate the odd digits first, multiply
+ * them by 16 and then add the even digits:
+ *      [k]G = 16 * sum_i e[2i+1] 256^i G + sum_i e[2i] 256^i G
+ * Every term is read from the table. The additions and doublings use the
+ * 4-lane point representation.
+ *
+ * \assumption r, k != NULL
+ */
+CurvePointExt *curve1174_scalar_mul_base(CurvePointExt *r, BigInt *k)
+{
+    int8_t e[CURVE1174_SCALAR_RADIX16_DIGITS];
+    CurvePointPrecomp4 p;
+    CurvePointExt4 acc;
+    int64_t i;
+
+    BIG_INT_DEFINE_PTR(k_red);
+
+    curve1174_scalar_reduce(k_red, k);
+    curve1174_scalar_recode_radix16(e, k_red);
+
+    curve1174_point_4_set_neutral(&acc);
+    for (i = 1; i < CURVE1174_SCALAR_RADIX16_DIGITS; i += 2) {
+        curve1174_base_table_lookup(&p, i / 2, e[i]);
+        curve1174_point_4_add_mixed(&acc, &acc, &p);
+    }
+
+    curve1174_point_4_double(&acc, &acc);
+    curve1174_point_4_double(&acc, &acc);
+    curve1174_point_4_double(&acc, &acc);
+    curve1174_point_4_double(&acc, &acc);
+
+    for (i = 0; i < CURVE1174_SCALAR_RADIX16_DIGITS; i += 2) {
+        curve1174_base_table_lookup(&p, i / 2, e[i]);
+        curve1174_point_4_add_mixed(&acc, &acc, &p);
+    }
+
+    return curve1174_point_4_to_ext(r, &acc);
+}
+
+
+/**
+ * \brief Return count bits of |k| starting at bit position pos
+ *
+ * \assumption k != NULL
+ * \assumption 1 <= count <= 32
+ */
+uint64_t curve1174_scalar_get_bits(BigInt *k, uint64_t pos, uint64_t count)
+{
+    uint64_t idx, shift, bits;
+
+    idx = pos / BIGINT_CHUNK_BIT_SIZE;
+    shift = pos % BIGINT_CHUNK_BIT_SIZE;
+
+    bits = 0;
+    if (idx < k->size)
+        bits = k->chunks[idx] >> shift;
+    if (shift + count > BIGINT_CHUNK_BIT_SIZE && idx + 1 < k->size)
+        bits |= k->chunks[idx + 1] << (BIGINT_CHUNK_BIT_SIZE - shift);
+
+    return bits & ((1ULL << count) - 1);
+}
+
+
+/**
+ * \brief Compute the width-w NAF of |k|, i.e., k = sum_i wnaf[i] * 2^i where
+ *        every non-zero digit is odd with |wnaf[i]| < 2^(w-1) and among w
+ *        consecutive digits at most one is non-zero.
+ *
+ * \assumption wnaf != NULL has space for CURVE1174_SCALAR_MAX_BITS + 1 digits
+ * \assumption 2 <= w <= 8
+ * \returns the number of digits up to the most significant non-zero one
+ */
+int64_t curve1174_scalar_wnaf(int8_t *wnaf, BigInt *k, uint64_t w)
+{
+    uint64_t len, bit, now, carry;
+    int64_t word, nr_digits;
+
+    len = k->size * BIGINT_CHUNK_BIT_SIZE;
+    for (bit = 0; bit <= len; ++bit)
+        wnaf[bit] = 0;
+
+    carry = 0;
+    nr_digits = 0;
+    bit = 0;
+    while (bit < len) {
+        // Even (current bit + carry): the digit is 0, carry stays the same
+        if (curve1174_scalar_get_bits(k, bit, 1) == carry) {
+            bit++;
+            continue;
+        }
+
+        now = w;
+        if (now > len - bit)
+            now = len - bit;
+
+        word = curve1174_scalar_get_bits(k, bit, now) + carry;
+        carry = (word >> (w - 1)) & 1;
+        word -= carry << w;
+
+        wnaf[bit] = word;
+        nr_digits = bit + 1;
+        bit += now;
+    }
+
+    if (carry) {
+        wnaf[len] = 1;
+        nr_digits = len + 1;
+    }
+
+    return nr_digits;
+}
+
+
+/**
+ * \brief Compute the table of odd multiples P, 3P, ..., (2^(w-1) - 1)P and
+ *        their negations for curve1174_scalar_mul_table
+ *
+ * The odd multiples are normalized together, such that all additions in the
+ * main loop of the scalar multiplication are mixed additions.
+ *
+ * \assumption r, p != NULL
+ * \assumption p is a point on the curve
+ */
+CurvePointWnafTable *curve1174_scalar_wnaf_table(CurvePointWnafTable *r,
+    CurvePoint *p)
+{
+    CurvePointExt odd[CURVE1174_SCALAR_WNAF_TABLE_SIZE];
+    CurvePointExt4 odd4, p2;
+    CurvePointPrecomp pre[CURVE1174_SCALAR_WNAF_TABLE_SIZE], pre_neg;
+    int64_t i;
+
+    // odd[i] = (2i + 1) P
+    curve1174_point_from_affine(odd, p);
+    curve1174_point_4_from_ext(&odd4, odd);
+    curve1174_point_4_double(&p2, &odd4);
+    for (i = 1; i < CURVE1174_SCALAR_WNAF_TABLE_SIZE; ++i) {
+        curve1174_point_4_add(&odd4, &odd4, &p2);
+        curve1174_point_4_to_ext(odd + i, &odd4);
+    }
+
+    curve1174_point_precompute_batch(pre, odd, CURVE1174_SCALAR_WNAF_TABLE_SIZE);
+    for (i = 0; i < CURVE1174_SCALAR_WNAF_TABLE_SIZE; ++i) {
+        curve1174_point_precomp_neg(&pre_neg, pre + i);
+        curve1174_point_4_from_precomp(r->pos + i, pre + i);
+        curve1174_point_4_from_precomp(r->neg + i, &pre_neg);
+    }
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r := [k]P, where t is the table of P computed by
+ *        curve1174_scalar_wnaf_table
+ *
+ * Uses a width-CURVE1174_SCALAR_WNAF_WINDOW NAF, the main loop works on the
+ * 4-lane point representation. k is not reduced mod l, since P may have a
+ * component of small order.
+ * NOTE: this is not constant time, the sequence of operations depends on k.
+ *
+ * \assumption r, k, t != NULL
+ * \assumption |k| < 2^CURVE1174_SCALAR_MAX_BITS
+ */
+CurvePointExt *curve1174_scalar_mul_table(CurvePointExt *r, BigInt *k,
+    CurvePointWnafTable *t)
+{
+    CurvePointExt4 acc;
+    int8_t wnaf[CURVE1174_SCALAR_MAX_BITS + 1];
+    int64_t i, nr_digits;
+    int8_t d;
+
+    BIG_INT_DEFINE_PTR(k_abs);
+
+    big_int_copy(k_abs, k);
+    k_abs->sign = 0;
+
+    nr_digits = curve1174_scalar_wnaf(wnaf, k_abs, CURVE1174_SCALAR_WNAF_WINDOW);
+
+    curve1174_point_4_set_neutral(&acc);
+    for (i = nr_digits - 1; i >= 0; --i) {
+        if (i < nr_digits - 1)
+            curve1174_point_4_double(&acc, &acc);
+
+        d = wnaf[i];
+        if (d > 0)
+            curve1174_point_4_add_mixed(&acc, &acc, t->pos + d / 2);
+        else if (d < 0)
+            curve1174_point_4_add_mixed(&acc, &acc, t->neg + (-d) / 2);
+    }
+    curve1174_point_4_to_ext(r, &acc);
+
+    if (k->sign)
+        curve1174_point_neg(r, r);
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r := [k]P
+ *
+ * \assumption r, k, p != NULL
+ * \assumption |k| < 2^CURVE1174_SCALAR_MAX_BITS
+ * \assumption p is a point on the curve
+ */
+CurvePointExt *curve1174_scalar_mul(CurvePointExt *r, BigInt *k,
+    CurvePoint *p)
+{
+    CurvePointWnafTable t;
+
+    curve1174_scalar_wnaf_table(&t, p);
+    return curve1174_scalar_mul_table(r, k, &t);
+}
+
+
+/**
+ * \brief Return the number of bits of |k|
+ *
+ * \assumption k != NULL
+ */
+uint64_t curve1174_scalar_bit_length(BigInt *k)
+{
+    int64_t i;
+
+    for (i = k->size - 1; i >= 0; --i)
+        if (k->chunks[i])
+            return i * BIGINT_CHUNK_BIT_SIZE + 64 - __builtin_clzll(k->chunks[i]);
+
+    return 0;
+}
+
+
+/**
+ * \brief Calculate r := sum_i [k_i]P_i
+ *
+ * Uses Straus' method for fewer than CURVE1174_MSM_PIPPENGER_THRESHOLD points
+ * and Pippenger's method otherwise. The scalars are not reduced mod l.
+ * NOTE: this is not constant time.
+ *
+ * \assumption r, k, p != NULL
+ * \assumption |k[i]| < 2^CURVE1174_SCALAR_MAX_BITS
+ * \assumption p[i] are points on the curve
+ */
+CurvePointExt *curve1174_msm(CurvePointExt *r, BigInt *k, CurvePoint *p,
+    uint64_t n)
+{
+    if (n < CURVE1174_MSM_PIPPENGER_THRESHOLD)
+        return curve1174_msm_straus(r, k, p, n);
+    return curve1174_msm_pippenger(r, k, p, n);
+}
+
+
+/**
+ * \brief Calculate r := sum_i [k_i]P_i with Straus' method
+ *
+ * Every point gets a table of odd multiples as in curve1174_scalar_mul, all
+ * tables are normalized with one batched inversion. The main loop shares the
+ * doublings between all points and adds the wNAF digits of all scalars.
+ *
+ * \assumption see curve1174_msm
+ */
+CurvePointExt *curve1174_msm_straus(CurvePointExt *r, BigInt *k,
+    CurvePoint *p, uint64_t n)
+{
+    CurvePointExt *odd;
+    CurvePointExt4 odd4, p2, acc;
+    CurvePointPrecomp *pre, pre_neg;
+    CurvePointPrecomp4 *pre4, *pre4_neg, *tbl;
+    int8_t *wnaf;
+    int64_t i, j, nr_digits, max_digits;
+    int8_t d;
+
+    if (!n)
+        return curve1174_point_set_neutral(r);
+
+    odd = (CurvePointExt *) malloc(n * CURVE1174_SCALAR_WNAF_TABLE_SIZE
+        * sizeof(CurvePointExt));
+    pre = (CurvePointPrecomp *) malloc(n * CURVE1174_SCALAR_WNAF_TABLE_SIZE
+        * sizeof(CurvePointPrecomp));
+    pre4 = (CurvePointPrecomp4 *) aligned_alloc(32, 2 * n
+        * CURVE1174_SCALAR_WNAF_TABLE_SIZE * sizeof(CurvePointPrecomp4));
+    wnaf = (int8_t *) calloc(n, CURVE1174_SCALAR_MAX_BITS + 1);
+    if (!odd || !pre || !pre4 || !wnaf)
+        FATAL("Failed to allocate MSM tables\n");
+    pre4_neg = pre4 + n * CURVE1174_SCALAR_WNAF_TABLE_SIZE;
+
+    // odd[i * size + j] = (2j + 1) P_i
+    for (i = 0; i < n; ++i) {
+        curve1174_point_from_affine(odd + i * CURVE1174_SCALAR_WNAF_TABLE_SIZE,
+            p + i);
+        curve1174_point_4_from_ext(&odd4,
+            odd + i * CURVE1174_SCALAR_WNAF_TABLE_SIZE);
+        curve1174_point_4_double(&p2, &odd4);
+        for (j = 1; j < CURVE1174_SCALAR_WNAF_TABLE_SIZE; ++j) {
+            curve1174_point_4_add(&odd4, &odd4, &p2);
+            curve1174_point_4_to_ext(odd + i * CURVE1174_SCALAR_WNAF_TABLE_SIZE
+                + j, &odd4);
+        }
+    }
+
+    curve1174_point_precompute_batch(pre, odd,
+        n * CURVE1174_SCALAR_WNAF_TABLE_SIZE);
+
+    // A negative scalar swaps the table of the point with its negation
+    for (i = 0; i < n; ++i) {
+        for (j = 0; j < CURVE1174_SCALAR_WNAF_TABLE_SIZE; ++j) {
+            tbl = (k[i].sign) ? pre4_neg : pre4;
+            curve1174_point_precomp_neg(&pre_neg,
+                pre + i * CURVE1174_SCALAR_WNAF_TABLE_SIZE + j);
+            curve1174_point_4_from_precomp(
+                tbl + i * CURVE1174_SCALAR_WNAF_TABLE_SIZE + j,
+                pre + i * CURVE1174_SCALAR_WNAF_TABLE_SIZE + j);
+
+            tbl = (k[i].sign) ? pre4 : pre4_neg;
+            curve1174_point_4_from_precomp(
+                tbl + i * CURVE1174_SCALAR_WNAF_TABLE_SIZE + j, &pre_neg);
+        }
+    }
+
+    max_digits = 0;
+    for (i = 0; i < n; ++i) {
+        nr_digits = curve1174_scalar_wnaf(wnaf + i * (CURVE1174_SCALAR_MAX_BITS + 1),
+            k + i, CURVE1174_SCALAR_WNAF_WINDOW);
+        if (nr_digits > max_digits)
+            max_digits = nr_digits;
+    }
+
+    curve1174_point_4_set_neutral(&acc);
+    for (j = max_digits - 1; j >= 0; --j) {
+        if (j < max_digits - 1)
+            curve1174_point_4_double(&acc, &acc);
+
+        for (i = 0; i < n; ++i) {
+            d = wnaf[i * (CURVE1174_SCALAR_MAX_BITS + 1) + j];
+            if (d > 0)
+                curve1174_point_4_add_mixed(&acc, &acc,
+                    pre4 + i * CURVE1174_SCALAR_WNAF_TABLE_SIZE + d / 2);
+            else if (d < 0)
+                curve1174_point_4_add_mixed(&acc, &acc,
+                    pre4_neg + i * CURVE1174_SCALAR_WNAF_TABLE_SIZE + (-d) / 2);
+        }
+    }
+    curve1174_point_4_to_ext(r, &acc);
+
+    free(odd);
+    free(pre);
+    free(pre4);
+    free(wnaf);
+
+    return r;
+}
+
+
+/**
+ * \brief Return the bucket window c in [1, CURVE1174_MSM_MAX_WINDOW] that
+ *        minimizes the number of additions of Pippenger's method, i.e.,
+ *        (bits / c + 1) * (n + 2^c) for n points and bits-bit scalars.
+ */
+uint64_t curve1174_msm_pippenger_window(uint64_t n, uint64_t bits)
+{
+    uint64_t c, best_c, cost, best_cost;
+
+    best_c = 1;
+    best_cost = UINT64_MAX;
+    for (c = 1; c <= CURVE1174_MSM_MAX_WINDOW; ++c) {
+        cost = (bits / c + 1) * (n + (1ULL << c));
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_c = c;
+        }
+    }
+
+    return best_c;
+}
+
+
+/**
+ * \brief Calculate r := sum_i [k_i]P_i with Pippenger's bucket method
+ *
+ * The scalars are written in signed radix 2^c with digits in
+ * (-2^(c-1), 2^(c-1)], where c is chosen by curve1174_msm_pippenger_window.
+ * For every window, the points are added to the bucket of their digit (or
+ * subtracted for negative digits), and the buckets are combined with the
+ * running sum sum_b b * B_b = sum_b sum_{b' >= b} B_b'.
+ *
+ * \assumption see curve1174_msm
+ */
+CurvePointExt *curve1174_msm_pippenger(CurvePointExt *r, BigInt *k,
+    CurvePoint *p, uint64_t n)
+{
+    CurvePointPrecomp pre;
+    CurvePointPrecomp4 *pre4, neg;
+    CurvePointExt4 *buckets, acc, sum, win;
+    int32_t *digits, d;
+    uint64_t i, c, bits, nr_windows, nr_buckets, carry, val;
+    int64_t w, b;
+
+    bits = 0;
+    for (i = 0; i < n; ++i) {
+        val = curve1174_scalar_bit_length(k + i);
+        if (val > bits)
+            bits = val;
+    }
+
+    if (!bits)
+        return curve1174_point_set_neutral(r);
+
+    c = curve1174_msm_pippenger_window(n, bits);
+    nr_windows = bits / c + 1;
+    nr_buckets = 1ULL << (c - 1);
+
+    pre4 = (CurvePointPrecomp4 *) aligned_alloc(32,
+        n * sizeof(CurvePointPrecomp4));
+    buckets = (CurvePointExt4 *) aligned_alloc(32,
+        nr_buckets * sizeof(CurvePointExt4));
+    digits = (int32_t *) malloc(n * nr_windows * sizeof(int32_t));
+    if (!pre4 || !buckets || !digits)
+        FATAL("Failed to allocate MSM buckets\n");
+
+    for (i = 0; i < n; ++i) {
+        curve1174_point_precompute(&pre, p + i);
+        curve1174_point_4_from_precomp(pre4 + i, &pre);
+        if (k[i].sign)
+            curve1174_point_4_precomp_neg(pre4 + i, pre4 + i);
+
+        carry = 0;
+        for (w = 0; w < nr_windows; ++w) {
+            val = curve1174_scalar_get_bits(k + i, w * c, c) + carry;
+            carry = val > nr_buckets;
+            digits[i * nr_windows + w] = (int32_t) val - (int32_t) (carry << c);
+        }
+    }
+
+    curve1174_point_4_set_neutral(&acc);
+    for (w = nr_windows - 1; w >= 0; --w) {
+        if (w < nr_windows - 1)
+            for (i = 0; i < c; ++i)
+                curve1174_point_4_double(&acc, &acc);
+
+        for (b = 0; b < nr_buckets; ++b)
+            curve1174_point_4_set_neutral(buckets + b);
+
+        for (i = 0; i < n; ++i) {
+            d = digits[i * nr_windows + w];
+            if (d > 0) {
+                curve1174_point_4_add_mixed(buckets + d - 1, buckets + d - 1,
+                    pre4 + i);
+            }
+            else if (d < 0) {
+                curve1174_point_4_precomp_neg(&neg, pre4 + i);
+                curve1174_point_4_add_mixed(buckets - d - 1, buckets - d - 1,
+                    &neg);
+            }
+        }
+
+        curve1174_point_4_set_neutral(&sum);
+        curve1174_point_4_set_neutral(&win);
+        for (b = nr_buckets - 1; b >= 0; --b) {
+            curve1174_point_4_add(&sum, &sum, buckets + b);
+            curve1174_point_4_add(&win, &win, &sum);
+        }
+
+        curve1174_point_4_add(&acc, &acc, &win);
+    }
+    curve1174_point_4_to_ext(r, &acc);
+
+    free(pre4);
+    free(buckets);
+    free(digits);
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r := sum_i [k_i]P_i, where P_i is the point that the
+ *        Elligator 1 string t_i maps to
+ *
+ * The strings are decoded with the batched Elligator 1 map.
+ *
+ * \assumption r, k, t != NULL
+ * \assumption t[i] are valid Elligator 1 strings, see
+ *             elligator_1_string_to_point
+ */
+CurvePointExt *curve1174_msm_str(CurvePointExt *r, BigInt *k, BigInt *t,
+    uint64_t n, Curve curve)
+{
+    CurvePoint *p;
+
+    if (!n)
+        return curve1174_point_set_neutral(r);
+
+    p = (CurvePoint *) malloc(n * sizeof(CurvePoint));
+    if (!p)
+        FATAL("Failed to allocate MSM points\n");
+
+    elligator_1_string_to_point_batch(p, t, n, curve);
+    curve1174_msm(r, k, p, n);
+
+    free(p);
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r := [4]a, which maps every point into the subgroup of
+ *        prime order l
+ *
+ * \assumption r, a != NULL (aliasing is fine)
+ */
+CurvePointExt *curve1174_clear_cofactor(CurvePointExt *r, CurvePointExt *a)
+{
+    CurvePointExt4 a4;
+
+    curve1174_point_4_from_ext(&a4, a);
+    curve1174_point_4_double(&a4, &a4);
+    curve1174_point_4_double(&a4, &a4);
+
+    return curve1174_point_4_to_ext(r, &a4);
+}
+
+
+/**
+ * \brief Check whether [l]p = (0, 1), where wnaf is the wNAF of l
+ *
+ * Curve1174 has no efficient endomorphism, so we compute [l]P with the wNAF
+ * of l. Unlike in curve1174_scalar_mul, the table of odd multiples is not
+ * normalized and the result is compared to the neutral element as
+ * X = 0, Y = Z, which avoids both inversions.
+ *
+ * \assumption p, wnaf != NULL
+ * \assumption p is a point on the curve
+ */
+int8_t curve1174_point_is_in_subgroup_wnaf(CurvePoint *p, int8_t *wnaf,
+    int64_t nr_digits)
+{
+    CurvePointExt4 tbl[CURVE1174_SCALAR_WNAF_TABLE_SIZE];
+    CurvePointExt4 tbl_neg[CURVE1174_SCALAR_WNAF_TABLE_SIZE];
+    CurvePointExt4 acc, p2;
+    CurvePointExt ext;
+    int64_t i;
+    int8_t d;
+
+    // tbl[i] = (2i + 1) P
+    curve1174_point_from_affine(&ext, p);
+    curve1174_point_4_from_ext(tbl, &ext);
+    curve1174_point_4_double(&p2, tbl);
+    curve1174_point_4_neg(tbl_neg, tbl);
+    for (i = 1; i < CURVE1174_SCALAR_WNAF_TABLE_SIZE; ++i) {
+        curve1174_point_4_add(tbl + i, tbl + i - 1, &p2);
+        curve1174_point_4_neg(tbl_neg + i, tbl + i);
+    }
+
+    curve1174_point_4_set_neutral(&acc);
+    for (i = nr_digits - 1; i >= 0; --i) {
+        if (i < nr_digits - 1)
+            curve1174_point_4_double(&acc, &acc);
+
+        d = wnaf[i];
+        if (d > 0)
+            curve1174_point_4_add(&acc, &acc, tbl + d / 2);
+        else if (d < 0)
+            curve1174_point_4_add(&acc, &acc, tbl_neg + (-d) / 2);
+    }
+
+    curve1174_point_4_to_ext(&ext, &acc);
+
+    return big_int_is_zero(&(ext.x)) && big_int_compare(&(ext.y), &(ext.z)) == 0;
+}
+
+
+/**
+ * \brief Check whether p is in the subgroup of prime order l, i.e., whether
+ *        [l]p = (0, 1)
+ *
+ * \assumption p != NULL
+ * \assumption p is a point on the curve
+ * \returns 1 if p is in the subgroup, 0 otherwise
+ */
+int8_t curve1174_point_is_in_subgroup(CurvePoint *p)
+{
+    int8_t wnaf[CURVE1174_SCALAR_MAX_BITS + 1];
+    int64_t nr_digits;
+
+    nr_digits = curve1174_scalar_wnaf(wnaf, curve1174_order,
+        CURVE1174_SCALAR_WNAF_WINDOW);
+
+    return curve1174_point_is_in_subgroup_wnaf(p, wnaf, nr_digits);
+}
+
+
+/**
+ * \brief Check which of the n points p are in the subgroup of prime order l
+ *
+ * The wNAF of l is computed once for all points.
+ *
+ * \assumption p != NULL
+ * \assumption p[i] are points on the curve
+ * \param ok if not NULL, ok[i] is set to 1 if point i is in the subgroup,
+ *        0 otherwise
+ * \returns 1 if all points are in the subgroup, 0 otherwise
+ */
+int8_t curve1174_point_is_in_subgroup_batch(CurvePoint *p, uint64_t n,
+    uint8_t *ok)
+{
+    int8_t wnaf[CURVE1174_SCALAR_MAX_BITS + 1];
+    int64_t nr_digits;
+    uint64_t i;
+    int8_t valid, all_valid;
+
+    nr_digits = curve1174_scalar_wnaf(wnaf, curve1174_order,
+        CURVE1174_SCALAR_WNAF_WINDOW);
+
+    all_valid = 1;
+    for (i = 0; i < n; ++i) {
+        valid = curve1174_point_is_in_subgroup_wnaf(p + i, wnaf, nr_digits);
+        if (ok)
+            ok[i] = valid;
+        all_valid &= valid;
+    }
+
+    return all_valid;
+}
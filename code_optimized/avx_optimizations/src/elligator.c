@@ -235,3 +235,665 @@ BigInt *elligator_1_point_to_string(BigInt *t, CurvePoint p, Curve curve)
 
     return t;
 }
+
+
+// === === === === === === === === === === === === === === === === === === ===
+
+/**
+ * \brief Reduce the denominator den modulo q and replace it by 1 if it is zero,
+ *        such that it does not zero all other inverses of a shared inversion.
+ *        The caller sets the inverse of a zero denominator to 0, which is what
+ *        the unbatched division returns.
+ *
+ * \returns 1 if den was zero modulo q, 0 otherwise
+ */
+static inline int8_t elligator_den_guard(BigInt *den)
+{
+    big_int_curve1174_mod(den);
+    if (!big_int_is_zero(den))
+        return 0;
+
+    big_int_create_from_chunk(den, 1, 0);
+    return 1;
+}
+
+/**
+ * \brief Batched version of elligator_1_string_to_point, i.e., computes
+ *        r[i] := elligator_1_string_to_point(t[i]) for all i in [0, n).
+ *
+ * The elements are processed in blocks of ELLIGATOR_BATCH_SIZE. Per block,
+ * the inversions of 1 + t and of the denominators of x and y are each shared
+ * using Montgomery's trick, so a block only needs two inversions instead of
+ * three per element. Denominators that are zero modulo q (e.g. 1 + t for
+ * t = q - 1) are excluded from the shared inversions, so they only affect
+ * their own element, which then matches elligator_1_string_to_point.
+ *
+ * \param t Integers in range [0, (q-1)/2]
+ * \param curve Curve satisfying the properties needed for Elligator one (e.g. Curve1174)
+ *
+ * \assumption r, t != NULL
+ */
+CurvePoint *elligator_1_string_to_point_batch(CurvePoint *r, BigInt *t,
+    uint64_t n, Curve curve)
+{
+    uint64_t i, k, m;
+    int8_t chiv, chi_2;
+    int8_t is_one[ELLIGATOR_BATCH_SIZE];
+    int8_t den_zero[2 * ELLIGATOR_BATCH_SIZE];
+
+    // den[2k] and den[2k+1] are the denominators of x and y of element k.
+    // The first half is used before for the denominators 1 + t.
+    BigInt den[2 * ELLIGATOR_BATCH_SIZE];
+    BigInt den_inv[2 * ELLIGATOR_BATCH_SIZE];
+    BigInt x_num[ELLIGATOR_BATCH_SIZE];
+    BigInt y_num[ELLIGATOR_BATCH_SIZE];
+
+    BigInt *X;
+    BigInt *Y;
+
+    BIG_INT_DEFINE_PTR(u);
+    BIG_INT_DEFINE_PTR(u_2);
+    BIG_INT_DEFINE_PTR(u_3);
+    BIG_INT_DEFINE_PTR(v);
+
+    BIG_INT_DEFINE_PTR(X_plus_1_squared);
+
+    BIG_INT_DEFINE_PTR(tmp_0);
+    BIG_INT_DEFINE_PTR(tmp_1);
+    BIG_INT_DEFINE_PTR(tmp_2);
+    BIG_INT_DEFINE_PTR(tmp_3);
+
+    for (i = 0; i < n; i += m)
+    {
+        m = (n - i < ELLIGATOR_BATCH_SIZE) ? n - i : ELLIGATOR_BATCH_SIZE;
+
+        // t = 1 is mapped to (0, 1) and must not spoil the shared inversion
+        for (k = 0; k < m; ++k)
+        {
+            is_one[k] = t[i+k].size == 1 && t[i+k].chunks[0] == 1;
+            if (is_one[k])
+                big_int_create_from_chunk(den + k, 1, 0);
+            else
+                big_int_add(den + k, big_int_one, t + i + k); // 1 + t
+            den_zero[k] = elligator_den_guard(den + k);
+        }
+
+        big_int_curve1174_inv_batch(den_inv, den, m);
+        for (k = 0; k < m; ++k)
+        {
+            if (den_zero[k])
+                big_int_create_from_chunk(den_inv + k, 0, 0);
+        }
+
+        for (k = 0; k < m; ++k)
+        {
+            if (is_one[k])
+            {
+                big_int_create_from_chunk(den + 2 * k, 1, 0);
+                big_int_create_from_chunk(den + 2 * k + 1, 1, 0);
+                continue;
+            }
+
+            big_int_sub(tmp_0, big_int_one, t + i + k);
+            big_int_curve1174_mul_mod(u, tmp_0, den_inv + k); // u = (1 − t) / (1 + t)
+
+            big_int_curve1174_square_mod(u_2, u);
+            big_int_curve1174_mul_mod(u_3, u_2, u); // u_3 = u^3
+            big_int_curve1174_mul_mod(tmp_1, u_3, u_2); // u_5 = u^5
+            big_int_curve1174_mul_mod(tmp_0, &(curve.r_squared_minus_two), u_3); // (r^2 − 2)*u^3
+
+            big_int_add(v, tmp_1, u); // u^5 + u
+            big_int_add(v, v, tmp_0); // v = u^5 + (r^2 − 2)*u^3 + u
+
+            chiv = big_int_curve1174_chi(v);
+
+            X = u;
+            X->sign = X->sign ^ chiv; ADD_STAT_COLLECTION(BASIC_BITWISE) // X = χ(v)u
+            v->sign = v->sign ^ chiv; ADD_STAT_COLLECTION(BASIC_BITWISE) // χ(v)v
+
+            big_int_curve1174_pow_q_p1_d4(tmp_3, v); // (χ(v)v)^((q + 1) / 4)
+            tmp_3->sign ^= chiv; ADD_STAT_COLLECTION(BASIC_BITWISE) // (χ(v)v)^((q + 1) / 4)χ(v)
+
+            big_int_add(tmp_2, u_2, &(curve.c_squared_inverse)); // u^2 + 1 / c^2
+            chi_2 = big_int_curve1174_chi(tmp_2); // χ(u^2 + 1 / c^2)
+
+            Y = tmp_3;
+            Y->sign = Y->sign ^ chi_2; ADD_STAT_COLLECTION(BASIC_BITWISE) // Y = (χ(v)v)^((q + 1) / 4)χ(v)χ(u^2 + 1 / c^2)
+            big_int_copy(den + 2 * k, Y);
+
+            big_int_add(tmp_0, big_int_one, X); // X+1
+            big_int_curve1174_square_mod(X_plus_1_squared, tmp_0); // (X+1)^2
+
+            big_int_curve1174_mul_mod(tmp_1, &(curve.c_minus_1_s), X); // (c - 1) * s * X
+            big_int_curve1174_mul_mod(x_num + k, tmp_1, tmp_0); // (c - 1) * s * X * (1+X)
+
+            big_int_curve1174_mul_mod(tmp_2, &(curve.r), X); // rX
+            big_int_sub(y_num + k, tmp_2, X_plus_1_squared); // rX - (1 + X)^2
+            big_int_add(den + 2 * k + 1, tmp_2, X_plus_1_squared); // rX + (1 + X)^2
+        }
+
+        for (k = 0; k < 2 * m; ++k)
+            den_zero[k] = elligator_den_guard(den + k);
+
+        big_int_curve1174_inv_batch(den_inv, den, 2 * m);
+        for (k = 0; k < 2 * m; ++k)
+        {
+            if (den_zero[k])
+                big_int_create_from_chunk(den_inv + k, 0, 0);
+        }
+
+        for (k = 0; k < m; ++k)
+        {
+            if (is_one[k])
+            {
+                big_int_create_from_chunk(&(r[i+k].x), 0, 0);
+                big_int_create_from_chunk(&(r[i+k].y), 1, 0);
+                continue;
+            }
+
+            // x = (c − 1) * s * X * (1 + X) / Y
+            big_int_curve1174_mul_mod(&(r[i+k].x), x_num + k, den_inv + 2 * k);
+            //  y = (rX − (1 + X)^2) / (rX + (1 + X)^2)
+            big_int_curve1174_mul_mod(&(r[i+k].y), y_num + k, den_inv + 2 * k + 1);
+        }
+    }
+
+    return r;
+}
+
+
+// === === === === === === === === === === === === === === === === === === ===
+
+/**
+ * \brief Batched version of elligator_1_point_to_string, i.e., computes
+ *        t[i] := elligator_1_point_to_string(p[i]) for all i in [0, n).
+ *
+ * The divisions for η and t are each shared across a block of
+ * ELLIGATOR_BATCH_SIZE points.
+ *
+ * Prerequisites:
+ *  - the given points are on the curve and in the image of the Elligator map
+ *
+ * \assumption t, p != NULL
+ */
+BigInt *elligator_1_point_to_string_batch(BigInt *t, CurvePoint *p,
+    uint64_t n, Curve curve)
+{
+    uint64_t i, k, m;
+    int8_t z;
+    int8_t is_neutral[ELLIGATOR_BATCH_SIZE];
+
+    BigInt den[ELLIGATOR_BATCH_SIZE];
+    BigInt den_inv[ELLIGATOR_BATCH_SIZE];
+    BigInt t_num[ELLIGATOR_BATCH_SIZE];
+
+    BigInt *u;
+
+    BIG_INT_DEFINE_PTR(X);
+
+    BIG_INT_DEFINE_PTR(tmp_0);
+    BIG_INT_DEFINE_PTR(tmp_1);
+    BIG_INT_DEFINE_PTR(tmp_2);
+
+    for (i = 0; i < n; i += m)
+    {
+        m = (n - i < ELLIGATOR_BATCH_SIZE) ? n - i : ELLIGATOR_BATCH_SIZE;
+
+        for (k = 0; k < m; ++k)
+        {
+            // Special case (x, y) = (0, 1) maps to 1
+            is_neutral[k] = p[i+k].x.size == 1 && p[i+k].y.size == 1
+                && p[i+k].x.chunks[0] == 0 && p[i+k].y.chunks[0] == 1;
+
+            big_int_add(tmp_1, &(p[i+k].y), big_int_one); // y + 1
+            big_int_sll_small(den + k, tmp_1, 1); // 2 * (y + 1)
+            big_int_curve1174_mod(den + k);
+
+            // Invalid inputs with y = -1 must not spoil the shared inversion
+            if (is_neutral[k] || big_int_is_zero(den + k))
+                big_int_create_from_chunk(den + k, 1, 0);
+        }
+
+        big_int_curve1174_inv_batch(den_inv, den, m);
+
+        for (k = 0; k < m; ++k)
+        {
+            if (is_neutral[k])
+            {
+                big_int_create_from_chunk(den + k, 1, 0);
+                continue;
+            }
+
+            big_int_sub(tmp_0, &(p[i+k].y), big_int_one); // y - 1
+            big_int_curve1174_mul_mod(tmp_1, tmp_0, den_inv + k); // η = (y-1)/(2 * (y + 1))
+
+            big_int_curve1174_mul_mod(tmp_0, tmp_1, &(curve.r)); // ηr
+            big_int_add(tmp_1, big_int_one, tmp_0); // 1 + ηr
+
+            big_int_curve1174_square_mod(tmp_2, tmp_1); // (1 + ηr)^2
+            big_int_sub(tmp_0, tmp_2, big_int_one); // (1 + η  * r)^2 - 1
+            big_int_curve1174_pow_q_p1_d4(tmp_2, tmp_0); // ((1 + ηr)^2 - 1)^((q + 1) / 4)
+
+            big_int_curve1174_sub_mod(X, tmp_2, tmp_1); // X = −(1 + ηr) + ((1 + ηr)^2 − 1)^((q + 1) / 4)
+
+            big_int_curve1174_mul_mod(tmp_0, &(curve.c_minus_1_s), X); // (c - 1)sX
+            big_int_add(tmp_1, big_int_one, X); // 1 + X
+            big_int_curve1174_mul_mod(tmp_2, tmp_0, tmp_1); // (c - 1)sX(1 + X)
+            big_int_curve1174_mul_mod(tmp_0, tmp_2, &(p[i+k].x)); // (c - 1)sX(1 + X)x
+            big_int_curve1174_square_mod(tmp_1, X); // X^2
+
+            big_int_add(tmp_2, tmp_1, &(curve.c_squared_inverse)); // X^2 + 1/c^2
+            big_int_curve1174_mul_mod(tmp_1, tmp_0, tmp_2); // (c - 1)sX(1 + X)x(X^2 + 1/c^2)
+
+            z = big_int_curve1174_chi(tmp_1); // z = χ((c - 1)sX(1 + X)x(X^2 + 1/c^2))
+
+            u = X;
+            u->sign = u->sign ^ z; ADD_STAT_COLLECTION(BASIC_BITWISE) // u = zX
+
+            big_int_sub(t_num + k, big_int_one, u); // 1 - u
+            big_int_add(den + k, big_int_one, u); // 1 + u
+            big_int_curve1174_mod(den + k);
+            if (big_int_is_zero(den + k))
+                big_int_create_from_chunk(den + k, 1, 0);
+        }
+
+        big_int_curve1174_inv_batch(den_inv, den, m);
+
+        for (k = 0; k < m; ++k)
+        {
+            if (is_neutral[k])
+            {
+                big_int_create_from_chunk(t + i + k, 1, 0);
+                continue;
+            }
+
+            big_int_curve1174_mul_mod(t + i + k, t_num + k, den_inv + k); // t = (1 − u)/(1 + u)
+
+            if (big_int_curve1174_gt_q_m1_d2(t + i + k))
+                big_int_sub(t + i + k, &(curve.q), t + i + k);
+        }
+    }
+
+    return t;
+}
+
+
+/**
+ * \brief Pack n points into the compact representation
+ *
+ * \assumption r, p != NULL
+ * \assumption 0 <= p[i].x, p[i].y < 2^256
+ */
+CurvePointPacked *curve_point_pack(CurvePointPacked *r, CurvePoint *p,
+    uint64_t n)
+{
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        big_int_pack(&(r[i].x), &(p[i].x), 1);
+        big_int_pack(&(r[i].y), &(p[i].y), 1);
+    }
+
+    return r;
+}
+
+/**
+ * \brief Unpack n points from the compact representation
+ *
+ * \assumption r, p != NULL
+ */
+CurvePoint *curve_point_unpack(CurvePoint *r, CurvePointPacked *p, uint64_t n)
+{
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        big_int_unpack(&(r[i].x), &(p[i].x), 1);
+        big_int_unpack(&(r[i].y), &(p[i].y), 1);
+    }
+
+    return r;
+}
+
+/**
+ * \brief Batched Elligator 1 string to point mapping on packed arrays. Only
+ *        one block of ELLIGATOR_BATCH_SIZE elements is unpacked at a time, so
+ *        the working set of large arrays shrinks by the packing ratio.
+ *
+ * \assumption r, t != NULL
+ * \assumption t[i] in [0, (q-1)/2]
+ */
+CurvePointPacked *elligator_1_string_to_point_batch_packed(CurvePointPacked *r,
+    BigInt256Packed *t, uint64_t n, Curve curve)
+{
+    uint64_t i, m;
+
+    BigInt t_loc[ELLIGATOR_BATCH_SIZE];
+    CurvePoint r_loc[ELLIGATOR_BATCH_SIZE];
+
+    for (i = 0; i < n; i += m)
+    {
+        m = (n - i < ELLIGATOR_BATCH_SIZE) ? n - i : ELLIGATOR_BATCH_SIZE;
+
+        big_int_unpack(t_loc, t + i, m);
+        elligator_1_string_to_point_batch(r_loc, t_loc, m, curve);
+        curve_point_pack(r + i, r_loc, m);
+    }
+
+    return r;
+}
+
+/**
+ * \brief Batched Elligator 1 point to string mapping on packed arrays
+ *
+ * \assumption t, p != NULL
+ * \assumption p[i] is in the image of the Elligator 1 map
+ */
+BigInt256Packed *elligator_1_point_to_string_batch_packed(BigInt256Packed *t,
+    CurvePointPacked *p, uint64_t n, Curve curve)
+{
+    uint64_t i, m;
+
+    BigInt t_loc[ELLIGATOR_BATCH_SIZE];
+    CurvePoint p_loc[ELLIGATOR_BATCH_SIZE];
+
+    for (i = 0; i < n; i += m)
+    {
+        m = (n - i < ELLIGATOR_BATCH_SIZE) ? n - i : ELLIGATOR_BATCH_SIZE;
+
+        curve_point_unpack(p_loc, p + i, m);
+        elligator_1_point_to_string_batch(t_loc, p_loc, m, curve);
+        big_int_pack(t + i, t_loc, m);
+    }
+
+    return t;
+}
+
+// === === === === === === === === === === === === === === === === === === ===
+//                            Elligator Squared
+//
+// Every point P is represented by two strings (u1, u2) with P = f(u1) + f(u2),
+// where f is the Elligator 1 map (Tibouchi, "Elligator Squared", 2014). For
+// encoding, u1 is drawn uniformly at random until P - f(u1) is in the image of
+// f. Since every image point except (0, 1) has exactly the two preimages ±t
+// and we only use the representative in [0, (q-1)/2], u2 is then unique and
+// the pair (u1, u2) is uniformly distributed.
+// === === === === === === === === === === === === === === === === === === ===
+
+/**
+ * \brief Draw a uniformly random string t in [0, (q-1)/2]
+ *
+ * \assumption r != NULL
+ */
+static BigInt *elligator_random_string(BigInt *r)
+{
+    do {
+        big_int_fill_random(r, 1, 250); // r < 2^250
+    } while (big_int_curve1174_gt_q_m1_d2(r)); // (q-1)/2 = 2^250 - 5
+
+    return r;
+}
+
+
+/**
+ * \brief Calculate r[i] := a[i * stride] + b[i * stride] (or the difference
+ *        if sub is set) on the Edwards curve x^2 + y^2 = 1 + d x^2 y^2, for
+ *        all i in [0, n).
+ *
+ * Uses the affine addition law, which is complete on Curve1174 since d is not
+ * a square, so a[i] = b[i] (doubling) is fine too. The 2n inversions are
+ * shared.
+ *
+ * \assumption r, a, b != NULL
+ * \assumption n <= ELLIGATOR_BATCH_SIZE
+ * \assumption r does not overlap with a or b (no aliasing)
+ */
+CurvePoint *curve_point_add_batch(CurvePoint *r, CurvePoint *a,
+    CurvePoint *b, uint64_t stride, uint64_t n, int8_t sub, Curve curve)
+{
+    uint64_t k;
+
+    BigInt den[2 * ELLIGATOR_BATCH_SIZE];
+    BigInt den_inv[2 * ELLIGATOR_BATCH_SIZE];
+
+    CurvePoint *p1, *p2;
+
+    BIG_INT_DEFINE_PTR(x1x2);
+    BIG_INT_DEFINE_PTR(y1y2);
+    BIG_INT_DEFINE_PTR(x1y2);
+    BIG_INT_DEFINE_PTR(y1x2);
+    BIG_INT_DEFINE_PTR(dxy);
+    BIG_INT_DEFINE_PTR(tmp);
+
+    for (k = 0; k < n; ++k)
+    {
+        p1 = a + k * stride;
+        p2 = b + k * stride;
+
+        big_int_curve1174_mul_mod_4(x1x2, y1y2, x1y2, y1x2,
+                                    &(p1->x), &(p1->y), &(p1->x), &(p1->y),
+                                    &(p2->x), &(p2->y), &(p2->y), &(p2->x));
+        big_int_curve1174_mul_mod(tmp, x1x2, y1y2);
+        big_int_curve1174_mul_mod(dxy, tmp, &(curve.d)); // d x1 x2 y1 y2
+
+        // Store numerators in r, the denominators are inverted together
+        if (sub)
+        {
+            // -(x2, y2) = (-x2, y2)
+            big_int_sub(&(r[k].x), x1y2, y1x2);
+            big_int_add(&(r[k].y), y1y2, x1x2);
+            big_int_sub(den + 2 * k, big_int_one, dxy);
+            big_int_add(den + 2 * k + 1, big_int_one, dxy);
+        }
+        else
+        {
+            big_int_add(&(r[k].x), x1y2, y1x2);
+            big_int_sub(&(r[k].y), y1y2, x1x2);
+            big_int_add(den + 2 * k, big_int_one, dxy);
+            big_int_sub(den + 2 * k + 1, big_int_one, dxy);
+        }
+    }
+
+    big_int_curve1174_inv_batch(den_inv, den, 2 * n);
+
+    for (k = 0; k < n; ++k)
+    {
+        big_int_curve1174_mul_mod(tmp, &(r[k].x), den_inv + 2 * k);
+        big_int_copy(&(r[k].x), tmp);
+        big_int_curve1174_mul_mod(tmp, &(r[k].y), den_inv + 2 * k + 1);
+        big_int_copy(&(r[k].y), tmp);
+    }
+
+    return r;
+}
+
+
+/**
+ * \brief Check whether the point p has a preimage under the Elligator 1 map.
+ *
+ * By Theorem 3 of the Elligator paper, this is the case iff y + 1 != 0 and
+ * (1 + ηr)^2 - 1 is a square, with η = (y - 1) / (2(y + 1)). We write
+ * 1 + ηr = N / D with D = 2(y + 1) and N = D + r(y - 1), such that no
+ * inversion is needed: (1 + ηr)^2 - 1 is a square iff
+ * N^2 - D^2 = r(y - 1) * (4(y + 1) + r(y - 1)) is one.
+ *
+ * The single point with ηr = -2 is rejected even though it can be in the
+ * image, which is harmless for Elligator Squared.
+ *
+ * \returns 1 if p is in the image, 0 otherwise
+ *
+ * \assumption p, curve != NULL
+ * \assumption p is on the curve with reduced coordinates
+ */
+int8_t elligator_1_is_in_image(CurvePoint *p, Curve *curve)
+{
+    BIG_INT_DEFINE_PTR(tmp_0);
+    BIG_INT_DEFINE_PTR(tmp_1);
+    BIG_INT_DEFINE_PTR(tmp_2);
+
+    // (0, 1) = f(1)
+    if (p->x.size == 1 && p->y.size == 1
+        && p->x.chunks[0] == 0 && p->y.chunks[0] == 1)
+        return 1;
+
+    // y + 1 == 0
+    big_int_add(tmp_0, &(p->y), big_int_one);
+    if (big_int_curve1174_compare_to_q(tmp_0) == 0)
+        return 0;
+
+    big_int_sll_small(tmp_1, tmp_0, 2); // 4(y + 1)
+    big_int_sub(tmp_0, &(p->y), big_int_one); // y - 1
+    big_int_curve1174_mul_mod(tmp_2, tmp_0, &(curve->r)); // r(y - 1)
+    big_int_add(tmp_0, tmp_1, tmp_2); // 4(y + 1) + r(y - 1)
+    big_int_curve1174_mul_mod(tmp_1, tmp_2, tmp_0);
+
+    // Only possible for ηr = -2 (y = 1 implies x = 0)
+    if (big_int_is_zero(tmp_1))
+        return 0;
+
+    return !big_int_curve1174_chi(tmp_1);
+}
+
+
+/**
+ * \brief Encode the points p[i] as pairs of strings
+ *        (u[2i], u[2i+1]) with p[i] = f(u[2i]) + f(u[2i+1]) for all
+ *        i in [0, n), where f is the Elligator 1 map.
+ *
+ * Both strings of a pair are uniformly random in [0, (q-1)/2] and every point
+ * is encodable. On average, about two candidates for u[2i] are needed. The
+ * candidates of all pending points of a block are mapped, subtracted and
+ * inverted together.
+ *
+ * \assumption u, p != NULL
+ * \assumption u has space for 2n BigInts
+ * \assumption p[i] is on the curve with reduced coordinates
+ */
+BigInt *elligator_squared_encode_batch(BigInt *u, CurvePoint *p, uint64_t n,
+    Curve curve)
+{
+    uint64_t i, j, k, m, nr_pending, nr_left, nr_accepted;
+
+    // Indices (relative to the block) of points without an encoding yet
+    uint64_t pending[ELLIGATOR_BATCH_SIZE];
+    uint64_t accepted[ELLIGATOR_BATCH_SIZE];
+
+    BigInt u1[ELLIGATOR_BATCH_SIZE];
+    BigInt u2[ELLIGATOR_BATCH_SIZE];
+    CurvePoint p_pending[ELLIGATOR_BATCH_SIZE];
+    CurvePoint f_u1[ELLIGATOR_BATCH_SIZE];
+    CurvePoint diff[ELLIGATOR_BATCH_SIZE];
+
+    for (i = 0; i < n; i += m)
+    {
+        m = (n - i < ELLIGATOR_BATCH_SIZE) ? n - i : ELLIGATOR_BATCH_SIZE;
+
+        for (k = 0; k < m; ++k)
+            pending[k] = k;
+        nr_pending = m;
+
+        while (nr_pending)
+        {
+            for (j = 0; j < nr_pending; ++j)
+            {
+                elligator_random_string(u1 + j);
+                p_pending[j] = p[i + pending[j]];
+            }
+
+            // diff = p - f(u1)
+            elligator_1_string_to_point_batch(f_u1, u1, nr_pending, curve);
+            curve_point_add_batch(diff, p_pending, f_u1, 1, nr_pending, 1,
+                curve);
+
+            // Keep the candidates for which diff has a preimage, retry the rest
+            nr_left = 0;
+            nr_accepted = 0;
+            for (j = 0; j < nr_pending; ++j)
+            {
+                if (elligator_1_is_in_image(diff + j, &curve))
+                {
+                    big_int_copy(u + 2 * (i + pending[j]), u1 + j);
+                    diff[nr_accepted] = diff[j];
+                    accepted[nr_accepted++] = pending[j];
+                }
+                else
+                {
+                    pending[nr_left++] = pending[j];
+                }
+            }
+
+            if (nr_accepted)
+                elligator_1_point_to_string_batch(u2, diff, nr_accepted, curve);
+
+            for (j = 0; j < nr_accepted; ++j)
+                big_int_copy(u + 2 * (i + accepted[j]) + 1, u2 + j);
+
+            nr_pending = nr_left;
+        }
+    }
+
+    return u;
+}
+
+
+/**
+ * \brief Decode the pairs of strings (u[2i], u[2i+1]) to the points
+ *        p[i] = f(u[2i]) + f(u[2i+1]) for all i in [0, n).
+ *
+ * All 2n strings go through the batched Elligator 1 map and the additions
+ * share their inversions.
+ *
+ * \assumption p, u != NULL
+ * \assumption u[i] in [0, (q-1)/2] for all i in [0, 2n)
+ */
+CurvePoint *elligator_squared_decode_batch(CurvePoint *p, BigInt *u,
+    uint64_t n, Curve curve)
+{
+    uint64_t i, m;
+
+    CurvePoint f_u[2 * ELLIGATOR_BATCH_SIZE];
+
+    for (i = 0; i < n; i += m)
+    {
+        m = (n - i < ELLIGATOR_BATCH_SIZE) ? n - i : ELLIGATOR_BATCH_SIZE;
+
+        elligator_1_string_to_point_batch(f_u, u + 2 * i, 2 * m, curve);
+        curve_point_add_batch(p + i, f_u, f_u + 1, 2, m, 0, curve);
+    }
+
+    return p;
+}
+
+
+/**
+ * \brief Encode the point p as two strings u1, u2 in [0, (q-1)/2] such that
+ *        p = f(u1) + f(u2).
+ *
+ * \assumption u1, u2 != NULL
+ * \assumption p is on the curve with reduced coordinates
+ */
+BigInt *elligator_squared_encode(BigInt *u1, BigInt *u2, CurvePoint p,
+    Curve curve)
+{
+    BigInt u[2];
+
+    elligator_squared_encode_batch(u, &p, 1, curve);
+    big_int_copy(u1, u);
+    big_int_copy(u2, u + 1);
+
+    return u1;
+}
+
+
+/**
+ * \brief Decode the strings u1, u2 to the point p = f(u1) + f(u2).
+ *
+ * \assumption p, u1, u2 != NULL
+ */
+CurvePoint *elligator_squared_decode(CurvePoint *p, BigInt *u1, BigInt *u2,
+    Curve curve)
+{
+    BigInt u[2];
+
+    big_int_copy(u, u1);
+    big_int_copy(u + 1, u2);
+
+    return elligator_squared_decode_batch(p, u, 1, curve);
+}
@@ -0,0 +1,580 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * Daemon serving Elligator 1 requests over a Unix domain socket (see
+ * elligator_service.h for the protocol). Requests of all clients are
+ * coalesced into one batch, which is mapped once
+ *  - it is full,
+ *  - every connected client waits for an answer, or
+ *  - the oldest request would otherwise miss the latency budget, based on
+ *    a moving average of the mapping cost per record.
+ */
+
+#define _GNU_SOURCE
+
+/*
+ * Includes
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// header files
+#include "elligator_service.h"
+
+/*
+ * Macros
+ */
+#define DAEMON_NAME "elligator1-daemon"
+
+#define DAEMON_MAX_CLIENTS 1024
+#define DAEMON_DEFAULT_BUDGET_US 1000
+#define DAEMON_DEFAULT_MAX_BATCH 256
+
+// Requests of a client are not read while this many bytes of its responses
+// are pending, so a client that does not read cannot grow its buffer
+#define DAEMON_MAX_BACKLOG (64 * ELLIGATOR_RECORD_POINT_SIZE)
+
+// Weight of the newest measurement in the moving average of the cost
+#define DAEMON_COST_EWMA_WEIGHT 0.2
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0  // SIGPIPE is ignored instead
+#endif
+
+#define DAEMON_DIE(fmt...)                          \
+    do {                                            \
+        fprintf(stderr, DAEMON_NAME ": " fmt);      \
+        exit(EXIT_FAILURE);                         \
+    } while (0)
+
+typedef struct DaemonClient
+{
+    int fd;                 // -1 if the slot is free
+    uint64_t gen;           // Incremented whenever the slot is reused
+    uint64_t nr_pending;    // Requests in the current batch
+    uint8_t in[ELLIGATOR_SERVICE_MAX_REQUEST_SIZE];
+    uint64_t in_len;
+    uint8_t *out;           // Responses not yet written
+    uint64_t out_off;
+    uint64_t out_len;
+    uint64_t out_cap;
+} DaemonClient;
+
+typedef struct DaemonRequest
+{
+    uint64_t client;
+    uint64_t gen;
+    uint8_t op;
+    uint64_t idx;           // Index in the input of its op
+} DaemonRequest;
+
+typedef struct Daemon
+{
+    int listen_fd;
+    DaemonClient clients[DAEMON_MAX_CLIENTS];
+    struct pollfd fds[DAEMON_MAX_CLIENTS + 1];
+    uint64_t nr_clients;
+
+    // Current batch
+    DaemonRequest *pending;
+    uint64_t nr_pending;
+    uint64_t nr_waiting_clients;
+    uint64_t oldest_ns;
+    uint8_t *in[2];
+    uint8_t *out[2];
+    uint64_t nr_in[2];      // Number of requests per op
+
+    ElligatorRecordCtx ctx;
+    uint64_t max_batch;
+    uint64_t budget_ns;
+    double cost_ns;         // Moving average of the cost per record
+
+    uint64_t nr_batches;
+    uint64_t nr_records;
+} Daemon;
+
+/*
+ * Function prototypes (for internal use)
+ */
+void daemon_usage(void);
+void daemon_on_signal(int sig);
+uint64_t daemon_now_ns(void);
+void daemon_close_client(Daemon *d, uint64_t c);
+void daemon_update_events(Daemon *d, uint64_t c);
+void daemon_write_client(Daemon *d, uint64_t c);
+void daemon_flush(Daemon *d);
+void daemon_add_request(Daemon *d, uint64_t c);
+void daemon_read_client(Daemon *d, uint64_t c);
+void daemon_accept(Daemon *d);
+int64_t daemon_timeout_ns(Daemon *d);
+
+/**
+ * Global variables
+ */
+static volatile sig_atomic_t daemon_stop = 0;
+
+void daemon_usage(void)
+{
+    fprintf(stderr,
+        "Usage: " DAEMON_NAME " [-s socket] [-l budget_us] [-b max_batch] "
+        "[-t threads]\n"
+        "\n"
+        "  -s  socket path (default " ELLIGATOR_SERVICE_DEFAULT_PATH ")\n"
+        "  -l  latency budget for batching in microseconds (default %d)\n"
+        "  -b  maximum number of requests per batch (default %d)\n"
+        "  -t  threads for mapping a batch, 0 for all online cores (default 1)\n",
+        DAEMON_DEFAULT_BUDGET_US, DAEMON_DEFAULT_MAX_BATCH);
+    exit(EXIT_FAILURE);
+}
+
+void daemon_on_signal(int sig)
+{
+    daemon_stop = 1;
+}
+
+uint64_t daemon_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * \brief Close the connection. Pending requests of the client are still
+ *        mapped, but their responses are dropped.
+ */
+void daemon_close_client(Daemon *d, uint64_t c)
+{
+    DaemonClient *client = d->clients + c;
+
+    close(client->fd);
+    client->fd = -1;
+    client->gen++;
+    client->in_len = 0;
+    client->out_off = client->out_len = 0;
+
+    if (client->nr_pending)
+        d->nr_waiting_clients--;
+    client->nr_pending = 0;
+
+    d->fds[c + 1].fd = -1;
+    d->nr_clients--;
+}
+
+/**
+ * \brief Poll for POLLOUT while responses are buffered and for POLLIN while
+ *        the backlog of the client is below DAEMON_MAX_BACKLOG
+ */
+void daemon_update_events(Daemon *d, uint64_t c)
+{
+    DaemonClient *client = d->clients + c;
+    uint64_t backlog;
+
+    // Pending requests count with the larger response size
+    backlog = client->out_len - client->out_off
+        + client->nr_pending * ELLIGATOR_RECORD_POINT_SIZE;
+
+    d->fds[c + 1].events = ((backlog < DAEMON_MAX_BACKLOG) ? POLLIN : 0)
+        | ((client->out_len) ? POLLOUT : 0);
+}
+
+/**
+ * \brief Write as much of the buffered responses as possible without
+ *        blocking and wait for POLLOUT if something is left.
+ */
+void daemon_write_client(Daemon *d, uint64_t c)
+{
+    DaemonClient *client = d->clients + c;
+    ssize_t ret;
+
+    while (client->out_off < client->out_len)
+    {
+        ret = send(client->fd, client->out + client->out_off,
+            client->out_len - client->out_off, MSG_NOSIGNAL);
+        if (ret < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            daemon_close_client(d, c);
+            return;
+        }
+        client->out_off += ret;
+    }
+
+    if (client->out_off == client->out_len)
+        client->out_off = client->out_len = 0;
+
+    daemon_update_events(d, c);
+}
+
+/**
+ * \brief Map all pending requests and queue the responses in request order
+ */
+void daemon_flush(Daemon *d)
+{
+    DaemonRequest *req;
+    DaemonClient *client;
+    uint64_t i, start, cost, out_size;
+
+    if (!d->nr_pending)
+        return;
+
+    start = daemon_now_ns();
+
+    if (d->nr_in[ELLIGATOR_SERVICE_OP_DECODE])
+        elligator_records_decode(d->out[ELLIGATOR_SERVICE_OP_DECODE],
+            d->in[ELLIGATOR_SERVICE_OP_DECODE],
+            d->nr_in[ELLIGATOR_SERVICE_OP_DECODE], &(d->ctx));
+    if (d->nr_in[ELLIGATOR_SERVICE_OP_ENCODE])
+        elligator_records_encode(d->out[ELLIGATOR_SERVICE_OP_ENCODE],
+            d->in[ELLIGATOR_SERVICE_OP_ENCODE],
+            d->nr_in[ELLIGATOR_SERVICE_OP_ENCODE], &(d->ctx));
+
+    cost = daemon_now_ns() - start;
+    d->cost_ns = (1 - DAEMON_COST_EWMA_WEIGHT) * d->cost_ns
+        + DAEMON_COST_EWMA_WEIGHT * ((double) cost / d->nr_pending);
+
+    for (i = 0; i < d->nr_pending; ++i)
+    {
+        req = d->pending + i;
+        client = d->clients + req->client;
+        if (client->fd < 0 || client->gen != req->gen)
+            continue;
+
+        out_size = ELLIGATOR_SERVICE_OUT_SIZE(req->op);
+        // Drop the responses that were already written before growing
+        if (client->out_len + out_size > client->out_cap && client->out_off) {
+            client->out_len -= client->out_off;
+            memmove(client->out, client->out + client->out_off,
+                client->out_len);
+            client->out_off = 0;
+        }
+        if (client->out_len + out_size > client->out_cap) {
+            client->out_cap = 2 * (client->out_len + out_size);
+            client->out = (uint8_t *) realloc(client->out, client->out_cap);
+            if (!client->out)
+                DAEMON_DIE("failed to allocate response buffer\n");
+        }
+
+        memcpy(client->out + client->out_len,
+            d->out[req->op] + req->idx * out_size, out_size);
+        client->out_len += out_size;
+        client->nr_pending = 0;
+    }
+
+    d->nr_batches++;
+    d->nr_records += d->nr_pending;
+    d->nr_pending = 0;
+    d->nr_waiting_clients = 0;
+    d->nr_in[0] = d->nr_in[1] = 0;
+
+    for (i = 0; i < DAEMON_MAX_CLIENTS; ++i)
+        if (d->clients[i].fd >= 0 && d->clients[i].out_len)
+            daemon_write_client(d, i);
+}
+
+/**
+ * \brief Add the complete request in the input buffer of the client to the
+ *        batch
+ */
+void daemon_add_request(Daemon *d, uint64_t c)
+{
+    DaemonClient *client = d->clients + c;
+    DaemonRequest *req;
+    uint64_t in_size;
+
+    if (!d->nr_pending)
+        d->oldest_ns = daemon_now_ns();
+
+    req = d->pending + d->nr_pending++;
+    req->client = c;
+    req->gen = client->gen;
+    req->op = client->in[0];
+    req->idx = d->nr_in[req->op]++;
+
+    in_size = ELLIGATOR_SERVICE_IN_SIZE(req->op);
+    memcpy(d->in[req->op] + req->idx * in_size, client->in + 1, in_size);
+    client->in_len = 0;
+
+    if (!client->nr_pending++)
+        d->nr_waiting_clients++;
+
+    if (d->nr_pending == d->max_batch)
+        daemon_flush(d);
+}
+
+void daemon_read_client(Daemon *d, uint64_t c)
+{
+    DaemonClient *client = d->clients + c;
+    uint8_t buf[64 * ELLIGATOR_SERVICE_MAX_REQUEST_SIZE];
+    uint64_t i, needed;
+    ssize_t ret;
+
+    ret = recv(client->fd, buf, sizeof(buf), 0);
+    if (ret < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK))
+        return;
+    if (ret <= 0) {
+        daemon_close_client(d, c);
+        return;
+    }
+
+    for (i = 0; i < ret; ++i)
+    {
+        client->in[client->in_len++] = buf[i];
+
+        if (client->in[0] != ELLIGATOR_SERVICE_OP_DECODE
+            && client->in[0] != ELLIGATOR_SERVICE_OP_ENCODE) {
+            daemon_close_client(d, c);
+            return;
+        }
+
+        needed = 1 + ELLIGATOR_SERVICE_IN_SIZE(client->in[0]);
+        if (client->in_len == needed) {
+            daemon_add_request(d, c);
+
+            // A full batch was flushed and writing the responses failed
+            if (client->fd < 0)
+                return;
+        }
+    }
+
+    daemon_update_events(d, c);
+}
+
+void daemon_accept(Daemon *d)
+{
+    DaemonClient *client;
+    uint64_t c;
+    int fd;
+
+    fd = accept(d->listen_fd, NULL, NULL);
+    if (fd < 0)
+        return;
+
+    for (c = 0; c < DAEMON_MAX_CLIENTS && d->clients[c].fd >= 0; ++c);
+    if (c == DAEMON_MAX_CLIENTS) {
+        close(fd);
+        return;
+    }
+
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    client = d->clients + c;
+    client->fd = fd;
+    client->in_len = 0;
+    client->nr_pending = 0;
+    client->out_off = client->out_len = 0;
+
+    d->fds[c + 1].fd = fd;
+    daemon_update_events(d, c);
+    d->nr_clients++;
+}
+
+/**
+ * \brief Time until the batch has to be mapped to meet the latency budget of
+ *        the oldest request, -1 if there is no pending request.
+ */
+int64_t daemon_timeout_ns(Daemon *d)
+{
+    int64_t deadline;
+
+    if (!d->nr_pending)
+        return -1;
+
+    deadline = d->oldest_ns + d->budget_ns
+        - (uint64_t) (d->cost_ns * d->nr_pending);
+    deadline -= daemon_now_ns();
+
+    return (deadline > 0) ? deadline : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    Daemon *d;
+    struct sockaddr_un addr;
+    struct sigaction sa;
+    const char *path;
+    uint64_t nr_threads, c, op;
+    int64_t timeout_ns;
+    int opt, ret;
+#ifdef __linux__
+    struct timespec timeout;
+#endif
+
+    path = ELLIGATOR_SERVICE_DEFAULT_PATH;
+    nr_threads = 1;
+
+    d = (Daemon *) calloc(1, sizeof(Daemon));
+    if (!d)
+        DAEMON_DIE("failed to allocate daemon state\n");
+
+    d->budget_ns = DAEMON_DEFAULT_BUDGET_US * 1000ULL;
+    d->max_batch = DAEMON_DEFAULT_MAX_BATCH;
+
+    while ((opt = getopt(argc, argv, "s:l:b:t:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 's':
+                path = optarg;
+                break;
+            case 'l':
+                d->budget_ns = strtoull(optarg, NULL, 10) * 1000ULL;
+                break;
+            case 'b':
+                d->max_batch = strtoull(optarg, NULL, 10);
+                break;
+            case 't':
+                nr_threads = strtoull(optarg, NULL, 10);
+                break;
+            default:
+                daemon_usage();
+        }
+    }
+
+    if (!d->max_batch || strlen(path) >= sizeof(addr.sun_path))
+        daemon_usage();
+
+    // Batch buffers
+    d->pending = (DaemonRequest *) malloc(d->max_batch * sizeof(DaemonRequest));
+    for (op = 0; op < 2; ++op)
+    {
+        d->in[op] = (uint8_t *) malloc(d->max_batch
+            * ELLIGATOR_SERVICE_IN_SIZE(op));
+        d->out[op] = (uint8_t *) malloc(d->max_batch
+            * ELLIGATOR_SERVICE_OUT_SIZE(op));
+        if (!d->in[op] || !d->out[op])
+            DAEMON_DIE("failed to allocate batch buffers\n");
+    }
+    if (!d->pending)
+        DAEMON_DIE("failed to allocate batch buffers\n");
+
+    elligator_records_init(&(d->ctx), d->max_batch, nr_threads);
+
+    // Listen on the socket
+    d->listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (d->listen_fd < 0)
+        DAEMON_DIE("socket failed: %s\n", strerror(errno));
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);
+
+    if (bind(d->listen_fd, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+        DAEMON_DIE("cannot bind to '%s': %s\n", path, strerror(errno));
+    if (listen(d->listen_fd, SOMAXCONN) < 0)
+        DAEMON_DIE("listen failed: %s\n", strerror(errno));
+    fcntl(d->listen_fd, F_SETFL, fcntl(d->listen_fd, F_GETFL) | O_NONBLOCK);
+
+    d->fds[0].fd = d->listen_fd;
+    d->fds[0].events = POLLIN;
+    for (c = 0; c < DAEMON_MAX_CLIENTS; ++c)
+    {
+        d->clients[c].fd = -1;
+        d->fds[c + 1].fd = -1;
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = daemon_on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    sa.sa_handler = SIG_IGN;
+    sigaction(SIGPIPE, &sa, NULL);
+
+    fprintf(stderr, DAEMON_NAME ": listening on '%s'\n", path);
+
+    while (!daemon_stop)
+    {
+        timeout_ns = daemon_timeout_ns(d);
+
+#ifdef __linux__
+        timeout.tv_sec = timeout_ns / 1000000000;
+        timeout.tv_nsec = timeout_ns % 1000000000;
+        ret = ppoll(d->fds, DAEMON_MAX_CLIENTS + 1,
+            (timeout_ns < 0) ? NULL : &timeout, NULL);
+#else
+        ret = poll(d->fds, DAEMON_MAX_CLIENTS + 1,
+            (timeout_ns < 0) ? -1 : (int) ((timeout_ns + 999999) / 1000000));
+#endif
+        if (ret < 0 && errno != EINTR)
+            DAEMON_DIE("poll failed: %s\n", strerror(errno));
+
+        if (ret > 0)
+        {
+            if (d->fds[0].revents & POLLIN)
+                daemon_accept(d);
+
+            for (c = 0; c < DAEMON_MAX_CLIENTS; ++c)
+            {
+                if (d->clients[c].fd < 0 || !d->fds[c + 1].revents)
+                    continue;
+
+                if (d->fds[c + 1].revents & POLLOUT)
+                    daemon_write_client(d, c);
+                if (d->clients[c].fd >= 0
+                    && d->fds[c + 1].revents & (POLLIN | POLLHUP | POLLERR))
+                    daemon_read_client(d, c);
+            }
+        }
+
+        // No more requests can be expected if all clients wait for answers
+        if (d->nr_pending && (d->nr_waiting_clients == d->nr_clients
+                || !daemon_timeout_ns(d)))
+            daemon_flush(d);
+    }
+
+    fprintf(stderr, DAEMON_NAME ": mapped %" PRIu64 " records in %" PRIu64
+        " batches (%.1f records/batch)\n", d->nr_records, d->nr_batches,
+        (d->nr_batches) ? (double) d->nr_records / d->nr_batches : 0.0);
+
+    for (c = 0; c < DAEMON_MAX_CLIENTS; ++c)
+    {
+        if (d->clients[c].fd >= 0)
+            close(d->clients[c].fd);
+        free(d->clients[c].out);
+    }
+    close(d->listen_fd);
+    unlink(path);
+
+    elligator_records_free(&(d->ctx));
+    for (op = 0; op < 2; ++op)
+    {
+        free(d->in[op]);
+        free(d->out[op]);
+    }
+    free(d->pending);
+    free(d);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,286 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * Load generator for the Elligator 1 daemon. Every connection runs in its
+ * own thread and sends closed-loop pairs of requests: decode a random string
+ * and encode the resulting point, which must give back the string. Reports
+ * the p50/p99 latency and the throughput.
+ */
+
+/*
+ * Includes
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// header files
+#include "elligator_service.h"
+
+/*
+ * Macros
+ */
+#define LOADGEN_NAME "elligator1-loadgen"
+
+#define LOADGEN_DEFAULT_CONNECTIONS 16
+#define LOADGEN_DEFAULT_REQUESTS 1000
+
+#define LOADGEN_DIE(fmt...)                         \
+    do {                                            \
+        fprintf(stderr, LOADGEN_NAME ": " fmt);     \
+        exit(EXIT_FAILURE);                         \
+    } while (0)
+
+typedef struct LoadgenThread
+{
+    pthread_t thread;
+    const char *path;
+    uint64_t id;
+    uint64_t nr_requests;   // Number of decode/encode pairs
+    uint64_t *latencies_ns; // 2 * nr_requests latencies
+    uint64_t nr_errors;
+} LoadgenThread;
+
+/*
+ * Function prototypes (for internal use)
+ */
+void loadgen_usage(void);
+uint64_t loadgen_now_ns(void);
+void loadgen_send_all(int fd, const uint8_t *buf, uint64_t len);
+void loadgen_recv_all(int fd, uint8_t *buf, uint64_t len);
+uint64_t loadgen_request(int fd, uint8_t op, const uint8_t *in, uint8_t *out);
+void *loadgen_thread_main(void *arg);
+int loadgen_cmp(const void *a, const void *b);
+
+void loadgen_usage(void)
+{
+    fprintf(stderr,
+        "Usage: " LOADGEN_NAME " [-s socket] [-c connections] [-n requests]\n"
+        "\n"
+        "  -s  socket path (default " ELLIGATOR_SERVICE_DEFAULT_PATH ")\n"
+        "  -c  number of concurrent connections (default %d)\n"
+        "  -n  decode/encode request pairs per connection (default %d)\n",
+        LOADGEN_DEFAULT_CONNECTIONS, LOADGEN_DEFAULT_REQUESTS);
+    exit(EXIT_FAILURE);
+}
+
+uint64_t loadgen_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+void loadgen_send_all(int fd, const uint8_t *buf, uint64_t len)
+{
+    ssize_t ret;
+
+    while (len)
+    {
+        ret = send(fd, buf, len, 0);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        if (ret <= 0)
+            LOADGEN_DIE("send failed: %s\n", strerror(errno));
+        buf += ret;
+        len -= ret;
+    }
+}
+
+void loadgen_recv_all(int fd, uint8_t *buf, uint64_t len)
+{
+    ssize_t ret;
+
+    while (len)
+    {
+        ret = recv(fd, buf, len, 0);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        if (ret <= 0)
+            LOADGEN_DIE("connection closed by the daemon\n");
+        buf += ret;
+        len -= ret;
+    }
+}
+
+/**
+ * \brief Send one request, wait for the response and return the latency
+ */
+uint64_t loadgen_request(int fd, uint8_t op, const uint8_t *in, uint8_t *out)
+{
+    uint8_t req[ELLIGATOR_SERVICE_MAX_REQUEST_SIZE];
+    uint64_t start;
+
+    req[0] = op;
+    memcpy(req + 1, in, ELLIGATOR_SERVICE_IN_SIZE(op));
+
+    start = loadgen_now_ns();
+    loadgen_send_all(fd, req, 1 + ELLIGATOR_SERVICE_IN_SIZE(op));
+    loadgen_recv_all(fd, out, ELLIGATOR_SERVICE_OUT_SIZE(op));
+
+    return loadgen_now_ns() - start;
+}
+
+void *loadgen_thread_main(void *arg)
+{
+    LoadgenThread *thread = (LoadgenThread *) arg;
+    struct sockaddr_un addr;
+    uint8_t str[ELLIGATOR_RECORD_STRING_SIZE];
+    uint8_t str_res[ELLIGATOR_RECORD_STRING_SIZE];
+    uint8_t point[ELLIGATOR_RECORD_POINT_SIZE];
+    uint64_t i, j, state;
+    int fd;
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        LOADGEN_DIE("socket failed: %s\n", strerror(errno));
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, thread->path, sizeof(addr.sun_path) - 1);
+
+    if (connect(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+        LOADGEN_DIE("cannot connect to '%s': %s\n", thread->path,
+            strerror(errno));
+
+    // xorshift64 state, distinct per thread
+    state = 0x9E3779B97F4A7C15ULL * (thread->id + 1);
+
+    for (i = 0; i < thread->nr_requests; ++i)
+    {
+        // Random string in [0, 2^248), i.e., below (q-1)/2
+        str[0] = 0;
+        for (j = 1; j < ELLIGATOR_RECORD_STRING_SIZE; ++j)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            str[j] = (uint8_t) state;
+        }
+
+        thread->latencies_ns[2 * i] = loadgen_request(fd,
+            ELLIGATOR_SERVICE_OP_DECODE, str, point);
+        thread->latencies_ns[2 * i + 1] = loadgen_request(fd,
+            ELLIGATOR_SERVICE_OP_ENCODE, point, str_res);
+
+        if (memcmp(str, str_res, ELLIGATOR_RECORD_STRING_SIZE))
+            thread->nr_errors++;
+    }
+
+    close(fd);
+    return NULL;
+}
+
+int loadgen_cmp(const void *a, const void *b)
+{
+    uint64_t x = *((const uint64_t *) a);
+    uint64_t y = *((const uint64_t *) b);
+
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char *argv[])
+{
+    LoadgenThread *threads;
+    uint64_t *latencies_ns;
+    const char *path;
+    uint64_t nr_connections, nr_requests, nr_total, nr_errors, i;
+    uint64_t start, elapsed;
+    int opt;
+
+    path = ELLIGATOR_SERVICE_DEFAULT_PATH;
+    nr_connections = LOADGEN_DEFAULT_CONNECTIONS;
+    nr_requests = LOADGEN_DEFAULT_REQUESTS;
+
+    while ((opt = getopt(argc, argv, "s:c:n:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 's':
+                path = optarg;
+                break;
+            case 'c':
+                nr_connections = strtoull(optarg, NULL, 10);
+                break;
+            case 'n':
+                nr_requests = strtoull(optarg, NULL, 10);
+                break;
+            default:
+                loadgen_usage();
+        }
+    }
+
+    if (!nr_connections || !nr_requests)
+        loadgen_usage();
+
+    nr_total = 2 * nr_connections * nr_requests;
+    threads = (LoadgenThread *) calloc(nr_connections, sizeof(LoadgenThread));
+    latencies_ns = (uint64_t *) malloc(nr_total * sizeof(uint64_t));
+    if (!threads || !latencies_ns)
+        LOADGEN_DIE("failed to allocate memory\n");
+
+    start = loadgen_now_ns();
+
+    for (i = 0; i < nr_connections; ++i)
+    {
+        threads[i].path = path;
+        threads[i].id = i;
+        threads[i].nr_requests = nr_requests;
+        threads[i].latencies_ns = latencies_ns + 2 * i * nr_requests;
+
+        if (pthread_create(&(threads[i].thread), NULL, loadgen_thread_main,
+                threads + i))
+            LOADGEN_DIE("failed to create thread\n");
+    }
+
+    nr_errors = 0;
+    for (i = 0; i < nr_connections; ++i)
+    {
+        pthread_join(threads[i].thread, NULL);
+        nr_errors += threads[i].nr_errors;
+    }
+
+    elapsed = loadgen_now_ns() - start;
+
+    qsort(latencies_ns, nr_total, sizeof(uint64_t), loadgen_cmp);
+
+    printf("requests:   %" PRIu64 " (%" PRIu64 " connections)\n", nr_total,
+        nr_connections);
+    printf("throughput: %.0f requests/s\n", nr_total / (elapsed * 1e-9));
+    printf("latency:    p50 %.1f us, p99 %.1f us, max %.1f us\n",
+        latencies_ns[nr_total / 2] * 1e-3,
+        latencies_ns[(nr_total * 99) / 100] * 1e-3,
+        latencies_ns[nr_total - 1] * 1e-3);
+    printf("errors:     %" PRIu64 "\n", nr_errors);
+
+    free(threads);
+    free(latencies_ns);
+
+    return (nr_errors) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
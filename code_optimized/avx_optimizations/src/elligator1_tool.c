@@ -0,0 +1,372 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * Command line tool to map files (or streams) of fixed-size records with
+ * Elligator 1. Regular input files are mmap'd, other inputs are read in
+ * blocks. Reading the next block and writing the previous one is done by a
+ * helper thread while the current block is mapped (double buffering).
+ */
+
+/*
+ * Includes
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// header files
+#include "elligator_records.h"
+
+/*
+ * Macros
+ */
+#define TOOL_NAME "elligator1-tool"
+
+// Records per block and thread, a few chunks per thread for work stealing
+#define TOOL_CHUNKS_PER_THREAD 4
+
+#define TOOL_DIE(fmt...)                        \
+    do {                                        \
+        fprintf(stderr, TOOL_NAME ": " fmt);    \
+        exit(EXIT_FAILURE);                     \
+    } while (0)
+
+/**
+ * \brief Input records, either mmap'd or read in blocks into two buffers
+ */
+typedef struct ToolReader
+{
+    int fd;
+    const uint8_t *map;     // NULL if the input is streamed
+    uint64_t map_len;
+    uint64_t pos;
+    uint64_t record_size;
+    uint64_t block_records;
+    uint8_t *buf[2];
+    const uint8_t *block[2];
+} ToolReader;
+
+/**
+ * \brief Sequential output through two block buffers, one is filled while
+ *        the other one is written.
+ */
+typedef struct ToolWriter
+{
+    int fd;
+    uint8_t *buf[2];
+    uint64_t len[2];
+} ToolWriter;
+
+/**
+ * \brief Work of the I/O helper thread for one block
+ */
+typedef struct ToolIoStep
+{
+    ToolReader *reader;
+    ToolWriter *writer;
+    uint64_t idx;           // Buffer index to write from and read into
+    uint64_t nr_records;    // Result: number of records read
+} ToolIoStep;
+
+/*
+ * Function prototypes (for internal use)
+ */
+void tool_usage(void);
+void tool_write_all(int fd, const uint8_t *buf, uint64_t len);
+uint64_t tool_read_block(ToolReader *reader, uint64_t idx);
+void tool_flush(ToolWriter *writer, uint64_t idx);
+void *tool_io_step(void *arg);
+
+void tool_usage(void)
+{
+    fprintf(stderr,
+        "Usage: " TOOL_NAME " [-t threads] [-q] decode|encode [input [output]]\n"
+        "\n"
+        "  decode  map 32-byte strings to 64-byte points (x || y)\n"
+        "  encode  map 64-byte points (x || y) to 32-byte strings\n"
+        "\n"
+        "All values are big-endian. Input and output default to stdin and\n"
+        "stdout, '-' selects them explicitly. Regular input files are mmap'd.\n"
+        "\n"
+        "  -t  number of threads, 0 for all online cores (default)\n"
+        "  -q  do not report the throughput on stderr\n");
+    exit(EXIT_FAILURE);
+}
+
+void tool_write_all(int fd, const uint8_t *buf, uint64_t len)
+{
+    ssize_t ret;
+
+    while (len)
+    {
+        ret = write(fd, buf, len);
+        if (ret < 0) {
+            if (errno == EINTR)
+                continue;
+            TOOL_DIE("write failed: %s\n", strerror(errno));
+        }
+        buf += ret;
+        len -= ret;
+    }
+}
+
+/**
+ * \brief Make the next block available in reader->block[idx]
+ *
+ * \return Number of records in the block, 0 at the end of the input
+ */
+uint64_t tool_read_block(ToolReader *reader, uint64_t idx)
+{
+    uint64_t block_len, len;
+    uintptr_t page_mask, page_start;
+    ssize_t ret;
+
+    block_len = reader->block_records * reader->record_size;
+
+    if (reader->map)
+    {
+        len = reader->map_len - reader->pos;
+        if (len > block_len)
+            len = block_len;
+
+        reader->block[idx] = reader->map + reader->pos;
+        reader->pos += len;
+
+        // Fault the pages in ahead of the mapping (page aligned start)
+        if (len) {
+            page_mask = sysconf(_SC_PAGESIZE) - 1;
+            page_start = (uintptr_t) reader->block[idx] & ~page_mask;
+            madvise((void *) page_start,
+                (uintptr_t) reader->block[idx] + len - page_start,
+                MADV_WILLNEED);
+        }
+
+        return len / reader->record_size;
+    }
+
+    len = 0;
+    while (len < block_len)
+    {
+        ret = read(reader->fd, reader->buf[idx] + len, block_len - len);
+        if (ret < 0) {
+            if (errno == EINTR)
+                continue;
+            TOOL_DIE("read failed: %s\n", strerror(errno));
+        }
+        if (!ret)
+            break;
+        len += ret;
+    }
+
+    if (len % reader->record_size)
+        TOOL_DIE("input ends with a truncated record\n");
+
+    reader->block[idx] = reader->buf[idx];
+    return len / reader->record_size;
+}
+
+void tool_flush(ToolWriter *writer, uint64_t idx)
+{
+    tool_write_all(writer->fd, writer->buf[idx], writer->len[idx]);
+    writer->len[idx] = 0;
+}
+
+void *tool_io_step(void *arg)
+{
+    ToolIoStep *step = (ToolIoStep *) arg;
+
+    tool_flush(step->writer, step->idx);
+    step->nr_records = tool_read_block(step->reader, step->idx);
+
+    return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    ElligatorRecordCtx ctx;
+    ToolReader reader;
+    ToolWriter writer;
+    ToolIoStep step;
+    pthread_t io_thread;
+    struct stat st;
+    struct timespec start, end;
+
+    uint8_t is_decode, quiet;
+    uint64_t nr_threads, out_record_size, chunk_size, nr_records, nr_total;
+    uint64_t cur;
+    double secs;
+    long nr_cores;
+    int opt;
+    void *map;
+
+    nr_threads = 0;
+    quiet = 0;
+
+    while ((opt = getopt(argc, argv, "t:qh")) != -1)
+    {
+        switch (opt)
+        {
+            case 't':
+                nr_threads = strtoull(optarg, NULL, 10);
+                break;
+            case 'q':
+                quiet = 1;
+                break;
+            default:
+                tool_usage();
+        }
+    }
+
+    if (optind >= argc || argc - optind > 3)
+        tool_usage();
+
+    if (!strcmp(argv[optind], "decode"))
+        is_decode = 1;
+    else if (!strcmp(argv[optind], "encode"))
+        is_decode = 0;
+    else
+        tool_usage();
+
+    if (!nr_threads) {
+        nr_cores = sysconf(_SC_NPROCESSORS_ONLN);
+        nr_threads = (nr_cores > 0) ? nr_cores : 1;
+    }
+
+    reader.record_size = (is_decode) ? ELLIGATOR_RECORD_STRING_SIZE
+        : ELLIGATOR_RECORD_POINT_SIZE;
+    out_record_size = (is_decode) ? ELLIGATOR_RECORD_POINT_SIZE
+        : ELLIGATOR_RECORD_STRING_SIZE;
+
+    chunk_size = elligator_pool_chunk_size(sizeof(BigInt) + sizeof(CurvePoint));
+    reader.block_records = TOOL_CHUNKS_PER_THREAD * nr_threads * chunk_size;
+
+    // Open input and output
+    reader.fd = STDIN_FILENO;
+    if (argc - optind > 1 && strcmp(argv[optind + 1], "-")) {
+        reader.fd = open(argv[optind + 1], O_RDONLY);
+        if (reader.fd < 0)
+            TOOL_DIE("cannot open '%s': %s\n", argv[optind + 1], strerror(errno));
+    }
+
+    writer.fd = STDOUT_FILENO;
+    if (argc - optind > 2 && strcmp(argv[optind + 2], "-")) {
+        writer.fd = open(argv[optind + 2], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (writer.fd < 0)
+            TOOL_DIE("cannot open '%s': %s\n", argv[optind + 2], strerror(errno));
+    }
+
+    reader.map = NULL;
+    reader.pos = 0;
+    if (!fstat(reader.fd, &st) && S_ISREG(st.st_mode) && st.st_size > 0)
+    {
+        if (st.st_size % reader.record_size)
+            TOOL_DIE("input size is not a multiple of %" PRIu64 " bytes\n",
+                reader.record_size);
+
+        map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, reader.fd, 0);
+        if (map == MAP_FAILED)
+            TOOL_DIE("mmap failed: %s\n", strerror(errno));
+        madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+        reader.map = (const uint8_t *) map;
+        reader.map_len = st.st_size;
+    }
+
+    for (cur = 0; cur < 2; ++cur)
+    {
+        reader.buf[cur] = NULL;
+        if (!reader.map)
+            reader.buf[cur] = (uint8_t *) malloc(reader.block_records
+                * reader.record_size);
+
+        writer.buf[cur] = (uint8_t *) malloc(reader.block_records
+            * out_record_size);
+        writer.len[cur] = 0;
+
+        if ((!reader.map && !reader.buf[cur]) || !writer.buf[cur])
+            TOOL_DIE("failed to allocate I/O buffers\n");
+    }
+
+    elligator_records_init(&ctx, reader.block_records, nr_threads);
+
+    // Map block cur while the helper writes block 1 - cur and reads the next
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    nr_total = 0;
+    cur = 0;
+    nr_records = tool_read_block(&reader, cur);
+
+    while (nr_records)
+    {
+        step.reader = &reader;
+        step.writer = &writer;
+        step.idx = 1 - cur;
+        if (pthread_create(&io_thread, NULL, tool_io_step, &step))
+            TOOL_DIE("failed to create I/O thread\n");
+
+        if (is_decode)
+            elligator_records_decode(writer.buf[cur], reader.block[cur],
+                nr_records, &ctx);
+        else
+            elligator_records_encode(writer.buf[cur], reader.block[cur],
+                nr_records, &ctx);
+        writer.len[cur] = nr_records * out_record_size;
+        nr_total += nr_records;
+
+        pthread_join(io_thread, NULL);
+        nr_records = step.nr_records;
+        cur = 1 - cur;
+    }
+    tool_flush(&writer, 1 - cur);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    if (!quiet)
+    {
+        secs = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+        fprintf(stderr, "%" PRIu64 " records in %.3f s (%.0f records/s, "
+            "%" PRIu64 " threads)\n", nr_total, secs,
+            (secs > 0) ? nr_total / secs : 0.0, nr_threads);
+    }
+
+    elligator_records_free(&ctx);
+    for (cur = 0; cur < 2; ++cur)
+    {
+        free(reader.buf[cur]);
+        free(writer.buf[cur]);
+    }
+    if (reader.map)
+        munmap((void *) reader.map, reader.map_len);
+
+    close(reader.fd);
+    if (close(writer.fd))
+        TOOL_DIE("close failed: %s\n", strerror(errno));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This file implements an ephemeral Diffie-Hellman key exchange over Curve1174
+ * where the public keys are sent as Elligator 1 strings. Key generation
+ * retries until [k]G is in the image of the map (about every second scalar),
+ * the shared secret is the peer's decoded point multiplied by the own secret.
+ */
+
+/*
+ * Includes
+ */
+// header files
+#include "elligator_dh.h"
+#include "bigint_curve1174.h"
+#include "curve1174_point.h"
+#include "curve1174_scalar.h"
+#include "debug.h"
+
+
+/**
+ * \brief Generate an ephemeral key pair with an Elligator 1 representable
+ *        public key
+ *
+ * The secret is 4 * k' for a uniformly random k' in [1, l). k' is drawn by
+ * rejection sampling of 249-bit integers from the ChaCha20 CSPRNG of the
+ * calling thread, which is keyed from the OS (getentropy).
+ *
+ * \assumption kp != NULL
+ */
+ElligatorDhKeypair *elligator1_dh_keypair(ElligatorDhKeypair *kp,
+    Curve curve)
+{
+    CurvePointExt pub_ext;
+    CurvePoint pub;
+    BigIntRng *prev = big_int_rng_use(big_int_rng_secure());
+
+    do {
+        do {
+            big_int_fill_random(&(kp->secret), 1, ELLIGATOR_DH_ORDER_BITS);
+        } while (big_int_is_zero(&(kp->secret))
+            || big_int_compare(&(kp->secret), curve1174_order) >= 0);
+        big_int_sll_small(&(kp->secret), &(kp->secret),
+            ELLIGATOR_DH_COFACTOR_SHIFT);
+
+        curve1174_scalar_mul_base(&pub_ext, &(kp->secret));
+        curve1174_point_to_affine(&pub, &pub_ext);
+    } while (!elligator_1_is_in_image(&pub, &curve));
+
+    big_int_rng_use(prev);
+    elligator_1_point_to_string(&(kp->public_str), pub, curve);
+
+    return kp;
+}
+
+
+/**
+ * \brief Calculate the shared point [secret]P, where P is the point encoded
+ *        by the peer's string peer_str
+ *
+ * \assumption shared, secret, peer_str != NULL
+ * \assumption secret was generated by elligator1_dh_keypair
+ * \returns 1 on success, 0 if peer_str is not a valid string or the shared
+ *          point is the neutral element (shared is then (0, 1))
+ */
+int8_t elligator1_dh_shared(CurvePoint *shared, BigInt *secret,
+    BigInt *peer_str, Curve curve)
+{
+    CurvePointExt shared_ext;
+    CurvePoint peer;
+
+    if (peer_str->sign || big_int_curve1174_gt_q_m1_d2(peer_str)) {
+        big_int_copy(&(shared->x), big_int_zero);
+        big_int_copy(&(shared->y), big_int_one);
+        return 0;
+    }
+
+    elligator_1_string_to_point(&peer, peer_str, curve);
+    curve1174_scalar_mul(&shared_ext, secret, &peer);
+    curve1174_point_to_affine(shared, &shared_ext);
+
+    return !big_int_is_zero(&(shared->x));
+}
+
+
+/**
+ * \brief Same as elligator1_dh_shared, but the decoded peer point and its
+ *        precomputation are taken from cache
+ *
+ * \assumption shared, secret, peer_str, cache != NULL
+ * \assumption secret was generated by elligator1_dh_keypair
+ * \returns see elligator1_dh_shared
+ */
+int8_t elligator1_dh_shared_cached(CurvePoint *shared, BigInt *secret,
+    BigInt *peer_str, Curve1174Cache *cache, Curve curve)
+{
+    CurvePointExt shared_ext;
+
+    if (peer_str->sign || big_int_curve1174_gt_q_m1_d2(peer_str)) {
+        big_int_copy(&(shared->x), big_int_zero);
+        big_int_copy(&(shared->y), big_int_one);
+        return 0;
+    }
+
+    curve1174_cache_scalar_mul(&shared_ext, cache, secret, peer_str, curve);
+    curve1174_point_to_affine(shared, &shared_ext);
+
+    return !big_int_is_zero(&(shared->x));
+}
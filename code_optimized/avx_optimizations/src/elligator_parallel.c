@@ -0,0 +1,423 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This file implements a work-stealing thread pool and parallel bulk versions
+ * of the batched Elligator mappings on top of it. The input is split into
+ * chunks that fit into L2, every worker starts on a contiguous range of
+ * chunks and idle workers steal half of the remaining chunks of others.
+ */
+
+/*
+ * Includes
+ */
+#include <stdlib.h>
+#include <unistd.h>
+
+// header files
+#include "elligator_parallel.h"
+#include "debug.h"
+
+/*
+ * Macros
+ */
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+// Minimum number of chunks per thread of a job, such that idle workers have
+// something to steal
+#define ELLIGATOR_POOL_CHUNKS_PER_THREAD 4
+
+/**
+ * \brief Arguments of the Elligator jobs
+ */
+typedef struct ElligatorParallelJob
+{
+    void *out;
+    void *in;
+    Curve *curve;
+} ElligatorParallelJob;
+
+/*
+ * Function prototypes (for internal use)
+ */
+uint8_t elligator_pool_take_chunk(ElligatorPool *pool,
+    ElligatorPoolWorker *self, uint64_t *chunk);
+void *elligator_pool_worker_main(void *arg);
+uint64_t elligator_pool_job_chunk_size(ElligatorPool *pool, uint64_t n,
+    uint64_t bytes_per_element);
+
+void elligator_1_string_to_point_job(void *arg, uint64_t start, uint64_t len,
+    uint8_t *scratch);
+void elligator_1_point_to_string_job(void *arg, uint64_t start, uint64_t len,
+    uint8_t *scratch);
+void elligator_squared_encode_job(void *arg, uint64_t start, uint64_t len,
+    uint8_t *scratch);
+void elligator_squared_decode_job(void *arg, uint64_t start, uint64_t len,
+    uint8_t *scratch);
+
+/**
+ * \brief Take the next chunk of the own range or, if that is empty, steal
+ *        the back half of the range of another worker.
+ *
+ * \return 1 if a chunk was found, 0 if there is no work left
+ */
+uint8_t elligator_pool_take_chunk(ElligatorPool *pool,
+    ElligatorPoolWorker *self, uint64_t *chunk)
+{
+    ElligatorPoolWorker *victim;
+    uint64_t k, nr_left, nr_stolen;
+
+    pthread_mutex_lock(&(self->lock));
+    if (self->head < self->tail) {
+        *chunk = self->head++;
+        pthread_mutex_unlock(&(self->lock));
+        return 1;
+    }
+    pthread_mutex_unlock(&(self->lock));
+
+    for (k = 1; k < pool->nr_threads; ++k)
+    {
+        victim = pool->workers + (self->id + k) % pool->nr_threads;
+
+        pthread_mutex_lock(&(victim->lock));
+        nr_left = victim->tail - victim->head;
+        if (!nr_left) {
+            pthread_mutex_unlock(&(victim->lock));
+            continue;
+        }
+
+        nr_stolen = (nr_left + 1) / 2;
+        victim->tail -= nr_stolen;
+        *chunk = victim->tail;
+        pthread_mutex_unlock(&(victim->lock));
+
+        // Keep the rest of the stolen range, such that others can steal it
+        pthread_mutex_lock(&(self->lock));
+        self->head = *chunk + 1;
+        self->tail = *chunk + nr_stolen;
+        pthread_mutex_unlock(&(self->lock));
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * \brief Main loop of the worker threads
+ */
+void *elligator_pool_worker_main(void *arg)
+{
+    ElligatorPoolWorker *self = (ElligatorPoolWorker *) arg;
+    ElligatorPool *pool = self->pool;
+    uint64_t generation, chunk, start;
+
+    generation = 0;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&(pool->lock));
+        while (pool->generation == generation && !pool->stop)
+            pthread_cond_wait(&(pool->work_cond), &(pool->lock));
+
+        if (pool->stop) {
+            pthread_mutex_unlock(&(pool->lock));
+            return NULL;
+        }
+        generation = pool->generation;
+        pthread_mutex_unlock(&(pool->lock));
+
+        while (elligator_pool_take_chunk(pool, self, &chunk))
+        {
+            start = chunk * pool->job_chunk_size;
+            pool->job_fn(pool->job_arg, start,
+                MIN(pool->job_chunk_size, pool->job_n - start), self->scratch);
+        }
+
+        pthread_mutex_lock(&(pool->lock));
+        if (--pool->nr_busy == 0)
+            pthread_cond_signal(&(pool->done_cond));
+        pthread_mutex_unlock(&(pool->lock));
+    }
+}
+
+/**
+ * \brief Create a pool with nr_threads worker threads, each with its own
+ *        scratch arena of ELLIGATOR_POOL_SCRATCH_SIZE bytes.
+ *
+ * \param nr_threads Number of workers, 0 to use all online cores
+ */
+ElligatorPool *elligator_pool_create(uint64_t nr_threads)
+{
+    ElligatorPool *pool;
+    ElligatorPoolWorker *worker;
+    long nr_cores;
+    uint64_t i;
+
+    if (!nr_threads) {
+        nr_cores = sysconf(_SC_NPROCESSORS_ONLN);
+        nr_threads = (nr_cores > 0) ? nr_cores : 1;
+    }
+
+    pool = (ElligatorPool *) malloc(sizeof(ElligatorPool));
+    if (!pool)
+        FATAL("Failed to allocate thread pool\n");
+
+    pool->workers = (ElligatorPoolWorker *) aligned_alloc(
+        ELLIGATOR_POOL_CACHE_LINE, nr_threads * sizeof(ElligatorPoolWorker));
+    if (!pool->workers)
+        FATAL("Failed to allocate thread pool\n");
+
+    pool->nr_threads = nr_threads;
+    pool->generation = 0;
+    pool->nr_busy = 0;
+    pool->stop = 0;
+
+    pthread_mutex_init(&(pool->lock), NULL);
+    pthread_cond_init(&(pool->work_cond), NULL);
+    pthread_cond_init(&(pool->done_cond), NULL);
+
+    for (i = 0; i < nr_threads; ++i)
+    {
+        worker = pool->workers + i;
+
+        pthread_mutex_init(&(worker->lock), NULL);
+        worker->head = worker->tail = 0;
+        worker->pool = pool;
+        worker->id = i;
+        worker->scratch = (uint8_t *) aligned_alloc(ELLIGATOR_POOL_CACHE_LINE,
+            ELLIGATOR_POOL_SCRATCH_SIZE);
+        if (!worker->scratch)
+            FATAL("Failed to allocate scratch arena\n");
+
+        if (pthread_create(&(worker->thread), NULL, elligator_pool_worker_main,
+                worker))
+            FATAL("Failed to create worker thread\n");
+    }
+
+    return pool;
+}
+
+/**
+ * \brief Stop all workers and free the pool
+ */
+void elligator_pool_destroy(ElligatorPool *pool)
+{
+    uint64_t i;
+
+    pthread_mutex_lock(&(pool->lock));
+    pool->stop = 1;
+    pthread_cond_broadcast(&(pool->work_cond));
+    pthread_mutex_unlock(&(pool->lock));
+
+    for (i = 0; i < pool->nr_threads; ++i)
+    {
+        pthread_join(pool->workers[i].thread, NULL);
+        pthread_mutex_destroy(&(pool->workers[i].lock));
+        free(pool->workers[i].scratch);
+    }
+
+    pthread_mutex_destroy(&(pool->lock));
+    pthread_cond_destroy(&(pool->work_cond));
+    pthread_cond_destroy(&(pool->done_cond));
+
+    free(pool->workers);
+    free(pool);
+}
+
+/**
+ * \brief Number of elements per chunk, such that the input and output of a
+ *        chunk fill at most half of L2. The rest is left for the temporaries
+ *        of the batched functions and the curve constants.
+ *
+ * \param bytes_per_element Input plus output bytes of one element
+ */
+uint64_t elligator_pool_chunk_size(uint64_t bytes_per_element)
+{
+    long l2_size = -1;
+    uint64_t chunk_size;
+
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    l2_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+    if (l2_size <= 0)
+        l2_size = ELLIGATOR_POOL_DEFAULT_L2_SIZE;
+
+    // Whole blocks only, such that no inversions are wasted
+    chunk_size = (l2_size / 2) / bytes_per_element;
+    chunk_size -= chunk_size % ELLIGATOR_BATCH_SIZE;
+
+    return (chunk_size) ? chunk_size : ELLIGATOR_BATCH_SIZE;
+}
+
+/**
+ * \brief Chunk size for a job of n elements on the pool: the L2 bound of
+ *        elligator_pool_chunk_size, but small enough that every thread gets
+ *        at least ELLIGATOR_POOL_CHUNKS_PER_THREAD chunks, rounded up to whole
+ *        blocks.
+ */
+uint64_t elligator_pool_job_chunk_size(ElligatorPool *pool, uint64_t n,
+    uint64_t bytes_per_element)
+{
+    uint64_t nr_chunks, chunk_size;
+
+    nr_chunks = ELLIGATOR_POOL_CHUNKS_PER_THREAD * pool->nr_threads;
+    chunk_size = (n + nr_chunks - 1) / nr_chunks;
+    chunk_size = (chunk_size + ELLIGATOR_BATCH_SIZE - 1)
+        / ELLIGATOR_BATCH_SIZE * ELLIGATOR_BATCH_SIZE;
+
+    return MIN(chunk_size, elligator_pool_chunk_size(bytes_per_element));
+}
+
+/**
+ * \brief Run job_fn on all elements [0, n) in chunks of chunk_size elements
+ *        and return once all chunks are done.
+ *
+ * \assumption pool is not used by multiple callers concurrently
+ */
+void elligator_pool_run(ElligatorPool *pool, ElligatorPoolJobFn job_fn,
+    void *arg, uint64_t n, uint64_t chunk_size)
+{
+    ElligatorPoolWorker *worker;
+    uint64_t i, nr_chunks;
+
+    if (!n)
+        return;
+
+    nr_chunks = (n + chunk_size - 1) / chunk_size;
+
+    pool->job_fn = job_fn;
+    pool->job_arg = arg;
+    pool->job_n = n;
+    pool->job_chunk_size = chunk_size;
+
+    // Start every worker on an equal, contiguous range of chunks
+    for (i = 0; i < pool->nr_threads; ++i)
+    {
+        worker = pool->workers + i;
+        pthread_mutex_lock(&(worker->lock));
+        worker->head = i * nr_chunks / pool->nr_threads;
+        worker->tail = (i + 1) * nr_chunks / pool->nr_threads;
+        pthread_mutex_unlock(&(worker->lock));
+    }
+
+    pthread_mutex_lock(&(pool->lock));
+    pool->nr_busy = pool->nr_threads;
+    pool->generation++;
+    pthread_cond_broadcast(&(pool->work_cond));
+
+    while (pool->nr_busy)
+        pthread_cond_wait(&(pool->done_cond), &(pool->lock));
+    pthread_mutex_unlock(&(pool->lock));
+}
+
+// === === === === === === === === === === === === === === === === === === ===
+
+void elligator_1_string_to_point_job(void *arg, uint64_t start, uint64_t len,
+    uint8_t *scratch)
+{
+    ElligatorParallelJob *job = (ElligatorParallelJob *) arg;
+    elligator_1_string_to_point_batch((CurvePoint *) job->out + start,
+        (BigInt *) job->in + start, len, *(job->curve));
+}
+
+void elligator_1_point_to_string_job(void *arg, uint64_t start, uint64_t len,
+    uint8_t *scratch)
+{
+    ElligatorParallelJob *job = (ElligatorParallelJob *) arg;
+    elligator_1_point_to_string_batch((BigInt *) job->out + start,
+        (CurvePoint *) job->in + start, len, *(job->curve));
+}
+
+void elligator_squared_encode_job(void *arg, uint64_t start, uint64_t len,
+    uint8_t *scratch)
+{
+    ElligatorParallelJob *job = (ElligatorParallelJob *) arg;
+    elligator_squared_encode_batch((BigInt *) job->out + 2 * start,
+        (CurvePoint *) job->in + start, len, *(job->curve));
+}
+
+void elligator_squared_decode_job(void *arg, uint64_t start, uint64_t len,
+    uint8_t *scratch)
+{
+    ElligatorParallelJob *job = (ElligatorParallelJob *) arg;
+    elligator_squared_decode_batch((CurvePoint *) job->out + start,
+        (BigInt *) job->in + 2 * start, len, *(job->curve));
+}
+
+/**
+ * \brief Parallel version of elligator_1_string_to_point_batch
+ */
+CurvePoint *elligator_1_string_to_point_parallel(CurvePoint *r, BigInt *t,
+    uint64_t n, Curve curve, ElligatorPool *pool)
+{
+    ElligatorParallelJob job = {.out = r, .in = t, .curve = &curve};
+
+    elligator_pool_run(pool, elligator_1_string_to_point_job, &job, n,
+        elligator_pool_job_chunk_size(pool, n,
+            sizeof(BigInt) + sizeof(CurvePoint)));
+    return r;
+}
+
+/**
+ * \brief Parallel version of elligator_1_point_to_string_batch
+ */
+BigInt *elligator_1_point_to_string_parallel(BigInt *t, CurvePoint *p,
+    uint64_t n, Curve curve, ElligatorPool *pool)
+{
+    ElligatorParallelJob job = {.out = t, .in = p, .curve = &curve};
+
+    elligator_pool_run(pool, elligator_1_point_to_string_job, &job, n,
+        elligator_pool_job_chunk_size(pool, n,
+            sizeof(BigInt) + sizeof(CurvePoint)));
+    return t;
+}
+
+/**
+ * \brief Parallel version of elligator_squared_encode_batch. Each worker
+ *        draws the random strings from the default generator of its own
+ *        thread, seeded independently from the OS, so the workers share no
+ *        RNG state. A generator selected with big_int_rng_use by the caller
+ *        is not used by the workers.
+ */
+BigInt *elligator_squared_encode_parallel(BigInt *u, CurvePoint *p,
+    uint64_t n, Curve curve, ElligatorPool *pool)
+{
+    ElligatorParallelJob job = {.out = u, .in = p, .curve = &curve};
+
+    elligator_pool_run(pool, elligator_squared_encode_job, &job, n,
+        elligator_pool_job_chunk_size(pool, n,
+            2 * sizeof(BigInt) + sizeof(CurvePoint)));
+    return u;
+}
+
+/**
+ * \brief Parallel version of elligator_squared_decode_batch
+ */
+CurvePoint *elligator_squared_decode_parallel(CurvePoint *p, BigInt *u,
+    uint64_t n, Curve curve, ElligatorPool *pool)
+{
+    ElligatorParallelJob job = {.out = p, .in = u, .curve = &curve};
+
+    elligator_pool_run(pool, elligator_squared_decode_job, &job, n,
+        elligator_pool_job_chunk_size(pool, n,
+            2 * sizeof(BigInt) + sizeof(CurvePoint)));
+    return p;
+}
@@ -0,0 +1,139 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This file maps arrays of serialized Elligator 1 records, i.e., 32-byte
+ * strings and 64-byte points, with the batched or parallel mappings.
+ */
+
+/*
+ * Includes
+ */
+#include <stdlib.h>
+
+// header files
+#include "elligator_records.h"
+#include "bigint_curve1174.h"
+#include "debug.h"
+
+/**
+ * \brief Allocate buffers for capacity records and a pool of nr_threads
+ *        threads (0 for all online cores).
+ *
+ * \assumption ctx != NULL, capacity > 0
+ */
+ElligatorRecordCtx *elligator_records_init(ElligatorRecordCtx *ctx,
+    uint64_t capacity, uint64_t nr_threads)
+{
+    init_curve1174(&(ctx->curve));
+
+    ctx->t = (BigInt *) malloc(capacity * sizeof(BigInt));
+    ctx->p = (CurvePoint *) malloc(capacity * sizeof(CurvePoint));
+    if (!ctx->t || !ctx->p)
+        FATAL("Failed to allocate record buffers\n");
+
+    ctx->capacity = capacity;
+    ctx->pool = (nr_threads == 1) ? NULL : elligator_pool_create(nr_threads);
+
+    return ctx;
+}
+
+void elligator_records_free(ElligatorRecordCtx *ctx)
+{
+    if (ctx->pool)
+        elligator_pool_destroy(ctx->pool);
+
+    free(ctx->t);
+    free(ctx->p);
+}
+
+/**
+ * \brief Map the n strings in to the points out. The strings are reduced
+ *        modulo q and mapped to [0, (q-1)/2] with t -> q - t, which is the
+ *        domain of the Elligator 1 map. Arbitrary input is thus safe, even
+ *        when the strings of different sources share a batch.
+ *
+ * \assumption n <= ctx->capacity
+ */
+uint8_t *elligator_records_decode(uint8_t *out, const uint8_t *in, uint64_t n,
+    ElligatorRecordCtx *ctx)
+{
+    uint64_t i;
+
+    for (i = 0; i < n; ++i)
+    {
+        big_int_create_from_bytes(ctx->t + i,
+            in + i * ELLIGATOR_RECORD_STRING_SIZE, ELLIGATOR_RECORD_STRING_SIZE);
+        big_int_curve1174_mod(ctx->t + i);
+
+        if (big_int_curve1174_gt_q_m1_d2(ctx->t + i))
+            big_int_sub(ctx->t + i, &(ctx->curve.q), ctx->t + i);
+    }
+
+    if (ctx->pool)
+        elligator_1_string_to_point_parallel(ctx->p, ctx->t, n, ctx->curve,
+            ctx->pool);
+    else
+        elligator_1_string_to_point_batch(ctx->p, ctx->t, n, ctx->curve);
+
+    for (i = 0; i < n; ++i)
+    {
+        big_int_to_bytes(out + i * ELLIGATOR_RECORD_POINT_SIZE,
+            &(ctx->p[i].x), ELLIGATOR_RECORD_STRING_SIZE);
+        big_int_to_bytes(out + i * ELLIGATOR_RECORD_POINT_SIZE
+            + ELLIGATOR_RECORD_STRING_SIZE, &(ctx->p[i].y),
+            ELLIGATOR_RECORD_STRING_SIZE);
+    }
+
+    return out;
+}
+
+/**
+ * \brief Map the n points in to the strings out.
+ *
+ * \assumption n <= ctx->capacity
+ * \assumption all points are in the image of the Elligator 1 map
+ */
+uint8_t *elligator_records_encode(uint8_t *out, const uint8_t *in, uint64_t n,
+    ElligatorRecordCtx *ctx)
+{
+    uint64_t i;
+
+    for (i = 0; i < n; ++i)
+    {
+        big_int_create_from_bytes(&(ctx->p[i].x),
+            in + i * ELLIGATOR_RECORD_POINT_SIZE, ELLIGATOR_RECORD_STRING_SIZE);
+        big_int_create_from_bytes(&(ctx->p[i].y),
+            in + i * ELLIGATOR_RECORD_POINT_SIZE + ELLIGATOR_RECORD_STRING_SIZE,
+            ELLIGATOR_RECORD_STRING_SIZE);
+    }
+
+    if (ctx->pool)
+        elligator_1_point_to_string_parallel(ctx->t, ctx->p, n, ctx->curve,
+            ctx->pool);
+    else
+        elligator_1_point_to_string_batch(ctx->t, ctx->p, n, ctx->curve);
+
+    for (i = 0; i < n; ++i)
+        big_int_to_bytes(out + i * ELLIGATOR_RECORD_STRING_SIZE, ctx->t + i,
+            ELLIGATOR_RECORD_STRING_SIZE);
+
+    return out;
+}
@@ -0,0 +1,290 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This file implements hashing of arbitrary messages to Curve1174 points,
+ * following the random oracle construction of RFC 9380 with Elligator 1 as
+ * the mapping: P = 4 * (f(u0) + f(u1)), where u0, u1 are obtained with
+ * expand_message_xmd using SHA-512.
+ */
+
+/*
+ * Includes
+ */
+#include <string.h>
+
+// header files
+#include "hash_to_curve.h"
+#include "bigint_curve1174.h"
+#include "debug.h"
+
+/*
+ * Macros
+ */
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+/*
+ * Function prototypes (for internal use)
+ */
+uint8_t *expand_message_xmd_finish(uint8_t *out, uint64_t out_len,
+    Sha512Ctx *ctx, const uint8_t *dst, uint64_t dst_len);
+BigInt *hash_to_curve_field_elements(BigInt *t, Sha512Ctx *ctx,
+    const uint8_t *dst, uint64_t dst_len, Curve *curve);
+
+/**
+ * Global variables
+ */
+static const uint8_t hash_to_curve_z_pad[SHA512_BLOCK_SIZE] = {0};
+
+/**
+ * \brief Finish expand_message_xmd for a context that has already absorbed
+ *        Z_pad || msg.
+ *
+ * \assumption out, ctx, dst != NULL
+ */
+uint8_t *expand_message_xmd_finish(uint8_t *out, uint64_t out_len,
+    Sha512Ctx *ctx, const uint8_t *dst, uint64_t dst_len)
+{
+    uint8_t b_0[SHA512_DIGEST_SIZE];
+    uint8_t b_i[SHA512_DIGEST_SIZE];
+    uint8_t l_i_b_str[3]; // I2OSP(len_in_bytes, 2) || I2OSP(0, 1)
+    uint8_t dst_len_byte, counter;
+    uint64_t ell, i, j;
+
+    ell = (out_len + SHA512_DIGEST_SIZE - 1) / SHA512_DIGEST_SIZE;
+    if (ell > 255 || out_len > 65535 || dst_len > HASH_TO_CURVE_MAX_DST_LEN) {
+        FATAL("expand_message_xmd: invalid output or DST length\n");
+    }
+
+    dst_len_byte = (uint8_t) dst_len;
+
+    // b_0 = H(Z_pad || msg || I2OSP(len_in_bytes, 2) || I2OSP(0, 1) || DST_prime)
+    l_i_b_str[0] = (uint8_t) (out_len >> 8);
+    l_i_b_str[1] = (uint8_t) out_len;
+    l_i_b_str[2] = 0;
+    sha512_update(ctx, l_i_b_str, 3);
+    sha512_update(ctx, dst, dst_len);
+    sha512_update(ctx, &dst_len_byte, 1);
+    sha512_final(b_0, ctx);
+
+    for (i = 1; i <= ell; ++i)
+    {
+        sha512_init(ctx);
+
+        // b_1 = H(b_0 || I2OSP(1, 1) || DST_prime)
+        // b_i = H(strxor(b_0, b_(i-1)) || I2OSP(i, 1) || DST_prime)
+        if (i > 1) {
+            for (j = 0; j < SHA512_DIGEST_SIZE; ++j)
+                b_i[j] ^= b_0[j];
+            sha512_update(ctx, b_i, SHA512_DIGEST_SIZE);
+        }
+        else {
+            sha512_update(ctx, b_0, SHA512_DIGEST_SIZE);
+        }
+
+        counter = (uint8_t) i;
+        sha512_update(ctx, &counter, 1);
+        sha512_update(ctx, dst, dst_len);
+        sha512_update(ctx, &dst_len_byte, 1);
+        sha512_final(b_i, ctx);
+
+        memcpy(out + (i - 1) * SHA512_DIGEST_SIZE, b_i,
+            MIN(SHA512_DIGEST_SIZE, out_len - (i - 1) * SHA512_DIGEST_SIZE));
+    }
+
+    return out;
+}
+
+/**
+ * \brief Calculate out := expand_message_xmd(msg, DST, out_len) with SHA-512
+ *        as specified in RFC 9380, section 5.3.1.
+ *
+ * \assumption out, dst != NULL
+ * \assumption msg != NULL or msg_len == 0
+ * \assumption out_len <= 255 * 64, dst_len <= 255
+ */
+uint8_t *expand_message_xmd(uint8_t *out, uint64_t out_len,
+    const uint8_t *msg, uint64_t msg_len, const uint8_t *dst, uint64_t dst_len)
+{
+    Sha512Ctx ctx;
+
+    sha512_init(&ctx);
+    sha512_update(&ctx, hash_to_curve_z_pad, SHA512_BLOCK_SIZE);
+    sha512_update(&ctx, msg, msg_len);
+
+    return expand_message_xmd_finish(out, out_len, &ctx, dst, dst_len);
+}
+
+/**
+ * \brief Calculate the two strings t[0], t[1] in [0, (q-1)/2] for the
+ *        message absorbed by ctx (hash_to_field in RFC 9380).
+ *
+ * Since the Elligator 1 map satisfies f(t) = f(-t), reducing the field
+ * elements to [0, (q-1)/2] does not change the resulting point.
+ *
+ * \assumption t, ctx, dst, curve != NULL
+ */
+BigInt *hash_to_curve_field_elements(BigInt *t, Sha512Ctx *ctx,
+    const uint8_t *dst, uint64_t dst_len, Curve *curve)
+{
+    uint8_t uniform_bytes[2 * HASH_TO_CURVE_L];
+    int i;
+
+    expand_message_xmd_finish(uniform_bytes, 2 * HASH_TO_CURVE_L, ctx, dst,
+        dst_len);
+
+    for (i = 0; i < 2; ++i)
+    {
+        big_int_create_from_bytes(t + i, uniform_bytes + i * HASH_TO_CURVE_L,
+            HASH_TO_CURVE_L);
+        big_int_curve1174_mod(t + i);
+
+        if (big_int_curve1174_gt_q_m1_d2(t + i))
+            big_int_sub(t + i, &(curve->q), t + i);
+    }
+
+    return t;
+}
+
+// === === === === === === === === === === === === === === === === === === ===
+
+/**
+ * \brief Start hashing a message to the curve. The DST is not copied and must
+ *        stay valid until hash_to_curve_final.
+ *
+ * \assumption ctx, dst != NULL
+ * \assumption dst_len <= HASH_TO_CURVE_MAX_DST_LEN
+ */
+HashToCurveCtx *hash_to_curve_init(HashToCurveCtx *ctx, const uint8_t *dst,
+    uint64_t dst_len)
+{
+    if (dst_len > HASH_TO_CURVE_MAX_DST_LEN) {
+        FATAL("hash_to_curve: DST must be at most %d bytes\n",
+            HASH_TO_CURVE_MAX_DST_LEN);
+    }
+
+    ctx->dst = dst;
+    ctx->dst_len = dst_len;
+
+    sha512_init(&(ctx->sha));
+    sha512_update(&(ctx->sha), hash_to_curve_z_pad, SHA512_BLOCK_SIZE);
+
+    return ctx;
+}
+
+/**
+ * \brief Absorb the next msg_len bytes of the message
+ *
+ * \assumption ctx != NULL
+ * \assumption msg != NULL or msg_len == 0
+ */
+HashToCurveCtx *hash_to_curve_update(HashToCurveCtx *ctx, const uint8_t *msg,
+    uint64_t msg_len)
+{
+    sha512_update(&(ctx->sha), msg, msg_len);
+    return ctx;
+}
+
+/**
+ * \brief Map the absorbed message to the point r = 4 * (f(u0) + f(u1)) in the
+ *        prime order subgroup.
+ *
+ * \assumption r, ctx != NULL
+ */
+CurvePoint *hash_to_curve_final(CurvePoint *r, HashToCurveCtx *ctx,
+    Curve curve)
+{
+    BigInt t[2];
+    CurvePoint f_t[2];
+    CurvePoint p, p_2;
+
+    hash_to_curve_field_elements(t, &(ctx->sha), ctx->dst, ctx->dst_len,
+        &curve);
+
+    elligator_1_string_to_point_batch(f_t, t, 2, curve);
+    curve_point_add_batch(&p, f_t, f_t + 1, 1, 1, 0, curve);
+
+    // Clear the cofactor 4 with two doublings
+    curve_point_add_batch(&p_2, &p, &p, 1, 1, 0, curve);
+    curve_point_add_batch(r, &p_2, &p_2, 1, 1, 0, curve);
+
+    return r;
+}
+
+/**
+ * \brief Hash the message msg to the point r on the curve
+ *
+ * \assumption r, dst != NULL
+ * \assumption msg != NULL or msg_len == 0
+ */
+CurvePoint *hash_to_curve(CurvePoint *r, const uint8_t *msg, uint64_t msg_len,
+    const uint8_t *dst, uint64_t dst_len, Curve curve)
+{
+    HashToCurveCtx ctx;
+
+    hash_to_curve_init(&ctx, dst, dst_len);
+    hash_to_curve_update(&ctx, msg, msg_len);
+    return hash_to_curve_final(r, &ctx, curve);
+}
+
+/**
+ * \brief Hash the messages msgs[i] of length msg_lens[i] to the points r[i]
+ *        for all i in [0, n).
+ *
+ * The hashing is done per message, but the Elligator maps, additions and
+ * doublings of a block of ELLIGATOR_BATCH_SIZE messages share their
+ * inversions.
+ *
+ * \assumption r, msgs, msg_lens, dst != NULL
+ */
+CurvePoint *hash_to_curve_batch(CurvePoint *r, const uint8_t **msgs,
+    const uint64_t *msg_lens, uint64_t n, const uint8_t *dst, uint64_t dst_len,
+    Curve curve)
+{
+    uint64_t i, k, m;
+
+    HashToCurveCtx ctx;
+    BigInt t[2 * ELLIGATOR_BATCH_SIZE];
+    CurvePoint f_t[2 * ELLIGATOR_BATCH_SIZE];
+    CurvePoint p[ELLIGATOR_BATCH_SIZE];
+    CurvePoint p_2[ELLIGATOR_BATCH_SIZE];
+
+    for (i = 0; i < n; i += m)
+    {
+        m = (n - i < ELLIGATOR_BATCH_SIZE) ? n - i : ELLIGATOR_BATCH_SIZE;
+
+        for (k = 0; k < m; ++k)
+        {
+            hash_to_curve_init(&ctx, dst, dst_len);
+            hash_to_curve_update(&ctx, msgs[i+k], msg_lens[i+k]);
+            hash_to_curve_field_elements(t + 2 * k, &(ctx.sha), dst, dst_len,
+                &curve);
+        }
+
+        elligator_1_string_to_point_batch(f_t, t, 2 * m, curve);
+        curve_point_add_batch(p, f_t, f_t + 1, 2, m, 0, curve);
+
+        // Clear the cofactor 4 with two doublings
+        curve_point_add_batch(p_2, p, p, 1, m, 0, curve);
+        curve_point_add_batch(r + i, p_2, p_2, 1, m, 0, curve);
+    }
+
+    return r;
+}
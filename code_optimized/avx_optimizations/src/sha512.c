@@ -0,0 +1,251 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This file implements SHA-512 (FIPS 180-4), such that hashing to the curve
+ * does not depend on an external crypto library.
+ */
+
+/*
+ * Includes
+ */
+#include <string.h>
+
+// header files
+#include "sha512.h"
+
+/*
+ * Macros
+ */
+#define ROTR64(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+
+#define SHA512_CH(x, y, z) (((x) & (y)) ^ (~(x) & (z)))
+#define SHA512_MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define SHA512_BSIG0(x) (ROTR64(x, 28) ^ ROTR64(x, 34) ^ ROTR64(x, 39))
+#define SHA512_BSIG1(x) (ROTR64(x, 14) ^ ROTR64(x, 18) ^ ROTR64(x, 41))
+#define SHA512_SSIG0(x) (ROTR64(x, 1) ^ ROTR64(x, 8) ^ ((x) >> 7))
+#define SHA512_SSIG1(x) (ROTR64(x, 19) ^ ROTR64(x, 61) ^ ((x) >> 6))
+
+/*
+ * Round constants: first 64 bits of the fractional parts of the cube roots of
+ * the first 80 primes
+ */
+static const uint64_t sha512_k[80] = {
+    0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc,
+    0x3956c25bf348b538, 0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
+    0xd807aa98a3030242, 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
+    0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235, 0xc19bf174cf692694,
+    0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+    0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
+    0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4,
+    0xc6e00bf33da88fc2, 0xd5a79147930aa725, 0x06ca6351e003826f, 0x142929670a0e6e70,
+    0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
+    0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
+    0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30,
+    0xd192e819d6ef5218, 0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8,
+    0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8,
+    0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3,
+    0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+    0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b,
+    0xca273eceea26619c, 0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178,
+    0x06f067aa72176fba, 0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b,
+    0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c,
+    0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817,
+};
+
+/*
+ * Function prototypes (for internal use)
+ */
+void sha512_compress(Sha512Ctx *ctx, const uint8_t *block);
+
+/**
+ * \brief Process one 128-byte block
+ *
+ * \assumption ctx, block != NULL
+ */
+void sha512_compress(Sha512Ctx *ctx, const uint8_t *block)
+{
+    uint64_t w[80];
+    uint64_t a, b, c, d, e, f, g, h, t1, t2;
+    int i, j;
+
+    for (i = 0; i < 16; ++i)
+    {
+        w[i] = 0;
+        for (j = 0; j < 8; ++j)
+            w[i] = (w[i] << 8) | block[8 * i + j];
+    }
+
+    for (i = 16; i < 80; ++i)
+        w[i] = SHA512_SSIG1(w[i-2]) + w[i-7] + SHA512_SSIG0(w[i-15]) + w[i-16];
+
+    a = ctx->state[0];
+    b = ctx->state[1];
+    c = ctx->state[2];
+    d = ctx->state[3];
+    e = ctx->state[4];
+    f = ctx->state[5];
+    g = ctx->state[6];
+    h = ctx->state[7];
+
+    for (i = 0; i < 80; ++i)
+    {
+        t1 = h + SHA512_BSIG1(e) + SHA512_CH(e, f, g) + sha512_k[i] + w[i];
+        t2 = SHA512_BSIG0(a) + SHA512_MAJ(a, b, c);
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    ctx->state[0] += a;
+    ctx->state[1] += b;
+    ctx->state[2] += c;
+    ctx->state[3] += d;
+    ctx->state[4] += e;
+    ctx->state[5] += f;
+    ctx->state[6] += g;
+    ctx->state[7] += h;
+}
+
+/**
+ * \brief Initialize a SHA-512 computation
+ *
+ * \assumption ctx != NULL
+ */
+Sha512Ctx *sha512_init(Sha512Ctx *ctx)
+{
+    ctx->state[0] = 0x6a09e667f3bcc908;
+    ctx->state[1] = 0xbb67ae8584caa73b;
+    ctx->state[2] = 0x3c6ef372fe94f82b;
+    ctx->state[3] = 0xa54ff53a5f1d36f1;
+    ctx->state[4] = 0x510e527fade682d1;
+    ctx->state[5] = 0x9b05688c2b3e6c1f;
+    ctx->state[6] = 0x1f83d9abfb41bd6b;
+    ctx->state[7] = 0x5be0cd19137e2179;
+
+    ctx->nr_bytes = 0;
+    ctx->buf_len = 0;
+
+    return ctx;
+}
+
+/**
+ * \brief Absorb len bytes of data
+ *
+ * \assumption ctx != NULL
+ * \assumption data != NULL or len == 0
+ */
+Sha512Ctx *sha512_update(Sha512Ctx *ctx, const uint8_t *data, uint64_t len)
+{
+    uint64_t nr_copied;
+
+    ctx->nr_bytes += len;
+
+    // Fill up a partial block first
+    if (ctx->buf_len)
+    {
+        nr_copied = SHA512_BLOCK_SIZE - ctx->buf_len;
+        if (nr_copied > len)
+            nr_copied = len;
+
+        memcpy(ctx->buf + ctx->buf_len, data, nr_copied);
+        ctx->buf_len += nr_copied;
+        data += nr_copied;
+        len -= nr_copied;
+
+        if (ctx->buf_len < SHA512_BLOCK_SIZE)
+            return ctx;
+
+        sha512_compress(ctx, ctx->buf);
+        ctx->buf_len = 0;
+    }
+
+    // Compress full blocks directly from the input
+    for (; len >= SHA512_BLOCK_SIZE; len -= SHA512_BLOCK_SIZE)
+    {
+        sha512_compress(ctx, data);
+        data += SHA512_BLOCK_SIZE;
+    }
+
+    if (len)
+        memcpy(ctx->buf, data, len);
+    ctx->buf_len = len;
+
+    return ctx;
+}
+
+/**
+ * \brief Pad the message and write the 64-byte digest. The context must be
+ *        re-initialized before it can be used again.
+ *
+ * \assumption digest, ctx != NULL
+ */
+uint8_t *sha512_final(uint8_t *digest, Sha512Ctx *ctx)
+{
+    uint64_t nr_bits;
+    int i, j;
+
+    // Messages are shorter than 2^64 bytes, so the upper 64 bits of the
+    // 128-bit length are only filled by the carry of the byte to bit shift.
+    nr_bits = ctx->nr_bytes << 3;
+
+    ctx->buf[ctx->buf_len++] = 0x80;
+
+    // Not enough space for the 16-byte length: pad a full extra block
+    if (ctx->buf_len > SHA512_BLOCK_SIZE - 16)
+    {
+        memset(ctx->buf + ctx->buf_len, 0, SHA512_BLOCK_SIZE - ctx->buf_len);
+        sha512_compress(ctx, ctx->buf);
+        ctx->buf_len = 0;
+    }
+
+    memset(ctx->buf + ctx->buf_len, 0, SHA512_BLOCK_SIZE - 8 - ctx->buf_len);
+    ctx->buf[SHA512_BLOCK_SIZE - 9] = (uint8_t) (ctx->nr_bytes >> 61);
+    for (i = 0; i < 8; ++i)
+        ctx->buf[SHA512_BLOCK_SIZE - 1 - i] = (uint8_t) (nr_bits >> (8 * i));
+
+    sha512_compress(ctx, ctx->buf);
+
+    for (i = 0; i < 8; ++i)
+        for (j = 0; j < 8; ++j)
+            digest[8 * i + j] = (uint8_t) (ctx->state[i] >> (56 - 8 * j));
+
+    return digest;
+}
+
+/**
+ * \brief Calculate digest := SHA-512(data)
+ *
+ * \assumption digest != NULL
+ * \assumption data != NULL or len == 0
+ */
+uint8_t *sha512(uint8_t *digest, const uint8_t *data, uint64_t len)
+{
+    Sha512Ctx ctx;
+
+    sha512_init(&ctx);
+    sha512_update(&ctx, data, len);
+    return sha512_final(digest, &ctx);
+}
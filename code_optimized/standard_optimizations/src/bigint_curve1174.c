@@ -618,7 +618,8 @@ BigInt *big_int_curve1174_pow(BigInt *r, BigInt *b, BigInt *e)
         ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
         e_chunk = e->chunks[i];
 
-        for (j = 0; j < BIGINT_CHUNK_BIT_SIZE; ++j)
+        // Every iteration consumes two bits of the chunk
+        for (j = 0; j < BIGINT_CHUNK_BIT_SIZE / 2; ++j)
         {
             ADD_STAT_COLLECTION(BASIC_ADD_OTHER)
             // If power is odd
@@ -911,8 +912,8 @@ int8_t big_int_curve1174_gt_q_m1_d2(BigInt *a)
     if (a->chunks[Q_CHUNKS - 1] > Q_M1_D2_CHUNK_7)
         return 1;
 
-    // Compare to lowest chunk of Q
-    if (a->chunks[0] <= Q_LSB_CHUNK)
+    // Compare to lowest chunk of (q - 1) / 2
+    if (a->chunks[0] <= Q_M1_D2_CHUNK_0)
         return 0;
 
     // Compare to intermediate chunks
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+
+################################################################################
+#
+# This file is part of the ASL project "Censorship-avoiding high-speed EC
+# (Elligator with Curve1174)"
+# (https://github.com/Miro-H/optimizing-elligator-1).
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+# Contact: miro.haller@alumni.ethz.ch
+#
+# Short description of this file:
+# This is a Python helper script that generates the header file with the
+# precomputed multiples of the Curve1174 base point used by the fixed-base
+# scalar multiplication.
+#
+################################################################################
+
+
+import argparse
+
+HEADER = \
+"""\
+/**
+ * This file is **autogenerated** by Python. Any manual changes to it will be
+ * OVERWRITTEN!
+ */
+
+"""
+
+Q = 2**251 - 9
+D = -1174 % Q
+
+# Base point of Curve1174 (order 2^249 - 11332719920821432534773113288178349711)
+G = (1582619097725911541954547006453739763381091388846394833492296309729998839514,
+     3037538013604154504764115728651437646519513534305223422754827055689195992590)
+
+NR_CHUNKS = 8
+CHUNK_BITS = 32
+
+
+def add(p1, p2):
+    x1, y1 = p1
+    x2, y2 = p2
+    t = D * x1 * x2 * y1 * y2 % Q
+    x3 = (x1 * y2 + y1 * x2) * pow(1 + t, Q - 2, Q) % Q
+    y3 = (y1 * y2 - x1 * x2) * pow(1 - t, Q - 2, Q) % Q
+    return (x3, y3)
+
+
+def precompute(p):
+    x, y = p
+    return ((y + x) % Q, (y - x) % Q, 2 * D * x * y % Q)
+
+
+def chunks(a):
+    mask = (1 << CHUNK_BITS) - 1
+    return ", ".join("0x{:08x}".format((a >> (CHUNK_BITS * i)) & mask)
+                     for i in range(NR_CHUNKS))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+
+    parser.add_argument("--dest_file", help="Destination file to write the table to",
+                        required=True)
+    parser.add_argument("--rows", help="Number of rows (radix 256 positions)",
+                        type=int, default=32)
+    parser.add_argument("--cols", help="Number of multiples per row",
+                        type=int, default=8)
+
+    args = parser.parse_args()
+
+    rows = args.rows
+    cols = args.cols
+
+    guard_macro = args.dest_file.split("/")[-1].split(".")[0].upper() + "_H_"
+
+    with open(args.dest_file, "w+") as tar_fp:
+        tar_fp.write(HEADER)
+        tar_fp.write(f"#ifndef {guard_macro}\n#define {guard_macro}\n\n")
+        tar_fp.write("#include <stdint.h>\n\n")
+
+        tar_fp.write(f"#define CURVE1174_BASE_TABLE_ROWS {rows}\n")
+        tar_fp.write(f"#define CURVE1174_BASE_TABLE_COLS {cols}\n\n")
+
+        tar_fp.write("typedef struct Curve1174BaseTableEntry\n{\n")
+        tar_fp.write(f"    uint32_t y_plus_x[{NR_CHUNKS}];\n")
+        tar_fp.write(f"    uint32_t y_minus_x[{NR_CHUNKS}];\n")
+        tar_fp.write(f"    uint32_t t2d[{NR_CHUNKS}];\n")
+        tar_fp.write("} Curve1174BaseTableEntry;\n\n")
+
+        tar_fp.write("// curve1174_base_table[i][j] = (j + 1) * 256^i * G as "
+                     "(y + x, y - x, 2dxy),\n")
+        tar_fp.write("// chunks are stored least significant first.\n")
+        tar_fp.write("__attribute__((unused, aligned(64)))\n")
+        tar_fp.write("static const Curve1174BaseTableEntry curve1174_base_table"
+                     "[CURVE1174_BASE_TABLE_ROWS][CURVE1174_BASE_TABLE_COLS] = {\n")
+
+        row_base = G
+        for i in range(rows):
+            tar_fp.write("    {\n")
+            p = row_base
+            for j in range(cols):
+                yp, ym, t2d = precompute(p)
+                tar_fp.write(f"        {{ // {j + 1} * 256^{i} * G\n")
+                tar_fp.write(f"            {{{chunks(yp)}}},\n")
+                tar_fp.write(f"            {{{chunks(ym)}}},\n")
+                tar_fp.write(f"            {{{chunks(t2d)}}},\n")
+                tar_fp.write("        },\n")
+                p = add(p, row_base)
+            tar_fp.write("    },\n")
+
+            for _ in range(8):
+                row_base = add(row_base, row_base)
+
+        tar_fp.write("};\n")
+        tar_fp.write(f"\n#endif // {guard_macro}\n")
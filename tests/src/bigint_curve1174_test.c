@@ -444,6 +444,16 @@ START_TEST(test_power)
 
     big_int_curve1174_pow(a, b, e);
     ck_assert_int_eq(big_int_compare(a, r), 0);
+
+    // Exponent with multiple chunks
+    big_int_create_from_hex(b, "ABCDEF123456789");
+    big_int_create_from_hex(e,
+        "5D1F8A3C2B7E9064D3C1B2A5F6E7D8C9B0A1928374655647382910ABCDEF0123");
+    big_int_create_from_hex(r,
+        "2B8C9C06A68EB6A04D1ED67C5B009EBFC754C2A35C983422646817DEAF16800");
+
+    big_int_curve1174_pow(a, b, e);
+    ck_assert_int_eq(big_int_compare(a, r), 0);
 }
 END_TEST
 
@@ -0,0 +1,407 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This is a unit test file to test the fixed-width BigInt families.
+ */
+
+/*
+ * Includes
+ */
+#include <check.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include header files
+#include "bigint.h"
+#include "bigint_n.h"
+#include "debug.h"
+
+// Check all modular operations of one width against precomputed results for
+// a modulus q and operands a, b, e
+#define TEST_BIG_INT_N_MONT(bits, q_s, a_s, b_s, e_s, ab_s, apb_s, amb_s,      \
+    bma_s, pow_s)                                                              \
+    do {                                                                       \
+        BigInt##bits q, a, b, e, r, exp, a_m, b_m;                             \
+        BigInt##bits##MontCtx ctx;                                             \
+                                                                               \
+        big_int_##bits##_from_hex(&q, q_s);                                    \
+        big_int_##bits##_from_hex(&a, a_s);                                    \
+        big_int_##bits##_from_hex(&b, b_s);                                    \
+        big_int_##bits##_from_hex(&e, e_s);                                    \
+        big_int_##bits##_mont_ctx_init(&ctx, &q);                              \
+                                                                               \
+        big_int_##bits##_to_mont(&a_m, &a, &ctx);                              \
+        big_int_##bits##_to_mont(&b_m, &b, &ctx);                              \
+        big_int_##bits##_from_mont(&r, &a_m, &ctx);                            \
+        ck_assert_int_eq(big_int_##bits##_compare(&r, &a), 0);                 \
+                                                                               \
+        big_int_##bits##_mont_mul(&r, &a_m, &b_m, &ctx);                       \
+        big_int_##bits##_from_mont(&r, &r, &ctx);                              \
+        big_int_##bits##_from_hex(&exp, ab_s);                                 \
+        ck_assert_int_eq(big_int_##bits##_compare(&r, &exp), 0);               \
+                                                                               \
+        big_int_##bits##_add_mod(&r, &a, &b, &ctx);                            \
+        big_int_##bits##_from_hex(&exp, apb_s);                                \
+        ck_assert_int_eq(big_int_##bits##_compare(&r, &exp), 0);               \
+                                                                               \
+        big_int_##bits##_sub_mod(&r, &a, &b, &ctx);                            \
+        big_int_##bits##_from_hex(&exp, amb_s);                                \
+        ck_assert_int_eq(big_int_##bits##_compare(&r, &exp), 0);               \
+                                                                               \
+        big_int_##bits##_sub_mod(&r, &b, &a, &ctx);                            \
+        big_int_##bits##_from_hex(&exp, bma_s);                                \
+        ck_assert_int_eq(big_int_##bits##_compare(&r, &exp), 0);               \
+                                                                               \
+        big_int_##bits##_pow_mont(&r, &b, &e, &ctx);                           \
+        big_int_##bits##_from_hex(&exp, pow_s);                                \
+        ck_assert_int_eq(big_int_##bits##_compare(&r, &exp), 0);               \
+                                                                               \
+        /* x^(q-1) = 1 for prime q */                                          \
+        memset(&exp, 0, sizeof(exp));                                          \
+        exp.limbs[0] = 1;                                                      \
+        big_int_##bits##_sub(&e, &q, &exp);                                    \
+        big_int_##bits##_pow_mont(&r, &a, &e, &ctx);                           \
+        ck_assert_int_eq(big_int_##bits##_compare(&r, &exp), 0);               \
+                                                                               \
+        /* Zero exponent */                                                    \
+        memset(&e, 0, sizeof(e));                                              \
+        big_int_##bits##_pow_mont(&r, &a, &e, &ctx);                           \
+        ck_assert_int_eq(big_int_##bits##_compare(&r, &exp), 0);               \
+    } while (0)
+
+/**
+* \brief Test conversions from and to BigInts and hex strings
+*/
+START_TEST(test_conversion)
+{
+    BIG_INT_DEFINE_FROM_CHUNK(a, 0, 0);
+    BIG_INT_DEFINE_FROM_CHUNK(b, 0, 0);
+    BigInt256 a_256, b_256;
+    BigInt384 a_384, b_384;
+
+    big_int_create_from_hex(a,
+        "386C206FA6399A757E3A82B21B8666F7A8490F89DFA4CCB4CE8B1AD2F7517CBC");
+    big_int_256_from_big_int(&a_256, a);
+    big_int_256_from_hex(&b_256,
+        "386c206fa6399a757e3a82b21b8666f7a8490f89dfa4ccb4ce8b1ad2f7517cbc");
+    ck_assert_int_eq(big_int_256_compare(&a_256, &b_256), 0);
+    ck_assert_uint_eq(a_256.limbs[0], 0xce8b1ad2f7517cbcULL);
+    ck_assert_uint_eq(a_256.limbs[3], 0x386c206fa6399a75ULL);
+
+    big_int_256_to_big_int(b, &a_256);
+    ck_assert_int_eq(big_int_compare(a, b), 0);
+
+    // Leading zeros are pruned
+    big_int_create_from_hex(a, "C0FFEE");
+    big_int_256_from_hex(&a_256, "C0FFEE");
+    big_int_256_to_big_int(b, &a_256);
+    ck_assert_int_eq(big_int_compare(a, b), 0);
+    ck_assert_uint_eq(b->size, 1);
+
+    // Width beyond the BigInt of the curve
+    big_int_create_from_hex(a,
+        "1041DFB66C7CAC7212C4FF1D0727BA023794291678C71EE427A88C338232A8DD"
+        "D9ADEF0E8E7AF51F82F83E7AC323A6A7");
+    big_int_384_from_big_int(&a_384, a);
+    big_int_384_from_hex(&b_384,
+        "1041dfb66c7cac7212c4ff1d0727ba023794291678c71ee427a88c338232a8dd"
+        "d9adef0e8e7af51f82f83e7ac323a6a7");
+    ck_assert_int_eq(big_int_384_compare(&a_384, &b_384), 0);
+
+    big_int_384_to_big_int(b, &a_384);
+    ck_assert_int_eq(big_int_compare(a, b), 0);
+
+    ck_assert_int_eq(big_int_384_is_zero(&a_384), 0);
+    memset(&a_384, 0, sizeof(a_384));
+    ck_assert_int_eq(big_int_384_is_zero(&a_384), 1);
+}
+END_TEST
+
+/**
+* \brief Test addition and subtraction with carries over all limbs
+*/
+START_TEST(test_add_sub)
+{
+    BigInt512 a, b, r;
+
+    memset(&a, 0xff, sizeof(a));
+    memset(&b, 0, sizeof(b));
+    b.limbs[0] = 1;
+
+    ck_assert_uint_eq(big_int_512_add(&r, &a, &b), 1);
+    ck_assert_int_eq(big_int_512_is_zero(&r), 1);
+
+    ck_assert_uint_eq(big_int_512_sub(&r, &r, &b), 1);
+    ck_assert_int_eq(big_int_512_compare(&r, &a), 0);
+
+    ck_assert_uint_eq(big_int_512_sub(&r, &a, &b), 0);
+    ck_assert_uint_eq(r.limbs[0], 0xfffffffffffffffeULL);
+    ck_assert_uint_eq(r.limbs[7], 0xffffffffffffffffULL);
+    ck_assert_int_eq(big_int_512_compare(&r, &a), -1);
+    ck_assert_int_eq(big_int_512_compare(&a, &r), 1);
+}
+END_TEST
+
+/**
+* \brief Test full-width multiplication
+*/
+START_TEST(test_mul)
+{
+    BigInt384 a_384, b_384;
+    BigInt384Wide r_384;
+    BigInt512 a_512, b_512;
+    BigInt512Wide r_512;
+    BigInt1024 a_1024, b_1024;
+    BigInt1024Wide r_1024;
+    uint64_t exp_384[] = {
+        0xee78d01f84007802ULL, 0x5efba1c0c9398c8aULL, 0xff5c0bcf439d634bULL,
+        0x63625edb63d14aa5ULL, 0xcd98c7166bd0bd7bULL, 0x42daa4f91de6c229ULL,
+        0xdb137a369eef31a2ULL, 0x227bc3619396f145ULL, 0x7b28b58557c24afcULL,
+        0xb4c478ba003adcb2ULL, 0x39aa2b0949aa26f5ULL, 0x61314f96031783d4ULL
+    };
+    uint64_t exp_512[] = {
+        0xfaa7204256e195fcULL, 0xdee08ad7f58be93bULL, 0xa9a0ca07c830573aULL,
+        0x9801079983f4d48aULL, 0x1b51caeaeace47fbULL, 0x2519bb4477e5c789ULL,
+        0x9b6ff320b809c46cULL, 0x0732234bb954a61eULL, 0x247de2d817f3f062ULL,
+        0x877cb48cce641382ULL, 0x69b211ddf67b6412ULL, 0x43686a1ce0846ce9ULL,
+        0x67751857487116acULL, 0xdfa6c2f0159827e1ULL, 0x605653725beec4daULL,
+        0x206052590a19b437ULL
+    };
+    uint64_t exp_1024[] = {
+        0xa3e1bd657a3a0b29ULL, 0xdfd2e9ac5729c23dULL, 0x1e84928d42ff9102ULL,
+        0x2d161f59781fc6a2ULL, 0x8aefdad50deb843fULL, 0x7c891086f7046fa7ULL,
+        0x1050df775cfa2c41ULL, 0xbadd25d33645f065ULL, 0x9a6ad62f62938648ULL,
+        0xe8c1bc331c466511ULL, 0x11361820657a91c3ULL, 0x7f504e2df8b0fd94ULL,
+        0x4c3bd8a94f9f688fULL, 0x31e5abd87aca0706ULL, 0xd75de028dc50f27eULL,
+        0x54cb8c195afa909dULL, 0xb45c397821eab15dULL, 0x534b9265f8bd4409ULL,
+        0x95dbdebbbcc418d7ULL, 0x5277df3287264f80ULL, 0x1607fd0e01c7ca07ULL,
+        0x25b81ecdb3182a54ULL, 0x8a49461e15ca8528ULL, 0xe291bedfcebf0723ULL,
+        0x2bc461bc95b7ada4ULL, 0xef3b27efc7a65024ULL, 0x3e1d782ca6496560ULL,
+        0xf0da2a09113fc005ULL, 0xb5c681917512a449ULL, 0x61ab2e3d713d1ae4ULL,
+        0x6b16aa49b9efe923ULL, 0x64f5106e0bc18ea8ULL
+    };
+
+    big_int_384_from_hex(&a_384,
+        "ea532286e0de6fc64108f52e6b4a6a70388a808dde41afcc8ca7f6a1c3874bd1"
+        "a79894fc13bf84114ddc9806ac9be9c6");
+    big_int_384_from_hex(&b_384,
+        "6a2edae25411e7cab68484873c609639e3121ca32d7f5e2a41ca7b1b8f80fb8a"
+        "d72cd4f693295fc1129d5cfeae8e84cb");
+
+    big_int_384_mul(&r_384, &a_384, &b_384);
+    for (uint64_t i = 0; i < 12; ++i)
+        ck_assert_uint_eq(r_384.limbs[i], exp_384[i]);
+
+    big_int_512_from_hex(&a_512,
+        "d83b845efe2cf7eef860c5fa7c0736299e5ada02b55a278bd05ab2c08c3d4abb"
+        "1be332fe1d9711652728c6e71645009ac4eed7ea2dd08af57783dfb612518ba6");
+    big_int_512_from_hex(&b_512,
+        "2654a265a0f52dc025948fb6b01039ceaf6fc3432efddff531415b9fe6170d85"
+        "07635ca02c5fb4c81d1c7511c5a8855247e4de96222102b18f1291bdad6c744a");
+
+    big_int_512_mul(&r_512, &a_512, &b_512);
+    for (uint64_t i = 0; i < 16; ++i)
+        ck_assert_uint_eq(r_512.limbs[i], exp_512[i]);
+
+    big_int_1024_from_hex(&a_1024,
+        "8faf156782006a7f768025167151913f0c92e2f57a9c21e3b3409287ba9a420b"
+        "84f19cb7381f871fa11178955f72a92d787c843258096239d785f59a81e2c08a"
+        "696adf86a5402e4f90ed84ffda797733b5d9f0528fc6ac7035a488867a51dc3b"
+        "7e2cb4ffcc80cd5e3fe82ab31029e3650b5333a939d79ad41a46df567bcd87b5");
+    big_int_1024_from_hex(&b_1024,
+        "b3dfdb0eb1d2af8efa60fc3b4c15524b260f48ada56bc8a03879699d189b77f5"
+        "33bf74b3476c03f40059577cbfc573c5862d5a9586da6dd094df88d3cf67ac94"
+        "0ce4070cc5176d42820f9b3c6c3d6073960e79c56ba7c0913fe7b44ef939444b"
+        "5c347ee6693f22d7229a5ffc0116a1b69248aa92d314be2ead02ef23a0187625");
+
+    big_int_1024_mul(&r_1024, &a_1024, &b_1024);
+    for (uint64_t i = 0; i < 32; ++i)
+        ck_assert_uint_eq(r_1024.limbs[i], exp_1024[i]);
+
+    // (2^1024 - 1)^2 = 2^2048 - 2^1025 + 1, maximal carries
+    memset(&a_1024, 0xff, sizeof(a_1024));
+    big_int_1024_mul(&r_1024, &a_1024, &a_1024);
+    ck_assert_uint_eq(r_1024.limbs[0], 1);
+    for (uint64_t i = 1; i < 16; ++i)
+        ck_assert_uint_eq(r_1024.limbs[i], 0);
+    ck_assert_uint_eq(r_1024.limbs[16], 0xfffffffffffffffeULL);
+    for (uint64_t i = 17; i < 32; ++i)
+        ck_assert_uint_eq(r_1024.limbs[i], 0xffffffffffffffffULL);
+}
+END_TEST
+
+/**
+* \brief Test Montgomery arithmetic with 256-bit BigInts
+*/
+START_TEST(test_mont_256)
+{
+    TEST_BIG_INT_N_MONT(256,
+        "7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7",
+        "65865684d60426388e7e802b627ef1d8e91579a21c3a39e50c191728c541241",
+        "13cb4d82a677c0b6f945d78c3117314b6c006b43155fd43815c2a41f03615cb",
+        "386c206fa6399a757e3a82b21b8666f7a8490f89dfa4ccb4ce8b1ad2f7517cbc",
+        "211716f8f05c652eda073d231984186d8d199aa07756109714d26feb18e6613",
+        "7951a4077c7be6ef87c457b7939623245515e4e5319a0e1d21dbbb47c8a280c",
+        "51bb09022f8c65819538a89f3167c08d7d150e5f06da65acf6567309c1dfc76",
+        "2e44f6fdd0739a7e6ac75760ce983f7282eaf1a0f9259a5309a98cf63e20381",
+        "77d6e4b1eb816751a8ffb0090cfe106181ce6bef8ad1b498b72ca5d343440e7");
+}
+END_TEST
+
+/**
+* \brief Test Montgomery arithmetic with 384-bit BigInts
+*/
+START_TEST(test_mont_384)
+{
+    TEST_BIG_INT_N_MONT(384,
+        "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe"
+        "ffffffff0000000000000000ffffffff",
+        "1041dfb66c7cac7212c4ff1d0727ba023794291678c71ee427a88c338232a8dd"
+        "d9adef0e8e7af51f82f83e7ac323a6a7",
+        "56ce7284efb847f44ab04b8a8c52c215b2b9a32f0e7d56b620fb877bf35ecbbb"
+        "29bca53cac1981697fb7009621e91946",
+        "938d4fdd6449a1baeae5e29ffaab5e188cb6b629871bb6a391b097146f4cb1e9"
+        "b1d1646bbba8e5bdcf9f5df094b49b52",
+        "fb40d3d1580f791cb704401805c0438efaebab80e512be50b1b19a0a1c544c56"
+        "d68af4ced849967e2a843147a15c7f0b",
+        "6710523b5c34f4665d754aa7937a7c17ea4dcc458744759a48a413af75917499"
+        "036a944b3a94768902af3f10e50cbfed",
+        "b9736d317cc4647dc814b3927ad4f7ec84da85e76a49c82e06ad04b78ed3dd21"
+        "aff149d0e26173b603413de5a13a8d60",
+        "468c92ce833b9b8237eb4c6d852b08137b257a1895b637d1f952fb48712c22dd"
+        "500eb62e1d9e8c49fcbec21b5ec5729f",
+        "2ca612e522bf6987289b70189527c474df4082b88fa43309c98e6b8f99cc9911"
+        "b200dc39d3c94085084b1ed517643b9e");
+}
+END_TEST
+
+/**
+* \brief Test Montgomery arithmetic with 512-bit BigInts
+*/
+START_TEST(test_mont_512)
+{
+    TEST_BIG_INT_N_MONT(512,
+        "ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"
+        "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffdc7",
+        "be2e61bdd16cac0715215c06e7be67183677eda2dbf4280a984cd44b07637487"
+        "8c84fa7457ce1de743b600032d1c58dd274518b767dc33a7d19d0ac4641719",
+        "18b8d1ad705cc71ed72c0443dd0a138d82988d3672ce28f499d283abdc2ab0c5"
+        "cebb5e33a5ef453c174c6e75e5ba2bbc5e23add355fb5556a48f7676ae889e6b",
+        "11e2c7330c52df0da6d2b3ba1fe689d5c4be369add2939bf517e5ee476c45a59"
+        "f0696895f40cf9683b0fe613b1490b06160b40656c076f45aa85760265ae5758",
+        "c6e272295e6d965742380eff7ef9a4837e0c9cf00df04f265d98b801abdff07c"
+        "a72e8833bea735df7e346a34a286af12ef054a901913020e4491edfe3e8eecb0",
+        "1977000f2e2e33cade41259fe3f1d1f49acf052415aa1d1ca46ad0802732143a"
+        "5647e32e1a471359fe902475e8e748153b4af2ec0d63318a4c61138172ecb584",
+        "e8055cb44d74a58d2fe91d1829ddaad9959deab7300dcb3370c5c9286edcb2ae"
+        "b8d126c6ce6888e1cff7478a1d72f09c7f039745616c86dd0342269415db7675",
+        "17faa34bb28b5a72d016e2e7d62255266a621548cff234cc8f3a36d791234d51"
+        "472ed9393197771e3008b875e28d0f6380fc68ba9e937922fcbdd96bea248752",
+        "32798d911508bfd17f092c7c40d85b95f66b72b9c0f0d90341405fcbbef0cead"
+        "f7e050ee4f33df9c1d5ac22722082889d395f9a5f1615b28e31c1ff0675d778");
+}
+END_TEST
+
+/**
+* \brief Test Montgomery arithmetic with 1024-bit BigInts
+*/
+START_TEST(test_mont_1024)
+{
+    TEST_BIG_INT_N_MONT(1024,
+        "ffffffffffffffffc90fdaa22168c234c4c6628b80dc1cd129024e088a67cc74"
+        "020bbea63b139b22514a08798e3404ddef9519b3cd3a431b302b0a6df25f1437"
+        "4fe1356d6d51c245e485b576625e7ec6f44c42e9a637ed6b0bff5cb6f406b7ed"
+        "ee386bfb5a899fa5ae9f24117c4b1fe649286651ece65381ffffffffffffffff",
+        "a10a5afd4737baa5bc538f4f02d14fb081f31d5cd238e560639fbce9163e820d"
+        "f01f0da9973de0e39057e4ff12982d0b0b6c0dfec6df63556c0058b4f7a8f778"
+        "a341fe0d90b3181e21b97ecdd1ed9ec331b07f6d5263b2b1436a954e3cd4f61f"
+        "22b6c04c1b1da2b995422412ed9895b635c416e0d7615b00219238f8df7be76e",
+        "6a10917d750b0401a8784dcd03d4644a20ace909306378def8a9d8a97ae5a156"
+        "4ad5833fca7d12154d4cea0ca90f3b12662fca6a779feeca546b0b61ad7b4f25"
+        "92fb6cf174880b67807413e6c5cb19a589a68ded6118d39bc2a392631892dbf4"
+        "176d6b13d34f264d207ecc281f613b4bed5bd197d48e5b1726ed811a9de4ae20",
+        "f760fb501d66a73ad5f4ffdee5f8a0a42aedd96cbcc22391b7c6226d7f49dc3c"
+        "72b612490a671708190ed1ca63067b753843db1e263697f7c659d4e20f2d83ba"
+        "10a5b65b05189b2739dd865b0d82dd5f1aef7d6cf4db446b5fb9baae7fff7897"
+        "9e660f292519eee4f8831513705761d70c28209d0a72b150ca0b1751eceef299",
+        "64e0c5c2d4fb2e3e67ca49531fb02975b76880401527095fe6178708de918e74"
+        "9b8c95312274b346b16b5143d193c4e46a71df7fe0bdde5f4648a24ea5f0cfb8"
+        "7a9c7470dcc12b56af17f2c0be8b03f3dd6dea2cfa6b949e2732561836bf4d35"
+        "cdb7c2270d85d6afeb63be6139763039218f2124bb584b51f69dc9af93b39962",
+        "b1aec7abc42bea79bbc0279e53cf1c5ddd9a3da81c0416e3347478a06bc56f03"
+        "8e8d24326a757d68c5ac6922d73633f8206beb571450f04904059a8b2c53266e"
+        "65c359197e9613fbda7dd3e355a39a1c70aca710d4498e1fa0ecafa61611a254"
+        "bebbf6493e329610721cc2990aeb11bd9f78226bf096295487fba137d60958f",
+        "36f9c97fd22cb6a413db4181fefceb6661463453a1d56c816af5e43f9b58e0b7"
+        "a5498a69ccc0cece430afaf26988f1f8a53c43944f3f748b17954d534a2da853"
+        "1046911c1c2b0cb6a1456ae70c22851da809f17ff14adf1580c702eb24421a2b"
+        "0b49553847ce7c6c74c357eace375a6a4868454902d2ffe8faa4b7de4197394e",
+        "c90636802dd3495bb5349920226bd6ce63802e37df06b04fbe0c69c8ef0eebbc"
+        "5cc2343c6e52cc540e3f0d8724ab12e54a58d61f7dface901895bd1aa8316be4"
+        "3f9aa4515126b58f43404a8f563bf9a94c425169b4ed0e558b3859cbcfc49dc2"
+        "e2ef16c312bb233939dbcc26ae13c57c00c02108ea135399055b4821be68c6b1",
+        "28b557002b2bc1ccb2c1e120714ae8914c861d010b441e0b295fdac40ca5f5e8"
+        "a26743ea6f494751a33a8bb3f719f1b82fe08f181a935c41909c0a42581a8031"
+        "4e52649dcfad1c5d075a19a33abbf5e05bdf4d37e499929d1cb40b6bc723abbe"
+        "04f39bdc242c517156e59de47071a1ab7da653b74425a01a9f41dcfafe596840");
+}
+END_TEST
+
+
+Suite *bigints_n_suite(void)
+{
+    Suite *s;
+    TCase *tc_basic_arith, *tc_modular_arith;
+
+    s = suite_create("Fixed-Width BigInt Test Suite");
+
+    tc_basic_arith = tcase_create("Basic Arithmetic");
+    tc_modular_arith = tcase_create("Modular Arithmetic");
+
+    tcase_add_test(tc_basic_arith, test_conversion);
+    tcase_add_test(tc_basic_arith, test_add_sub);
+    tcase_add_test(tc_basic_arith, test_mul);
+
+    tcase_add_test(tc_modular_arith, test_mont_256);
+    tcase_add_test(tc_modular_arith, test_mont_384);
+    tcase_add_test(tc_modular_arith, test_mont_512);
+    tcase_add_test(tc_modular_arith, test_mont_1024);
+
+    suite_add_tcase(s, tc_basic_arith);
+    suite_add_tcase(s, tc_modular_arith);
+
+    return s;
+}
+
+ int main(void)
+ {
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = bigints_n_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+ }
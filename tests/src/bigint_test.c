@@ -27,6 +27,9 @@
  */
 #include <check.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
 
 // Include header files
 #include "bigint.h"
@@ -112,24 +115,245 @@ START_TEST(test_create_from_hex)
 
     // Test multi-chunk positive integer
     big_int_create_from_hex(a, "F050000000000000000F00D");
+#ifdef BIGINT_LIMB_64
+    ck_assert_uint_eq(a->chunks[0], 0x000000000000F00D);
+    ck_assert_uint_eq(a->chunks[1], 0x0F050000);
+    ck_assert_uint_eq(a->size, 2);
+#else
     ck_assert_uint_eq(a->chunks[0], 0x0000F00D);
     ck_assert_uint_eq(a->chunks[1], 0x00000000);
     ck_assert_uint_eq(a->chunks[2], 0x0F050000);
     ck_assert_uint_eq(a->size, 3);
+#endif
     ck_assert_uint_eq(a->sign, 0);
 
     // Test multi-chunk negative integer
     big_int_create_from_hex(a, "-F050000000000000000F00D");
+#ifdef BIGINT_LIMB_64
+    ck_assert_uint_eq(a->chunks[0], 0x000000000000F00D);
+    ck_assert_uint_eq(a->chunks[1], 0x0F050000);
+    ck_assert_uint_eq(a->size, 2);
+#else
     ck_assert_uint_eq(a->chunks[0], 0x0000F00D);
     ck_assert_uint_eq(a->chunks[1], 0x00000000);
     ck_assert_uint_eq(a->chunks[2], 0x0F050000);
     ck_assert_uint_eq(a->size, 3);
+#endif
     ck_assert_uint_eq(a->sign, 1);
 
     TEST_BIG_INT_DESTROY(a);
 }
 END_TEST
 
+#if VERSION > 2
+/**
+* \brief Test converting BigInts from and to big-endian byte strings
+*/
+START_TEST(test_bytes)
+{
+    TEST_BIG_INT_DEFINE(a);
+    TEST_BIG_INT_DEFINE(b);
+    uint8_t buf[32];
+    uint8_t in[5] = {0x0F, 0x05, 0x00, 0xF0, 0x0D};
+    uint64_t i;
+
+    // Multi-chunk integer with a partial most significant chunk
+    big_int_create_from_bytes(a, in, 5);
+#ifdef BIGINT_LIMB_64
+    ck_assert_uint_eq(a->chunks[0], 0x0F0500F00D);
+    ck_assert_uint_eq(a->size, 1);
+#else
+    ck_assert_uint_eq(a->chunks[0], 0x0500F00D);
+    ck_assert_uint_eq(a->chunks[1], 0x0F);
+    ck_assert_uint_eq(a->size, 2);
+#endif
+    ck_assert_uint_eq(a->sign, 0);
+
+    // Leading zeros are pruned and added back
+    big_int_to_bytes(buf, a, 8);
+    ck_assert_uint_eq(buf[0] | buf[1] | buf[2], 0);
+    ck_assert_mem_eq(buf + 3, in, 5);
+
+    big_int_create_from_bytes(b, buf, 8);
+    ck_assert_int_eq(big_int_compare(a, b), 0);
+
+    // Round trip of a 256-bit integer
+    big_int_create_from_hex(a,
+        "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7");
+    big_int_to_bytes(buf, a, 32);
+    ck_assert_uint_eq(buf[0], 0x07);
+    ck_assert_uint_eq(buf[31], 0xF7);
+    for (i = 1; i < 31; ++i)
+        ck_assert_uint_eq(buf[i], 0xFF);
+
+    big_int_create_from_bytes(b, buf, 32);
+    ck_assert_int_eq(big_int_compare(a, b), 0);
+
+    TEST_BIG_INT_DESTROY(a);
+    TEST_BIG_INT_DESTROY(b);
+}
+END_TEST
+
+/**
+* \brief Test packing BigInts into the compact 32-byte representation
+*/
+START_TEST(test_packed)
+{
+    BigInt a[4], b[4];
+    BigInt256Packed p[4];
+    uint64_t i;
+
+    ck_assert_uint_eq(sizeof(BigInt256Packed), 32);
+
+    big_int_create_from_chunk(a, 0, 0);
+    big_int_create_from_hex(a + 1, "F050000000000000000F00D");
+    big_int_create_from_hex(a + 2,
+        "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7");
+    big_int_create_from_hex(a + 3,
+        "FFFFFFFF00000000000000000000000000000000000000000000000000000000");
+
+    // Chunks above the size must not end up in the packed representation
+    for (i = 0; i < 4; ++i)
+        memset(&(a[i].chunks[a[i].size]), 0xAB,
+            (BIGINT_FIXED_SIZE_INTERNAL - a[i].size) * sizeof(a[i].chunks[0]));
+
+    big_int_pack(p, a, 4);
+    ck_assert_uint_eq(p[0].chunks[BIGINT_FIXED_SIZE - 1], 0);
+    ck_assert_uint_eq(p[1].chunks[BIGINT_FIXED_SIZE - 1], 0);
+    ck_assert_uint_eq(p[3].chunks[0], 0);
+
+    big_int_unpack(b, p, 4);
+    for (i = 0; i < 4; ++i)
+    {
+        ck_assert_int_eq(big_int_compare(a + i, b + i), 0);
+        ck_assert_uint_eq(a[i].size, b[i].size);
+    }
+}
+END_TEST
+
+/**
+* \brief Generator that returns 0, 1, 2, ..., used to test plugging in
+* generators
+*/
+static void test_counter_fill(BigIntRng *rng, uint64_t *out, uint64_t n)
+{
+    for (uint64_t i = 0; i < n; ++i)
+        out[i] = rng->state.xoshiro[0]++;
+}
+
+/**
+* \brief Test the random number generators and random BigInts
+*/
+START_TEST(test_random)
+{
+    BigIntRng rng, counter, *prev;
+    BigInt a[40];
+    TEST_BIG_INT_DEFINE(bound);
+    uint64_t w[30];
+    uint8_t key[32];
+    uint64_t i;
+
+    // xoshiro256** seeded with splitmix64(0)
+    big_int_rng_xoshiro_init(&rng, 0);
+    big_int_rng_fill(&rng, w, 4);
+    ck_assert_uint_eq(w[0], 0x99ec5f36cb75f2b4);
+    ck_assert_uint_eq(w[1], 0xbf6e1f784956452a);
+    ck_assert_uint_eq(w[2], 0x1a5f849d4933e6e0);
+    ck_assert_uint_eq(w[3], 0x6aa594f1262d2d2c);
+    for (i = 4; i < 1000; ++i)
+        big_int_rng_fill(&rng, w, 1);
+    ck_assert_uint_eq(w[0], 0x7aac8c483a2edd2f);
+
+    // ChaCha20 (RFC 8439) with key 00 01 ... 1f, the first 28 words come from
+    // the first refill, then the generator continues with the new key
+    for (i = 0; i < 32; ++i)
+        key[i] = i;
+    big_int_rng_chacha_init(&rng, key);
+    big_int_rng_fill(&rng, w, 2);
+    big_int_rng_fill(&rng, w + 2, 28);
+    ck_assert_uint_eq(w[0], 0xab2360a2e7cc232b);
+    ck_assert_uint_eq(w[1], 0x647fc83a69ef0e3f);
+    ck_assert_uint_eq(w[27], 0x2c3baee4a81cd806);
+    ck_assert_uint_eq(w[28], 0x8e1ae4909ca5412d);
+    ck_assert_uint_eq(w[29], 0x9906461caacc4d7a);
+
+    // Random BigInts of a given number of bits, i.e., in [0, 2^250)
+    big_int_create_from_hex(bound,
+        "4000000000000000000000000000000000000000000000000000000000000000");
+    big_int_fill_random(a, 40, 250);
+    for (i = 0; i < 40; ++i)
+    {
+        ck_assert_uint_eq(a[i].sign, 0);
+        ck_assert_int_lt(big_int_compare(a + i, bound), 0);
+    }
+
+    big_int_fill_random(a, 40, 1);
+    for (i = 0; i < 40; ++i)
+    {
+        ck_assert_uint_eq(a[i].size, 1);
+        ck_assert_uint_le(a[i].chunks[0], 1);
+    }
+
+    big_int_create_random(a, 3);
+    ck_assert_uint_eq(a->size, 3);
+
+    // Plug in a generator and restore the previous one
+    counter.fill = test_counter_fill;
+    counter.state.xoshiro[0] = 1;
+    prev = big_int_rng_use(&counter);
+    big_int_fill_random(a, 2, BIGINT_CHUNK_BIT_SIZE);
+    ck_assert(big_int_rng_use(prev) == &counter);
+    ck_assert_uint_eq(a[0].chunks[0], 1);
+    ck_assert_uint_eq(a[1].chunks[0], 2);
+
+    // The secure generator is per thread
+    ck_assert(big_int_rng_secure() == big_int_rng_secure());
+    big_int_rng_fill(big_int_rng_secure(), w, 30);
+
+    TEST_BIG_INT_DESTROY(bound);
+}
+END_TEST
+
+/**
+* \brief Test that a child process does not continue with the generator states
+* of its parent, which would, e.g., give both the same secret keys
+*/
+START_TEST(test_random_fork)
+{
+    uint64_t w[2][8], w_child[2][8];
+    int fds[2];
+    pid_t pid;
+    int status;
+
+    // Seed both generators and leave unused words in the ChaCha20 buffer
+    big_int_rng_fill(big_int_rng_secure(), w[0], 3);
+    big_int_rng_fill(NULL, w[1], 3);
+
+    ck_assert_int_eq(pipe(fds), 0);
+    pid = fork();
+    ck_assert_int_ge(pid, 0);
+
+    big_int_rng_fill(big_int_rng_secure(), w[0], 8);
+    big_int_rng_fill(NULL, w[1], 8);
+
+    if (pid == 0)
+    {
+        close(fds[0]);
+        _exit(write(fds[1], w, sizeof(w)) != sizeof(w));
+    }
+
+    close(fds[1]);
+    ck_assert_int_eq(read(fds[0], w_child, sizeof(w_child)), sizeof(w_child));
+    close(fds[0]);
+    ck_assert_int_eq(waitpid(pid, &status, 0), pid);
+    ck_assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    ck_assert(memcmp(w[0], w_child[0], sizeof(w[0])));
+    ck_assert(memcmp(w[1], w_child[1], sizeof(w[1])));
+}
+END_TEST
+#endif
+
 
 /**
 * \brief Test negating BigInt by flipping the sign twice, and checking that we
@@ -525,6 +749,63 @@ START_TEST(test_multiplication)
     ck_assert_int_eq(big_int_compare(c, r), 0);
     ck_assert_uint_eq(c->overflow, 0);
 
+    // Multiply integers of very different sizes (512 x 32 bits)
+    a = big_int_create_from_hex(a,
+        "C6A32F42BC66323AC2232D710B7880D7AE0B65170CB76F5ACEC8129282E394BD"
+        "8DEA3AA4C08A607352D095151C4A09CAEEEE318369CA47E7582600E9111F4EFD");
+    b = big_int_create_from_hex(b, "-A7837704");
+    r = big_int_create_from_hex(r,
+        "-81FA75AEAD91D5AE7BA863CE6200BCCFD2ADC40CC84276C7AFFD4809501DD59E"
+        "9A45DB0B94D44BCDEB088F494FD0EAC1406B226C84FEF3A564788FA18C738A26"
+        "48ABD6F4");
+
+    big_int_mul(c, a, b);
+    ck_assert_int_eq(big_int_compare(c, r), 0);
+    ck_assert_uint_eq(c->overflow, 0);
+
+    // Multiply integers of different sizes beyond 256 bits (288 x 224 bits)
+    a = big_int_create_from_hex(a,
+        "E437EAF0DB15976C381B78FE811870038BCD1ACBA164C2670B9F15ECBBD6B49E"
+        "746F25D4");
+    b = big_int_create_from_hex(b,
+        "BFADCD4E07CCA836666B98E85F0635A092C780AE49346AAB9A4130C7");
+    r = big_int_create_from_hex(r,
+        "AAE0A919CF5998551C0833F6451BF1DFDED4066910F2DADC903182BF2C3EEADF"
+        "A30B77953E6034F7A1C461D100D767EE6E028F471BBA98EC630296977C5227CC");
+
+    big_int_mul(c, a, b);
+    ck_assert_int_eq(big_int_compare(c, r), 0);
+    ck_assert_uint_eq(c->overflow, 0);
+
+    // Maximal carries in every column
+    a = big_int_create_from_hex(a,
+        "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+    b = big_int_create_from_hex(b,
+        "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+    r = big_int_create_from_hex(r,
+        "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE"
+        "0000000000000000000000000000000000000000000000000000000000000001");
+
+    big_int_mul(c, a, b);
+    ck_assert_int_eq(big_int_compare(c, r), 0);
+    ck_assert_uint_eq(c->overflow, 0);
+
+#if VERSION >= 3
+    // Operand sizes add up to more than the chunks of a BigInt, but the
+    // product fits (2^256 * -2^256)
+    a = big_int_create_from_hex(a,
+        "10000000000000000000000000000000000000000000000000000000000000000");
+    b = big_int_create_from_hex(b,
+        "-10000000000000000000000000000000000000000000000000000000000000000");
+    r = big_int_create_from_hex(r,
+        "-1000000000000000000000000000000000000000000000000000000000000000"
+        "00000000000000000000000000000000000000000000000000000000000000000");
+
+    big_int_mul(c, a, b);
+    ck_assert_int_eq(big_int_compare(c, r), 0);
+    ck_assert_uint_eq(c->overflow, 0);
+#endif
+
     TEST_BIG_INT_DESTROY(a);
     TEST_BIG_INT_DESTROY(b);
     TEST_BIG_INT_DESTROY(c);
@@ -840,6 +1121,18 @@ START_TEST(test_division)
     ck_assert_int_eq(big_int_compare(q_exp, q), 0);
     ck_assert_int_eq(big_int_compare(r_exp, r), 0);
 
+    // Quotient with all bits set, (2^192 - 1) * b + 0x1234
+    big_int_create_from_hex(a, "1B2D3F4E5A6978123456789ABCDEF00FFFFFFFFFFFFFFFFF"
+        "E4D2C0B1A59687EDCBA987654322333");
+    big_int_create_from_hex(b, "1B2D3F4E5A6978123456789ABCDEF01");
+    big_int_create_from_hex(q_exp,
+        "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+    big_int_create_from_hex(r_exp, "1234");
+
+    big_int_div_rem(q, r, a, b);
+    ck_assert_int_eq(big_int_compare(q_exp, q), 0);
+    ck_assert_int_eq(big_int_compare(r_exp, r), 0);
+
     TEST_BIG_INT_DESTROY(a);
     TEST_BIG_INT_DESTROY(b);
     TEST_BIG_INT_DESTROY(q);
@@ -1398,13 +1691,202 @@ START_TEST(test_power)
     big_int_pow(b, b, e, q);
     ck_assert_int_eq(big_int_compare(b, r), 0);
 
+    // Exponent with multiple chunks, odd and even modulus
+    big_int_create_from_hex(b, "ABCDEF123456789");
+    big_int_create_from_hex(e,
+        "5D1F8A3C2B7E9064D3C1B2A5F6E7D8C9B0A1928374655647382910ABCDEF0123");
+    big_int_create_from_hex(q, "31DECA5CA5BE11D8DF78F332F");
+    big_int_create_from_hex(r, "1EB08F0EE64EE10BA355AD0F6");
+
+    big_int_pow(b, b, e, q);
+    ck_assert_int_eq(big_int_compare(b, r), 0);
+
+    big_int_create_from_hex(b, "ABCDEF123456789");
+    big_int_create_from_hex(q, "987654321ABC");
+    big_int_create_from_hex(r, "645BD6DAE6E9");
+
+    big_int_pow(b, b, e, q);
+    ck_assert_int_eq(big_int_compare(b, r), 0);
+
+    TEST_BIG_INT_DESTROY(b);
+    TEST_BIG_INT_DESTROY(e);
+    TEST_BIG_INT_DESTROY(q);
+    TEST_BIG_INT_DESTROY(r);
+}
+END_TEST
+
+#if VERSION > 2
+/**
+* \brief Test Montgomery multiplication and exponentiation
+*/
+START_TEST(test_power_mont)
+{
+    BigIntMontCtx ctx;
+    TEST_BIG_INT_DEFINE(a);
+    TEST_BIG_INT_DEFINE(b);
+    TEST_BIG_INT_DEFINE(e);
+    TEST_BIG_INT_DEFINE(q);
+    TEST_BIG_INT_DEFINE(r);
+    TEST_BIG_INT_DEFINE(s);
+
+    // Modulus with fewer than four 64-bit limbs
+    big_int_create_from_hex(b, "4F2B8718");
+    big_int_create_from_chunk(e, 23, 0);
+    big_int_create_from_hex(q, "31DECA5CA5BE11D8DF78F332F");
+    big_int_create_from_hex(r, "F27EA91903E16641CB1465F4");
+
+    big_int_mont_ctx_init(&ctx, q);
+    big_int_pow_mont(b, b, e, &ctx);
+    ck_assert_int_eq(big_int_compare(b, r), 0);
+
+    // Inverse mod the Curve1174 prime
+    big_int_create_from_hex(b, "ABCDEF123456789ABCDEF123456789ABCDEF");
+    big_int_create_from_hex(q,
+        "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7");
+    big_int_sub(e, q, big_int_one);
+    big_int_sub(e, e, big_int_one);
+    big_int_create_from_hex(r,
+        "44087AAEC81405C30DE62CD72B79F16DAD50AC20FC445C9D7AD7053E2EBDEDEF");
+
+    big_int_mont_ctx_init(&ctx, q);
+    big_int_pow_mont(b, b, e, &ctx);
+    ck_assert_int_eq(big_int_compare(b, r), 0);
+
+    // Negative base
+    big_int_create_from_chunk(b, 5, 1);
+    big_int_srl_small(e, big_int_sub(e, q, big_int_one), 1);
+    big_int_create_from_hex(r,
+        "5D334A52309AEF59B22BCBCF314120C6A0AF8AC13B98EF6D6B0DEB3E916B04C4");
+
+    big_int_pow_mont(b, b, e, &ctx);
+    ck_assert_int_eq(big_int_compare(b, r), 0);
+
+    // Exponent 0
+    big_int_create_from_chunk(e, 0, 0);
+    big_int_pow_mont(b, b, e, &ctx);
+    ck_assert_int_eq(big_int_compare(b, big_int_one), 0);
+
+    // Modulus using all 256 bits
+    big_int_create_from_hex(b, "123456789ABCDEF0FEDCBA9876543210");
+    big_int_create_from_hex(q,
+        "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF43");
+    big_int_sub(e, q, big_int_one);
+    big_int_sub(e, e, big_int_one);
+    big_int_create_from_hex(r,
+        "503BFE9C29605E9FF646CB25D4B3B725608A23EF71FB0784A437122C3CE3F33D");
+
+    big_int_mont_ctx_init(&ctx, q);
+    big_int_pow_mont(b, b, e, &ctx);
+    ck_assert_int_eq(big_int_compare(b, r), 0);
+
+    // Compare to the division based functions for random odd moduli
+    for (int64_t i = 0; i < 64; ++i)
+    {
+        big_int_abs(q, big_int_create_random(q, 1 + i % BIGINT_FIXED_SIZE));
+        q->chunks[0] |= 3;
+        big_int_mont_ctx_init(&ctx, q);
+
+        big_int_abs(a, big_int_create_random(a, BIGINT_FIXED_SIZE));
+        big_int_abs(b, big_int_create_random(b, BIGINT_FIXED_SIZE));
+        big_int_mod(a, a, q);
+        big_int_mod(b, b, q);
+
+        big_int_to_mont(r, a, &ctx);
+        big_int_from_mont(s, r, &ctx);
+        ck_assert_int_eq(big_int_compare(s, a), 0);
+
+        big_int_to_mont(s, b, &ctx);
+        big_int_mont_mul(r, r, s, &ctx);
+        big_int_from_mont(r, r, &ctx);
+        ck_assert_int_eq(big_int_compare(r, big_int_mul_mod(s, a, b, q)), 0);
+
+        big_int_to_mont(r, a, &ctx);
+        big_int_mont_square(r, r, &ctx);
+        big_int_from_mont(r, r, &ctx);
+        ck_assert_int_eq(big_int_compare(r, big_int_mul_mod(s, a, a, q)), 0);
+
+        big_int_abs(e, big_int_create_random(e, 1 + i % BIGINT_FIXED_SIZE));
+        big_int_pow_mont(r, a, e, &ctx);
+        ck_assert_int_eq(big_int_compare(r, big_int_pow(s, a, e, q)), 0);
+    }
+
+    TEST_BIG_INT_DESTROY(a);
     TEST_BIG_INT_DESTROY(b);
     TEST_BIG_INT_DESTROY(e);
     TEST_BIG_INT_DESTROY(q);
     TEST_BIG_INT_DESTROY(r);
+    TEST_BIG_INT_DESTROY(s);
 }
 END_TEST
 
+/**
+* \brief Test Barrett reduction
+*/
+START_TEST(test_mod_barrett)
+{
+    BigIntBarrettCtx ctx;
+    TEST_BIG_INT_DEFINE(a);
+    TEST_BIG_INT_DEFINE(b);
+    TEST_BIG_INT_DEFINE(q);
+    TEST_BIG_INT_DEFINE(r);
+    TEST_BIG_INT_DEFINE(s);
+
+    // 512-bit input modulo the order of the Curve1174 base point
+    big_int_create_from_hex(a,
+        "FFFFFFFF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF01234567"
+        "89ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEFFEDCBA98");
+    big_int_create_from_hex(q,
+        "1FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF77965C4DFD307348944D45FD166C971");
+    big_int_create_from_hex(r,
+        "183A20A44043E9FB71C493A541209CBFD48C22BD3F208589A13458A9208D1DF");
+
+    big_int_barrett_ctx_init(&ctx, q);
+    big_int_mod_barrett(s, a, &ctx);
+    ck_assert_int_eq(big_int_compare(s, r), 0);
+
+    // Negative input
+    big_int_neg(a, a);
+    big_int_create_from_hex(r,
+        "7C5DF5BBFBC16048E3B6C5ABEDF633FA30A3990BE0FEDBEF318ED53F5DF792");
+
+    big_int_mod_barrett(s, a, &ctx);
+    ck_assert_int_eq(big_int_compare(s, r), 0);
+
+    // Input larger than 2^(128 n)
+    big_int_neg(a, a);
+    big_int_create_from_hex(q, "31DECA5CA5BE11D8DF78F332F");
+    big_int_create_from_hex(r, "B9A6AC3A560B7B5DE25E00FE");
+
+    big_int_barrett_ctx_init(&ctx, q);
+    big_int_mod_barrett(s, a, &ctx);
+    ck_assert_int_eq(big_int_compare(s, r), 0);
+
+    // Compare to the division based functions for random moduli
+    for (int64_t i = 0; i < 64; ++i)
+    {
+        big_int_abs(q, big_int_create_random(q, 1 + i % BIGINT_FIXED_SIZE));
+        q->chunks[0] |= 3;
+        big_int_barrett_ctx_init(&ctx, q);
+
+        big_int_create_random(a, 2 * BIGINT_FIXED_SIZE);
+        big_int_mod_barrett(r, a, &ctx);
+        ck_assert_int_eq(big_int_compare(r, big_int_mod(s, a, q)), 0);
+
+        big_int_create_random(a, q->size);
+        big_int_create_random(b, q->size);
+        big_int_mul_mod_barrett(r, a, b, &ctx);
+        ck_assert_int_eq(big_int_compare(r, big_int_mul_mod(s, a, b, q)), 0);
+    }
+
+    TEST_BIG_INT_DESTROY(a);
+    TEST_BIG_INT_DESTROY(b);
+    TEST_BIG_INT_DESTROY(q);
+    TEST_BIG_INT_DESTROY(r);
+    TEST_BIG_INT_DESTROY(s);
+}
+END_TEST
+#endif
+
 /**
 * \brief Test finding the greatest common divisor of BigInts
 */
@@ -1466,6 +1948,50 @@ START_TEST(test_gcd)
     big_int_egcd(&res, a, b);
     TEST_BIG_INT_CMP_GCD_RES(res, g_exp, x_exp, y_exp);
 
+    // Multi-limb arguments, expected values match GMP's mpz_gcdext (see also
+    // test_gcdext in gmp_elligator_test.c)
+    big_int_create_from_hex(a,
+        "3A0F5C7E9B1D24686E0F1A2B3C4D5E6F708192A3B4C5D6E7F8091A2B3C4D5E6F");
+    big_int_create_from_hex(b,
+        "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7");
+    big_int_create_from_chunk(g_exp, 1, 0);
+    big_int_create_from_hex(x_exp,
+        "-EB3840171AAB3A5A4CCB424C425417A5494707486216C05F363140801F8F15");
+    big_int_create_from_hex(y_exp,
+        "6AB1B79B114613AD4D617F6EA611556BFCAED23E6222D5CF9EF6DD36EF0B1C4");
+
+    big_int_egcd(&res, a, b);
+    TEST_BIG_INT_CMP_GCD_RES(res, g_exp, x_exp, y_exp);
+
+    // Consecutive Fibonacci numbers (all quotients are 1)
+    big_int_create_from_hex(a,
+        "7344A7F9C78E525CE23A29E3F9978BDF381AF8C33E741CD4B5037E6967D2EC2");
+    big_int_create_from_hex(b,
+        "BA82023500B514A5FE78E4582F4C7C9542261C883F7884C6B39C84D65381493");
+    big_int_create_from_chunk(g_exp, 1, 0);
+    big_int_create_from_hex(x_exp,
+        "-473D5A3B3926C2491C3EBA7435B4F0B60A0B23C5010467F1FE99066CEBAE5D1");
+    big_int_create_from_hex(y_exp,
+        "2C074DBE8E679013C5FB6F6FC3E29B292E0FD4FE3D6FB4E2B66A77FC7C248F1");
+
+    big_int_egcd(&res, a, b);
+    TEST_BIG_INT_CMP_GCD_RES(res, g_exp, x_exp, y_exp);
+
+    // Large common divisor and negative argument
+    big_int_create_from_hex(a,
+        "16432F8D339894AF482F9140ACB61C0C0211531806191D97EB4616A778EF8794"
+        "E979B11B");
+    big_int_create_from_hex(b,
+        "-10CBD0B709C4A7C7A2EC2E447739602736C20EFD8665AB251B1D92735495632E"
+        "1424FAB42391151");
+    big_int_create_from_hex(g_exp, "1B2D3F4E5A6978123456789ABCDEF01");
+    big_int_create_from_hex(x_exp,
+        "4C946A392B2E238E192B7995201D479D1BFE9CCEC8C62BDC");
+    big_int_create_from_hex(y_exp, "6580A6CD4386BF8D08ECDE5F9E99CDCC84C1AB543");
+
+    big_int_egcd(&res, a, b);
+    TEST_BIG_INT_CMP_GCD_RES(res, g_exp, x_exp, y_exp);
+
     // Both zero arguments
     big_int_create_from_chunk(a, 0, 0);
     big_int_create_from_chunk(b, 0, 0);
@@ -1698,6 +2224,12 @@ Suite *bigints_suite(void)
 
     tcase_add_test(tc_create, test_create_from_int64);
     tcase_add_test(tc_create, test_create_from_hex);
+#if VERSION > 2
+    tcase_add_test(tc_create, test_bytes);
+    tcase_add_test(tc_create, test_packed);
+    tcase_add_test(tc_create, test_random);
+    tcase_add_test(tc_create, test_random_fork);
+#endif
 
     tcase_add_test(tc_basic_arith, test_negate);
     tcase_add_test(tc_basic_arith, test_addition);
@@ -1721,6 +2253,10 @@ Suite *bigints_suite(void)
     tcase_add_test(tc_modular_arith, test_div_mod);
 
     tcase_add_test(tc_advanced_ops, test_power);
+#if VERSION > 2
+    tcase_add_test(tc_advanced_ops, test_power_mont);
+    tcase_add_test(tc_modular_arith, test_mod_barrett);
+#endif
     tcase_add_test(tc_advanced_ops, test_gcd);
     tcase_add_test(tc_advanced_ops, test_chi);
 
@@ -0,0 +1,959 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This is a unit test file to test the Curve1174 point arithmetic in
+ * extended coordinates against the affine addition from elligator.c, and the
+ * scalar multiplications built on it. The scalar multiplication test vectors
+ * are computed with a double-and-add in Python.
+ */
+
+/*
+ * Includes
+ */
+#include <check.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+
+// Include header files
+#include "bigint.h"
+#include "bigint_curve1174.h"
+#include "elligator.h"
+#include "curve1174_point.h"
+#include "curve1174_point_4.h"
+#include "curve1174_scalar.h"
+#include "curve1174_cache.h"
+#include "elligator_dh.h"
+#include "debug.h"
+
+// Macros
+#define TEST_NR_POINTS 8
+#define TEST_MSM_NR_POINTS (CURVE1174_MSM_PIPPENGER_THRESHOLD + 3)
+
+#define TEST_CURVE_POINT_EQ(p1, p2)                                            \
+    do {                                                                       \
+        ck_assert_int_eq(big_int_compare(&((p1).x), &((p2).x)), 0);            \
+        ck_assert_int_eq(big_int_compare(&((p1).y), &((p2).y)), 0);            \
+    } while (0)
+
+/**
+* \brief Fill p with TEST_NR_POINTS distinct curve points using Elligator 1
+*/
+static void test_gen_points(CurvePoint *p, Curve curve)
+{
+    BigInt t[TEST_NR_POINTS];
+
+    for (uint64_t i = 0; i < TEST_NR_POINTS; ++i)
+        big_int_create_from_chunk(t + i, i + 2, 0);
+
+    elligator_1_string_to_point_batch(p, t, TEST_NR_POINTS, curve);
+}
+
+/**
+* \brief Check that the extended point p is on the curve and consistent, i.e.,
+*        (X^2 + Y^2) Z^2 = Z^4 + d X^2 Y^2 and X Y = Z T
+*/
+static void test_check_on_curve(CurvePointExt *p, Curve curve)
+{
+    BIG_INT_DEFINE_PTR(xx);
+    BIG_INT_DEFINE_PTR(yy);
+    BIG_INT_DEFINE_PTR(zz);
+    BIG_INT_DEFINE_PTR(lhs);
+    BIG_INT_DEFINE_PTR(rhs);
+    BIG_INT_DEFINE_PTR(tmp);
+
+    big_int_curve1174_square_mod(xx, &(p->x));
+    big_int_curve1174_square_mod(yy, &(p->y));
+    big_int_curve1174_square_mod(zz, &(p->z));
+
+    big_int_curve1174_add_mod(tmp, xx, yy);
+    big_int_curve1174_mul_mod(lhs, tmp, zz);
+
+    big_int_curve1174_mul_mod(tmp, xx, yy);
+    big_int_curve1174_mul_mod(rhs, tmp, &(curve.d));
+    big_int_curve1174_square_mod(tmp, zz);
+    big_int_curve1174_add_mod(rhs, rhs, tmp);
+
+    ck_assert_int_eq(big_int_compare(lhs, rhs), 0);
+
+    big_int_curve1174_mul_mod(lhs, &(p->x), &(p->y));
+    big_int_curve1174_mul_mod(rhs, &(p->z), &(p->t));
+    ck_assert_int_eq(big_int_compare(lhs, rhs), 0);
+}
+
+/**
+* \brief Reference scalar multiplication r = [k]p with double-and-add
+*/
+static void test_double_and_add(CurvePointExt *r, BigInt *k, CurvePointExt *p)
+{
+    int64_t b;
+
+    curve1174_point_set_neutral(r);
+    for (b = k->size * BIGINT_CHUNK_BIT_SIZE - 1; b >= 0; --b) {
+        curve1174_point_double(r, r);
+        if ((k->chunks[b / BIGINT_CHUNK_BIT_SIZE] >> (b % BIGINT_CHUNK_BIT_SIZE)) & 1)
+            curve1174_point_add(r, r, p);
+    }
+
+    if (k->sign)
+        curve1174_point_neg(r, r);
+}
+
+/**
+* \brief Test conversions between affine and extended coordinates
+*/
+START_TEST(test_conversions)
+{
+    Curve curve;
+    CurvePoint p[TEST_NR_POINTS], r;
+    CurvePointExt p_ext, o;
+
+    init_curve1174(&curve);
+    test_gen_points(p, curve);
+
+    curve1174_point_set_neutral(&o);
+    test_check_on_curve(&o, curve);
+    curve1174_point_to_affine(&r, &o);
+    ck_assert_int_eq(big_int_compare(&(r.x), big_int_zero), 0);
+    ck_assert_int_eq(big_int_compare(&(r.y), big_int_one), 0);
+
+    for (uint64_t i = 0; i < TEST_NR_POINTS; ++i) {
+        curve1174_point_from_affine(&p_ext, p + i);
+        test_check_on_curve(&p_ext, curve);
+
+        curve1174_point_to_affine(&r, &p_ext);
+        TEST_CURVE_POINT_EQ(r, p[i]);
+    }
+}
+END_TEST
+
+/**
+* \brief Test unified addition and doubling against the affine formulas
+*/
+START_TEST(test_add_double)
+{
+    Curve curve;
+    CurvePoint p[TEST_NR_POINTS], exp[TEST_NR_POINTS], r;
+    CurvePointExt p_ext[TEST_NR_POINTS], r_ext, r2_ext, o;
+
+    init_curve1174(&curve);
+    test_gen_points(p, curve);
+    curve1174_point_set_neutral(&o);
+
+    for (uint64_t i = 0; i < TEST_NR_POINTS; ++i)
+        curve1174_point_from_affine(p_ext + i, p + i);
+
+    // P_i + P_{i+1}
+    curve_point_add_batch(exp, p, p + 1, 1, TEST_NR_POINTS - 1, 0, curve);
+    for (uint64_t i = 0; i < TEST_NR_POINTS - 1; ++i) {
+        curve1174_point_add(&r_ext, p_ext + i, p_ext + i + 1);
+        test_check_on_curve(&r_ext, curve);
+        curve1174_point_to_affine(&r, &r_ext);
+        TEST_CURVE_POINT_EQ(r, exp[i]);
+
+        // In-place addition
+        r2_ext = p_ext[i];
+        curve1174_point_add(&r2_ext, &r2_ext, p_ext + i + 1);
+        ck_assert(curve1174_point_equal(&r_ext, &r2_ext));
+    }
+
+    // 2 P_i
+    curve_point_add_batch(exp, p, p, 1, TEST_NR_POINTS, 0, curve);
+    for (uint64_t i = 0; i < TEST_NR_POINTS; ++i) {
+        curve1174_point_double(&r_ext, p_ext + i);
+        test_check_on_curve(&r_ext, curve);
+        curve1174_point_to_affine(&r, &r_ext);
+        TEST_CURVE_POINT_EQ(r, exp[i]);
+
+        // The unified addition also handles doublings
+        curve1174_point_add(&r2_ext, p_ext + i, p_ext + i);
+        ck_assert(curve1174_point_equal(&r_ext, &r2_ext));
+
+        r2_ext = p_ext[i];
+        curve1174_point_double(&r2_ext, &r2_ext);
+        ck_assert(curve1174_point_equal(&r_ext, &r2_ext));
+
+        // Neutral element
+        curve1174_point_add(&r2_ext, p_ext + i, &o);
+        ck_assert(curve1174_point_equal(p_ext + i, &r2_ext));
+        ck_assert(!curve1174_point_equal(p_ext + i, &r_ext));
+    }
+
+    curve1174_point_double(&r_ext, &o);
+    ck_assert(curve1174_point_equal(&o, &r_ext));
+}
+END_TEST
+
+/**
+* \brief Test mixed addition with precomputed points
+*/
+START_TEST(test_add_mixed)
+{
+    Curve curve;
+    CurvePoint p[TEST_NR_POINTS];
+    CurvePointExt p_ext[TEST_NR_POINTS], acc, acc_mixed;
+    CurvePointPrecomp p_pre[TEST_NR_POINTS];
+
+    init_curve1174(&curve);
+    test_gen_points(p, curve);
+
+    for (uint64_t i = 0; i < TEST_NR_POINTS; ++i) {
+        curve1174_point_from_affine(p_ext + i, p + i);
+        curve1174_point_precompute(p_pre + i, p + i);
+    }
+
+    // Accumulate all points with both addition variants, starting with a
+    // non-trivial Z coordinate.
+    curve1174_point_double(&acc, p_ext);
+    curve1174_point_double(&acc_mixed, p_ext);
+    for (uint64_t i = 0; i < TEST_NR_POINTS; ++i) {
+        curve1174_point_add(&acc, &acc, p_ext + i);
+        curve1174_point_add_mixed(&acc_mixed, &acc_mixed, p_pre + i);
+        test_check_on_curve(&acc_mixed, curve);
+        ck_assert(curve1174_point_equal(&acc, &acc_mixed));
+    }
+
+    // Adding a point to itself with the mixed addition
+    curve1174_point_double(&acc, p_ext + 1);
+    curve1174_point_add_mixed(&acc_mixed, p_ext + 1, p_pre + 1);
+    ck_assert(curve1174_point_equal(&acc, &acc_mixed));
+}
+END_TEST
+
+/**
+* \brief Test the 4-lane field arithmetic and point operations against the
+*        BigInt versions
+*/
+START_TEST(test_point_4)
+{
+    Curve curve;
+    CurvePoint p[TEST_NR_POINTS];
+    CurvePointExt p_ext[TEST_NR_POINTS], exp, r;
+    CurvePointPrecomp p_pre[TEST_NR_POINTS];
+    CurvePointExt4 acc4, p4, r4;
+    CurvePointPrecomp4 pre4;
+    Curve1174FieldElem4 a4, b4, r4_fe;
+    BigInt a[4], b[4], res[4];
+
+    BIG_INT_DEFINE_PTR(tmp);
+
+    init_curve1174(&curve);
+    test_gen_points(p, curve);
+
+    for (uint64_t i = 0; i < TEST_NR_POINTS; ++i) {
+        curve1174_point_from_affine(p_ext + i, p + i);
+        curve1174_point_precompute(p_pre + i, p + i);
+    }
+
+    // Field arithmetic, including the extremal values 0 and q - 1
+    big_int_copy(a, &(p[0].x));
+    big_int_copy(a + 1, big_int_zero);
+    big_int_sub(a + 2, q, big_int_one);
+    big_int_copy(a + 3, &(p[1].y));
+    big_int_copy(b, &(p[2].y));
+    big_int_sub(b + 1, q, big_int_one);
+    big_int_sub(b + 2, q, big_int_one);
+    big_int_copy(b + 3, big_int_zero);
+
+    curve1174_fe4_pack(&a4, a, a + 1, a + 2, a + 3);
+    curve1174_fe4_pack(&b4, b, b + 1, b + 2, b + 3);
+
+    curve1174_fe4_mul(&r4_fe, &a4, &b4);
+    curve1174_fe4_unpack(res, res + 1, res + 2, res + 3, &r4_fe);
+    for (uint64_t i = 0; i < 4; ++i) {
+        big_int_curve1174_mul_mod(tmp, a + i, b + i);
+        ck_assert_int_eq(big_int_compare(res + i, tmp), 0);
+    }
+
+    curve1174_fe4_add(&r4_fe, &a4, &b4);
+    curve1174_fe4_unpack(res, res + 1, res + 2, res + 3, &r4_fe);
+    for (uint64_t i = 0; i < 4; ++i) {
+        big_int_curve1174_add_mod(tmp, a + i, b + i);
+        ck_assert_int_eq(big_int_compare(res + i, tmp), 0);
+    }
+
+    curve1174_fe4_sub(&r4_fe, &a4, &b4);
+    curve1174_fe4_unpack(res, res + 1, res + 2, res + 3, &r4_fe);
+    for (uint64_t i = 0; i < 4; ++i) {
+        big_int_curve1174_sub_mod(tmp, a + i, b + i);
+        ck_assert_int_eq(big_int_compare(res + i, tmp), 0);
+    }
+
+    // Conversions
+    curve1174_point_4_from_ext(&p4, p_ext);
+    curve1174_point_4_to_ext(&r, &p4);
+    ck_assert(curve1174_point_equal(&r, p_ext));
+
+    curve1174_point_4_set_neutral(&r4);
+    curve1174_point_4_to_ext(&r, &r4);
+    curve1174_point_set_neutral(&exp);
+    ck_assert(curve1174_point_equal(&r, &exp));
+
+    // Accumulate all points with every 4-way operation, starting with a
+    // non-trivial Z coordinate
+    curve1174_point_double(&exp, p_ext);
+    curve1174_point_4_from_ext(&acc4, p_ext);
+    curve1174_point_4_double(&acc4, &acc4);
+    for (uint64_t i = 0; i < TEST_NR_POINTS; ++i) {
+        curve1174_point_add(&exp, &exp, p_ext + i);
+        curve1174_point_4_from_ext(&p4, p_ext + i);
+        curve1174_point_4_add(&acc4, &acc4, &p4);
+        curve1174_point_4_to_ext(&r, &acc4);
+        test_check_on_curve(&r, curve);
+        ck_assert(curve1174_point_equal(&r, &exp));
+
+        curve1174_point_add_mixed(&exp, &exp, p_pre + i);
+        curve1174_point_4_from_precomp(&pre4, p_pre + i);
+        curve1174_point_4_add_mixed(&acc4, &acc4, &pre4);
+        curve1174_point_4_to_ext(&r, &acc4);
+        test_check_on_curve(&r, curve);
+        ck_assert(curve1174_point_equal(&r, &exp));
+
+        curve1174_point_double(&exp, &exp);
+        curve1174_point_4_double(&acc4, &acc4);
+        curve1174_point_4_to_ext(&r, &acc4);
+        test_check_on_curve(&r, curve);
+        ck_assert(curve1174_point_equal(&r, &exp));
+    }
+
+    // The unified addition handles doublings and the neutral element
+    curve1174_point_4_from_ext(&p4, p_ext + 1);
+    curve1174_point_4_add(&r4, &p4, &p4);
+    curve1174_point_4_double(&acc4, &p4);
+    curve1174_point_4_to_ext(&r, &r4);
+    curve1174_point_4_to_ext(&exp, &acc4);
+    ck_assert(curve1174_point_equal(&r, &exp));
+
+    curve1174_point_4_set_neutral(&r4);
+    curve1174_point_4_add(&r4, &r4, &p4);
+    curve1174_point_4_to_ext(&r, &r4);
+    ck_assert(curve1174_point_equal(&r, p_ext + 1));
+}
+END_TEST
+
+/**
+* \brief Test fixed-base scalar multiplication [k]G
+*/
+START_TEST(test_scalar_mul_base)
+{
+    CurvePoint g, r, exp;
+    CurvePointExt g_ext, r_ext, o, ref;
+    uint64_t i;
+
+    BIG_INT_DEFINE_PTR(k);
+
+    char *ks[] = {
+        "2",
+        "123456789ABCDEF",
+        "592EA8545E41E09D5D1108759DF48EDE0054F225DF39D4F0F312450E0AA9DD25",
+        "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF",
+    };
+    char *exp_xs[] = {
+        "79A80493205EAABD8DBD138242543DCFCE7FE7F586FCEC0A3EFB76584FBE1C6",
+        "62C99169FE3DCB2D658958B98D2D934FD30EC779C50F7220267FCFC5F69E12A",
+        "2815795D77F11C78D56E7E9EE0E4FE164856046A07C5FA2E5E76833B8E3F9D9",
+        "34D325723E725DAAAE75847C223DF95D1BE3C0BCE9962B232B0289387767210",
+    };
+    char *exp_ys[] = {
+        "311E57112FF2CFFEA2CFE45BAED3F4A7064291BC8A18E229E94F6FBD93ECA27",
+        "7FB48A866217FCF798B8AC1759791533DBBE0981DF6C91C9092B241E93B6F0F",
+        "4B57840987B10A44C02B4136F26AC355B4D74370A9AF141598AB6712A62C119",
+        "55F543F4A275DFEA62585B5AAD7F96D8C584FD352DD460270A744316F96E910",
+    };
+
+    curve1174_base_point(&g);
+    curve1174_point_from_affine(&g_ext, &g);
+    curve1174_point_set_neutral(&o);
+
+    for (i = 0; i < sizeof(ks) / sizeof(ks[0]); ++i) {
+        big_int_create_from_hex(k, ks[i]);
+        big_int_create_from_hex(&(exp.x), exp_xs[i]);
+        big_int_create_from_hex(&(exp.y), exp_ys[i]);
+
+        curve1174_scalar_mul_base(&r_ext, k);
+        curve1174_point_to_affine(&r, &r_ext);
+        TEST_CURVE_POINT_EQ(r, exp);
+    }
+
+    // [0]G = [l]G = O, [1]G = G
+    curve1174_scalar_mul_base(&r_ext, big_int_zero);
+    ck_assert(curve1174_point_equal(&r_ext, &o));
+    curve1174_scalar_mul_base(&r_ext, curve1174_order);
+    ck_assert(curve1174_point_equal(&r_ext, &o));
+    curve1174_scalar_mul_base(&r_ext, big_int_one);
+    ck_assert(curve1174_point_equal(&r_ext, &g_ext));
+
+    // [l - 1]G = [-1]G = -G
+    big_int_sub(k, curve1174_order, big_int_one);
+    curve1174_scalar_mul_base(&r_ext, k);
+    curve1174_point_to_affine(&r, &r_ext);
+    big_int_curve1174_sub_mod(&(exp.x), big_int_zero, &(g.x));
+    big_int_copy(&(exp.y), &(g.y));
+    TEST_CURVE_POINT_EQ(r, exp);
+
+    curve1174_scalar_mul_base(&r_ext, big_int_min_one);
+    curve1174_point_to_affine(&r, &r_ext);
+    TEST_CURVE_POINT_EQ(r, exp);
+
+    // [k]G for small k against repeated additions
+    curve1174_point_set_neutral(&ref);
+    for (i = 0; i < 300; ++i) {
+        big_int_create_from_chunk(k, i, 0);
+        curve1174_scalar_mul_base(&r_ext, k);
+        ck_assert(curve1174_point_equal(&r_ext, &ref));
+        curve1174_point_add(&ref, &ref, &g_ext);
+    }
+}
+END_TEST
+
+/**
+* \brief Test variable-base scalar multiplication [k]P
+*/
+START_TEST(test_scalar_mul)
+{
+    Curve curve;
+    CurvePoint p[TEST_NR_POINTS], g;
+    CurvePointExt r_ext, exp_ext, p_ext, o;
+    uint64_t i, j;
+
+    BIG_INT_DEFINE_PTR(k);
+
+    char *ks[] = {
+        "1",
+        "123456789ABCDEF",
+        "592EA8545E41E09D5D1108759DF48EDE0054F225DF39D4F0F312450E0AA9DD25",
+        "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF",
+        "8000000000000000000000000000000000000000000000000000000000000000",
+        "F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F0F",
+    };
+
+    init_curve1174(&curve);
+    test_gen_points(p, curve);
+    curve1174_base_point(&g);
+    curve1174_point_set_neutral(&o);
+
+    for (i = 0; i < sizeof(ks) / sizeof(ks[0]); ++i) {
+        big_int_create_from_hex(k, ks[i]);
+
+        for (int8_t sign = 0; sign < 2; ++sign) {
+            k->sign = sign;
+
+            // Against the fixed-base multiplication
+            curve1174_scalar_mul(&r_ext, k, &g);
+            curve1174_scalar_mul_base(&exp_ext, k);
+            ck_assert(curve1174_point_equal(&r_ext, &exp_ext));
+
+            // Against double-and-add, the points from Elligator 1 do not
+            // necessarily lie in the subgroup generated by G.
+            for (j = 0; j < TEST_NR_POINTS; j += 3) {
+                curve1174_point_from_affine(&p_ext, p + j);
+                test_double_and_add(&exp_ext, k, &p_ext);
+                curve1174_scalar_mul(&r_ext, k, p + j);
+                ck_assert(curve1174_point_equal(&r_ext, &exp_ext));
+            }
+        }
+    }
+
+    // Small scalars against repeated additions
+    curve1174_point_from_affine(&p_ext, p);
+    curve1174_point_set_neutral(&exp_ext);
+    for (i = 0; i < 100; ++i) {
+        big_int_create_from_chunk(k, i, 0);
+        curve1174_scalar_mul(&r_ext, k, p);
+        ck_assert(curve1174_point_equal(&r_ext, &exp_ext));
+        curve1174_point_add(&exp_ext, &exp_ext, &p_ext);
+    }
+
+    // [l]G = O
+    curve1174_scalar_mul(&r_ext, curve1174_order, &g);
+    ck_assert(curve1174_point_equal(&r_ext, &o));
+}
+END_TEST
+
+/**
+* \brief Test multi-scalar multiplication with both methods against the sum
+*        of single scalar multiplications
+*/
+START_TEST(test_msm)
+{
+    Curve curve;
+    CurvePoint p[TEST_MSM_NR_POINTS];
+    CurvePointExt r_ext, exp_ext, tmp_ext;
+    BigInt t[TEST_MSM_NR_POINTS], k[TEST_MSM_NR_POINTS];
+    uint64_t i, n;
+
+    uint64_t ns[] = {0, 1, 2, 5, TEST_NR_POINTS, TEST_MSM_NR_POINTS};
+
+    init_curve1174(&curve);
+
+    for (i = 0; i < TEST_MSM_NR_POINTS; ++i) {
+        big_int_create_from_chunk(t + i, i + 2, 0);
+
+        // Mix full-size, short, zero and negative scalars
+        big_int_create_from_hex(k + i,
+            "592EA8545E41E09D5D1108759DF48EDE0054F225DF39D4F0F312450E0AA9DD25");
+        k[i].chunks[0] ^= i;
+        k[i].chunks[7] ^= (i * 0x9e3779b9) & 0x7fffffff;
+        if (i % 5 == 1)
+            big_int_create_from_chunk(k + i, i, 0);
+        if (i % 7 == 3)
+            big_int_create_from_chunk(k + i, 0, 0);
+        k[i].sign = (i % 3 == 2);
+    }
+    elligator_1_string_to_point_batch(p, t, TEST_MSM_NR_POINTS, curve);
+
+    for (i = 0; i < sizeof(ns) / sizeof(ns[0]); ++i) {
+        n = ns[i];
+
+        curve1174_point_set_neutral(&exp_ext);
+        for (uint64_t j = 0; j < n; ++j) {
+            curve1174_scalar_mul(&tmp_ext, k + j, p + j);
+            curve1174_point_add(&exp_ext, &exp_ext, &tmp_ext);
+        }
+
+        curve1174_msm_straus(&r_ext, k, p, n);
+        ck_assert(curve1174_point_equal(&r_ext, &exp_ext));
+
+        curve1174_msm_pippenger(&r_ext, k, p, n);
+        ck_assert(curve1174_point_equal(&r_ext, &exp_ext));
+
+        curve1174_msm(&r_ext, k, p, n);
+        ck_assert(curve1174_point_equal(&r_ext, &exp_ext));
+
+        curve1174_msm_str(&r_ext, k, t, n, curve);
+        ck_assert(curve1174_point_equal(&r_ext, &exp_ext));
+    }
+
+    // The window grows with the number of points
+    ck_assert_uint_le(curve1174_msm_pippenger_window(16, 252),
+                      curve1174_msm_pippenger_window(1 << 16, 252));
+    ck_assert_uint_le(curve1174_msm_pippenger_window(1ULL << 40, 252),
+                      CURVE1174_MSM_MAX_WINDOW);
+}
+END_TEST
+
+/**
+* \brief Test point compression and (batched) decompression
+*/
+START_TEST(test_compress)
+{
+    Curve curve;
+    CurvePoint p[TEST_NR_POINTS + 2], r[TEST_NR_POINTS + 6];
+    uint8_t buf[(TEST_NR_POINTS + 6) * CURVE1174_POINT_COMPRESSED_SIZE];
+    uint8_t ok[TEST_NR_POINTS + 6];
+    uint64_t i, nr_valid;
+
+    BIG_INT_DEFINE_PTR(y);
+
+    init_curve1174(&curve);
+    test_gen_points(p, curve);
+
+    // (0, 1) and (0, -1)
+    big_int_copy(&(p[TEST_NR_POINTS].x), big_int_zero);
+    big_int_copy(&(p[TEST_NR_POINTS].y), big_int_one);
+    big_int_copy(&(p[TEST_NR_POINTS + 1].x), big_int_zero);
+    big_int_sub(&(p[TEST_NR_POINTS + 1].y), q, big_int_one);
+
+    for (i = 0; i < TEST_NR_POINTS + 2; ++i) {
+        curve1174_point_compress(buf + i * CURVE1174_POINT_COMPRESSED_SIZE,
+            p + i);
+        ck_assert(curve1174_point_decompress(r + i,
+            buf + i * CURVE1174_POINT_COMPRESSED_SIZE));
+        TEST_CURVE_POINT_EQ(r[i], p[i]);
+    }
+
+    // Invalid encodings: y = q, (0, 1) with the sign bit set and a y without
+    // a matching x
+    big_int_to_bytes(buf + i * CURVE1174_POINT_COMPRESSED_SIZE, q,
+        CURVE1174_POINT_COMPRESSED_SIZE);
+    ck_assert(!curve1174_point_decompress(r + i,
+        buf + i * CURVE1174_POINT_COMPRESSED_SIZE));
+    ++i;
+
+    big_int_to_bytes(buf + i * CURVE1174_POINT_COMPRESSED_SIZE, big_int_one,
+        CURVE1174_POINT_COMPRESSED_SIZE);
+    buf[i * CURVE1174_POINT_COMPRESSED_SIZE] |= CURVE1174_POINT_SIGN_BIT;
+    ck_assert(!curve1174_point_decompress(r + i,
+        buf + i * CURVE1174_POINT_COMPRESSED_SIZE));
+    ++i;
+
+    for (uint64_t c = 2; ; ++c) {
+        big_int_create_from_chunk(y, c, 0);
+        big_int_to_bytes(buf + i * CURVE1174_POINT_COMPRESSED_SIZE, y,
+            CURVE1174_POINT_COMPRESSED_SIZE);
+        if (!curve1174_point_decompress(r + i,
+                buf + i * CURVE1174_POINT_COMPRESSED_SIZE))
+            break;
+    }
+    ck_assert_int_eq(big_int_compare(&(r[i].x), big_int_zero), 0);
+    ck_assert_int_eq(big_int_compare(&(r[i].y), big_int_one), 0);
+    ++i;
+
+    // Swap in an invalid encoding in the middle of the batch
+    memcpy(buf + i * CURVE1174_POINT_COMPRESSED_SIZE, buf,
+        CURVE1174_POINT_COMPRESSED_SIZE);
+    memcpy(buf, buf + (i - 1) * CURVE1174_POINT_COMPRESSED_SIZE,
+        CURVE1174_POINT_COMPRESSED_SIZE);
+    ++i;
+
+    ck_assert(!curve1174_point_decompress_batch(r, buf, i, ok));
+    nr_valid = 0;
+    for (uint64_t j = 0; j < i; ++j)
+        nr_valid += ok[j];
+    ck_assert_uint_eq(nr_valid, TEST_NR_POINTS + 2);
+    ck_assert(!ok[0]);
+    for (uint64_t j = 1; j < TEST_NR_POINTS + 2; ++j) {
+        ck_assert(ok[j]);
+        TEST_CURVE_POINT_EQ(r[j], p[j]);
+    }
+    ck_assert(ok[TEST_NR_POINTS + 5]);
+    TEST_CURVE_POINT_EQ(r[TEST_NR_POINTS + 5], p[0]);
+
+    ck_assert(curve1174_point_decompress_batch(r, buf
+        + CURVE1174_POINT_COMPRESSED_SIZE, TEST_NR_POINTS + 1, NULL));
+}
+END_TEST
+
+/**
+* \brief Test that both parties of an Elligator DH handshake derive the same
+*        point and that invalid public strings are rejected
+*/
+START_TEST(test_elligator_dh)
+{
+    Curve curve;
+    ElligatorDhKeypair alice, bob;
+    CurvePoint shared_a, shared_b;
+    Curve1174Cache cache;
+    uint64_t i;
+
+    BIG_INT_DEFINE_PTR(t);
+
+    init_curve1174(&curve);
+    curve1174_cache_init(&cache, 16 * sizeof(Curve1174CacheEntry), NULL);
+
+    for (i = 0; i < 4; ++i) {
+        elligator1_dh_keypair(&alice, curve);
+        elligator1_dh_keypair(&bob, curve);
+
+        ck_assert(!big_int_curve1174_gt_q_m1_d2(&(alice.public_str)));
+        ck_assert_uint_eq(alice.secret.chunks[0] & 3, 0);
+
+        // secret = 4 * k' with 0 < k' < l
+        big_int_srl_small(t, &(alice.secret), ELLIGATOR_DH_COFACTOR_SHIFT);
+        ck_assert_uint_eq(alice.secret.sign, 0);
+        ck_assert(!big_int_is_zero(t));
+        ck_assert_int_lt(big_int_compare(t, curve1174_order), 0);
+        ck_assert_int_ne(big_int_compare(&(alice.secret), &(bob.secret)), 0);
+
+        ck_assert(elligator1_dh_shared(&shared_a, &(alice.secret),
+            &(bob.public_str), curve));
+        ck_assert(elligator1_dh_shared(&shared_b, &(bob.secret),
+            &(alice.public_str), curve));
+        TEST_CURVE_POINT_EQ(shared_a, shared_b);
+
+        ck_assert(elligator1_dh_shared_cached(&shared_a, &(alice.secret),
+            &(bob.public_str), &cache, curve));
+        TEST_CURVE_POINT_EQ(shared_a, shared_b);
+    }
+
+    // t > (q - 1) / 2 and negative t
+    big_int_sub(t, q, big_int_one);
+    ck_assert(!elligator1_dh_shared(&shared_a, &(alice.secret), t, curve));
+    ck_assert_int_eq(big_int_compare(&(shared_a.x), big_int_zero), 0);
+    ck_assert_int_eq(big_int_compare(&(shared_a.y), big_int_one), 0);
+
+    big_int_neg(t, &(bob.public_str));
+    ck_assert(!elligator1_dh_shared(&shared_a, &(alice.secret), t, curve));
+    ck_assert(!elligator1_dh_shared_cached(&shared_a, &(alice.secret), t,
+        &cache, curve));
+
+    curve1174_cache_free(&cache);
+}
+END_TEST
+
+/**
+* \brief Test the batched on-curve check against the scalar one, including
+*        points with coordinates that are not reduced mod q
+*/
+START_TEST(test_validate_batch)
+{
+    Curve curve;
+    CurvePoint p[TEST_NR_POINTS + 7];
+    uint8_t ok[TEST_NR_POINTS + 7];
+    uint64_t i, n;
+
+    init_curve1174(&curve);
+    test_gen_points(p, curve);
+
+    // (0, 1) and (0, -1) are on the curve
+    big_int_copy(&(p[TEST_NR_POINTS].x), big_int_zero);
+    big_int_copy(&(p[TEST_NR_POINTS].y), big_int_one);
+    big_int_copy(&(p[TEST_NR_POINTS + 1].x), big_int_zero);
+    big_int_sub(&(p[TEST_NR_POINTS + 1].y), q, big_int_one);
+
+    // y + 1, x + q and -x are not (the last one is only invalid because of
+    // the sign)
+    p[TEST_NR_POINTS + 2] = p[0];
+    big_int_curve1174_add_mod(&(p[TEST_NR_POINTS + 2].y),
+        &(p[TEST_NR_POINTS + 2].y), big_int_one);
+    p[TEST_NR_POINTS + 3] = p[1];
+    big_int_add(&(p[TEST_NR_POINTS + 3].x), &(p[TEST_NR_POINTS + 3].x), q);
+    p[TEST_NR_POINTS + 4] = p[2];
+    big_int_neg(&(p[TEST_NR_POINTS + 4].x), &(p[TEST_NR_POINTS + 4].x));
+
+    // (q, 1) = (0, 1) mod q, (1, 0) is on the curve mod q
+    big_int_copy(&(p[TEST_NR_POINTS + 5].x), q);
+    big_int_copy(&(p[TEST_NR_POINTS + 5].y), big_int_one);
+    big_int_copy(&(p[TEST_NR_POINTS + 6].x), big_int_one);
+    big_int_copy(&(p[TEST_NR_POINTS + 6].y), big_int_zero);
+
+    n = TEST_NR_POINTS + 7;
+    ck_assert(!curve1174_validate_batch(p, n, ok));
+    for (i = 0; i < n; ++i) {
+        ck_assert_uint_eq(ok[i], curve1174_point_is_on_curve(p + i));
+        ck_assert_uint_eq(ok[i], i < TEST_NR_POINTS + 2
+            || i == TEST_NR_POINTS + 6);
+    }
+
+    // Lengths that are not a multiple of the number of lanes
+    for (n = 1; n <= TEST_NR_POINTS + 2; ++n)
+        ck_assert(curve1174_validate_batch(p, n, NULL));
+}
+END_TEST
+
+/**
+* \brief Test the LRU order of the precomputation cache and that its snapshot
+*        survives a restart
+*/
+START_TEST(test_cache)
+{
+    Curve curve;
+    Curve1174Cache cache;
+    Curve1174CacheStats stats;
+    Curve1174CacheEntry *e;
+    CurvePoint p, r, r_exp;
+    CurvePointExt r_ext;
+    BigInt t[TEST_NR_POINTS];
+    uint64_t i, budget, capacity;
+    char path[64];
+
+    BIG_INT_DEFINE_FROM_CHUNK(k, 0, 0x12345679);
+
+    init_curve1174(&curve);
+    for (i = 0; i < TEST_NR_POINTS; ++i)
+        big_int_create_from_chunk(t + i, i + 2, 0);
+
+    budget = 4 * sizeof(Curve1174CacheEntry);
+    capacity = curve1174_cache_capacity(budget);
+    ck_assert_uint_ge(capacity, 2);
+    ck_assert_uint_lt(capacity, TEST_NR_POINTS);
+
+    curve1174_cache_init(&cache, budget, NULL);
+    for (i = 0; i <= capacity; ++i) {
+        curve1174_cache_scalar_mul(&r_ext, &cache, k, t + i, curve);
+        curve1174_point_to_affine(&r, &r_ext);
+
+        elligator_1_string_to_point(&p, t + i, curve);
+        curve1174_scalar_mul(&r_ext, k, &p);
+        curve1174_point_to_affine(&r_exp, &r_ext);
+        TEST_CURVE_POINT_EQ(r, r_exp);
+    }
+
+    // t[0] was evicted, t[1] is still cached and becomes the most recent entry
+    curve1174_cache_get(&cache, t + 1, curve);
+    curve1174_cache_stats(&stats, &cache);
+    ck_assert_uint_eq(stats.hits, 1);
+    ck_assert_uint_eq(stats.misses, capacity + 1);
+
+    curve1174_cache_get(&cache, t, curve);
+    e = curve1174_cache_get(&cache, t + 1, curve);
+    elligator_1_string_to_point(&p, t + 1, curve);
+    TEST_CURVE_POINT_EQ(e->point, p);
+
+    curve1174_cache_stats(&stats, &cache);
+    ck_assert_uint_eq(stats.hits, 2);
+    ck_assert_uint_eq(stats.misses, capacity + 2);
+    ck_assert(stats.hit_rate > 0 && stats.hit_rate < 1);
+    ck_assert_uint_gt(stats.saved_cycles, 0);
+    curve1174_cache_free(&cache);
+
+    // Snapshot
+    snprintf(path, sizeof(path), "/tmp/curve1174_cache_test_%d",
+        (int) getpid());
+    unlink(path);
+
+    curve1174_cache_init(&cache, budget, path);
+    curve1174_cache_get(&cache, t, curve);
+    curve1174_cache_get(&cache, t + 1, curve);
+    curve1174_cache_free(&cache);
+
+    curve1174_cache_init(&cache, budget, path);
+    e = curve1174_cache_get(&cache, t, curve);
+    elligator_1_string_to_point(&p, t, curve);
+    TEST_CURVE_POINT_EQ(e->point, p);
+    curve1174_cache_stats(&stats, &cache);
+    ck_assert_uint_eq(stats.hits, 1);
+    ck_assert_uint_eq(stats.misses, 2);
+
+    // The buckets of a snapshot are rebuilt, not trusted
+    for (i = 0; i < cache.header->nr_buckets; ++i)
+        cache.buckets[i] = capacity;
+    curve1174_cache_free(&cache);
+
+    curve1174_cache_init(&cache, budget, path);
+    e = curve1174_cache_get(&cache, t + 1, curve);
+    elligator_1_string_to_point(&p, t + 1, curve);
+    TEST_CURVE_POINT_EQ(e->point, p);
+    curve1174_cache_stats(&stats, &cache);
+    ck_assert_uint_eq(stats.hits, 2);
+    ck_assert_uint_eq(stats.misses, 2);
+
+    // A snapshot with broken LRU links is discarded
+    cache.entries[cache.header->lru_head].lru_next = capacity;
+    curve1174_cache_free(&cache);
+
+    curve1174_cache_init(&cache, budget, path);
+    curve1174_cache_stats(&stats, &cache);
+    ck_assert_uint_eq(stats.hits + stats.misses, 0);
+    curve1174_cache_get(&cache, t, curve);
+    cache.header->lru_tail = capacity;
+    curve1174_cache_free(&cache);
+
+    curve1174_cache_init(&cache, budget, path);
+    curve1174_cache_stats(&stats, &cache);
+    ck_assert_uint_eq(stats.hits + stats.misses, 0);
+    curve1174_cache_free(&cache);
+
+    // A snapshot of a different size is discarded
+    curve1174_cache_init(&cache, 2 * budget, path);
+    curve1174_cache_stats(&stats, &cache);
+    ck_assert_uint_eq(stats.hits + stats.misses, 0);
+    curve1174_cache_free(&cache);
+
+    unlink(path);
+}
+END_TEST
+
+/**
+* \brief Test cofactor clearing and the (batched) subgroup check against
+*        [l]P computed with curve1174_scalar_mul
+*/
+START_TEST(test_subgroup)
+{
+    Curve curve;
+    CurvePoint p[2 * TEST_NR_POINTS + 1], r;
+    CurvePointExt p_ext, r_ext, t4;
+    uint8_t ok[2 * TEST_NR_POINTS + 1];
+    uint64_t i, n, nr_in_subgroup;
+    int8_t exp;
+
+    init_curve1174(&curve);
+    test_gen_points(p, curve);
+
+    // T4 = (1, 0) has order 4
+    big_int_copy(&(r.x), big_int_one);
+    big_int_copy(&(r.y), big_int_zero);
+    curve1174_point_from_affine(&t4, &r);
+
+    // 4P and 4P + T4
+    for (i = 0; i < TEST_NR_POINTS; ++i) {
+        curve1174_point_from_affine(&p_ext, p + i);
+        curve1174_clear_cofactor(&r_ext, &p_ext);
+
+        curve1174_point_double(&p_ext, &p_ext);
+        curve1174_point_double(&p_ext, &p_ext);
+        ck_assert(curve1174_point_equal(&r_ext, &p_ext));
+        curve1174_point_to_affine(p + TEST_NR_POINTS + i, &r_ext);
+    }
+    curve1174_point_add(&r_ext, &r_ext, &t4);
+    curve1174_point_to_affine(p + 2 * TEST_NR_POINTS, &r_ext);
+
+    n = 2 * TEST_NR_POINTS + 1;
+    ck_assert(!curve1174_point_is_in_subgroup_batch(p, n, ok));
+
+    nr_in_subgroup = 0;
+    for (i = 0; i < n; ++i) {
+        curve1174_scalar_mul(&r_ext, curve1174_order, p + i);
+        curve1174_point_to_affine(&r, &r_ext);
+        exp = big_int_is_zero(&(r.x))
+            && big_int_compare(&(r.y), big_int_one) == 0;
+
+        ck_assert_uint_eq(ok[i], exp);
+        ck_assert_uint_eq(curve1174_point_is_in_subgroup(p + i), exp);
+        nr_in_subgroup += exp;
+    }
+    // Some of the Elligator points have a component of small order
+    ck_assert_uint_lt(nr_in_subgroup, 2 * TEST_NR_POINTS);
+    for (i = TEST_NR_POINTS; i < 2 * TEST_NR_POINTS; ++i)
+        ck_assert(ok[i]);
+    ck_assert(!ok[2 * TEST_NR_POINTS]);
+
+    // The base point, and blocks that are not full
+    curve1174_base_point(&r);
+    ck_assert(curve1174_point_is_in_subgroup(&r));
+    ck_assert(curve1174_point_is_in_subgroup_batch(p + TEST_NR_POINTS,
+        TEST_NR_POINTS - 1, NULL));
+}
+END_TEST
+
+Suite *curve1174_point_suite(void)
+{
+    Suite *s;
+    TCase *tc_basic, *tc_advanced;
+
+    s = suite_create("Curve1174 Point Test Suite");
+
+    tc_basic = tcase_create("Basic Tests");
+    tcase_add_test(tc_basic, test_conversions);
+
+    tc_advanced = tcase_create("Advanced Tests");
+    tcase_add_test(tc_advanced, test_add_double);
+    tcase_add_test(tc_advanced, test_add_mixed);
+    tcase_add_test(tc_advanced, test_compress);
+    tcase_add_test(tc_advanced, test_validate_batch);
+    tcase_add_test(tc_advanced, test_point_4);
+    tcase_add_test(tc_advanced, test_scalar_mul_base);
+    tcase_add_test(tc_advanced, test_scalar_mul);
+    tcase_add_test(tc_advanced, test_msm);
+    tcase_add_test(tc_advanced, test_subgroup);
+    tcase_add_test(tc_advanced, test_elligator_dh);
+    tcase_add_test(tc_advanced, test_cache);
+
+    suite_add_tcase(s, tc_basic);
+    suite_add_tcase(s, tc_advanced);
+
+    return s;
+}
+
+ int main(void)
+ {
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = curve1174_point_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+ }
@@ -0,0 +1,257 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This is a test file for the Elligator 1 daemon. It starts the daemon binary
+ * (ELLIGATOR_DAEMON_BIN) and talks to it over its socket.
+ */
+
+/*
+ * Includes
+ */
+#include <check.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+
+// Include header files
+#include "elligator_records.h"
+#include "elligator_service.h"
+
+// Macros
+#define TEST_REQUEST_SIZE (1 + ELLIGATOR_RECORD_STRING_SIZE)
+#define TEST_NR_REQUESTS 100000
+#define TEST_REQUESTS_PER_SEND 64
+
+// Time without progress after which the daemon is considered to stall a
+// client
+#define TEST_STALL_MS 500
+
+#define TEST_CONNECT_RETRIES 200
+#define TEST_RECV_TIMEOUT_S 10
+
+/**
+* \brief Start the daemon on the socket path and return its pid
+*/
+static pid_t test_start_daemon(const char *path)
+{
+    pid_t pid;
+    int fd;
+
+    unlink(path);
+
+    pid = fork();
+    ck_assert_int_ge(pid, 0);
+
+    if (!pid) {
+#ifdef __linux__
+        // Do not outlive a test that fails
+        prctl(PR_SET_PDEATHSIG, SIGTERM);
+#endif
+        fd = open("/dev/null", O_WRONLY);
+        dup2(fd, STDERR_FILENO);
+        execl(ELLIGATOR_DAEMON_BIN, ELLIGATOR_DAEMON_BIN, "-s", path,
+            (char *) NULL);
+        _exit(EXIT_FAILURE);
+    }
+
+    return pid;
+}
+
+/**
+* \brief Connect to the daemon, waiting until it listens
+*/
+static int test_connect(const char *path)
+{
+    struct sockaddr_un addr;
+    struct timespec delay = { 0, 10000000 };
+    struct timeval timeout = { TEST_RECV_TIMEOUT_S, 0 };
+    int fd, i;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+
+    for (i = 0; i < TEST_CONNECT_RETRIES; ++i)
+    {
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        ck_assert_int_ge(fd, 0);
+
+        if (!connect(fd, (struct sockaddr *) &addr, sizeof(addr))) {
+            setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            return fd;
+        }
+
+        close(fd);
+        nanosleep(&delay, NULL);
+    }
+
+    ck_assert_msg(0, "cannot connect to the daemon");
+    return -1;
+}
+
+static void test_recv_all(int fd, uint8_t *buf, uint64_t len)
+{
+    ssize_t ret;
+
+    while (len)
+    {
+        ret = recv(fd, buf, len, 0);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        ck_assert_int_gt(ret, 0);
+        buf += ret;
+        len -= ret;
+    }
+}
+
+/**
+* \brief Test that the daemon stops reading from a client that sends requests
+*        without reading the responses, keeps serving other clients, and
+*        answers all requests it read once the client reads again
+*/
+START_TEST(test_daemon_stalled_client)
+{
+    ElligatorRecordCtx ctx;
+    char path[64];
+    uint8_t str[ELLIGATOR_RECORD_STRING_SIZE];
+    uint8_t exp[ELLIGATOR_RECORD_POINT_SIZE];
+    uint8_t point[ELLIGATOR_RECORD_POINT_SIZE];
+    uint8_t reqs[TEST_REQUESTS_PER_SEND * TEST_REQUEST_SIZE];
+    struct pollfd pfd;
+    uint64_t i, sent, len, nr_sent;
+    ssize_t ret;
+    pid_t pid;
+    int fd, other_fd, status;
+
+    // Expected response
+    str[0] = 0;
+    for (i = 1; i < ELLIGATOR_RECORD_STRING_SIZE; ++i)
+        str[i] = (uint8_t) (3 * i + 1);
+
+    elligator_records_init(&ctx, 1, 1);
+    elligator_records_decode(exp, str, 1, &ctx);
+    elligator_records_free(&ctx);
+
+    for (i = 0; i < TEST_REQUESTS_PER_SEND; ++i)
+    {
+        reqs[i * TEST_REQUEST_SIZE] = ELLIGATOR_SERVICE_OP_DECODE;
+        memcpy(reqs + i * TEST_REQUEST_SIZE + 1, str, sizeof(str));
+    }
+
+    snprintf(path, sizeof(path), "/tmp/elligator1-test-%d.sock",
+        (int) getpid());
+    pid = test_start_daemon(path);
+    fd = test_connect(path);
+
+    // Send requests without reading until the daemon stops reading them
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    pfd.fd = fd;
+    pfd.events = POLLOUT;
+
+    sent = 0;
+    while (sent < TEST_NR_REQUESTS * TEST_REQUEST_SIZE)
+    {
+        len = sizeof(reqs) - sent % sizeof(reqs);
+        if (len > TEST_NR_REQUESTS * TEST_REQUEST_SIZE - sent)
+            len = TEST_NR_REQUESTS * TEST_REQUEST_SIZE - sent;
+
+        ret = send(fd, reqs + sent % sizeof(reqs), len, MSG_NOSIGNAL);
+        if (ret > 0) {
+            sent += ret;
+            continue;
+        }
+        ck_assert(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR);
+
+        if (!poll(&pfd, 1, TEST_STALL_MS))
+            break;
+    }
+
+    // The socket buffers hold far less than all requests
+    ck_assert_uint_lt(sent, TEST_NR_REQUESTS * TEST_REQUEST_SIZE / 2);
+
+    // Other clients are still served
+    other_fd = test_connect(path);
+    ck_assert_int_eq(send(other_fd, reqs, TEST_REQUEST_SIZE, MSG_NOSIGNAL),
+        TEST_REQUEST_SIZE);
+    test_recv_all(other_fd, point, sizeof(point));
+    ck_assert_mem_eq(point, exp, sizeof(point));
+    close(other_fd);
+
+    // All complete requests are answered once the client reads again
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+    nr_sent = sent / TEST_REQUEST_SIZE;
+    for (i = 0; i < nr_sent; ++i)
+    {
+        test_recv_all(fd, point, sizeof(point));
+        ck_assert_mem_eq(point, exp, sizeof(point));
+    }
+    close(fd);
+
+    // The daemon did not die
+    ck_assert_int_eq(waitpid(pid, &status, WNOHANG), 0);
+    kill(pid, SIGTERM);
+    ck_assert_int_eq(waitpid(pid, &status, 0), pid);
+    ck_assert(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS);
+}
+END_TEST
+
+Suite *elligator_daemon_suite(void)
+{
+    Suite *s;
+    TCase *tc_basic;
+
+    s = suite_create("Elligator Daemon Test Suite");
+
+    tc_basic = tcase_create("Basic Tests");
+    tcase_set_timeout(tc_basic, 60);
+    tcase_add_test(tc_basic, test_daemon_stalled_client);
+
+    suite_add_tcase(s, tc_basic);
+
+    return s;
+}
+
+ int main(void)
+ {
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = elligator_daemon_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+ }
@@ -0,0 +1,185 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This is a unit test file to test the work-stealing thread pool and the
+ * parallel bulk Elligator mappings.
+ */
+
+/*
+ * Includes
+ */
+#include <check.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include header files
+#include "bigint.h"
+#include "elligator.h"
+#include "elligator_parallel.h"
+#include "debug.h"
+
+// Macros
+#define TEST_NR_ELEMENTS 1000
+#define TEST_CHUNK_SIZE 7
+
+/**
+* \brief Job counting how often every element was processed
+*/
+static void test_count_job(void *arg, uint64_t start, uint64_t len,
+    uint8_t *scratch)
+{
+    uint64_t i;
+
+    // The arena is private to the thread
+    memset(scratch, 0xff, ELLIGATOR_POOL_SCRATCH_SIZE);
+
+    for (i = start; i < start + len; ++i)
+        ((uint64_t *) arg)[i]++;
+}
+
+/**
+* \brief Test that every element is processed exactly once, also when the
+*        pool is reused and for more threads than chunks.
+*/
+START_TEST(test_pool_run)
+{
+    ElligatorPool *pool;
+    uint64_t counts[TEST_NR_ELEMENTS];
+    uint64_t nr_threads, i, run;
+
+    for (nr_threads = 1; nr_threads <= 8; nr_threads *= 2)
+    {
+        pool = elligator_pool_create(nr_threads);
+        memset(counts, 0, sizeof(counts));
+
+        for (run = 0; run < 3; ++run)
+            elligator_pool_run(pool, test_count_job, counts, TEST_NR_ELEMENTS,
+                TEST_CHUNK_SIZE);
+
+        // Fewer chunks than threads
+        elligator_pool_run(pool, test_count_job, counts, 2, TEST_CHUNK_SIZE);
+
+        for (i = 0; i < TEST_NR_ELEMENTS; ++i)
+            ck_assert_uint_eq(counts[i], (i < 2) ? 4 : 3);
+
+        elligator_pool_destroy(pool);
+    }
+
+    ck_assert_uint_ge(elligator_pool_chunk_size(1 << 30), ELLIGATOR_BATCH_SIZE);
+    ck_assert_uint_eq(elligator_pool_chunk_size(1) % ELLIGATOR_BATCH_SIZE, 0);
+}
+END_TEST
+
+/**
+* \brief Test that the parallel mappings match the batched ones
+*/
+START_TEST(test_parallel_mappings)
+{
+    Curve curve;
+    ElligatorPool *pool;
+    uint64_t n, i;
+
+    init_curve1174(&curve);
+
+    // Spans several chunks
+    n = 3 * elligator_pool_chunk_size(sizeof(BigInt) + sizeof(CurvePoint)) + 5;
+
+    BigInt *t = (BigInt *) malloc(n * sizeof(BigInt));
+    BigInt *t_res = (BigInt *) malloc(n * sizeof(BigInt));
+    BigInt *u = (BigInt *) malloc(2 * n * sizeof(BigInt));
+    CurvePoint *p = (CurvePoint *) malloc(n * sizeof(CurvePoint));
+    CurvePoint *p_exp = (CurvePoint *) malloc(n * sizeof(CurvePoint));
+
+    for (i = 0; i < n; ++i)
+        big_int_create_from_chunk(t + i, 5 * i + 2, 0);
+
+    pool = elligator_pool_create(4);
+
+    elligator_1_string_to_point_batch(p_exp, t, n, curve);
+    elligator_1_string_to_point_parallel(p, t, n, curve, pool);
+
+    // The chunks are small enough that all threads get several of them
+    ck_assert_uint_eq(pool->job_chunk_size % ELLIGATOR_BATCH_SIZE, 0);
+    ck_assert_uint_ge((n + pool->job_chunk_size - 1) / pool->job_chunk_size,
+        2 * pool->nr_threads);
+
+    for (i = 0; i < n; ++i)
+    {
+        ck_assert_int_eq(big_int_compare(&(p[i].x), &(p_exp[i].x)), 0);
+        ck_assert_int_eq(big_int_compare(&(p[i].y), &(p_exp[i].y)), 0);
+    }
+
+    elligator_1_point_to_string_parallel(t_res, p, n, curve, pool);
+    for (i = 0; i < n; ++i)
+        ck_assert_int_eq(big_int_compare(t_res + i, t + i), 0);
+
+    elligator_squared_encode_parallel(u, p_exp, n, curve, pool);
+    elligator_squared_decode_parallel(p, u, n, curve, pool);
+    for (i = 0; i < n; ++i)
+    {
+        ck_assert_int_eq(big_int_compare(&(p[i].x), &(p_exp[i].x)), 0);
+        ck_assert_int_eq(big_int_compare(&(p[i].y), &(p_exp[i].y)), 0);
+    }
+
+    elligator_pool_destroy(pool);
+
+    free(t);
+    free(t_res);
+    free(u);
+    free(p);
+    free(p_exp);
+}
+END_TEST
+
+Suite *elligator_parallel_suite(void)
+{
+    Suite *s;
+    TCase *tc_basic, *tc_advanced;
+
+    s = suite_create("Elligator Parallel Test Suite");
+
+    tc_basic = tcase_create("Basic Tests");
+    tcase_add_test(tc_basic, test_pool_run);
+
+    tc_advanced = tcase_create("Advanced Tests");
+    tcase_set_timeout(tc_advanced, 60);
+    tcase_add_test(tc_advanced, test_parallel_mappings);
+
+    suite_add_tcase(s, tc_basic);
+    suite_add_tcase(s, tc_advanced);
+
+    return s;
+}
+
+ int main(void)
+ {
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = elligator_parallel_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+ }
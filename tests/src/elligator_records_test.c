@@ -0,0 +1,186 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This is a unit test file to test mapping serialized Elligator 1 records.
+ */
+
+/*
+ * Includes
+ */
+#include <check.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include header files
+#include "bigint.h"
+#include "elligator.h"
+#include "elligator_records.h"
+#include "debug.h"
+
+// Macros
+#define TEST_NR_RECORDS (ELLIGATOR_BATCH_SIZE + 3)
+#define TEST_NR_HOSTILE 6
+
+/**
+* \brief Check that out holds the points of the strings t, which must be in
+*        [0, (q-1)/2]
+*/
+static void test_check_points(uint8_t *out, BigInt *t, uint64_t n,
+    Curve curve)
+{
+    CurvePoint p;
+    uint8_t exp[ELLIGATOR_RECORD_POINT_SIZE];
+    uint64_t i;
+
+    for (i = 0; i < n; ++i)
+    {
+        elligator_1_string_to_point(&p, t + i, curve);
+        big_int_to_bytes(exp, &(p.x), ELLIGATOR_RECORD_STRING_SIZE);
+        big_int_to_bytes(exp + ELLIGATOR_RECORD_STRING_SIZE, &(p.y),
+            ELLIGATOR_RECORD_STRING_SIZE);
+        ck_assert_mem_eq(out + i * ELLIGATOR_RECORD_POINT_SIZE, exp,
+            ELLIGATOR_RECORD_POINT_SIZE);
+    }
+}
+
+/**
+* \brief Test that a string of q - 1 in a batch is folded to 1 and leaves the
+*        other records of the batch intact
+*/
+START_TEST(test_decode_mixed)
+{
+    ElligatorRecordCtx ctx;
+    BigInt t[TEST_NR_RECORDS];
+    uint8_t in[TEST_NR_RECORDS * ELLIGATOR_RECORD_STRING_SIZE];
+    uint8_t out[TEST_NR_RECORDS * ELLIGATOR_RECORD_POINT_SIZE];
+    uint64_t i;
+
+    elligator_records_init(&ctx, TEST_NR_RECORDS, 1);
+
+    for (i = 0; i < TEST_NR_RECORDS; ++i)
+        big_int_create_from_chunk(t + i, 12345 + 7 * i, 0);
+    big_int_sub(t + 5, &(ctx.curve.q), big_int_one);
+
+    for (i = 0; i < TEST_NR_RECORDS; ++i)
+        big_int_to_bytes(in + i * ELLIGATOR_RECORD_STRING_SIZE, t + i,
+            ELLIGATOR_RECORD_STRING_SIZE);
+
+    elligator_records_decode(out, in, TEST_NR_RECORDS, &ctx);
+
+    // q - (q - 1) = 1
+    big_int_create_from_chunk(t + 5, 1, 0);
+    test_check_points(out, t, TEST_NR_RECORDS, ctx.curve);
+
+    elligator_records_free(&ctx);
+}
+END_TEST
+
+/**
+* \brief Test a batch as the daemon builds it from the requests of several
+*        clients, where one client sends strings outside of [0, (q-1)/2].
+*        These must map to the points of their folded values and must not
+*        affect the answers to the other clients.
+*/
+START_TEST(test_decode_hostile)
+{
+    ElligatorRecordCtx ctx;
+    BigInt t[2 * TEST_NR_RECORDS];
+    BigInt hostile[TEST_NR_HOSTILE];
+    uint8_t in[2 * TEST_NR_RECORDS * ELLIGATOR_RECORD_STRING_SIZE];
+    uint8_t out[2 * TEST_NR_RECORDS * ELLIGATOR_RECORD_POINT_SIZE];
+    uint64_t pos[TEST_NR_HOSTILE] = {0, 1, 4, 5, 17, 2 * TEST_NR_RECORDS - 1};
+    uint64_t i, n;
+
+    n = 2 * TEST_NR_RECORDS;
+
+    // Decode with a thread pool, as the daemon does with -t
+    elligator_records_init(&ctx, n, 2);
+
+    for (i = 0; i < n; ++i)
+        big_int_create_from_chunk(t + i, 1000 + 3 * i, 0);
+    big_int_create_from_hex(t + 9,
+        "3FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFB");
+
+    // Hostile strings and the values they are folded to
+    big_int_sub(hostile, &(ctx.curve.q), big_int_one);
+    big_int_copy(hostile + 1, &(ctx.curve.q));
+    big_int_add(hostile + 2, &(ctx.curve.q), big_int_one);
+    big_int_create_from_hex(hostile + 3,
+        "FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+    big_int_create_from_hex(hostile + 4,
+        "8000000000000000000000000000000000000000000000000000000000000000");
+    big_int_create_from_hex(hostile + 5,
+        "3FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC");
+
+    for (i = 0; i < TEST_NR_HOSTILE; ++i)
+        big_int_copy(t + pos[i], hostile + i);
+
+    for (i = 0; i < n; ++i)
+        big_int_to_bytes(in + i * ELLIGATOR_RECORD_STRING_SIZE, t + i,
+            ELLIGATOR_RECORD_STRING_SIZE);
+
+    elligator_records_decode(out, in, n, &ctx);
+
+    // q - 1 -> 1, q -> 0, q + 1 -> 1, 2^256 - 1 -> 287 (2^256 = 288 mod q),
+    // 2^255 -> 144, (q + 1) / 2 -> (q - 1) / 2
+    big_int_create_from_chunk(t + pos[0], 1, 0);
+    big_int_create_from_chunk(t + pos[1], 0, 0);
+    big_int_create_from_chunk(t + pos[2], 1, 0);
+    big_int_create_from_chunk(t + pos[3], 287, 0);
+    big_int_create_from_chunk(t + pos[4], 144, 0);
+    big_int_create_from_hex(t + pos[5],
+        "3FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFB");
+    test_check_points(out, t, n, ctx.curve);
+
+    elligator_records_free(&ctx);
+}
+END_TEST
+
+Suite *elligator_records_suite(void)
+{
+    Suite *s;
+    TCase *tc_basic;
+
+    s = suite_create("Elligator Records Test Suite");
+
+    tc_basic = tcase_create("Basic Tests");
+    tcase_add_test(tc_basic, test_decode_mixed);
+    tcase_add_test(tc_basic, test_decode_hostile);
+
+    suite_add_tcase(s, tc_basic);
+
+    return s;
+}
+
+ int main(void)
+ {
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = elligator_records_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+ }
@@ -33,6 +33,10 @@
 #include "elligator.h"
 #include "debug.h"
 
+#if VERSION > 2
+#include "bigint_curve1174.h"
+#endif
+
 // Macros
 #if VERSION == 1
 
@@ -353,6 +357,155 @@ START_TEST(test_advanced_string_to_point)
 END_TEST
 
 
+#if VERSION > 2
+/**
+* \brief Test that the batched mappings agree with the single element ones
+*/
+START_TEST(test_batch)
+{
+    Curve curve;
+    CurvePoint curve_point;
+    CurvePoint curve_points[ELLIGATOR_BATCH_SIZE + 3];
+    BigInt t[ELLIGATOR_BATCH_SIZE + 3];
+    BigInt r[ELLIGATOR_BATCH_SIZE + 3];
+    CurvePointPacked curve_points_packed[ELLIGATOR_BATCH_SIZE + 3];
+    BigInt256Packed t_packed[ELLIGATOR_BATCH_SIZE + 3];
+    uint64_t i, n;
+
+    n = ELLIGATOR_BATCH_SIZE + 3;
+
+    init_curve1174(&curve);
+
+    // Cover the special case t = 1 and more than one block
+    for (i = 0; i < n; ++i)
+        big_int_create_from_chunk(t + i, 3 * i + 1, 0);
+    big_int_create_from_hex(t + 5, "ABCDEF1234567899987654321ABCABCDEFDEF");
+    big_int_create_from_hex(t + 6,
+        "3FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFB");
+
+    elligator_1_string_to_point_batch(curve_points, t, n, curve);
+
+    for (i = 0; i < n; ++i)
+    {
+        elligator_1_string_to_point(&curve_point, t + i, curve);
+        TEST_CURVE_POINT_CMP(curve_points[i], TEST_REF(curve_point.x),
+            TEST_REF(curve_point.y));
+    }
+
+    elligator_1_point_to_string_batch(r, curve_points, n, curve);
+
+    for (i = 0; i < n; ++i)
+        ck_assert_int_eq(big_int_compare(r + i, t + i), 0);
+
+    // Same on packed arrays
+    big_int_pack(t_packed, t, n);
+    elligator_1_string_to_point_batch_packed(curve_points_packed, t_packed, n,
+        curve);
+    curve_point_unpack(curve_points, curve_points_packed, n);
+
+    for (i = 0; i < n; ++i)
+    {
+        elligator_1_string_to_point(&curve_point, t + i, curve);
+        TEST_CURVE_POINT_CMP(curve_points[i], TEST_REF(curve_point.x),
+            TEST_REF(curve_point.y));
+    }
+
+    elligator_1_point_to_string_batch_packed(t_packed, curve_points_packed, n,
+        curve);
+    big_int_unpack(r, t_packed, n);
+
+    for (i = 0; i < n; ++i)
+        ck_assert_int_eq(big_int_compare(r + i, t + i), 0);
+
+    // t = q - 1 (outside of the domain) makes 1 + t zero, which must not
+    // spoil the shared inversions of the other elements of the block
+    big_int_sub(t + 7, &(curve.q), big_int_one);
+
+    elligator_1_string_to_point_batch(curve_points, t, n, curve);
+
+    for (i = 0; i < n; ++i)
+    {
+        elligator_1_string_to_point(&curve_point, t + i, curve);
+        TEST_CURVE_POINT_CMP(curve_points[i], TEST_REF(curve_point.x),
+            TEST_REF(curve_point.y));
+    }
+}
+END_TEST
+
+/**
+* \brief Test Elligator Squared encoding and decoding
+*/
+START_TEST(test_elligator_squared)
+{
+    Curve curve;
+    CurvePoint p, p_dec;
+    CurvePoint points[ELLIGATOR_BATCH_SIZE + 1];
+    CurvePoint points_dec[ELLIGATOR_BATCH_SIZE + 1];
+    BigInt u[2 * (ELLIGATOR_BATCH_SIZE + 1)];
+    uint64_t i, n;
+
+    TEST_BIG_INT_DEFINE(u1);
+    TEST_BIG_INT_DEFINE(u2);
+    TEST_BIG_INT_DEFINE(x);
+    TEST_BIG_INT_DEFINE(y);
+
+    n = ELLIGATOR_BATCH_SIZE + 1;
+
+    init_curve1174(&curve);
+
+    // f(7) + f(123456789)
+    big_int_create_from_chunk(u1, 7, 0);
+    big_int_create_from_hex(u2, "75BCD15");
+    big_int_create_from_hex(x,
+        "7C357F0453C6639F98538216F880522289974899F0FF1FD6EEAFC21B9D22808");
+    big_int_create_from_hex(y,
+        "A2A093A4A1A03AEB3BC7C9605206A13201C90E71A51808A65C5331FEEB993B");
+
+    elligator_squared_decode(&p, u1, u2, curve);
+    TEST_CURVE_POINT_CMP(p, x, y);
+
+    // The encoding is randomized, but must decode to the same point
+    elligator_squared_encode(u1, u2, p, curve);
+    ck_assert_int_eq(big_int_curve1174_gt_q_m1_d2(u1), 0);
+    ck_assert_int_eq(big_int_curve1174_gt_q_m1_d2(u2), 0);
+
+    elligator_squared_decode(&p_dec, u1, u2, curve);
+    TEST_CURVE_POINT_CMP(p_dec, x, y);
+
+    // Neutral element (0, 1), which is f(1) + f(1)
+    big_int_create_from_chunk(x, 0, 0);
+    big_int_create_from_chunk(y, 1, 0);
+    big_int_create_from_chunk(TEST_REF(p.x), 0, 0);
+    big_int_create_from_chunk(TEST_REF(p.y), 1, 0);
+
+    elligator_squared_encode(u1, u2, p, curve);
+    elligator_squared_decode(&p_dec, u1, u2, curve);
+    TEST_CURVE_POINT_CMP(p_dec, x, y);
+
+    // Batched round trip over more than one block
+    for (i = 0; i < n; ++i)
+    {
+        big_int_create_from_chunk(u + 2 * i, 5 * i + 2, 0);
+        big_int_create_from_chunk(u + 2 * i + 1, 11 * i + 3, 0);
+    }
+    elligator_squared_decode_batch(points, u, n, curve);
+
+    elligator_squared_encode_batch(u, points, n, curve);
+    elligator_squared_decode_batch(points_dec, u, n, curve);
+
+    for (i = 0; i < n; ++i)
+        TEST_CURVE_POINT_CMP(points_dec[i], TEST_REF(points[i].x),
+            TEST_REF(points[i].y));
+
+    TEST_BIG_INT_DESTROY(u1);
+    TEST_BIG_INT_DESTROY(u2);
+    TEST_BIG_INT_DESTROY(x);
+    TEST_BIG_INT_DESTROY(y);
+}
+END_TEST
+#endif
+
+
 Suite *elligator_suite(void)
 {
     Suite *s;
@@ -369,6 +522,10 @@ Suite *elligator_suite(void)
     tc_advanced = tcase_create("Advanced Tests");
     tcase_add_test(tc_advanced, test_advanced_curve1174);
     tcase_add_test(tc_advanced, test_advanced_string_to_point);
+#if VERSION > 2
+    tcase_add_test(tc_advanced, test_batch);
+    tcase_add_test(tc_advanced, test_elligator_squared);
+#endif
 
     suite_add_tcase(s, tc_basic);
     suite_add_tcase(s, tc_advanced);
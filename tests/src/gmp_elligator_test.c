@@ -222,6 +222,69 @@ START_TEST(test_chi)
 }
 END_TEST
 
+/**
+ * \brief Test the extended GCD of GMP on the multi-limb inputs of test_gcd in
+ *        bigint_test.c, such that the expected values there are cross-checked
+ *        against GMP.
+ */
+START_TEST(test_gcdext)
+{
+    mpz_t a, b, g, x, y, g_exp, x_exp, y_exp;
+
+    const char *vectors[][5] = {
+        {"3A0F5C7E9B1D24686E0F1A2B3C4D5E6F708192A3B4C5D6E7F8091A2B3C4D5E6F",
+         "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7",
+         "1",
+         "-EB3840171AAB3A5A4CCB424C425417A5494707486216C05F363140801F8F15",
+         "6AB1B79B114613AD4D617F6EA611556BFCAED23E6222D5CF9EF6DD36EF0B1C4"},
+        {"7344A7F9C78E525CE23A29E3F9978BDF381AF8C33E741CD4B5037E6967D2EC2",
+         "BA82023500B514A5FE78E4582F4C7C9542261C883F7884C6B39C84D65381493",
+         "1",
+         "-473D5A3B3926C2491C3EBA7435B4F0B60A0B23C5010467F1FE99066CEBAE5D1",
+         "2C074DBE8E679013C5FB6F6FC3E29B292E0FD4FE3D6FB4E2B66A77FC7C248F1"},
+        {"16432F8D339894AF482F9140ACB61C0C0211531806191D97EB4616A778EF8794"
+         "E979B11B",
+         "-10CBD0B709C4A7C7A2EC2E447739602736C20EFD8665AB251B1D92735495632E"
+         "1424FAB42391151",
+         "1B2D3F4E5A6978123456789ABCDEF01",
+         "4C946A392B2E238E192B7995201D479D1BFE9CCEC8C62BDC",
+         "6580A6CD4386BF8D08ECDE5F9E99CDCC84C1AB543"},
+    };
+
+    mpz_init(a);
+    mpz_init(b);
+    mpz_init(g);
+    mpz_init(x);
+    mpz_init(y);
+    mpz_init(g_exp);
+    mpz_init(x_exp);
+    mpz_init(y_exp);
+
+    for (uint64_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); ++i)
+    {
+        mpz_set_str(a, vectors[i][0], 16);
+        mpz_set_str(b, vectors[i][1], 16);
+        mpz_set_str(g_exp, vectors[i][2], 16);
+        mpz_set_str(x_exp, vectors[i][3], 16);
+        mpz_set_str(y_exp, vectors[i][4], 16);
+
+        mpz_gcdext(g, x, y, a, b);
+        ck_assert_int_eq(mpz_cmp(g, g_exp), 0);
+        ck_assert_int_eq(mpz_cmp(x, x_exp), 0);
+        ck_assert_int_eq(mpz_cmp(y, y_exp), 0);
+    }
+
+    mpz_clear(a);
+    mpz_clear(b);
+    mpz_clear(g);
+    mpz_clear(x);
+    mpz_clear(y);
+    mpz_clear(g_exp);
+    mpz_clear(x_exp);
+    mpz_clear(y_exp);
+}
+END_TEST
+
 /**
  * \brief Check Curve1174 constants
  */
@@ -548,6 +611,7 @@ Suite *gmp_elligator_suite(void)
     tc_chi = tcase_create("Chi function");
 
     tcase_add_test(tc_chi, test_chi);
+    tcase_add_test(tc_chi, test_gcdext);
 
     tc_basic = tcase_create("Basic tests");
 
@@ -0,0 +1,255 @@
+/*
+ * This file is part of the ASL project "Censorship-avoiding high-speed EC
+ * (Elligator with Curve1174)"
+ * (https://github.com/Miro-H/optimizing-elligator-1).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Contact: miro.haller@alumni.ethz.ch
+ *
+ * Short description of this file:
+ * This is a unit test file to test SHA-512 and the hash_to_curve
+ * implementation. The hash_to_curve test vectors are generated with
+ * scripts/elligator.sage.
+ */
+
+/*
+ * Includes
+ */
+#include <check.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include header files
+#include "bigint.h"
+#include "elligator.h"
+#include "sha512.h"
+#include "hash_to_curve.h"
+#include "debug.h"
+
+// Macros
+#define TEST_DST "CURVE1174_XMD:SHA-512_ELL1_RO_TESTGEN"
+#define TEST_NR_MSGS 5
+
+#define TEST_CURVE_POINT_CMP(curve, exp_x, exp_y)                              \
+    do {                                                                       \
+        ck_assert_int_eq(big_int_compare(&((curve).x), (exp_x)), 0);           \
+        ck_assert_int_eq(big_int_compare(&((curve).y), (exp_y)), 0);           \
+    } while (0)
+
+/**
+* \brief Convert a hex string to bytes
+*/
+static uint8_t *test_hex_to_bytes(uint8_t *r, const char *hex)
+{
+    uint64_t i;
+
+    for (i = 0; hex[2*i]; ++i)
+        sscanf(hex + 2*i, "%2hhx", r + i);
+
+    return r;
+}
+
+/**
+* \brief Test SHA-512 with the FIPS 180-4 examples
+*/
+START_TEST(test_sha512)
+{
+    uint8_t digest[SHA512_DIGEST_SIZE];
+    uint8_t exp_digest[SHA512_DIGEST_SIZE];
+    uint8_t msg[1000];
+
+    sha512(digest, NULL, 0);
+    test_hex_to_bytes(exp_digest,
+        "cf83e1357eefb8bdf1542850d66d8007d620e4050b5715dc83f4a921d36ce9ce"
+        "47d0d13c5d85f2b0ff8318d2877eec2f63b931bd47417a81a538327af927da3e");
+    ck_assert_mem_eq(digest, exp_digest, SHA512_DIGEST_SIZE);
+
+    sha512(digest, (const uint8_t *) "abc", 3);
+    test_hex_to_bytes(exp_digest,
+        "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+        "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f");
+    ck_assert_mem_eq(digest, exp_digest, SHA512_DIGEST_SIZE);
+
+    // Multiple blocks
+    memset(msg, 'a', sizeof(msg));
+    sha512(digest, msg, sizeof(msg));
+    test_hex_to_bytes(exp_digest,
+        "67ba5535a46e3f86dbfbed8cbbaf0125c76ed549ff8b0b9e03e0c88cf90fa634"
+        "fa7b12b47d77b694de488ace8d9a65967dc96df599727d3292a8d9d447709c97");
+    ck_assert_mem_eq(digest, exp_digest, SHA512_DIGEST_SIZE);
+}
+END_TEST
+
+/**
+* \brief Test SHA-512 with data fed in uneven chunks
+*/
+START_TEST(test_sha512_streaming)
+{
+    Sha512Ctx ctx;
+    uint8_t digest[SHA512_DIGEST_SIZE];
+    uint8_t exp_digest[SHA512_DIGEST_SIZE];
+    uint8_t msg[1000];
+    uint64_t i, len;
+
+    for (i = 0; i < sizeof(msg); ++i)
+        msg[i] = (uint8_t) (7 * i + 3);
+
+    sha512(exp_digest, msg, sizeof(msg));
+
+    sha512_init(&ctx);
+    for (i = 0, len = 1; i < sizeof(msg); i += len, len = 2 * len + 1)
+    {
+        if (i + len > sizeof(msg))
+            len = sizeof(msg) - i;
+        sha512_update(&ctx, msg + i, len);
+    }
+    sha512_final(digest, &ctx);
+
+    ck_assert_mem_eq(digest, exp_digest, SHA512_DIGEST_SIZE);
+}
+END_TEST
+
+/**
+* \brief Test expand_message_xmd with the vectors from RFC 9380, appendix K.3
+*/
+START_TEST(test_expand_message_xmd)
+{
+    const uint8_t *dst = (const uint8_t *) "QUUX-V01-CS02-with-expander-SHA512-256";
+    uint8_t out[0x20];
+    uint8_t exp_out[0x20];
+
+    expand_message_xmd(out, 0x20, NULL, 0, dst, strlen((const char *) dst));
+    test_hex_to_bytes(exp_out,
+        "6b9a7312411d92f921c6f68ca0b6380730a1a4d982c507211a90964c394179ba");
+    ck_assert_mem_eq(out, exp_out, 0x20);
+
+    expand_message_xmd(out, 0x20, (const uint8_t *) "abc", 3, dst,
+        strlen((const char *) dst));
+    test_hex_to_bytes(exp_out,
+        "0da749f12fbe5483eb066a5f595055679b976e93abe9be6f0f6318bce7aca8dc");
+    ck_assert_mem_eq(out, exp_out, 0x20);
+}
+END_TEST
+
+/**
+* \brief Test hash_to_curve against test vectors and check that the streaming
+*        and batched interfaces agree with the one-shot one.
+*/
+START_TEST(test_hash_to_curve)
+{
+    Curve curve;
+    HashToCurveCtx ctx;
+    CurvePoint r;
+    CurvePoint r_batch[TEST_NR_MSGS];
+    BIG_INT_DEFINE_PTR(exp_x);
+    BIG_INT_DEFINE_PTR(exp_y);
+
+    char q128[5 + 128 + 1];
+    char a512[5 + 512 + 1];
+    const uint8_t *dst = (const uint8_t *) TEST_DST;
+    const uint8_t *msgs[TEST_NR_MSGS];
+    uint64_t msg_lens[TEST_NR_MSGS];
+    uint64_t i;
+
+    char *exp_xs[TEST_NR_MSGS] = {
+        "6D8C4FDA5A84507D48BBCB753D2E23F51C0A82620F866663C503F6DCB13E4B1",
+        "79C97706750AB7AE3D442D9E047149795C08242437E36CDD6B2AC262AB70FA5",
+        "2161A2D5062CD0CC5CD5321E9E7D481D6BE6D64051317187BC227D5C493F584",
+        "14BD28E2CE0E982FF96A95E0771D92CADDF529416189EADF0FD8DC0AE0F2B10",
+        "2485C83F51907EF482B82C8A34202643F19B3AD71EE70EA602BDAA2BE3BF88C",
+    };
+    char *exp_ys[TEST_NR_MSGS] = {
+        "430C8F54DB697A5C4B876303F9673195A9CFCDE6E9E017751D0A148732B9EF1",
+        "431BDFC185943B3D9EA49DB87B7DE66A98BBD59DB786732E5C56766F5640718",
+        "27B040767D7B1A37750EB21B5CDF0A3EDF5E5BF1F2AA6A961C9264018186E99",
+        "5F14FF724432489E5176D88B8877EC7B78A2BB3628504D8B20D07533C9A9FC2",
+        "5AC7B50348C63D0C3507DC815163D8E72B2DB0944C27D6E74BA2BFDF40E56B9",
+    };
+
+    init_curve1174(&curve);
+
+    strcpy(q128, "q128_");
+    memset(q128 + 5, 'q', 128);
+    q128[5 + 128] = 0;
+    strcpy(a512, "a512_");
+    memset(a512 + 5, 'a', 512);
+    a512[5 + 512] = 0;
+
+    msgs[0] = (const uint8_t *) "";
+    msgs[1] = (const uint8_t *) "abc";
+    msgs[2] = (const uint8_t *) "abcdef0123456789";
+    msgs[3] = (const uint8_t *) q128;
+    msgs[4] = (const uint8_t *) a512;
+    for (i = 0; i < TEST_NR_MSGS; ++i)
+        msg_lens[i] = strlen((const char *) msgs[i]);
+
+    hash_to_curve_batch(r_batch, msgs, msg_lens, TEST_NR_MSGS, dst,
+        strlen(TEST_DST), curve);
+
+    for (i = 0; i < TEST_NR_MSGS; ++i)
+    {
+        big_int_create_from_hex(exp_x, exp_xs[i]);
+        big_int_create_from_hex(exp_y, exp_ys[i]);
+
+        hash_to_curve(&r, msgs[i], msg_lens[i], dst, strlen(TEST_DST), curve);
+        TEST_CURVE_POINT_CMP(r, exp_x, exp_y);
+
+        TEST_CURVE_POINT_CMP(r_batch[i], exp_x, exp_y);
+
+        // Feed the message one byte at a time
+        hash_to_curve_init(&ctx, dst, strlen(TEST_DST));
+        for (uint64_t j = 0; j < msg_lens[i]; ++j)
+            hash_to_curve_update(&ctx, msgs[i] + j, 1);
+        hash_to_curve_final(&r, &ctx, curve);
+        TEST_CURVE_POINT_CMP(r, exp_x, exp_y);
+    }
+}
+END_TEST
+
+Suite *hash_to_curve_suite(void)
+{
+    Suite *s;
+    TCase *tc_basic, *tc_advanced;
+
+    s = suite_create("Hash to Curve Test Suite");
+
+    tc_basic = tcase_create("Basic Tests");
+    tcase_add_test(tc_basic, test_sha512);
+    tcase_add_test(tc_basic, test_sha512_streaming);
+    tcase_add_test(tc_basic, test_expand_message_xmd);
+
+    tc_advanced = tcase_create("Advanced Tests");
+    tcase_add_test(tc_advanced, test_hash_to_curve);
+
+    suite_add_tcase(s, tc_basic);
+    suite_add_tcase(s, tc_advanced);
+
+    return s;
+}
+
+ int main(void)
+ {
+    int number_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = hash_to_curve_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+    return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+ }
@@ -6,75 +6,130 @@
 #ifndef BENCHMARK_TYPES_H_
 #define BENCHMARK_TYPES_H_
 
-#define BENCH_TYPE_ABS                    0
-#define BENCH_TYPE_ADD                    1
-#define BENCH_TYPE_ADD_256                2
-#define BENCH_TYPE_ADD_256_AVX            3
-#define BENCH_TYPE_ADD_GENERAL            4
-#define BENCH_TYPE_ADD_MOD_CURVE          5
-#define BENCH_TYPE_ADD_MOD_RANDOM         6
-#define BENCH_TYPE_ADD_OPTIMAL_BOUND      7
-#define BENCH_TYPE_ALLOC                  8
-#define BENCH_TYPE_CALLOC                 9
-#define BENCH_TYPE_CHI                    10
-#define BENCH_TYPE_COMPARE                11
-#define BENCH_TYPE_COMPARE_TO_Q           12
-#define BENCH_TYPE_COPY                   13
-#define BENCH_TYPE_CREATE                 14
-#define BENCH_TYPE_CREATE_DBL_CHUNK       15
-#define BENCH_TYPE_CREATE_HEX             16
-#define BENCH_TYPE_CREATE_RANDOM          17
-#define BENCH_TYPE_CURVE_1174_ADD_MOD     18
-#define BENCH_TYPE_CURVE_1174_CHI         19
-#define BENCH_TYPE_CURVE_1174_COMPARE     20
-#define BENCH_TYPE_CURVE_1174_DIV_MOD     21
-#define BENCH_TYPE_CURVE_1174_INV_FERMAT  22
-#define BENCH_TYPE_CURVE_1174_MOD         23
-#define BENCH_TYPE_CURVE_1174_MOD_512     24
-#define BENCH_TYPE_CURVE_1174_MUL_MOD     25
-#define BENCH_TYPE_CURVE_1174_POW         26
-#define BENCH_TYPE_CURVE_1174_POW_Q_M1_D2 27
-#define BENCH_TYPE_CURVE_1174_POW_Q_M2    28
-#define BENCH_TYPE_CURVE_1174_POW_Q_P1_D4 29
-#define BENCH_TYPE_CURVE_1174_POW_SMALL   30
-#define BENCH_TYPE_CURVE_1174_SQUARE_MOD  31
-#define BENCH_TYPE_CURVE_1174_SUB_MOD     32
-#define BENCH_TYPE_DESTROY                33
-#define BENCH_TYPE_DIV                    34
-#define BENCH_TYPE_DIVREM                 35
-#define BENCH_TYPE_DIV_MOD_CURVE          36
-#define BENCH_TYPE_DUPLICATE              37
-#define BENCH_TYPE_EGCD                   38
-#define BENCH_TYPE_ELLIGATOR1_PNT2STR     39
-#define BENCH_TYPE_ELLIGATOR1_STR2PNT     40
-#define BENCH_TYPE_INV                    41
-#define BENCH_TYPE_IS_ODD                 42
-#define BENCH_TYPE_IS_ZERO                43
-#define BENCH_TYPE_MOD_512_CURVE          44
-#define BENCH_TYPE_MOD_CURVE              45
-#define BENCH_TYPE_MOD_RANDOM             46
-#define BENCH_TYPE_MUL                    47
-#define BENCH_TYPE_MUL_256                48
-#define BENCH_TYPE_MUL_256_AVX            49
-#define BENCH_TYPE_MUL_GENERAL            50
-#define BENCH_TYPE_MUL_MOD_CURVE          51
-#define BENCH_TYPE_MUL_MOD_RANDOM         52
-#define BENCH_TYPE_MUL_SINGLE_CHUNK       53
-#define BENCH_TYPE_MUL_SQUARE             54
-#define BENCH_TYPE_MUL_SQUARE_MOD_CURVE   55
-#define BENCH_TYPE_NEG                    56
-#define BENCH_TYPE_POW_CURVE              57
-#define BENCH_TYPE_POW_Q_M1_D2_CURVE      58
-#define BENCH_TYPE_POW_Q_P1_D4_CURVE      59
-#define BENCH_TYPE_POW_RANDOM             60
-#define BENCH_TYPE_POW_SMALL_CURVE        61
-#define BENCH_TYPE_PRUNE                  62
-#define BENCH_TYPE_SLL                    63
-#define BENCH_TYPE_SQUARE                 64
-#define BENCH_TYPE_SRL                    65
-#define BENCH_TYPE_SUB                    66
-#define BENCH_TYPE_SUB_MOD_CURVE          67
-#define BENCH_TYPE_SUB_MOD_RANDOM         68
-#define BENCH_TYPE_SUB_OPTIMAL_BOUND      69
+#define BENCH_TYPE_ABS                               0
+#define BENCH_TYPE_ADD                               1
+#define BENCH_TYPE_ADD_256                           2
+#define BENCH_TYPE_ADD_256_AVX                       3
+#define BENCH_TYPE_ADD_GENERAL                       4
+#define BENCH_TYPE_ADD_MOD_CURVE                     5
+#define BENCH_TYPE_ADD_MOD_RANDOM                    6
+#define BENCH_TYPE_ADD_OPTIMAL_BOUND                 7
+#define BENCH_TYPE_ALLOC                             8
+#define BENCH_TYPE_CALLOC                            9
+#define BENCH_TYPE_CHI                               10
+#define BENCH_TYPE_COMPARE                           11
+#define BENCH_TYPE_COMPARE_TO_Q                      12
+#define BENCH_TYPE_COPY                              13
+#define BENCH_TYPE_CREATE                            14
+#define BENCH_TYPE_CREATE_DBL_CHUNK                  15
+#define BENCH_TYPE_CREATE_HEX                        16
+#define BENCH_TYPE_CREATE_RANDOM                     17
+#define BENCH_TYPE_CURVE_1174_ADD_MOD                18
+#define BENCH_TYPE_CURVE_1174_CACHE_SCALAR_MUL       19
+#define BENCH_TYPE_CURVE_1174_CHI                    20
+#define BENCH_TYPE_CURVE_1174_CLEAR_COFACTOR         21
+#define BENCH_TYPE_CURVE_1174_COMPARE                22
+#define BENCH_TYPE_CURVE_1174_DIV_MOD                23
+#define BENCH_TYPE_CURVE_1174_INV_FERMAT             24
+#define BENCH_TYPE_CURVE_1174_MOD                    25
+#define BENCH_TYPE_CURVE_1174_MOD_512                26
+#define BENCH_TYPE_CURVE_1174_MSM                    27
+#define BENCH_TYPE_CURVE_1174_MSM_PIPPENGER          28
+#define BENCH_TYPE_CURVE_1174_MSM_STRAUS             29
+#define BENCH_TYPE_CURVE_1174_MUL_MOD                30
+#define BENCH_TYPE_CURVE_1174_POINT_4_ADD            31
+#define BENCH_TYPE_CURVE_1174_POINT_4_ADD_MIXED      32
+#define BENCH_TYPE_CURVE_1174_POINT_4_DOUBLE         33
+#define BENCH_TYPE_CURVE_1174_POINT_ADD              34
+#define BENCH_TYPE_CURVE_1174_POINT_ADD_MIXED        35
+#define BENCH_TYPE_CURVE_1174_POINT_COMPRESS         36
+#define BENCH_TYPE_CURVE_1174_POINT_DECOMPRESS       37
+#define BENCH_TYPE_CURVE_1174_POINT_DECOMPRESS_BATCH 38
+#define BENCH_TYPE_CURVE_1174_POINT_DOUBLE           39
+#define BENCH_TYPE_CURVE_1174_POINT_IS_ON_CURVE      40
+#define BENCH_TYPE_CURVE_1174_POINT_LOAD_AFFINE      41
+#define BENCH_TYPE_CURVE_1174_POINT_PRECOMPUTE       42
+#define BENCH_TYPE_CURVE_1174_POINT_TO_AFFINE        43
+#define BENCH_TYPE_CURVE_1174_POW                    44
+#define BENCH_TYPE_CURVE_1174_POW_Q_M1_D2            45
+#define BENCH_TYPE_CURVE_1174_POW_Q_M2               46
+#define BENCH_TYPE_CURVE_1174_POW_Q_P1_D4            47
+#define BENCH_TYPE_CURVE_1174_POW_SMALL              48
+#define BENCH_TYPE_CURVE_1174_SCALAR_MUL             49
+#define BENCH_TYPE_CURVE_1174_SCALAR_MUL_BASE        50
+#define BENCH_TYPE_CURVE_1174_SCALAR_MUL_STR         51
+#define BENCH_TYPE_CURVE_1174_SQUARE_MOD             52
+#define BENCH_TYPE_CURVE_1174_SUBGROUP_CHECK         53
+#define BENCH_TYPE_CURVE_1174_SUBGROUP_CHECK_BATCH   54
+#define BENCH_TYPE_CURVE_1174_SUB_MOD                55
+#define BENCH_TYPE_CURVE_1174_VALIDATE_BATCH         56
+#define BENCH_TYPE_DESTROY                           57
+#define BENCH_TYPE_DIV                               58
+#define BENCH_TYPE_DIVREM                            59
+#define BENCH_TYPE_DIV_MOD_CURVE                     60
+#define BENCH_TYPE_DUPLICATE                         61
+#define BENCH_TYPE_EGCD                              62
+#define BENCH_TYPE_ELLIGATOR1_PNT2STR                63
+#define BENCH_TYPE_ELLIGATOR1_PNT2STR_BATCH          64
+#define BENCH_TYPE_ELLIGATOR1_PNT2STR_PARALLEL       65
+#define BENCH_TYPE_ELLIGATOR1_STR2PNT                66
+#define BENCH_TYPE_ELLIGATOR1_STR2PNT_BATCH          67
+#define BENCH_TYPE_ELLIGATOR1_STR2PNT_PARALLEL       68
+#define BENCH_TYPE_ELLIGATOR_DH_HANDSHAKE            69
+#define BENCH_TYPE_ELLIGATOR_SQUARED_DECODE          70
+#define BENCH_TYPE_ELLIGATOR_SQUARED_ENCODE          71
+#define BENCH_TYPE_FILL_RANDOM                       72
+#define BENCH_TYPE_HASH_TO_CURVE                     73
+#define BENCH_TYPE_HASH_TO_CURVE_BATCH               74
+#define BENCH_TYPE_INV                               75
+#define BENCH_TYPE_IS_ODD                            76
+#define BENCH_TYPE_IS_ZERO                           77
+#define BENCH_TYPE_MOD_512_CURVE                     78
+#define BENCH_TYPE_MOD_BARRETT_512_CURVE             79
+#define BENCH_TYPE_MOD_BARRETT_RANDOM                80
+#define BENCH_TYPE_MOD_CURVE                         81
+#define BENCH_TYPE_MOD_RANDOM                        82
+#define BENCH_TYPE_MONT_MUL_CURVE                    83
+#define BENCH_TYPE_MONT_MUL_N_1024                   84
+#define BENCH_TYPE_MONT_MUL_N_256                    85
+#define BENCH_TYPE_MONT_MUL_N_384                    86
+#define BENCH_TYPE_MONT_MUL_N_512                    87
+#define BENCH_TYPE_MONT_MUL_RANDOM                   88
+#define BENCH_TYPE_MUL                               89
+#define BENCH_TYPE_MUL_256                           90
+#define BENCH_TYPE_MUL_256_AVX                       91
+#define BENCH_TYPE_MUL_GENERAL                       92
+#define BENCH_TYPE_MUL_MOD_BARRETT_RANDOM            93
+#define BENCH_TYPE_MUL_MOD_CURVE                     94
+#define BENCH_TYPE_MUL_MOD_RANDOM                    95
+#define BENCH_TYPE_MUL_N_1024                        96
+#define BENCH_TYPE_MUL_N_256                         97
+#define BENCH_TYPE_MUL_N_384                         98
+#define BENCH_TYPE_MUL_N_512                         99
+#define BENCH_TYPE_MUL_SINGLE_CHUNK                  100
+#define BENCH_TYPE_MUL_SQUARE                        101
+#define BENCH_TYPE_MUL_SQUARE_MOD_CURVE              102
+#define BENCH_TYPE_MUL_UNBALANCED                    103
+#define BENCH_TYPE_NEG                               104
+#define BENCH_TYPE_POW_512_CURVE                     105
+#define BENCH_TYPE_POW_CURVE                         106
+#define BENCH_TYPE_POW_MONT_CURVE                    107
+#define BENCH_TYPE_POW_MONT_N_1024                   108
+#define BENCH_TYPE_POW_MONT_N_256                    109
+#define BENCH_TYPE_POW_MONT_N_384                    110
+#define BENCH_TYPE_POW_MONT_N_512                    111
+#define BENCH_TYPE_POW_MONT_RANDOM                   112
+#define BENCH_TYPE_POW_Q_M1_D2_CURVE                 113
+#define BENCH_TYPE_POW_Q_P1_D4_CURVE                 114
+#define BENCH_TYPE_POW_RANDOM                        115
+#define BENCH_TYPE_POW_SMALL_CURVE                   116
+#define BENCH_TYPE_PRUNE                             117
+#define BENCH_TYPE_SLL                               118
+#define BENCH_TYPE_SQUARE                            119
+#define BENCH_TYPE_SRL                               120
+#define BENCH_TYPE_SUB                               121
+#define BENCH_TYPE_SUB_MOD_CURVE                     122
+#define BENCH_TYPE_SUB_MOD_RANDOM                    123
+#define BENCH_TYPE_SUB_OPTIMAL_BOUND                 124
 
 #endif // BENCHMARK_TYPES_H_
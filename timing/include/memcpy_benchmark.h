@@ -18,10 +18,32 @@
 #define REPS 10000
 #endif
 
+#if VERSION > 2
+#include "bigint.h"
+
+// The working-set benchmarks sweep arrays of 2^k elements, for k in
+// [WORKING_SET_MIN_LOG, WORKING_SET_MAX_LOG]. Every call processes
+// WORKING_SET_ELEMS elements, i.e., several passes over small arrays, such
+// that the cycles per call can be compared across array sizes.
+#define WORKING_SET_MIN_LOG 12
+#define WORKING_SET_MAX_LOG 21
+#define WORKING_SET_STEP_LOG 3
+#define WORKING_SET_ELEMS (1 << WORKING_SET_MAX_LOG)
+#define WORKING_SET_REPS 4
+#define WORKING_SET_BLOCK_SIZE 16
+#endif
+
 /*
  * Global variables
  */
 void **mem_array;
 int64_t mem_elem_size;
 
+#if VERSION > 2
+BigInt *working_set_array;
+BigInt256Packed *working_set_packed_array;
+int64_t working_set_nr_elems;
+volatile uint64_t working_set_sink;
+#endif
+
 #endif // MEMCPY_BENCHMARK_H_
@@ -21,6 +21,10 @@
 #include "bigint.h"
 #include "elligator.h"
 
+#if VERSION > 2
+#include "elligator_parallel.h"
+#endif
+
 // Create macro to define a BigInt chunk according to the different APIs of
 // different versions of our code
 #if VERSION == 1
@@ -86,6 +90,17 @@ CurvePoint *curve_point_array;
 int8_t *int8_t_array_1;
 uint64_t *uint64_t_array_1;
 
+// Messages for hash_to_curve
+uint8_t *msg_array;
+const uint8_t **msg_ptr_array;
+uint64_t *msg_len_array;
+
+#if VERSION > 2
+ElligatorPool *bench_pool;
+BigIntMontCtx *mont_ctx_array;
+BigIntBarrettCtx *barrett_ctx_array;
+#endif
+
 int big_int_size_;
 int big_int_array_size_;
 
@@ -93,6 +108,10 @@ int bench_big_int_size_256_args[] = {BIGINTSIZE, REPS, 1};
 int bench_big_int_size_256_random_mod_args[] = {BIGINTSIZE, REPS, 1};
 int bench_big_int_size_256_curve_mod_args[] = {BIGINTSIZE, REPS, 0};
 int bench_big_int_size_512_curve_mod_args[] = {2 * BIGINTSIZE, REPS, 0};
+#if VERSION > 2
+// The width of fixed-width BigInts is given by the benchmarked family
+int bench_big_int_n_args[] = {0, REPS, 1};
+#endif
 
 
 #endif // RUNTIME_BENCHMARK_H_
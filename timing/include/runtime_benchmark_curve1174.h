@@ -14,6 +14,13 @@
 #endif
 
 #include "bigint.h"
+#if VERSION > 2
+#include "elligator.h"
+#include "curve1174_point.h"
+#include "curve1174_point_4.h"
+#include "curve1174_cache.h"
+#include "elligator_dh.h"
+#endif
 
 /*
  * Global BigInt variables
@@ -29,6 +36,38 @@ uint64_t *uint64_t_array;
 
 int big_int_array_size_;
 
+#if VERSION > 2
+Curve bench_curve;
+
+CurvePoint *curve_point_array;
+CurvePointExt *curve_point_ext_array_1;
+CurvePointExt *curve_point_ext_array_2;
+CurvePointPrecomp *curve_point_precomp_array;
+
+CurvePointExt4 *curve_point_ext4_array_1;
+CurvePointExt4 *curve_point_ext4_array_2;
+CurvePointPrecomp4 *curve_point_precomp4_array;
+
+// Compressed (32 bytes) and affine (x || y, 64 bytes big-endian) points
+uint8_t *point_compressed_array;
+uint8_t *point_affine_bytes_array;
+
+// Results of the on-curve validation
+uint8_t *point_valid_array;
+
+// Points and scalars shared by all MSM benchmarks, generated only once
+CurvePoint *msm_point_array;
+BigInt *msm_scalar_array;
+CurvePointExt msm_result;
+int bench_msm_n;
+
+// Precomputation cache holding the points of all peers
+Curve1174Cache bench_cache;
+
+// Key pairs of both parties of the Elligator DH handshakes
+ElligatorDhKeypair *dh_keypair_array;
+#endif
+
 int bench_big_int_curve_1174_args[] = {REPS};
 
 
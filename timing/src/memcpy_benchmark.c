@@ -21,7 +21,8 @@
  * Contact: miro.haller@alumni.ethz.ch
  *
  * Short description of this file:
- * This file implements benchmarks of memcpy.
+ * This file implements benchmarks of memcpy and of the working set of BigInt
+ * arrays.
  */
 
 /*
@@ -65,6 +66,73 @@ void bench_memcpy_cleanup(void *argptr)
     free(mem_array);
 }
 
+#if VERSION > 2
+void bench_working_set_prep(void *argptr)
+{
+    uint8_t buf[32];
+    int64_t i, j;
+
+    working_set_nr_elems = ((int64_t *)argptr)[0];
+    working_set_array = (BigInt *) malloc(working_set_nr_elems * sizeof(BigInt));
+    working_set_packed_array = (BigInt256Packed *) malloc(
+        working_set_nr_elems * sizeof(BigInt256Packed));
+
+    for (i = 0; i < working_set_nr_elems; ++i)
+    {
+        for (j = 0; j < 32; ++j)
+            buf[j] = rand();
+        big_int_create_from_bytes(working_set_array + i, buf, 32);
+    }
+    big_int_pack(working_set_packed_array, working_set_array,
+        working_set_nr_elems);
+}
+
+/**
+ * \brief Read all chunks of WORKING_SET_ELEMS BigInts
+ */
+void bench_working_set_bigint_fn(void *argptr)
+{
+    uint64_t acc = 0;
+    int64_t i, j;
+
+    for (i = 0; i < WORKING_SET_ELEMS; ++i)
+    {
+        BigInt *a = working_set_array + (i & (working_set_nr_elems - 1));
+        for (j = 0; j < a->size; ++j)
+            acc ^= a->chunks[j];
+    }
+    working_set_sink = acc;
+}
+
+/**
+ * \brief Same as bench_working_set_bigint_fn, but the array is stored packed
+ *        and unpacked block by block into a buffer that stays in L1
+ */
+void bench_working_set_packed_fn(void *argptr)
+{
+    BigInt buf[WORKING_SET_BLOCK_SIZE];
+    uint64_t acc = 0;
+    int64_t i, j, k;
+
+    for (i = 0; i < WORKING_SET_ELEMS; i += WORKING_SET_BLOCK_SIZE)
+    {
+        big_int_unpack(buf,
+            working_set_packed_array + (i & (working_set_nr_elems - 1)),
+            WORKING_SET_BLOCK_SIZE);
+        for (k = 0; k < WORKING_SET_BLOCK_SIZE; ++k)
+            for (j = 0; j < buf[k].size; ++j)
+                acc ^= buf[k].chunks[j];
+    }
+    working_set_sink = acc;
+}
+
+void bench_working_set_cleanup(void *argptr)
+{
+    free(working_set_array);
+    free(working_set_packed_array);
+}
+#endif
+
 int main(int argc, char const *argv[])
 {
     int64_t bench_memcpy_32_args[] = {
@@ -107,6 +175,43 @@ int main(int argc, char const *argv[])
     benchmark_runner(bench_memcpy_overhead_closure, "benchmark overhead",
         LOG_PATH "/memcpy_benchmark_overhead.log", SETS, REPS, 0);
 
+#if VERSION > 2
+    char bench_name[64];
+    char log_fname[256];
+
+    for (int64_t k = WORKING_SET_MIN_LOG; k <= WORKING_SET_MAX_LOG;
+         k += WORKING_SET_STEP_LOG)
+    {
+        int64_t bench_working_set_args[] = {
+            1 << k,
+        };
+
+        BenchmarkClosure bench_working_set_bigint_closure = {
+            .bench_prep_args = bench_working_set_args,
+            .bench_prep_fn = bench_working_set_prep,
+            .bench_fn = bench_working_set_bigint_fn,
+            .bench_cleanup_fn = bench_working_set_cleanup,
+        };
+
+        sprintf(bench_name, "working set 2^%" PRId64 " BigInts", k);
+        sprintf(log_fname, LOG_PATH "/working_set_bigint_%" PRId64 ".log", k);
+        benchmark_runner(bench_working_set_bigint_closure, bench_name,
+            log_fname, SETS, WORKING_SET_REPS, 0);
+
+        BenchmarkClosure bench_working_set_packed_closure = {
+            .bench_prep_args = bench_working_set_args,
+            .bench_prep_fn = bench_working_set_prep,
+            .bench_fn = bench_working_set_packed_fn,
+            .bench_cleanup_fn = bench_working_set_cleanup,
+        };
+
+        sprintf(bench_name, "working set 2^%" PRId64 " packed BigInts", k);
+        sprintf(log_fname, LOG_PATH "/working_set_packed_%" PRId64 ".log", k);
+        benchmark_runner(bench_working_set_packed_closure, bench_name,
+            log_fname, SETS, WORKING_SET_REPS, 0);
+    }
+#endif
+
 
     return EXIT_SUCCESS;
 }
@@ -31,12 +31,17 @@
 #include <stdio.h>
 #include <assert.h>
 #include <time.h> // for random BigInt
+#include <unistd.h>
 
 // Include header files
 #include "runtime_benchmark.h"
 #include "bigint.h"
 #include "elligator.h"
 #include "debug.h"
+#if VERSION > 2
+#include "hash_to_curve.h"
+#include "bigint_n.h"
+#endif
 #include "benchmark_helpers.h"
 #include "benchmark_types.h"
 
@@ -91,8 +96,16 @@ void bench_big_int_prep(void *argptr)
                 "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF7");
         }
 
+#if VERSION < 3
         uint64_t_array_1[i] = rand() % 256;
+#endif
     }
+
+#if VERSION > 2
+    big_int_rng_fill(NULL, uint64_t_array_1, array_size);
+    for (uint64_t i = 0; i < array_size; i++)
+        uint64_t_array_1[i] %= 256;
+#endif
 }
 
 // Run after benchmark
@@ -336,6 +349,108 @@ void bench_elligator_1_point_to_string_cleanup(void *argptr)
 
 //=== === === === === === === === === === === === === === ===
 
+#if VERSION > 2
+void bench_elligator_squared_prep(void *argptr)
+{
+    RUNTIME_BIG_INT_DEFINE(q_half);
+
+    big_int_size_ = ((int *)argptr)[0];
+    int64_t array_size = ((int *)argptr)[1];
+
+    // Two strings per point
+    RUNTIME_BIG_INT_ALLOC_ARR(big_int_array, 2 * array_size);
+
+    init_curve1174(&bench_curve);
+    curve_point_array = (CurvePoint *) malloc(array_size * sizeof(CurvePoint));
+
+    // q_half = (q-1)/2
+    big_int_srl_small(q_half, RUNTIME_REF(bench_curve.q), 1);
+
+    for (uint64_t i = 0; i < 2 * array_size; i++)
+    {
+        // t \in [0, (q-1)/2)
+        RUNTIME_BIG_INT_CREATE_RANDOM(RUNTIME_DEREF(big_int_array, i), big_int_size_);
+        big_int_mod(RUNTIME_DEREF(big_int_array, i),
+            RUNTIME_DEREF(big_int_array, i), q_half);
+    }
+
+    // Uniformly distributed points
+    elligator_squared_decode_batch(curve_point_array, big_int_array,
+        array_size, bench_curve);
+}
+
+// Run after benchmark
+void bench_elligator_squared_cleanup(void *argptr)
+{
+    free(curve_point_array);
+    free(big_int_array);
+}
+
+//=== === === === === === === === === === === === === === === ===
+
+// Length of the random messages hashed to the curve
+#define BENCH_HASH_TO_CURVE_MSG_LEN 64
+
+void bench_hash_to_curve_prep(void *argptr)
+{
+    int64_t array_size = ((int *)argptr)[1];
+
+    init_curve1174(&bench_curve);
+    curve_point_array = (CurvePoint *) malloc(array_size * sizeof(CurvePoint));
+
+    msg_array = (uint8_t *) malloc(array_size * BENCH_HASH_TO_CURVE_MSG_LEN);
+    msg_ptr_array = (const uint8_t **) malloc(array_size * sizeof(uint8_t *));
+    msg_len_array = (uint64_t *) malloc(array_size * sizeof(uint64_t));
+
+    for (uint64_t i = 0; i < array_size; i++)
+    {
+        for (uint64_t j = 0; j < BENCH_HASH_TO_CURVE_MSG_LEN; j++)
+            msg_array[i * BENCH_HASH_TO_CURVE_MSG_LEN + j] = rand() % 256;
+
+        msg_ptr_array[i] = msg_array + i * BENCH_HASH_TO_CURVE_MSG_LEN;
+        msg_len_array[i] = BENCH_HASH_TO_CURVE_MSG_LEN;
+    }
+}
+
+// Run after benchmark
+void bench_hash_to_curve_cleanup(void *argptr)
+{
+    free(curve_point_array);
+    free(msg_array);
+    free(msg_ptr_array);
+    free(msg_len_array);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+// argptr[2] is the number of threads of the pool
+void bench_elligator_1_string_to_point_parallel_prep(void *argptr)
+{
+    bench_elligator_1_string_to_point_prep(argptr);
+    bench_pool = elligator_pool_create(((int *)argptr)[2]);
+}
+
+void bench_elligator_1_string_to_point_parallel_cleanup(void *argptr)
+{
+    elligator_pool_destroy(bench_pool);
+    bench_elligator_1_string_to_point_cleanup(argptr);
+}
+
+void bench_elligator_1_point_to_string_parallel_prep(void *argptr)
+{
+    bench_elligator_1_point_to_string_prep(argptr);
+    bench_pool = elligator_pool_create(((int *)argptr)[2]);
+}
+
+void bench_elligator_1_point_to_string_parallel_cleanup(void *argptr)
+{
+    elligator_pool_destroy(bench_pool);
+    bench_elligator_1_point_to_string_cleanup(argptr);
+}
+#endif
+
+//=== === === === === === === === === === === === === === ===
+
 #if VERSION == 1
 void bench_big_int_alloc_fn(void *arg)
 {
@@ -521,6 +636,35 @@ void bench_big_int_create_random(void *bench_args, char *bench_name, char *path)
 
 //=== === === === === === === === === === === === === === ===
 
+#if VERSION > 2
+// Fills BENCH_FILL_RANDOM_LEN BigInts on every BENCH_FILL_RANDOM_LEN-th call,
+// such that the reported cycles are per BigInt.
+#define BENCH_FILL_RANDOM_LEN 32
+
+void bench_big_int_fill_random_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    if (i % BENCH_FILL_RANDOM_LEN)
+        return;
+
+    big_int_fill_random(big_int_array + i, (REPS - i < BENCH_FILL_RANDOM_LEN)
+        ? REPS - i : BENCH_FILL_RANDOM_LEN, 256);
+}
+
+void bench_big_int_fill_random(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_big_int_small_prep,
+        .bench_fn = bench_big_int_fill_random_fn,
+        .bench_cleanup_fn = bench_big_int_small_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, REPS);
+}
+#endif
+
+//=== === === === === === === === === === === === === === ===
+
 #if VERSION == 1
 void bench_big_int_duplicate_fn(void *arg)
 {
@@ -686,6 +830,28 @@ void bench_big_int_mul(void *bench_args, char *bench_name, char *path)
 
 //=== === === === === === === === === === === === === === ===
 
+void bench_big_int_mul_unbalanced_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    big_int_mul(RUNTIME_DEREF(big_int_array_1, i),
+        RUNTIME_DEREF(big_int_array_2, i),
+        RUNTIME_DEREF(big_int_64_bit_array, i));
+}
+
+void bench_big_int_mul_unbalanced(void *bench_args, char *bench_name,
+    char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_big_int_prep,
+        .bench_fn = bench_big_int_mul_unbalanced_fn,
+        .bench_cleanup_fn = bench_big_int_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
 #if VERSION > 2
 void bench_big_int_mul_general_fn(void *arg)
 {
@@ -981,6 +1147,76 @@ void bench_big_int_mod(void *bench_args, char *bench_name, char *path)
     benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
 }
 
+#if VERSION > 2
+// Run before Barrett benchmarks: make the moduli positive and precompute their
+// contexts
+void bench_big_int_barrett_prep(void *argptr)
+{
+    int64_t array_size = ((int *)argptr)[1];
+
+    bench_big_int_prep(argptr);
+
+    barrett_ctx_array = (BigIntBarrettCtx *) malloc(
+        array_size * sizeof(BigIntBarrettCtx));
+
+    for (uint64_t i = 0; i < array_size; i++)
+    {
+        big_int_abs(RUNTIME_DEREF(big_int_array_q, i),
+            RUNTIME_DEREF(big_int_array_q, i));
+        big_int_barrett_ctx_init(barrett_ctx_array + i,
+            RUNTIME_DEREF(big_int_array_q, i));
+    }
+}
+
+// Run after Barrett benchmarks
+void bench_big_int_barrett_cleanup(void *argptr)
+{
+    free(barrett_ctx_array);
+    bench_big_int_cleanup(argptr);
+}
+
+void bench_big_int_mod_barrett_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    big_int_mod_barrett(RUNTIME_DEREF(big_int_array_1, i),
+        RUNTIME_DEREF(big_int_array_2, i), barrett_ctx_array + i);
+}
+
+void bench_big_int_mod_barrett(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_big_int_barrett_prep,
+        .bench_fn = bench_big_int_mod_barrett_fn,
+        .bench_cleanup_fn = bench_big_int_barrett_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_big_int_mul_mod_barrett_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+
+    big_int_mul_mod_barrett(RUNTIME_DEREF(big_int_array_1, i),
+        RUNTIME_DEREF(big_int_array_2, i), RUNTIME_DEREF(big_int_array_3, i),
+        barrett_ctx_array + i);
+}
+
+void bench_big_int_mul_mod_barrett(void *bench_args, char *bench_name,
+    char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_big_int_barrett_prep,
+        .bench_fn = bench_big_int_mul_mod_barrett_fn,
+        .bench_cleanup_fn = bench_big_int_barrett_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+#endif
+
 //=== === === === === === === === === === === === === === ===
 
 void bench_big_int_inv_fn(void *arg)
@@ -1024,6 +1260,201 @@ void bench_big_int_pow(void *bench_args, char *bench_name, char *path)
 
 //=== === === === === === === === === === === === === === ===
 
+#if VERSION > 2
+// Run before Montgomery benchmarks: make the moduli odd and positive,
+// precompute their contexts, and convert the operands to Montgomery form
+void bench_big_int_mont_prep(void *argptr)
+{
+    int64_t array_size = ((int *)argptr)[1];
+
+    bench_big_int_prep(argptr);
+
+    mont_ctx_array = (BigIntMontCtx *) malloc(
+        array_size * sizeof(BigIntMontCtx));
+
+    for (uint64_t i = 0; i < array_size; i++)
+    {
+        big_int_abs(RUNTIME_DEREF(big_int_array_q, i),
+            RUNTIME_DEREF(big_int_array_q, i));
+        RUNTIME_DEREF(big_int_array_q, i)->chunks[0] |= 1;
+
+        big_int_mont_ctx_init(mont_ctx_array + i,
+            RUNTIME_DEREF(big_int_array_q, i));
+        big_int_to_mont(RUNTIME_DEREF(big_int_array_2, i),
+            RUNTIME_DEREF(big_int_array_2, i), mont_ctx_array + i);
+        big_int_to_mont(RUNTIME_DEREF(big_int_array_3, i),
+            RUNTIME_DEREF(big_int_array_3, i), mont_ctx_array + i);
+    }
+}
+
+// Run after Montgomery benchmarks
+void bench_big_int_mont_cleanup(void *argptr)
+{
+    free(mont_ctx_array);
+    bench_big_int_cleanup(argptr);
+}
+
+void bench_big_int_mont_mul_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+
+    big_int_mont_mul(RUNTIME_DEREF(big_int_array_1, i),
+        RUNTIME_DEREF(big_int_array_2, i), RUNTIME_DEREF(big_int_array_3, i),
+        mont_ctx_array + i);
+}
+
+void bench_big_int_mont_mul(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_big_int_mont_prep,
+        .bench_fn = bench_big_int_mont_mul_fn,
+        .bench_cleanup_fn = bench_big_int_mont_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_big_int_pow_mont_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    big_int_pow_mont(RUNTIME_DEREF(big_int_array_1, i),
+        RUNTIME_DEREF(big_int_array_2, i), RUNTIME_DEREF(big_int_array_3, i),
+        mont_ctx_array + i);
+}
+
+void bench_big_int_pow_mont(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_big_int_mont_prep,
+        .bench_fn = bench_big_int_pow_mont_fn,
+        .bench_cleanup_fn = bench_big_int_mont_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+// Benchmarks of the fixed-width BigInt families. Random odd moduli have the
+// top bit set, operands have it cleared such that they are reduced.
+#define BENCH_BIG_INT_N_DEFINE(bits)                                           \
+                                                                               \
+BigInt##bits *big_int_##bits##_array_1, *big_int_##bits##_array_2,             \
+    *big_int_##bits##_array_3;                                                 \
+BigInt##bits##MontCtx *big_int_##bits##_ctx_array;                             \
+BigInt##bits##Wide *big_int_##bits##_wide_array;                              \
+                                                                               \
+void bench_big_int_##bits##_prep(void *argptr)                                 \
+{                                                                              \
+    int64_t array_size = ((int *)argptr)[1];                                   \
+    BigInt##bits q;                                                            \
+                                                                               \
+    big_int_##bits##_array_1 = (BigInt##bits *) malloc(                        \
+        array_size * sizeof(BigInt##bits));                                    \
+    big_int_##bits##_array_2 = (BigInt##bits *) malloc(                        \
+        array_size * sizeof(BigInt##bits));                                    \
+    big_int_##bits##_array_3 = (BigInt##bits *) malloc(                        \
+        array_size * sizeof(BigInt##bits));                                    \
+    big_int_##bits##_ctx_array = (BigInt##bits##MontCtx *) malloc(             \
+        array_size * sizeof(BigInt##bits##MontCtx));                           \
+    big_int_##bits##_wide_array = (BigInt##bits##Wide *) malloc(              \
+        array_size * sizeof(BigInt##bits##Wide));                              \
+                                                                               \
+    for (int64_t i = 0; i < array_size; i++)                                   \
+    {                                                                          \
+        big_int_rng_fill(NULL, q.limbs, BIGINT_N_LIMBS(bits));                 \
+        big_int_rng_fill(NULL, big_int_##bits##_array_2[i].limbs,              \
+            BIGINT_N_LIMBS(bits));                                             \
+        big_int_rng_fill(NULL, big_int_##bits##_array_3[i].limbs,              \
+            BIGINT_N_LIMBS(bits));                                             \
+        q.limbs[0] |= 1;                                                       \
+        q.limbs[BIGINT_N_LIMBS(bits) - 1] |= 1ULL << 63;                       \
+        big_int_##bits##_array_2[i].limbs[BIGINT_N_LIMBS(bits) - 1] >>= 1;     \
+                                                                               \
+        big_int_##bits##_mont_ctx_init(big_int_##bits##_ctx_array + i, &q);    \
+        big_int_##bits##_to_mont(big_int_##bits##_array_2 + i,                 \
+            big_int_##bits##_array_2 + i, big_int_##bits##_ctx_array + i);     \
+    }                                                                          \
+}                                                                              \
+                                                                               \
+void bench_big_int_##bits##_cleanup(void *argptr)                              \
+{                                                                              \
+    free(big_int_##bits##_array_1);                                            \
+    free(big_int_##bits##_array_2);                                            \
+    free(big_int_##bits##_array_3);                                            \
+    free(big_int_##bits##_ctx_array);                                          \
+    free(big_int_##bits##_wide_array);                                         \
+}                                                                              \
+                                                                               \
+void bench_big_int_##bits##_mul_fn(void *arg)                                  \
+{                                                                              \
+    int64_t i = *((int64_t *) arg);                                            \
+    big_int_##bits##_mul(big_int_##bits##_wide_array + i,                      \
+        big_int_##bits##_array_2 + i, big_int_##bits##_array_3 + i);           \
+}                                                                              \
+                                                                               \
+void bench_big_int_##bits##_mul(void *bench_args, char *bench_name,            \
+    char *path)                                                                \
+{                                                                              \
+    BenchmarkClosure bench_closure = {                                         \
+        .bench_prep_args = bench_args,                                         \
+        .bench_prep_fn = bench_big_int_##bits##_prep,                          \
+        .bench_fn = bench_big_int_##bits##_mul_fn,                             \
+        .bench_cleanup_fn = bench_big_int_##bits##_cleanup,                    \
+    };                                                                         \
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);          \
+}                                                                              \
+                                                                               \
+void bench_big_int_##bits##_mont_mul_fn(void *arg)                             \
+{                                                                              \
+    int64_t i = *((int64_t *) arg);                                            \
+    big_int_##bits##_mont_mul(big_int_##bits##_array_1 + i,                    \
+        big_int_##bits##_array_2 + i, big_int_##bits##_array_2 + i,            \
+        big_int_##bits##_ctx_array + i);                                       \
+}                                                                              \
+                                                                               \
+void bench_big_int_##bits##_mont_mul(void *bench_args, char *bench_name,       \
+    char *path)                                                                \
+{                                                                              \
+    BenchmarkClosure bench_closure = {                                         \
+        .bench_prep_args = bench_args,                                         \
+        .bench_prep_fn = bench_big_int_##bits##_prep,                          \
+        .bench_fn = bench_big_int_##bits##_mont_mul_fn,                        \
+        .bench_cleanup_fn = bench_big_int_##bits##_cleanup,                    \
+    };                                                                         \
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);          \
+}                                                                              \
+                                                                               \
+void bench_big_int_##bits##_pow_mont_fn(void *arg)                             \
+{                                                                              \
+    int64_t i = *((int64_t *) arg);                                            \
+    big_int_##bits##_pow_mont(big_int_##bits##_array_1 + i,                    \
+        big_int_##bits##_array_2 + i, big_int_##bits##_array_3 + i,            \
+        big_int_##bits##_ctx_array + i);                                       \
+}                                                                              \
+                                                                               \
+void bench_big_int_##bits##_pow_mont(void *bench_args, char *bench_name,       \
+    char *path)                                                                \
+{                                                                              \
+    BenchmarkClosure bench_closure = {                                         \
+        .bench_prep_args = bench_args,                                         \
+        .bench_prep_fn = bench_big_int_##bits##_prep,                          \
+        .bench_fn = bench_big_int_##bits##_pow_mont_fn,                        \
+        .bench_cleanup_fn = bench_big_int_##bits##_cleanup,                    \
+    };                                                                         \
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);          \
+}
+
+BENCH_BIG_INT_N_DEFINE(256)
+BENCH_BIG_INT_N_DEFINE(384)
+BENCH_BIG_INT_N_DEFINE(512)
+BENCH_BIG_INT_N_DEFINE(1024)
+#endif
+
+//=== === === === === === === === === === === === === === ===
+
 void bench_big_int_pow_small_fn(void *arg)
 {
     int64_t i = *((int64_t *) arg);
@@ -1247,6 +1678,230 @@ void bench_elligator_1_point_to_string(void *bench_args, char *bench_name, char
 
 //=== === === === === === === === === === === === === === ===
 
+#if VERSION > 2
+// The batched benchmarks process a whole batch on every ELLIGATOR_BATCH_SIZE-th
+// call, such that the reported cycles are per element.
+#define BENCH_BATCH_LEN(i) \
+    ((REPS - (i) < ELLIGATOR_BATCH_SIZE) ? REPS - (i) : ELLIGATOR_BATCH_SIZE)
+
+void bench_elligator_1_string_to_point_batch_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    if (i % ELLIGATOR_BATCH_SIZE)
+        return;
+
+    elligator_1_string_to_point_batch(curve_point_array + i,
+        RUNTIME_DEREF(big_int_array_1, i), BENCH_BATCH_LEN(i), bench_curve);
+}
+
+void bench_elligator_1_string_to_point_batch(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_elligator_1_string_to_point_prep,
+        .bench_fn = bench_elligator_1_string_to_point_batch_fn,
+        .bench_cleanup_fn = bench_elligator_1_string_to_point_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, REPS);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_elligator_1_point_to_string_batch_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    if (i % ELLIGATOR_BATCH_SIZE)
+        return;
+
+    elligator_1_point_to_string_batch(RUNTIME_DEREF(big_int_array, i),
+        curve_point_array + i, BENCH_BATCH_LEN(i), bench_curve);
+}
+
+void bench_elligator_1_point_to_string_batch(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_elligator_1_point_to_string_prep,
+        .bench_fn = bench_elligator_1_point_to_string_batch_fn,
+        .bench_cleanup_fn = bench_elligator_1_point_to_string_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, REPS);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_elligator_squared_encode_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    if (i % ELLIGATOR_BATCH_SIZE)
+        return;
+
+    elligator_squared_encode_batch(RUNTIME_DEREF(big_int_array, 2 * i),
+        curve_point_array + i, BENCH_BATCH_LEN(i), bench_curve);
+}
+
+void bench_elligator_squared_encode(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_elligator_squared_prep,
+        .bench_fn = bench_elligator_squared_encode_fn,
+        .bench_cleanup_fn = bench_elligator_squared_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, REPS);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_elligator_squared_decode_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    if (i % ELLIGATOR_BATCH_SIZE)
+        return;
+
+    elligator_squared_decode_batch(curve_point_array + i,
+        RUNTIME_DEREF(big_int_array, 2 * i), BENCH_BATCH_LEN(i), bench_curve);
+}
+
+void bench_elligator_squared_decode(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_elligator_squared_prep,
+        .bench_fn = bench_elligator_squared_decode_fn,
+        .bench_cleanup_fn = bench_elligator_squared_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, REPS);
+}
+
+//=== === === === === === === === === === === === === === === ===
+
+void bench_hash_to_curve_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    hash_to_curve(curve_point_array + i, msg_ptr_array[i], msg_len_array[i],
+        (const uint8_t *) HASH_TO_CURVE_SUITE_ID,
+        sizeof(HASH_TO_CURVE_SUITE_ID) - 1, bench_curve);
+}
+
+void bench_hash_to_curve(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_hash_to_curve_prep,
+        .bench_fn = bench_hash_to_curve_fn,
+        .bench_cleanup_fn = bench_hash_to_curve_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, REPS);
+}
+
+//=== === === === === === === === === === === === === === === ===
+
+void bench_hash_to_curve_batch_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    if (i % ELLIGATOR_BATCH_SIZE)
+        return;
+
+    hash_to_curve_batch(curve_point_array + i, msg_ptr_array + i,
+        msg_len_array + i, BENCH_BATCH_LEN(i),
+        (const uint8_t *) HASH_TO_CURVE_SUITE_ID,
+        sizeof(HASH_TO_CURVE_SUITE_ID) - 1, bench_curve);
+}
+
+void bench_hash_to_curve_batch(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_hash_to_curve_prep,
+        .bench_fn = bench_hash_to_curve_batch_fn,
+        .bench_cleanup_fn = bench_hash_to_curve_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, REPS);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+// The parallel benchmarks map all REPS elements in the first call, such that
+// the reported cycles are per element. They are repeated for 1, 2, 4, ...
+// threads up to the number of online cores to measure the scaling.
+#define BENCH_PARALLEL_NAME_LEN 256
+
+void bench_parallel_scaling(BenchmarkClosure bench_closure, char *name_fmt,
+    char *path_fmt)
+{
+    char bench_name[BENCH_PARALLEL_NAME_LEN];
+    char path[BENCH_PARALLEL_NAME_LEN];
+    int bench_args[3] = {BIGINTSIZE, REPS, 0};
+    long nr_cores;
+    int nr_threads;     // Matches the %d of name_fmt and path_fmt
+
+    nr_cores = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nr_cores < 1)
+        nr_cores = 1;
+
+    bench_closure.bench_prep_args = (void *) bench_args;
+
+    for (nr_threads = 1; ; nr_threads *= 2)
+    {
+        if (nr_threads > nr_cores)
+            nr_threads = (int) nr_cores;
+
+        bench_args[2] = nr_threads;
+        snprintf(bench_name, BENCH_PARALLEL_NAME_LEN, name_fmt, nr_threads);
+        snprintf(path, BENCH_PARALLEL_NAME_LEN, path_fmt, nr_threads);
+        benchmark_runner(bench_closure, bench_name, path, SETS, REPS, REPS);
+
+        if (nr_threads == nr_cores)
+            break;
+    }
+}
+
+void bench_elligator_1_string_to_point_parallel_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    if (i)
+        return;
+
+    elligator_1_string_to_point_parallel(curve_point_array,
+        RUNTIME_DEREF(big_int_array_1, 0), REPS, bench_curve, bench_pool);
+}
+
+void bench_elligator_1_string_to_point_parallel(char *name_fmt, char *path_fmt)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_fn = bench_elligator_1_string_to_point_parallel_prep,
+        .bench_fn = bench_elligator_1_string_to_point_parallel_fn,
+        .bench_cleanup_fn = bench_elligator_1_string_to_point_parallel_cleanup,
+    };
+    bench_parallel_scaling(bench_closure, name_fmt, path_fmt);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_elligator_1_point_to_string_parallel_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    if (i)
+        return;
+
+    elligator_1_point_to_string_parallel(RUNTIME_DEREF(big_int_array, 0),
+        curve_point_array, REPS, bench_curve, bench_pool);
+}
+
+void bench_elligator_1_point_to_string_parallel(char *name_fmt, char *path_fmt)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_fn = bench_elligator_1_point_to_string_parallel_prep,
+        .bench_fn = bench_elligator_1_point_to_string_parallel_fn,
+        .bench_cleanup_fn = bench_elligator_1_point_to_string_parallel_cleanup,
+    };
+    bench_parallel_scaling(bench_closure, name_fmt, path_fmt);
+}
+#endif
+
+//=== === === === === === === === === === === === === === ===
+
 #if VERSION > 2
 void bench_big_int_add_general_fn(void *arg)
 {
@@ -1456,6 +2111,12 @@ int main(int argc, char const *argv[])
             bench_big_int_create_random((void *)bench_big_int_size_256_args,
                 "create random", LOG_PATH "/runtime_big_int_create_random.log"));
 
+#if VERSION > 2
+        BENCHMARK(bench_type, BENCH_TYPE_FILL_RANDOM,
+            bench_big_int_fill_random((void *)bench_big_int_size_256_args,
+                "fill random", LOG_PATH "/runtime_big_int_fill_random.log"));
+#endif
+
         BENCHMARK(bench_type, BENCH_TYPE_NEG,
             bench_big_int_neg((void *)bench_big_int_size_256_args, "negate",
                 LOG_PATH "/runtime_big_int_negate.log"));
@@ -1492,6 +2153,11 @@ int main(int argc, char const *argv[])
             bench_big_int_mul((void *)bench_big_int_size_256_args, "mul",
                 LOG_PATH "/runtime_big_int_mul.log"));
 
+        BENCHMARK(bench_type, BENCH_TYPE_MUL_UNBALANCED,
+            bench_big_int_mul_unbalanced((void *)bench_big_int_size_256_args,
+                "mul (256 x 64 bits)",
+                LOG_PATH "/runtime_big_int_mul_unbalanced.log"));
+
         BENCHMARK(bench_type, BENCH_TYPE_MUL_MOD_CURVE,
             bench_big_int_mul_mod((void *)bench_big_int_size_256_curve_mod_args,
                 "mul mod (curve)", LOG_PATH "/runtime_big_int_mul_mod_curve.log"));
@@ -1500,6 +2166,26 @@ int main(int argc, char const *argv[])
             bench_big_int_mul_mod((void *)bench_big_int_size_256_random_mod_args,
                 "mul mod (random)", LOG_PATH "/runtime_big_int_mul_mod_random.log"));
 
+#if VERSION > 2
+        BENCHMARK(bench_type, BENCH_TYPE_MONT_MUL_CURVE,
+            bench_big_int_mont_mul((void *)bench_big_int_size_256_curve_mod_args,
+                "Montgomery mul (curve)",
+                LOG_PATH "/runtime_big_int_mont_mul_curve.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_MONT_MUL_RANDOM,
+            bench_big_int_mont_mul((void *)bench_big_int_size_256_random_mod_args,
+                "Montgomery mul (random)",
+                LOG_PATH "/runtime_big_int_mont_mul_random.log"));
+#endif
+
+#if VERSION > 2
+        BENCHMARK(bench_type, BENCH_TYPE_MUL_MOD_BARRETT_RANDOM,
+            bench_big_int_mul_mod_barrett(
+                (void *)bench_big_int_size_256_random_mod_args,
+                "mul mod Barrett (random)",
+                LOG_PATH "/runtime_big_int_mul_mod_barrett_random.log"));
+#endif
+
         BENCHMARK(bench_type, BENCH_TYPE_MUL_SQUARE_MOD_CURVE,
             bench_big_int_mul_square_mod((void *)bench_big_int_size_256_curve_mod_args,
                 "square mod (curve)",
@@ -1537,6 +2223,18 @@ int main(int argc, char const *argv[])
             bench_big_int_mod((void *)bench_big_int_size_256_random_mod_args,
             "mod (random)", LOG_PATH "/runtime_big_int_mod_random.log"));
 
+#if VERSION > 2
+        BENCHMARK(bench_type, BENCH_TYPE_MOD_BARRETT_RANDOM,
+            bench_big_int_mod_barrett((void *)bench_big_int_size_256_random_mod_args,
+            "mod Barrett (random)",
+            LOG_PATH "/runtime_big_int_mod_barrett_random.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_MOD_BARRETT_512_CURVE,
+            bench_big_int_mod_barrett((void *)bench_big_int_size_512_curve_mod_args,
+            "mod Barrett 512-bit (curve)",
+            LOG_PATH "/runtime_big_int_512_mod_barrett_curve.log"));
+#endif
+
         BENCHMARK(bench_type, BENCH_TYPE_INV,
             bench_big_int_inv((void *)bench_big_int_size_256_curve_mod_args, "inv",
                 LOG_PATH "/runtime_big_int_inv.log"));
@@ -1549,6 +2247,83 @@ int main(int argc, char const *argv[])
             bench_big_int_pow((void *)bench_big_int_size_256_random_mod_args,
                 "pow (random)", LOG_PATH "/runtime_big_int_pow_random.log"));
 
+        BENCHMARK(bench_type, BENCH_TYPE_POW_512_CURVE,
+            bench_big_int_pow((void *)bench_big_int_size_512_curve_mod_args,
+                "pow, exp: 512-bit (curve)",
+                LOG_PATH "/runtime_big_int_512_pow_curve.log"));
+
+#if VERSION > 2
+        BENCHMARK(bench_type, BENCH_TYPE_POW_MONT_CURVE,
+            bench_big_int_pow_mont((void *)bench_big_int_size_256_curve_mod_args,
+                "pow Montgomery (curve)",
+                LOG_PATH "/runtime_big_int_pow_mont_curve.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_POW_MONT_RANDOM,
+            bench_big_int_pow_mont((void *)bench_big_int_size_256_random_mod_args,
+                "pow Montgomery (random)",
+                LOG_PATH "/runtime_big_int_pow_mont_random.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_MUL_N_256,
+            bench_big_int_256_mul((void *)bench_big_int_n_args,
+                "mul (256-bit fixed width)",
+                LOG_PATH "/runtime_big_int_256_mul.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_MUL_N_384,
+            bench_big_int_384_mul((void *)bench_big_int_n_args,
+                "mul (384-bit fixed width)",
+                LOG_PATH "/runtime_big_int_384_mul.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_MUL_N_512,
+            bench_big_int_512_mul((void *)bench_big_int_n_args,
+                "mul (512-bit fixed width)",
+                LOG_PATH "/runtime_big_int_512_mul.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_MUL_N_1024,
+            bench_big_int_1024_mul((void *)bench_big_int_n_args,
+                "mul (1024-bit fixed width)",
+                LOG_PATH "/runtime_big_int_1024_mul.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_MONT_MUL_N_256,
+            bench_big_int_256_mont_mul((void *)bench_big_int_n_args,
+                "Montgomery mul (256-bit fixed width)",
+                LOG_PATH "/runtime_big_int_256_mont_mul.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_MONT_MUL_N_384,
+            bench_big_int_384_mont_mul((void *)bench_big_int_n_args,
+                "Montgomery mul (384-bit fixed width)",
+                LOG_PATH "/runtime_big_int_384_mont_mul.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_MONT_MUL_N_512,
+            bench_big_int_512_mont_mul((void *)bench_big_int_n_args,
+                "Montgomery mul (512-bit fixed width)",
+                LOG_PATH "/runtime_big_int_512_mont_mul.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_MONT_MUL_N_1024,
+            bench_big_int_1024_mont_mul((void *)bench_big_int_n_args,
+                "Montgomery mul (1024-bit fixed width)",
+                LOG_PATH "/runtime_big_int_1024_mont_mul.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_POW_MONT_N_256,
+            bench_big_int_256_pow_mont((void *)bench_big_int_n_args,
+                "pow Montgomery (256-bit fixed width)",
+                LOG_PATH "/runtime_big_int_256_pow_mont.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_POW_MONT_N_384,
+            bench_big_int_384_pow_mont((void *)bench_big_int_n_args,
+                "pow Montgomery (384-bit fixed width)",
+                LOG_PATH "/runtime_big_int_384_pow_mont.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_POW_MONT_N_512,
+            bench_big_int_512_pow_mont((void *)bench_big_int_n_args,
+                "pow Montgomery (512-bit fixed width)",
+                LOG_PATH "/runtime_big_int_512_pow_mont.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_POW_MONT_N_1024,
+            bench_big_int_1024_pow_mont((void *)bench_big_int_n_args,
+                "pow Montgomery (1024-bit fixed width)",
+                LOG_PATH "/runtime_big_int_1024_pow_mont.log"));
+#endif
+
         BENCHMARK(bench_type, BENCH_TYPE_POW_SMALL_CURVE,
             bench_big_int_pow_small((void *)bench_big_int_size_256_curve_mod_args,
                 "pow, exp: 64-bit (curve)", LOG_PATH "/runtime_big_int_pow_small_curve.log"));
@@ -1600,6 +2375,48 @@ int main(int argc, char const *argv[])
                 "Elligator pnt2str",
                 LOG_PATH "/runtime_elligator_1_point_to_string.log"));
 
+        #if VERSION > 2
+        BENCHMARK(bench_type, BENCH_TYPE_ELLIGATOR1_STR2PNT_BATCH,
+            bench_elligator_1_string_to_point_batch((void *)bench_big_int_size_256_args,
+                "Elligator str2pnt (batched)",
+                LOG_PATH "/runtime_elligator_1_string_to_point_batch.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_ELLIGATOR1_PNT2STR_BATCH,
+            bench_elligator_1_point_to_string_batch((void *)bench_big_int_size_256_args,
+                "Elligator pnt2str (batched)",
+                LOG_PATH "/runtime_elligator_1_point_to_string_batch.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_ELLIGATOR_SQUARED_ENCODE,
+            bench_elligator_squared_encode((void *)bench_big_int_size_256_args,
+                "Elligator Squared encode",
+                LOG_PATH "/runtime_elligator_squared_encode.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_ELLIGATOR_SQUARED_DECODE,
+            bench_elligator_squared_decode((void *)bench_big_int_size_256_args,
+                "Elligator Squared decode",
+                LOG_PATH "/runtime_elligator_squared_decode.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_HASH_TO_CURVE,
+            bench_hash_to_curve((void *)bench_big_int_size_256_args,
+                "hash_to_curve",
+                LOG_PATH "/runtime_hash_to_curve.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_HASH_TO_CURVE_BATCH,
+            bench_hash_to_curve_batch((void *)bench_big_int_size_256_args,
+                "hash_to_curve (batched)",
+                LOG_PATH "/runtime_hash_to_curve_batch.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_ELLIGATOR1_STR2PNT_PARALLEL,
+            bench_elligator_1_string_to_point_parallel(
+                "Elligator str2pnt (%d threads)",
+                LOG_PATH "/runtime_elligator_1_string_to_point_parallel_%02d.log"));
+
+        BENCHMARK(bench_type, BENCH_TYPE_ELLIGATOR1_PNT2STR_PARALLEL,
+            bench_elligator_1_point_to_string_parallel(
+                "Elligator pnt2str (%d threads)",
+                LOG_PATH "/runtime_elligator_1_point_to_string_parallel_%02d.log"));
+        #endif
+
     }
 
     return EXIT_SUCCESS;
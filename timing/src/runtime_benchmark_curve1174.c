@@ -34,6 +34,12 @@
 
 // Include header files
 #include "bigint_curve1174.h"
+#if VERSION > 2
+#include "elligator.h"
+#include "curve1174_point.h"
+#include "curve1174_scalar.h"
+#include "elligator_dh.h"
+#endif
 #include "runtime_benchmark_curve1174.h"
 #include "debug.h"
 #include "benchmark_helpers.h"
@@ -59,7 +65,9 @@ void bench_big_int_prep(void *argptr)
     int8_t_array = (int8_t *) malloc(array_size * sizeof(int8_t));
     uint64_t_array = (uint64_t *) malloc(array_size * sizeof(uint64_t));
 
+#if VERSION < 3
     uint64_t offset;
+#endif
     for (uint64_t i = 0; i < array_size; i++)
     {
         big_int_create_random(big_int_array_1 + i, BIGINT_FIXED_SIZE);
@@ -69,13 +77,19 @@ void bench_big_int_prep(void *argptr)
         // 512-bit BigInts
         big_int_create_random(big_int_512_array + i, 2 * BIGINT_FIXED_SIZE);
 
+#if VERSION < 3
         offset = 1;
         uint64_t_array[i] = 0;
         while (offset < UINT64_MAX / RAND_MAX) {
             uint64_t_array[i] += ((uint64_t) rand()) * offset;
             offset *= RAND_MAX;
         }
+#endif
     }
+
+#if VERSION > 2
+    big_int_rng_fill(NULL, uint64_t_array, array_size);
+#endif
 }
 
 void bench_big_int_cleanup(void *argptr)
@@ -381,6 +395,790 @@ void bench_big_int_curve1174_chi(void *bench_args, char *bench_name, char *path)
 
 //=== === === === === === === === === === === === === === ===
 
+#if VERSION > 2
+/**
+ * Prepare random curve points, in extended coordinates with a non-trivial Z
+ * coordinate (result of a doubling) and as precomputed affine points.
+ */
+void bench_curve1174_point_prep(void *argptr)
+{
+    int64_t array_size = ((int *)argptr)[0];
+    BigInt *t;
+
+    init_curve1174(&bench_curve);
+
+    RUNTIME_BIG_INT_ALLOC_ARR(t, 2 * array_size);
+    curve_point_array = (CurvePoint *) malloc(2 * array_size * sizeof(CurvePoint));
+    curve_point_ext_array_1 = (CurvePointExt *) malloc(array_size * sizeof(CurvePointExt));
+    curve_point_ext_array_2 = (CurvePointExt *) malloc(array_size * sizeof(CurvePointExt));
+    curve_point_precomp_array = (CurvePointPrecomp *) malloc(array_size * sizeof(CurvePointPrecomp));
+
+    for (uint64_t i = 0; i < 2 * array_size; i++)
+    {
+        big_int_create_random(t + i, BIGINT_FIXED_SIZE);
+        big_int_curve1174_mod(t + i);
+    }
+    elligator_1_string_to_point_batch(curve_point_array, t, 2 * array_size,
+        bench_curve);
+
+    for (uint64_t i = 0; i < array_size; i++)
+    {
+        curve1174_point_from_affine(curve_point_ext_array_1 + i, curve_point_array + i);
+        curve1174_point_double(curve_point_ext_array_1 + i, curve_point_ext_array_1 + i);
+
+        curve1174_point_from_affine(curve_point_ext_array_2 + i,
+            curve_point_array + array_size + i);
+        curve1174_point_double(curve_point_ext_array_2 + i, curve_point_ext_array_2 + i);
+
+        curve1174_point_precompute(curve_point_precomp_array + i,
+            curve_point_array + array_size + i);
+    }
+
+    free(t);
+}
+
+void bench_curve1174_point_cleanup(void *argptr)
+{
+    free(curve_point_array);
+    free(curve_point_ext_array_1);
+    free(curve_point_ext_array_2);
+    free(curve_point_precomp_array);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_point_add_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_point_add(curve_point_ext_array_1 + i,
+        curve_point_ext_array_1 + i, curve_point_ext_array_2 + i);
+}
+
+void bench_curve1174_point_add(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_prep,
+        .bench_fn = bench_curve1174_point_add_fn,
+        .bench_cleanup_fn = bench_curve1174_point_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_point_double_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_point_double(curve_point_ext_array_1 + i,
+        curve_point_ext_array_1 + i);
+}
+
+void bench_curve1174_point_double(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_prep,
+        .bench_fn = bench_curve1174_point_double_fn,
+        .bench_cleanup_fn = bench_curve1174_point_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_point_add_mixed_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_point_add_mixed(curve_point_ext_array_1 + i,
+        curve_point_ext_array_1 + i, curve_point_precomp_array + i);
+}
+
+void bench_curve1174_point_add_mixed(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_prep,
+        .bench_fn = bench_curve1174_point_add_mixed_fn,
+        .bench_cleanup_fn = bench_curve1174_point_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_point_to_affine_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_point_to_affine(curve_point_array + i,
+        curve_point_ext_array_1 + i);
+}
+
+void bench_curve1174_point_to_affine(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_prep,
+        .bench_fn = bench_curve1174_point_to_affine_fn,
+        .bench_cleanup_fn = bench_curve1174_point_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_point_precompute_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_point_precompute(curve_point_precomp_array + i,
+        curve_point_array + i);
+}
+
+void bench_curve1174_point_precompute(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_prep,
+        .bench_fn = bench_curve1174_point_precompute_fn,
+        .bench_cleanup_fn = bench_curve1174_point_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+/**
+ * Additionally to the curve points, prepare their 4-lane representations.
+ * The 4-lane structs need 32-byte alignment.
+ */
+void bench_curve1174_point_4_prep(void *argptr)
+{
+    int64_t array_size = ((int *)argptr)[0];
+
+    bench_curve1174_point_prep(argptr);
+
+    curve_point_ext4_array_1 = (CurvePointExt4 *) aligned_alloc(32,
+        array_size * sizeof(CurvePointExt4));
+    curve_point_ext4_array_2 = (CurvePointExt4 *) aligned_alloc(32,
+        array_size * sizeof(CurvePointExt4));
+    curve_point_precomp4_array = (CurvePointPrecomp4 *) aligned_alloc(32,
+        array_size * sizeof(CurvePointPrecomp4));
+
+    for (uint64_t i = 0; i < array_size; i++)
+    {
+        curve1174_point_4_from_ext(curve_point_ext4_array_1 + i,
+            curve_point_ext_array_1 + i);
+        curve1174_point_4_from_ext(curve_point_ext4_array_2 + i,
+            curve_point_ext_array_2 + i);
+        curve1174_point_4_from_precomp(curve_point_precomp4_array + i,
+            curve_point_precomp_array + i);
+    }
+}
+
+void bench_curve1174_point_4_cleanup(void *argptr)
+{
+    bench_curve1174_point_cleanup(argptr);
+    free(curve_point_ext4_array_1);
+    free(curve_point_ext4_array_2);
+    free(curve_point_precomp4_array);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_point_4_add_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_point_4_add(curve_point_ext4_array_1 + i,
+        curve_point_ext4_array_1 + i, curve_point_ext4_array_2 + i);
+}
+
+void bench_curve1174_point_4_add(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_4_prep,
+        .bench_fn = bench_curve1174_point_4_add_fn,
+        .bench_cleanup_fn = bench_curve1174_point_4_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_point_4_double_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_point_4_double(curve_point_ext4_array_1 + i,
+        curve_point_ext4_array_1 + i);
+}
+
+void bench_curve1174_point_4_double(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_4_prep,
+        .bench_fn = bench_curve1174_point_4_double_fn,
+        .bench_cleanup_fn = bench_curve1174_point_4_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_point_4_add_mixed_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_point_4_add_mixed(curve_point_ext4_array_1 + i,
+        curve_point_ext4_array_1 + i, curve_point_precomp4_array + i);
+}
+
+void bench_curve1174_point_4_add_mixed(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_4_prep,
+        .bench_fn = bench_curve1174_point_4_add_mixed_fn,
+        .bench_cleanup_fn = bench_curve1174_point_4_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+/**
+ * Additionally to the curve points, prepare their compressed and their raw
+ * affine serialization.
+ */
+#define BENCH_AFFINE_COORD_SIZE (CURVE1174_POINT_COMPRESSED_SIZE)
+#define BENCH_AFFINE_POINT_SIZE (2 * BENCH_AFFINE_COORD_SIZE)
+
+void bench_curve1174_point_bytes_prep(void *argptr)
+{
+    int64_t array_size = ((int *)argptr)[0];
+
+    bench_curve1174_point_prep(argptr);
+
+    point_compressed_array = (uint8_t *) malloc(array_size
+        * CURVE1174_POINT_COMPRESSED_SIZE);
+    point_affine_bytes_array = (uint8_t *) malloc(array_size
+        * BENCH_AFFINE_POINT_SIZE);
+
+    for (uint64_t i = 0; i < array_size; i++)
+    {
+        curve1174_point_compress(point_compressed_array
+            + i * CURVE1174_POINT_COMPRESSED_SIZE, curve_point_array + i);
+        big_int_to_bytes(point_affine_bytes_array + i * BENCH_AFFINE_POINT_SIZE,
+            &(curve_point_array[i].x), BENCH_AFFINE_COORD_SIZE);
+        big_int_to_bytes(point_affine_bytes_array + i * BENCH_AFFINE_POINT_SIZE
+            + BENCH_AFFINE_COORD_SIZE, &(curve_point_array[i].y),
+            BENCH_AFFINE_COORD_SIZE);
+    }
+}
+
+void bench_curve1174_point_bytes_cleanup(void *argptr)
+{
+    bench_curve1174_point_cleanup(argptr);
+    free(point_compressed_array);
+    free(point_affine_bytes_array);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_point_compress_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_point_compress(point_compressed_array
+        + i * CURVE1174_POINT_COMPRESSED_SIZE, curve_point_array + i);
+}
+
+void bench_curve1174_point_compress(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_bytes_prep,
+        .bench_fn = bench_curve1174_point_compress_fn,
+        .bench_cleanup_fn = bench_curve1174_point_bytes_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_point_decompress_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_point_decompress(curve_point_array + i, point_compressed_array
+        + i * CURVE1174_POINT_COMPRESSED_SIZE);
+}
+
+void bench_curve1174_point_decompress(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_bytes_prep,
+        .bench_fn = bench_curve1174_point_decompress_fn,
+        .bench_cleanup_fn = bench_curve1174_point_bytes_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+// The batched benchmarks process a whole batch on every ELLIGATOR_BATCH_SIZE-th
+// call, such that the reported cycles are per element.
+#define BENCH_BATCH_LEN(i) \
+    ((REPS - (i) < ELLIGATOR_BATCH_SIZE) ? REPS - (i) : ELLIGATOR_BATCH_SIZE)
+
+void bench_curve1174_point_decompress_batch_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    if (i % ELLIGATOR_BATCH_SIZE)
+        return;
+
+    curve1174_point_decompress_batch(curve_point_array + i,
+        point_compressed_array + i * CURVE1174_POINT_COMPRESSED_SIZE,
+        BENCH_BATCH_LEN(i), NULL);
+}
+
+void bench_curve1174_point_decompress_batch(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_bytes_prep,
+        .bench_fn = bench_curve1174_point_decompress_batch_fn,
+        .bench_cleanup_fn = bench_curve1174_point_bytes_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+// Baseline for the decompression: parse both coordinates of an uncompressed
+// point. Elligator 1 decoding is measured by ELLIGATOR1_STR2PNT(_BATCH) in
+// runtime-benchmark.
+void bench_curve1174_point_load_affine_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    big_int_create_from_bytes(&(curve_point_array[i].x),
+        point_affine_bytes_array + i * BENCH_AFFINE_POINT_SIZE,
+        BENCH_AFFINE_COORD_SIZE);
+    big_int_create_from_bytes(&(curve_point_array[i].y),
+        point_affine_bytes_array + i * BENCH_AFFINE_POINT_SIZE
+        + BENCH_AFFINE_COORD_SIZE, BENCH_AFFINE_COORD_SIZE);
+}
+
+void bench_curve1174_point_load_affine(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_bytes_prep,
+        .bench_fn = bench_curve1174_point_load_affine_fn,
+        .bench_cleanup_fn = bench_curve1174_point_bytes_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_point_validate_prep(void *argptr)
+{
+    int64_t array_size = ((int *)argptr)[0];
+
+    bench_curve1174_point_prep(argptr);
+    point_valid_array = (uint8_t *) malloc(array_size * sizeof(uint8_t));
+}
+
+void bench_curve1174_point_validate_cleanup(void *argptr)
+{
+    bench_curve1174_point_cleanup(argptr);
+    free(point_valid_array);
+}
+
+void bench_curve1174_point_is_on_curve_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    point_valid_array[i] = curve1174_point_is_on_curve(curve_point_array + i);
+}
+
+void bench_curve1174_point_is_on_curve(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_validate_prep,
+        .bench_fn = bench_curve1174_point_is_on_curve_fn,
+        .bench_cleanup_fn = bench_curve1174_point_validate_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_validate_batch_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    if (i % ELLIGATOR_BATCH_SIZE)
+        return;
+
+    curve1174_validate_batch(curve_point_array + i, BENCH_BATCH_LEN(i),
+        point_valid_array + i);
+}
+
+void bench_curve1174_validate_batch(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_validate_prep,
+        .bench_fn = bench_curve1174_validate_batch_fn,
+        .bench_cleanup_fn = bench_curve1174_point_validate_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_clear_cofactor_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_clear_cofactor(curve_point_ext_array_2 + i,
+        curve_point_ext_array_1 + i);
+}
+
+void bench_curve1174_clear_cofactor(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_prep,
+        .bench_fn = bench_curve1174_clear_cofactor_fn,
+        .bench_cleanup_fn = bench_curve1174_point_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_subgroup_check_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    point_valid_array[i] = curve1174_point_is_in_subgroup(curve_point_array + i);
+}
+
+void bench_curve1174_subgroup_check(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_validate_prep,
+        .bench_fn = bench_curve1174_subgroup_check_fn,
+        .bench_cleanup_fn = bench_curve1174_point_validate_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_subgroup_check_batch_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    if (i % ELLIGATOR_BATCH_SIZE)
+        return;
+
+    curve1174_point_is_in_subgroup_batch(curve_point_array + i,
+        BENCH_BATCH_LEN(i), point_valid_array + i);
+}
+
+void bench_curve1174_subgroup_check_batch(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_point_validate_prep,
+        .bench_fn = bench_curve1174_subgroup_check_batch_fn,
+        .bench_cleanup_fn = bench_curve1174_point_validate_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+/**
+ * Additionally to the curve points, prepare random 256-bit scalars.
+ */
+void bench_curve1174_scalar_prep(void *argptr)
+{
+    int64_t array_size = ((int *)argptr)[0];
+
+    bench_curve1174_point_prep(argptr);
+
+    RUNTIME_BIG_INT_ALLOC_ARR(big_int_array_1, array_size);
+    for (uint64_t i = 0; i < array_size; i++)
+    {
+        big_int_create_random(big_int_array_1 + i, BIGINT_FIXED_SIZE);
+        big_int_array_1[i].sign = 0;
+    }
+}
+
+void bench_curve1174_scalar_cleanup(void *argptr)
+{
+    bench_curve1174_point_cleanup(argptr);
+    free(big_int_array_1);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_scalar_mul_base_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_scalar_mul_base(curve_point_ext_array_1 + i, big_int_array_1 + i);
+}
+
+void bench_curve1174_scalar_mul_base(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_scalar_prep,
+        .bench_fn = bench_curve1174_scalar_mul_base_fn,
+        .bench_cleanup_fn = bench_curve1174_scalar_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_curve1174_scalar_mul_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_scalar_mul(curve_point_ext_array_1 + i, big_int_array_1 + i,
+        curve_point_array + i);
+}
+
+void bench_curve1174_scalar_mul(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_scalar_prep,
+        .bench_fn = bench_curve1174_scalar_mul_fn,
+        .bench_cleanup_fn = bench_curve1174_scalar_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+void bench_elligator_dh_prep(void *argptr)
+{
+    int64_t array_size = ((int *)argptr)[0];
+
+    bench_curve1174_point_prep(argptr);
+    dh_keypair_array = (ElligatorDhKeypair *) malloc(2 * array_size
+        * sizeof(ElligatorDhKeypair));
+}
+
+void bench_elligator_dh_cleanup(void *argptr)
+{
+    bench_curve1174_point_cleanup(argptr);
+    free(dh_keypair_array);
+}
+
+/**
+ * One full handshake: both parties generate an ephemeral key pair and
+ * compute the shared point from the other party's Elligator string.
+ */
+void bench_elligator_dh_handshake_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    ElligatorDhKeypair *alice = dh_keypair_array + 2 * i;
+    ElligatorDhKeypair *bob = alice + 1;
+
+    elligator1_dh_keypair(alice, bench_curve);
+    elligator1_dh_keypair(bob, bench_curve);
+    elligator1_dh_shared(curve_point_array + 2 * i, &(alice->secret),
+        &(bob->public_str), bench_curve);
+    elligator1_dh_shared(curve_point_array + 2 * i + 1, &(bob->secret),
+        &(alice->public_str), bench_curve);
+}
+
+void bench_elligator_dh_handshake(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_elligator_dh_prep,
+        .bench_fn = bench_elligator_dh_handshake_fn,
+        .bench_cleanup_fn = bench_elligator_dh_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+// Number of distinct peers whose strings are repeatedly multiplied with
+#define BENCH_CACHE_NR_PEERS 64
+
+/**
+ * Prepare scalars and BENCH_CACHE_NR_PEERS peer strings, all of which are in
+ * the (warm) cache.
+ */
+void bench_curve1174_cache_prep(void *argptr)
+{
+    int64_t array_size = ((int *)argptr)[0];
+
+    bench_curve1174_scalar_prep(argptr);
+
+    RUNTIME_BIG_INT_ALLOC_ARR(big_int_array_2, array_size);
+    for (uint64_t i = 0; i < array_size; i++)
+    {
+        if (i < BENCH_CACHE_NR_PEERS) {
+            big_int_create_random(big_int_array_2 + i, BIGINT_FIXED_SIZE);
+            big_int_curve1174_mod(big_int_array_2 + i);
+            if (big_int_curve1174_gt_q_m1_d2(big_int_array_2 + i))
+                big_int_sub(big_int_array_2 + i, q, big_int_array_2 + i);
+        }
+        else {
+            big_int_copy(big_int_array_2 + i,
+                big_int_array_2 + i % BENCH_CACHE_NR_PEERS);
+        }
+    }
+
+    curve1174_cache_init(&bench_cache, BENCH_CACHE_NR_PEERS
+        * (sizeof(Curve1174CacheEntry) + 1024), NULL);
+    for (uint64_t i = 0; i < BENCH_CACHE_NR_PEERS; i++)
+        curve1174_cache_get(&bench_cache, big_int_array_2 + i, bench_curve);
+}
+
+void bench_curve1174_cache_cleanup(void *argptr)
+{
+    bench_curve1174_scalar_cleanup(argptr);
+    free(big_int_array_2);
+    curve1174_cache_free(&bench_cache);
+}
+
+// Baseline: decode the peer string and compute its table for every product
+void bench_curve1174_scalar_mul_str_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    elligator_1_string_to_point(curve_point_array + i, big_int_array_2 + i,
+        bench_curve);
+    curve1174_scalar_mul(curve_point_ext_array_1 + i, big_int_array_1 + i,
+        curve_point_array + i);
+}
+
+void bench_curve1174_scalar_mul_str(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_cache_prep,
+        .bench_fn = bench_curve1174_scalar_mul_str_fn,
+        .bench_cleanup_fn = bench_curve1174_cache_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+void bench_curve1174_cache_scalar_mul_fn(void *arg)
+{
+    int64_t i = *((int64_t *) arg);
+    curve1174_cache_scalar_mul(curve_point_ext_array_1 + i, &bench_cache,
+        big_int_array_1 + i, big_int_array_2 + i, bench_curve);
+}
+
+void bench_curve1174_cache_scalar_mul(void *bench_args, char *bench_name, char *path)
+{
+    BenchmarkClosure bench_closure = {
+        .bench_prep_args = bench_args,
+        .bench_prep_fn = bench_curve1174_cache_prep,
+        .bench_fn = bench_curve1174_cache_scalar_mul_fn,
+        .bench_cleanup_fn = bench_curve1174_cache_cleanup,
+    };
+    benchmark_runner(bench_closure, bench_name, path, SETS, REPS, 0);
+}
+
+//=== === === === === === === === === === === === === === ===
+
+// The MSM benchmarks are repeated for n = 2, 4, ..., 2^BENCH_MSM_MAX_LOG_N
+// points, every set computes max(1, BENCH_MSM_POINTS_PER_SET / n) MSMs and
+// the reported cycles are per MSM. Straus' method keeps 16 table entries per
+// point and is only measured up to 2^BENCH_MSM_STRAUS_MAX_LOG_N points.
+#define BENCH_MSM_MAX_LOG_N 16
+#define BENCH_MSM_STRAUS_MAX_LOG_N 12
+#define BENCH_MSM_POINTS_PER_SET 256
+#define BENCH_MSM_NAME_LEN 256
+
+void bench_curve1174_msm_prep(void *argptr)
+{
+    uint64_t max_n = 1ULL << BENCH_MSM_MAX_LOG_N;
+    BigInt *t;
+
+    if (msm_point_array)
+        return;
+
+    init_curve1174(&bench_curve);
+
+    RUNTIME_BIG_INT_ALLOC_ARR(t, max_n);
+    RUNTIME_BIG_INT_ALLOC_ARR(msm_scalar_array, max_n);
+    msm_point_array = (CurvePoint *) malloc(max_n * sizeof(CurvePoint));
+
+    for (uint64_t i = 0; i < max_n; i++)
+    {
+        big_int_create_random(t + i, BIGINT_FIXED_SIZE);
+        big_int_curve1174_mod(t + i);
+
+        big_int_create_random(msm_scalar_array + i, BIGINT_FIXED_SIZE);
+        curve1174_scalar_reduce(msm_scalar_array + i, msm_scalar_array + i);
+    }
+    elligator_1_string_to_point_batch(msm_point_array, t, max_n, bench_curve);
+
+    free(t);
+}
+
+void bench_curve1174_msm_cleanup(void *argptr)
+{
+    // The points are reused by all sets and sizes
+}
+
+void bench_curve1174_msm_scaling(void (*bench_fn)(void *), char *name_fmt,
+    char *path_fmt, int max_log_n)
+{
+    char bench_name[BENCH_MSM_NAME_LEN];
+    char path[BENCH_MSM_NAME_LEN];
+    int reps;
+
+    BenchmarkClosure bench_closure = {
+        .bench_prep_fn = bench_curve1174_msm_prep,
+        .bench_fn = bench_fn,
+        .bench_cleanup_fn = bench_curve1174_msm_cleanup,
+    };
+
+    for (int log_n = 1; log_n <= max_log_n; ++log_n)
+    {
+        bench_msm_n = 1 << log_n;
+        reps = BENCH_MSM_POINTS_PER_SET / bench_msm_n;
+        if (reps < 1)
+            reps = 1;
+
+        snprintf(bench_name, BENCH_MSM_NAME_LEN, name_fmt, bench_msm_n);
+        snprintf(path, BENCH_MSM_NAME_LEN, path_fmt, bench_msm_n);
+        benchmark_runner(bench_closure, bench_name, path, SETS, reps, 0);
+    }
+}
+
+void bench_curve1174_msm_fn(void *arg)
+{
+    curve1174_msm(&msm_result, msm_scalar_array, msm_point_array,
+        bench_msm_n);
+}
+
+void bench_curve1174_msm_straus_fn(void *arg)
+{
+    curve1174_msm_straus(&msm_result, msm_scalar_array,
+        msm_point_array, bench_msm_n);
+}
+
+void bench_curve1174_msm_pippenger_fn(void *arg)
+{
+    curve1174_msm_pippenger(&msm_result, msm_scalar_array,
+        msm_point_array, bench_msm_n);
+}
+
+#endif
+
+//=== === === === === === === === === === === === === === ===
+
 int main(int argc, char const *argv[])
 {
 
@@ -477,6 +1275,133 @@ int main(int argc, char const *argv[])
                 (void *) bench_big_int_curve_1174_args,
                 "chi",
                 LOG_PATH "/runtime_big_int_curve1174_chi.log"));
+#if VERSION > 2
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_ADD,
+            bench_curve1174_point_add(
+                (void *) bench_big_int_curve_1174_args,
+                "point add, extended (curve)",
+                LOG_PATH "/runtime_curve1174_point_add.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_DOUBLE,
+            bench_curve1174_point_double(
+                (void *) bench_big_int_curve_1174_args,
+                "point double, extended (curve)",
+                LOG_PATH "/runtime_curve1174_point_double.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_ADD_MIXED,
+            bench_curve1174_point_add_mixed(
+                (void *) bench_big_int_curve_1174_args,
+                "point add, mixed (curve)",
+                LOG_PATH "/runtime_curve1174_point_add_mixed.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_4_ADD,
+            bench_curve1174_point_4_add(
+                (void *) bench_big_int_curve_1174_args,
+                "point add, extended, AVX2 4-lane (curve)",
+                LOG_PATH "/runtime_curve1174_point_4_add.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_4_DOUBLE,
+            bench_curve1174_point_4_double(
+                (void *) bench_big_int_curve_1174_args,
+                "point double, extended, AVX2 4-lane (curve)",
+                LOG_PATH "/runtime_curve1174_point_4_double.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_4_ADD_MIXED,
+            bench_curve1174_point_4_add_mixed(
+                (void *) bench_big_int_curve_1174_args,
+                "point add, mixed, AVX2 4-lane (curve)",
+                LOG_PATH "/runtime_curve1174_point_4_add_mixed.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_TO_AFFINE,
+            bench_curve1174_point_to_affine(
+                (void *) bench_big_int_curve_1174_args,
+                "point to affine (curve)",
+                LOG_PATH "/runtime_curve1174_point_to_affine.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_PRECOMPUTE,
+            bench_curve1174_point_precompute(
+                (void *) bench_big_int_curve_1174_args,
+                "point precompute (curve)",
+                LOG_PATH "/runtime_curve1174_point_precompute.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_COMPRESS,
+            bench_curve1174_point_compress(
+                (void *) bench_big_int_curve_1174_args,
+                "point compress (curve)",
+                LOG_PATH "/runtime_curve1174_point_compress.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_DECOMPRESS,
+            bench_curve1174_point_decompress(
+                (void *) bench_big_int_curve_1174_args,
+                "point decompress (curve)",
+                LOG_PATH "/runtime_curve1174_point_decompress.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_DECOMPRESS_BATCH,
+            bench_curve1174_point_decompress_batch(
+                (void *) bench_big_int_curve_1174_args,
+                "point decompress, batched (curve)",
+                LOG_PATH "/runtime_curve1174_point_decompress_batch.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_LOAD_AFFINE,
+            bench_curve1174_point_load_affine(
+                (void *) bench_big_int_curve_1174_args,
+                "point load, raw affine bytes (curve)",
+                LOG_PATH "/runtime_curve1174_point_load_affine.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_POINT_IS_ON_CURVE,
+            bench_curve1174_point_is_on_curve(
+                (void *) bench_big_int_curve_1174_args,
+                "point on-curve check (curve)",
+                LOG_PATH "/runtime_curve1174_point_is_on_curve.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_VALIDATE_BATCH,
+            bench_curve1174_validate_batch(
+                (void *) bench_big_int_curve_1174_args,
+                "point on-curve check, batched 4-lane (curve)",
+                LOG_PATH "/runtime_curve1174_validate_batch.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_CLEAR_COFACTOR,
+            bench_curve1174_clear_cofactor(
+                (void *) bench_big_int_curve_1174_args,
+                "clear cofactor [4]P (curve)",
+                LOG_PATH "/runtime_curve1174_clear_cofactor.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_SUBGROUP_CHECK,
+            bench_curve1174_subgroup_check(
+                (void *) bench_big_int_curve_1174_args,
+                "subgroup check [l]P = O (curve)",
+                LOG_PATH "/runtime_curve1174_subgroup_check.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_SUBGROUP_CHECK_BATCH,
+            bench_curve1174_subgroup_check_batch(
+                (void *) bench_big_int_curve_1174_args,
+                "subgroup check [l]P = O, batched (curve)",
+                LOG_PATH "/runtime_curve1174_subgroup_check_batch.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_SCALAR_MUL_BASE,
+            bench_curve1174_scalar_mul_base(
+                (void *) bench_big_int_curve_1174_args,
+                "scalar mul [k]G, fixed-base (curve)",
+                LOG_PATH "/runtime_curve1174_scalar_mul_base.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_SCALAR_MUL,
+            bench_curve1174_scalar_mul(
+                (void *) bench_big_int_curve_1174_args,
+                "scalar mul [k]P, wNAF (curve)",
+                LOG_PATH "/runtime_curve1174_scalar_mul.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_SCALAR_MUL_STR,
+            bench_curve1174_scalar_mul_str(
+                (void *) bench_big_int_curve_1174_args,
+                "scalar mul [k]P, P given as string (curve)",
+                LOG_PATH "/runtime_curve1174_scalar_mul_str.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_CACHE_SCALAR_MUL,
+            bench_curve1174_cache_scalar_mul(
+                (void *) bench_big_int_curve_1174_args,
+                "scalar mul [k]P, P given as string, warm cache (curve)",
+                LOG_PATH "/runtime_curve1174_cache_scalar_mul.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_ELLIGATOR_DH_HANDSHAKE,
+            bench_elligator_dh_handshake(
+                (void *) bench_big_int_curve_1174_args,
+                "Elligator DH handshake, 2 keygens + 2 shared (curve)",
+                LOG_PATH "/runtime_elligator_dh_handshake.log"));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_MSM,
+            bench_curve1174_msm_scaling(bench_curve1174_msm_fn,
+                "MSM, n = %d (curve)",
+                LOG_PATH "/runtime_curve1174_msm_%d.log",
+                BENCH_MSM_MAX_LOG_N));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_MSM_STRAUS,
+            bench_curve1174_msm_scaling(bench_curve1174_msm_straus_fn,
+                "MSM, Straus, n = %d (curve)",
+                LOG_PATH "/runtime_curve1174_msm_straus_%d.log",
+                BENCH_MSM_STRAUS_MAX_LOG_N));
+        BENCHMARK(bench_type, BENCH_TYPE_CURVE_1174_MSM_PIPPENGER,
+            bench_curve1174_msm_scaling(bench_curve1174_msm_pippenger_fn,
+                "MSM, Pippenger, n = %d (curve)",
+                LOG_PATH "/runtime_curve1174_msm_pippenger_%d.log",
+                BENCH_MSM_MAX_LOG_N));
+#endif
     }
 
     return EXIT_SUCCESS;